@@ -0,0 +1,88 @@
+/**
+ * @file BenchUtil.h
+ * @brief Utilitários compartilhados pelos benchmarks
+ * @details Mediçao de tempo, cálculo de percentis de latência e impressao
+ *          padronizada dos resultados. Apenas para os executáveis em bench/.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace kanban {
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Nanossegundos decorridos entre dois instantes
+ */
+inline std::uint64_t elapsedNs(Clock::time_point start, Clock::time_point end) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+/**
+ * @brief Lê um argumento numérico da linha de comando, com valor padrao
+ * @param argc Número de argumentos
+ * @param argv Argumentos
+ * @param index Posiçao do argumento (1 = primeiro)
+ * @param fallback Valor usado se o argumento estiver ausente
+ */
+inline std::size_t argOr(int argc, char** argv, int index, std::size_t fallback) {
+    if (argc > index) {
+        long long value = std::atoll(argv[index]);
+        if (value > 0) {
+            return static_cast<std::size_t>(value);
+        }
+    }
+    return fallback;
+}
+
+/**
+ * @brief Imprime percentis (p50, p90, p99, p99.9, máx) de amostras em nanossegundos
+ * @param label Nome da série
+ * @param samples Amostras (reordenadas in-place)
+ */
+inline void printPercentiles(const std::string& label, std::vector<std::uint64_t>& samples) {
+    if (samples.empty()) {
+        std::cout << std::left << std::setw(28) << label << " (sem amostras)\n";
+        return;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto at = [&](double q) {
+        std::size_t i = static_cast<std::size_t>(q * static_cast<double>(samples.size() - 1));
+        return samples[i];
+    };
+    std::cout << std::left << std::setw(28) << label << std::right
+              << " p50=" << std::setw(7) << at(0.50) << "ns"
+              << " p90=" << std::setw(7) << at(0.90) << "ns"
+              << " p99=" << std::setw(7) << at(0.99) << "ns"
+              << " p99.9=" << std::setw(8) << at(0.999) << "ns"
+              << " max=" << std::setw(9) << samples.back() << "ns\n";
+}
+
+/**
+ * @brief Imprime a vazao de uma execuçao
+ * @param label Nome da série
+ * @param operations Operações realizadas
+ * @param totalNs Tempo de parede total em nanossegundos
+ */
+inline void printThroughput(const std::string& label, std::size_t operations, std::uint64_t totalNs) {
+    double seconds = static_cast<double>(totalNs) / 1e9;
+    double rate = seconds > 0 ? static_cast<double>(operations) / seconds : 0.0;
+    std::cout << std::left << std::setw(28) << label << std::right
+              << " " << operations << " ops em " << std::fixed << std::setprecision(3)
+              << seconds * 1e3 << " ms (" << std::setprecision(0) << rate << " ops/s)\n"
+              << std::defaultfloat;
+}
+
+} // namespace bench
+} // namespace kanban
@@ -0,0 +1,113 @@
+/**
+ * @file board_query_bench.cpp
+ * @brief Benchmark de consultas repetidas sobre um board grande
+ * @details Repete a mesma consulta, "prioridade >= 2 E tag bug", sobre um
+ *          board do KanbanService, de quatro formas:
+ *          - varredura: FilterPlan::matches() card a card sob o lock
+ *            compartilhado;
+ *          - CardTable montada a cada consulta (o custo de fromBoard()
+ *            somado ao dos kernels);
+ *          - KanbanService::query(): CardTable em cache no board;
+ *          - KanbanService::query() intercalada com uma ediçao de card, que
+ *            invalida o cache a cada consulta (pior caso).
+ *
+ *          Uso: bench_board_query [cards] [consultas]
+ */
+
+#include "BenchUtil.h"
+#include "application/KanbanService.h"
+#include "domain/CardFilter.h"
+#include "domain/CardTable.h"
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+namespace {
+
+/**
+ * @brief Repete a consulta e imprime a vazao em consultas/s
+ */
+template<typename Query>
+std::size_t run(const std::string& label, std::size_t queries, Query query) {
+    std::size_t selected = 0;
+    auto start = Clock::now();
+    for (std::size_t q = 0; q < queries; ++q) {
+        selected += query(q);
+    }
+    printThroughput(label, queries, elapsedNs(start, Clock::now()));
+    return selected / queries;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t cards = argOr(argc, argv, 1, 100000);
+    const std::size_t queries = argOr(argc, argv, 2, 200);
+
+    std::cout << "Cards: " << cards << ", consultas: " << queries << "\n\n";
+
+    static const char* const kTags[] = {"bug", "feature", "ui", "api", "infra", "docs", "urgente", "debt"};
+    application::KanbanService service;
+    std::mt19937 rng(42);
+    const std::string boardId = service.createBoard("Board grande");
+    std::vector<std::string> columns;
+    for (const char* name : {"To Do", "Doing", "Done"}) {
+        columns.push_back(service.addColumn(boardId, name));
+    }
+    std::vector<std::string> cardIds;
+    cardIds.reserve(cards);
+    for (std::size_t i = 0; i < cards; ++i) {
+        cardIds.push_back(service.addCard(boardId, columns[rng() % columns.size()], "Card " + std::to_string(i)));
+    }
+    std::vector<std::vector<std::string>> cardTags(cards);
+    for (std::size_t i = 0; i < cards; ++i) {
+        for (unsigned t = rng() % 4; t > 0; --t) {
+            cardTags[i].push_back(kTags[rng() % 8]);
+        }
+        service.updateCardTags(boardId, cardIds[i], cardTags[i]);
+    }
+    for (const auto& columnId : columns) {
+        for (auto& card : service.listCards(columnId)) {
+            card->setPriority(static_cast<int>(rng() % 4));
+        }
+    }
+
+    domain::AndFilter filter;
+    filter.add(domain::PriorityRangeFilter(2, 1 << 30))
+          .add(domain::TagFilter(domain::TagMatch::Any, {"bug"}));
+    auto plan = domain::FilterPlan::compile(filter);
+
+    std::size_t a = run("Varredura (FilterPlan)", queries, [&](std::size_t) {
+        return service.readBoard(boardId, [&plan](const domain::Board& board) {
+            std::size_t n = 0;
+            for (const auto& column : board.columns()) {
+                for (const auto& card : column->cards()) {
+                    n += plan.matches(*card, column->id()) ? 1 : 0;
+                }
+            }
+            return n;
+        });
+    });
+    std::size_t b = run("CardTable a cada consulta", queries, [&](std::size_t) {
+        return service.readBoard(boardId, [&plan](const domain::Board& board) {
+            auto table = domain::CardTable::fromBoard(board);
+            auto rows = plan.select(table);
+            return rows ? table.cardsIn(*rows).size() : 0;
+        });
+    });
+    std::size_t c = run("query() (CardTable em cache)", queries, [&](std::size_t) {
+        return service.query(boardId, plan).size();
+    });
+    std::size_t d = run("query() após ediçao", queries, [&](std::size_t q) {
+        // Reaplica as mesmas tags: o resultado nao muda, mas o cache é invalidado
+        service.updateCardTags(boardId, cardIds[q % cards], cardTags[q % cards]);
+        return service.query(boardId, plan).size();
+    });
+
+    std::cout << "\nSelecionados por consulta: " << a << " / " << b << " / " << c << " / " << d
+              << (a == b && b == c && c == d ? " (iguais)" : " (DIVERGENTES)") << "\n";
+    return 0;
+}
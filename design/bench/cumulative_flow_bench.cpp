@@ -0,0 +1,85 @@
+/**
+ * @file cumulative_flow_bench.cpp
+ * @brief Benchmark do diagrama de fluxo cumulativo sobre um histórico longo
+ * @details Um log com milhões de movimentações espalhadas por vários anos,
+ *          entre cinco colunas. Mede, para um CFD diário da janela inteira:
+ *          - a leitura das atividades da janela (ActivityLog::between());
+ *          - domain::cumulativeFlow() sequencial e com pools de 2, 4 e 8
+ *            threads (ou o número passado na linha de comando).
+ *          Em máquinas com menos núcleos que threads, o ganho do paralelismo
+ *          fica limitado ao número de núcleos.
+ *
+ *          Uso: bench_cumulative_flow [atividades] [anos] [threads]
+ */
+
+#include "BenchUtil.h"
+#include "domain/CumulativeFlow.h"
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+int main(int argc, char** argv) {
+    const std::size_t count = argOr(argc, argv, 1, 5000000);
+    const std::size_t years = argOr(argc, argv, 2, 3);
+    const std::size_t maxThreads = argOr(argc, argv, 3, 8);
+
+    std::cout << "Atividades: " << count << ", anos: " << years
+              << ", nucleos: " << std::thread::hardware_concurrency() << "\n\n";
+
+    domain::ActivityLog log;
+    std::mt19937 rng(7);
+    std::vector<domain::ActivityHandle> columns;
+    for (const char* name : {"backlog", "todo", "doing", "review", "done"}) {
+        columns.push_back(log.intern(name));
+    }
+    std::vector<domain::ActivityHandle> cards;
+    for (int i = 0; i < 10000; ++i) {
+        cards.push_back(log.intern("card_" + std::to_string(i)));
+    }
+
+    const auto span = std::chrono::hours(24 * 365) * static_cast<std::int64_t>(years);
+    const auto to = std::chrono::system_clock::now() - std::chrono::hours(1);
+    const auto from = to - span;
+    const auto fromMs = std::chrono::duration_cast<std::chrono::milliseconds>(from.time_since_epoch()).count();
+    const auto spanMs = std::chrono::duration_cast<std::chrono::milliseconds>(span).count();
+    for (std::size_t i = 0; i < count; ++i) {
+        auto ms = fromMs + static_cast<std::int64_t>(static_cast<double>(spanMs) * i / count);
+        std::size_t column = rng() % (columns.size() - 1);
+        log.add(domain::Activity::cardMoved(cards[rng() % cards.size()], columns[column], columns[column + 1], 0,
+                                            domain::HybridTimestamp::fromTimePoint(
+                                                domain::TimePoint(std::chrono::milliseconds(ms)))));
+    }
+    log.publish();
+
+    domain::CumulativeFlowInput input;
+    for (std::size_t c = 0; c < columns.size(); ++c) {
+        input.columns.emplace_back(columns[c], log.resolve(columns[c]));
+        input.current.push_back(static_cast<std::int64_t>(count));
+    }
+    auto start = Clock::now();
+    input.events = log.between(from, to);
+    printThroughput("Leitura da janela", input.events.size(), elapsedNs(start, Clock::now()));
+
+    const auto day = std::chrono::hours(24);
+    std::int64_t checksum = 0;
+    start = Clock::now();
+    auto flow = domain::cumulativeFlow(input, from, to, day);
+    printThroughput("CFD sequencial", input.events.size(), elapsedNs(start, Clock::now()));
+    checksum += flow.counts.back()[0];
+
+    for (std::size_t threads = 2; threads <= maxThreads; threads *= 2) {
+        concurrency::ThreadPool pool(threads - 1);   // o chamador processa uma partiçao
+        start = Clock::now();
+        flow = domain::cumulativeFlow(input, from, to, day, &pool);
+        std::string label = "CFD " + std::to_string(threads) + " threads";
+        printThroughput(label, input.events.size(), elapsedNs(start, Clock::now()));
+        checksum += flow.counts.back()[0];
+    }
+
+    std::cout << "\nBuckets: " << flow.counts.size() << ", checksum: " << checksum << "\n";
+    return 0;
+}
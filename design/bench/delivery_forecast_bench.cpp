@@ -0,0 +1,58 @@
+/**
+ * @file delivery_forecast_bench.cpp
+ * @brief Benchmark da previsao de entrega por Monte Carlo
+ * @details Um ano de throughput semanal irregular (incluindo semanas sem
+ *          entregas) e um backlog de cards restantes. Mede a simulaçao
+ *          sequencial e com pools de 2, 4 e 8 threads (ou o número passado
+ *          na linha de comando) e confere que todas produzem o mesmo
+ *          histograma. Em máquinas com menos núcleos que threads, o ganho
+ *          fica limitado ao número de núcleos.
+ *
+ *          Uso: bench_delivery_forecast [restantes] [tentativas] [threads]
+ */
+
+#include "BenchUtil.h"
+#include "domain/DeliveryForecast.h"
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+int main(int argc, char** argv) {
+    const std::size_t remaining = argOr(argc, argv, 1, 200);
+    const std::size_t trials = argOr(argc, argv, 2, 1000000);
+    const std::size_t maxThreads = argOr(argc, argv, 3, 8);
+
+    std::mt19937 rng(11);
+    std::poisson_distribution<std::uint32_t> perWeek(6.0);
+    std::vector<std::uint32_t> throughput;
+    for (int week = 0; week < 52; ++week) {
+        throughput.push_back(rng() % 10 == 0 ? 0 : perWeek(rng));
+    }
+
+    std::cout << "Restantes: " << remaining << ", tentativas: " << trials
+              << ", nucleos: " << std::thread::hardware_concurrency() << "\n\n";
+
+    const auto now = std::chrono::system_clock::now();
+    auto start = Clock::now();
+    auto sequential = domain::forecastDelivery(throughput, remaining, now, trials);
+    printThroughput("Monte Carlo sequencial", trials, elapsedNs(start, Clock::now()));
+
+    bool same = true;
+    for (std::size_t threads = 2; threads <= maxThreads; threads *= 2) {
+        concurrency::ThreadPool pool(threads - 1);   // o chamador processa um trecho
+        start = Clock::now();
+        auto forecast = domain::forecastDelivery(throughput, remaining, now, trials, &pool);
+        std::string label = "Monte Carlo " + std::to_string(threads) + " threads";
+        printThroughput(label, trials, elapsedNs(start, Clock::now()));
+        same = same && forecast.weeks == sequential.weeks;
+    }
+
+    std::cout << "\nSemanas p50/p85/p95: " << sequential.weeksAt(0.50).value_or(0) << "/"
+              << sequential.weeksAt(0.85).value_or(0) << "/" << sequential.weeksAt(0.95).value_or(0)
+              << ", histogramas iguais: " << (same ? "sim" : "nao") << "\n";
+    return 0;
+}
@@ -0,0 +1,120 @@
+/**
+ * @file event_replay_bench.cpp
+ * @brief Benchmark da gravaçao e da reproduçao do log de eventos
+ * @details Um board com 16 colunas e cards distribuídos entre elas; a maior
+ *          parte dos eventos move o último card de uma coluna para outra e
+ *          o restante altera prioridades. Mede a gravaçao, a reproduçao
+ *          completa (sem snapshots), a reproduçao a partir do snapshot mais
+ *          recente e a recuperaçao de um arquivo salvo, e imprime a taxa de
+ *          leitura do log em GB/s para comparar com a banda de memória.
+ *
+ *          Uso: bench_event_replay [eventos] [cards]
+ */
+
+#include "BenchUtil.h"
+#include "domain/EventStore.h"
+#include <random>
+#include <sstream>
+
+using namespace kanban;
+using namespace kanban::bench;
+using domain::Event;
+using domain::EventStore;
+
+namespace {
+
+constexpr std::size_t kColumns = 16;
+
+/// @brief Grava o board, os cards e os eventos pseudoaleatórios (mesma semente sempre)
+void fill(EventStore& store, std::size_t events, std::size_t cards) {
+    auto board = store.intern("board_1");
+    std::vector<Event> group;
+    group.push_back(Event::boardCreated(board, store.intern("Replay")));
+    std::vector<domain::EventHandle> columnHandles;
+    for (std::size_t c = 0; c < kColumns; ++c) {
+        columnHandles.push_back(store.intern("column_" + std::to_string(c + 1)));
+        group.push_back(Event::columnAdded(columnHandles.back(), board, store.intern("Coluna " + std::to_string(c))));
+    }
+    // Cópia local da ordem das colunas, só para gerar dicas de posiçao corretas
+    std::vector<std::vector<domain::EventHandle>> columns(kColumns);
+    std::vector<domain::EventHandle> cardHandles;
+    for (std::size_t k = 0; k < cards; ++k) {
+        cardHandles.push_back(store.intern("card_" + std::to_string(k + 1)));
+        group.push_back(Event::cardAdded(cardHandles.back(), columnHandles[k % kColumns],
+                                         store.intern("Card " + std::to_string(k))));
+        columns[k % kColumns].push_back(cardHandles.back());
+    }
+    store.appendGroup(std::move(group));
+
+    std::mt19937_64 rng(42);
+    const std::size_t chunk = 1 << 16;
+    for (std::size_t done = 0; done < events; done += chunk) {
+        std::vector<Event> batch;
+        batch.reserve(chunk);
+        for (std::size_t i = 0; i < chunk && done + i < events; ++i) {
+            std::size_t from = rng() % kColumns;
+            if (rng() % 10 == 0 || columns[from].empty()) {
+                batch.push_back(Event::cardPrioritySet(cardHandles[rng() % cards], static_cast<int>(rng() % 5)));
+                continue;
+            }
+            std::size_t to = (from + 1 + rng() % (kColumns - 1)) % kColumns;
+            auto card = columns[from].back();
+            batch.push_back(Event::cardMoved(card, columnHandles[from], columnHandles[to],
+                                             static_cast<std::uint32_t>(columns[from].size() - 1)));
+            columns[from].pop_back();
+            columns[to].push_back(card);
+        }
+        store.appendGroup(std::move(batch));
+    }
+}
+
+void printBandwidth(std::uint64_t events, std::uint64_t totalNs) {
+    double gb = static_cast<double>(events * sizeof(Event)) / 1e9;
+    std::cout << "    log lido a " << gb / (static_cast<double>(totalNs) / 1e9) << " GB/s\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t events = argOr(argc, argv, 1, 10000000);
+    const std::size_t cards = argOr(argc, argv, 2, 100000);
+
+    std::cout << "Eventos: " << events << ", cards: " << cards << ", colunas: " << kColumns
+              << ", bytes por evento: " << sizeof(Event) << "\n\n";
+
+    EventStore plain(0);
+    auto start = Clock::now();
+    fill(plain, events, cards);
+    printThroughput("Gravacao (sem snapshots)", plain.size(), elapsedNs(start, Clock::now()));
+
+    start = Clock::now();
+    auto full = plain.replay(plain.size());
+    auto ns = elapsedNs(start, Clock::now());
+    printThroughput("Reproducao completa", plain.size(), ns);
+    printBandwidth(plain.size(), ns);
+    std::cout << "    rejeitados: " << full.rejected() << "\n";
+
+    std::stringstream file;
+    plain.save(file);
+    EventStore recovered;
+    start = Clock::now();
+    recovered.load(file);
+    printThroughput("Recuperacao do arquivo", recovered.size(), elapsedNs(start, Clock::now()));
+
+    EventStore snapshotted;
+    start = Clock::now();
+    fill(snapshotted, events, cards);
+    printThroughput("Gravacao (com snapshots)", snapshotted.size(), elapsedNs(start, Clock::now()));
+    start = Clock::now();
+    auto fromSnapshot = snapshotted.replay(snapshotted.size());
+    ns = elapsedNs(start, Clock::now());
+    std::cout << "Reproducao desde o snapshot: " << ns / 1000 << " us ("
+              << snapshotted.snapshotCount() << " snapshots em memoria)\n";
+
+    bool same = fromSnapshot.cards().size() == full.cards().size();
+    for (std::size_t c = 0; same && c < full.columns().size(); ++c) {
+        same = fromSnapshot.columns()[c].cards == full.columns()[c].cards;
+    }
+    std::cout << "\nEstados iguais: " << (same ? "sim" : "nao") << "\n";
+    return 0;
+}
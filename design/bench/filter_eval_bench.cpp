@@ -0,0 +1,113 @@
+/**
+ * @file filter_eval_bench.cpp
+ * @brief Benchmark de avaliaçao de filtros de cards
+ * @details Avalia o mesmo critério, "prioridade >= 2 E tag bug E fora da
+ *          coluna Done", sobre uma massa de cards sintéticos, de quatro formas:
+ *          - árvore de IFilter (uma chamada virtual por nó);
+ *          - FilterPlan compilado em tempo de execuçao;
+ *          - expressao de domain::expr embrulhada em IFilter (uma chamada
+ *            virtual por card);
+ *          - expressao de domain::expr avaliada diretamente (sem virtual).
+ *
+ *          Uso: bench_filter_eval [cards] [passadas]
+ */
+
+#include "BenchUtil.h"
+#include "domain/Card.h"
+#include "domain/CardFilter.h"
+#include "domain/FilterExpr.h"
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+using domain::Card;
+
+namespace {
+
+/// @brief Um card da massa e a coluna onde ele está
+struct Row {
+    std::shared_ptr<Card> card;
+    const std::string* column;
+};
+
+const std::string kColumns[] = {"column_1", "column_2", "column_3"};
+const std::string& kDone = kColumns[2];
+
+/**
+ * @brief Massa sintética: prioridades 0-3, de 0 a 3 tags de um conjunto de 8
+ */
+std::vector<Row> makeRows(std::size_t count) {
+    static const char* const kTags[] = {"bug", "feature", "ui", "api", "infra", "docs", "urgente", "debt"};
+    std::mt19937 rng(42);
+    std::vector<Row> rows;
+    rows.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto card = std::make_shared<Card>("card_" + std::to_string(i), "Card " + std::to_string(i));
+        card->setPriority(static_cast<int>(rng() % 4));
+        for (unsigned t = rng() % 4; t > 0; --t) {
+            const char* name = kTags[rng() % 8];
+            card->addTag(std::make_shared<domain::Tag>(name, name));
+        }
+        rows.push_back(Row{card, &kColumns[rng() % 3]});
+    }
+    return rows;
+}
+
+/**
+ * @brief Conta os cards aceitos em várias passadas e imprime a vazao
+ */
+template<typename Predicate>
+std::size_t run(const std::string& label, const std::vector<Row>& rows, std::size_t passes,
+                Predicate predicate) {
+    std::size_t accepted = 0;
+    auto start = Clock::now();
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        for (const auto& row : rows) {
+            accepted += predicate(*row.card, *row.column) ? 1 : 0;
+        }
+    }
+    printThroughput(label, rows.size() * passes, elapsedNs(start, Clock::now()));
+    return accepted / passes;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t cards = argOr(argc, argv, 1, 1000000);
+    const std::size_t passes = argOr(argc, argv, 2, 5);
+
+    std::cout << "Cards: " << cards << ", passadas: " << passes << "\n\n";
+    auto rows = makeRows(cards);
+
+    // Árvore de IFilter
+    domain::AndFilter tree;
+    tree.add(domain::PriorityRangeFilter(2, 1 << 30))
+        .add(domain::TagFilter(domain::TagMatch::Any, {"bug"}))
+        .add(domain::NotFilter(domain::ColumnFilter({kDone})));
+    const interfaces::IFilter& treeRef = tree;
+
+    // Mesmo critério compilado em tempo de execuçao
+    auto plan = domain::FilterPlan::compile(tree);
+
+    // Mesmo critério como expression template
+    using namespace domain::expr;
+    auto expression = priority >= 2 && hasTag("bug") && !inColumn(kDone);
+    auto wrapped = toFilter(expression);
+    const interfaces::IFilter& wrappedRef = *wrapped;
+
+    std::size_t a = run("IFilter (árvore virtual)", rows, passes,
+                        [&](const Card& c, const std::string& col) { return treeRef.matchesInColumn(c, col); });
+    std::size_t b = run("FilterPlan (compilado)", rows, passes,
+                        [&](const Card& c, const std::string& col) { return plan.matches(c, col); });
+    std::size_t c = run("Expr via IFilter", rows, passes,
+                        [&](const Card& card, const std::string& col) { return wrappedRef.matchesInColumn(card, col); });
+    std::size_t d = run("Expr (template)", rows, passes,
+                        [&](const Card& card, const std::string& col) { return expression(card, col); });
+
+    std::cout << "\nAceitos por passada: " << a << " / " << b << " / " << c << " / " << d
+              << (a == b && b == c && c == d ? " (iguais)" : " (DIVERGENTES)") << "\n";
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file flow_metrics_bench.cpp
+ * @brief Benchmark das métricas de fluxo (lead time e permanência por coluna)
+ * @details Um board com quatro colunas; os cards avançam e às vezes voltam
+ *          uma coluna, gerando um log de movimentações. Compara a consulta
+ *          "percentis 50/85/95 da permanência em Doing e do lead time até Done":
+ *          - reprocessamento: percorre o log inteiro com forEach(), reconstrói
+ *            entradas e saídas e ordena as durações;
+ *          - ActivityLog::columnFlow(): estado mantido a cada publicaçao.
+ *          Mede também o custo de registrar as movimentações com as métricas.
+ *
+ *          Uso: bench_flow_metrics [cards] [movimentos] [consultas]
+ */
+
+#include "BenchUtil.h"
+#include "domain/FlowMetrics.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+namespace {
+
+const char* const kColumns[] = {"todo", "doing", "review", "done"};
+
+std::uint64_t percentileOf(std::vector<std::uint64_t>& values, double q) {
+    if (values.empty()) return 0;
+    auto at = static_cast<std::size_t>(q * static_cast<double>(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(at), values.end());
+    return values[at];
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t cards = argOr(argc, argv, 1, 20000);
+    const std::size_t moves = argOr(argc, argv, 2, 1000000);
+    const std::size_t queries = argOr(argc, argv, 3, 2000);
+
+    std::cout << "Cards: " << cards << ", movimentos: " << moves << ", consultas: " << queries << "\n\n";
+
+    domain::ActivityLog log;
+    std::mt19937 rng(7);
+    std::vector<domain::ActivityHandle> cardHandles;
+    std::vector<domain::ActivityHandle> columnHandles;
+    std::vector<int> position(cards, 0);
+    for (const char* column : kColumns) {
+        columnHandles.push_back(log.intern(column));
+    }
+    const auto created = std::chrono::system_clock::now();
+    for (std::size_t i = 0; i < cards; ++i) {
+        std::string id = "card_" + std::to_string(i);
+        cardHandles.push_back(log.intern(id));
+        log.registerCard(id, kColumns[0], created);
+    }
+
+    auto start = Clock::now();
+    for (std::size_t m = 0; m < moves; ++m) {
+        std::size_t card = rng() % cards;
+        int from = position[card];
+        int to = from == 3 ? 0 : (from > 0 && rng() % 5 == 0 ? from - 1 : from + 1);
+        position[card] = to;
+        log.add(domain::Activity::cardMoved(cardHandles[card], columnHandles[static_cast<std::size_t>(from)],
+                                            columnHandles[static_cast<std::size_t>(to)], 0, log.now()));
+    }
+    log.publish();
+    printThroughput("Movimentos + metricas", moves, elapsedNs(start, Clock::now()));
+
+    // Reprocessamento: estado reconstruído do log bruto a cada consulta
+    const std::size_t replayQueries = std::min<std::size_t>(queries, 5);
+    std::uint64_t checksum = 0;
+    start = Clock::now();
+    for (std::size_t q = 0; q < replayQueries; ++q) {
+        std::unordered_map<domain::ActivityHandle, std::uint64_t> entered;
+        std::unordered_map<domain::ActivityHandle, bool> finished;
+        std::vector<std::uint64_t> dwell;
+        std::vector<std::uint64_t> lead;
+        const auto createdMs = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(created.time_since_epoch()).count());
+        log.forEach([&](const domain::Activity& act) {
+            if (act.kind() != domain::ActivityKind::CardMoved) return;
+            std::uint64_t ms = act.timestamp().physicalMs();
+            if (act.fromColumn() == columnHandles[1]) {
+                auto it = entered.find(act.subject());
+                if (it != entered.end()) dwell.push_back(ms - it->second);
+            }
+            entered[act.subject()] = ms;
+            if (act.toColumn() == columnHandles[3] && !finished[act.subject()]) {
+                finished[act.subject()] = true;
+                lead.push_back(ms > createdMs ? ms - createdMs : 0);
+            }
+        });
+        for (double p : {0.5, 0.85, 0.95}) {
+            checksum += percentileOf(dwell, p) + percentileOf(lead, p);
+        }
+    }
+    printThroughput("Reprocessamento (consultas)", replayQueries, elapsedNs(start, Clock::now()));
+
+    std::vector<std::uint64_t> samples;
+    samples.reserve(queries);
+    for (std::size_t q = 0; q < queries; ++q) {
+        auto begin = Clock::now();
+        domain::ColumnFlow doing = log.columnFlow("doing");
+        domain::ColumnFlow done = log.columnFlow("done");
+        for (double p : {0.5, 0.85, 0.95}) {
+            checksum += doing.dwell.quantile(p) + done.leadTime.quantile(p);
+        }
+        samples.push_back(elapsedNs(begin, Clock::now()));
+    }
+    printPercentiles("columnFlow (consulta)", samples);
+
+    std::cout << "\nChecksum: " << checksum << "\n";
+    return 0;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file fuzzy_search_bench.cpp
+ * @brief Benchmark da busca aproximada nos títulos dos cards
+ * @details Títulos de quatro palavras sorteadas de um vocabulário de 20 mil
+ *          palavras sintéticas. Consultas sao as duas primeiras palavras de um
+ *          título existente, com um erro de digitaçao em cada (troca, omissao
+ *          ou transposiçao de letras).
+ *          Compara:
+ *          - varredura ingênua: distância de ediçao contra todas as palavras
+ *            de todos os títulos;
+ *          - domain::FuzzyIndex: palavras candidatas por trigramas,
+ *            verificaçao e intersecçao das listas de cards.
+ *          Mede também a indexaçao inicial e a taxa de acerto (o card de
+ *          origem entre os resultados).
+ *
+ *          Uso: bench_fuzzy_search [cards] [consultas]
+ */
+
+#include "BenchUtil.h"
+#include "domain/Card.h"
+#include "domain/FuzzyIndex.h"
+#include "domain/TextTokenizer.h"
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+namespace {
+
+const char* const kSyllables[] = {
+    "ca", "da", "men", "to", "ri", "ção", "pla", "ni", "lha", "ser", "vi", "dor", "in", "te", "gra",
+    "por", "ta", "fi", "la", "ges", "tão", "con", "sul", "re", "la", "tó", "rio", "de", "sem", "pe",
+    "nho", "ex", "pe", "di", "ção", "mo", "du", "lo", "ra", "zão", "ve", "ro", "pro", "ces", "so"};
+constexpr std::size_t kSyllableCount = sizeof(kSyllables) / sizeof(kSyllables[0]);
+
+/// @brief Vocabulário de palavras de 2 a 4 sílabas (com repetições)
+std::vector<std::string> makeVocabulary(std::size_t size, std::mt19937& rng) {
+    std::vector<std::string> words;
+    words.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        std::string word;
+        for (std::size_t s = 0, n = 2 + rng() % 3; s < n; ++s) {
+            word += kSyllables[rng() % kSyllableCount];
+        }
+        words.push_back(std::move(word));
+    }
+    return words;
+}
+
+/// @brief Um erro de digitaçao em uma palavra normalizada
+std::string misspell(std::string word, std::mt19937& rng) {
+    if (word.size() < 4) return word;
+    std::size_t at = 1 + rng() % (word.size() - 2);
+    switch (rng() % 3) {
+    case 0: word[at] = static_cast<char>('a' + rng() % 26); break;   // troca
+    case 1: word.erase(at, 1); break;                                   // omissao
+    default: std::swap(word[at], word[at + 1]); break;                  // transposiçao
+    }
+    return word;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = argOr(argc, argv, 1, 500000);
+    const std::size_t queries = argOr(argc, argv, 2, 200);
+
+    std::cout << "Cards: " << count << ", consultas: " << queries << "\n\n";
+
+    std::mt19937 rng(7);
+    const std::vector<std::string> vocabulary = makeVocabulary(20000, rng);
+    std::vector<std::shared_ptr<domain::Card>> cards;
+    cards.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string title;
+        for (int w = 0; w < 4; ++w) {
+            if (w > 0) title += ' ';
+            title += vocabulary[rng() % vocabulary.size()];
+        }
+        cards.push_back(std::make_shared<domain::Card>("card_" + std::to_string(i), title));
+    }
+
+    struct Query {
+        std::string text;
+        std::string expected;
+    };
+    std::vector<Query> workload;
+    for (std::size_t q = 0; q < queries; ++q) {
+        const auto& card = cards[rng() % count];
+        auto words = domain::tokenize(card->title());
+        workload.push_back({misspell(words[0], rng) + " " + misspell(words[1], rng), card->id()});
+    }
+
+    // Varredura: distância de ediçao contra cada palavra de cada título
+    std::vector<std::vector<std::string>> titleWords;
+    titleWords.reserve(count);
+    for (const auto& card : cards) {
+        titleWords.push_back(domain::tokenize(card->title()));
+    }
+    const std::size_t scanQueries = std::min<std::size_t>(queries, 5);
+    std::size_t scanned = 0;
+    auto start = Clock::now();
+    for (std::size_t q = 0; q < scanQueries; ++q) {
+        auto words = domain::tokenize(workload[q].text);
+        for (const auto& title : titleWords) {
+            bool all = true;
+            for (const auto& word : words) {
+                int bound = domain::FuzzyIndex::maxEdits(word.size());
+                bool found = false;
+                for (const auto& titleWord : title) {
+                    if (domain::FuzzyIndex::prefixDistance(word, titleWord, bound) <= bound) {
+                        found = true;
+                        break;
+                    }
+                }
+                if (!found) {
+                    all = false;
+                    break;
+                }
+            }
+            scanned += all ? 1 : 0;
+        }
+    }
+    printThroughput("Varredura (consultas)", scanQueries, elapsedNs(start, Clock::now()));
+
+    auto index = std::make_shared<domain::FuzzyIndex>();
+    start = Clock::now();
+    for (const auto& card : cards) {
+        card->setObserver(index);
+        index->add("board_1", *card);
+    }
+    printThroughput("Indexacao inicial (cards)", count, elapsedNs(start, Clock::now()));
+
+    std::vector<std::uint64_t> samples;
+    std::size_t found = 0;
+    std::size_t hitsTotal = 0;
+    for (const auto& query : workload) {
+        auto begin = Clock::now();
+        auto hits = index->search(query.text, 20);
+        samples.push_back(elapsedNs(begin, Clock::now()));
+        hitsTotal += hits.size();
+        auto all = index->search(query.text, count);
+        found += std::any_of(all.begin(), all.end(),
+                             [&query](const domain::SearchHit& hit) { return hit.cardId == query.expected; });
+    }
+    printPercentiles("Indice, top 20 (consulta)", samples);
+
+    std::cout << "\nCards aceitos pela varredura (por consulta): " << scanned / scanQueries
+              << "\nResultados do indice (media, top 20): " << hitsTotal / queries
+              << "\nCard de origem encontrado: " << found << "/" << queries << "\n";
+    return 0;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file prefix_completion_bench.cpp
+ * @brief Benchmark do completamento de títulos por prefixo
+ * @details Simula a digitaçao de títulos existentes, uma tecla por vez, e
+ *          compara a latência por tecla de:
+ *          - varredura ingênua: normaliza cada título, filtra pelo prefixo e
+ *            ordena as candidatas por prioridade (o que a GUI faria sem índice);
+ *          - domain::PrefixTrie: descida pelo prefixo e top-K guardado no nó.
+ *          Mede também a carga inicial e a atualizaçao de ranks (setPriority).
+ *
+ *          Uso: bench_prefix_completion [titulos] [digitacoes]
+ */
+
+#include "BenchUtil.h"
+#include "domain/PrefixTrie.h"
+#include "domain/TextTokenizer.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+namespace {
+
+const char* const kWords[] = {
+    "Migração", "banco", "relatório", "usuário", "tela", "login", "erro", "ajuste",
+    "Integração", "pagamento", "cadastro", "revisão", "desempenho", "cache", "fila", "notificação",
+    "Exportação", "planilha", "permissão", "auditoria", "sessão", "índice", "consulta", "backup",
+    "Configuração", "validação", "formulário", "documentação", "teste", "implantação", "serviço", "memória"};
+constexpr std::size_t kWordCount = sizeof(kWords) / sizeof(kWords[0]);
+constexpr std::size_t kLimit = 10;
+
+struct Title {
+    std::string id;
+    std::string text;
+    domain::CompletionRank rank;
+};
+
+std::vector<Title> makeTitles(std::size_t count) {
+    std::mt19937 rng(7);
+    std::vector<Title> titles;
+    titles.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string text;
+        for (int w = 0; w < 4; ++w) {
+            if (w > 0) text += ' ';
+            text += kWords[rng() % kWordCount];
+            text += std::to_string(rng() % 100);
+        }
+        titles.push_back({"card_" + std::to_string(i), text,
+                          domain::CompletionRank{static_cast<std::int64_t>(rng() % 3),
+                                                 static_cast<std::int64_t>(i)}});
+    }
+    return titles;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = argOr(argc, argv, 1, 200000);
+    const std::size_t typings = argOr(argc, argv, 2, 50);
+
+    std::cout << "Titulos: " << count << ", digitacoes: " << typings << "\n\n";
+    auto titles = makeTitles(count);
+
+    // Prefixos digitados: cada tecla de títulos existentes, até 12 caracteres
+    std::mt19937 rng(11);
+    std::vector<std::string> prefixes;
+    for (std::size_t t = 0; t < typings; ++t) {
+        const std::string& text = titles[rng() % count].text;
+        for (std::size_t n = 1; n <= std::min<std::size_t>(12, text.size()); ++n) {
+            if ((static_cast<unsigned char>(text[n - 1]) & 0xC0) != 0x80) {   // nao corta UTF-8
+                prefixes.push_back(text.substr(0, n));
+            }
+        }
+    }
+
+    // Varredura: normaliza e filtra todos os títulos a cada tecla
+    std::vector<std::uint64_t> scanSamples;
+    std::size_t scanned = 0;
+    const std::size_t scanKeys = std::min<std::size_t>(prefixes.size(), 60);
+    for (std::size_t k = 0; k < scanKeys; ++k) {
+        auto start = Clock::now();
+        std::string key = domain::foldText(prefixes[k]);
+        std::vector<const Title*> matches;
+        for (const auto& title : titles) {
+            if (domain::foldText(title.text).compare(0, key.size(), key) == 0) {
+                matches.push_back(&title);
+            }
+        }
+        std::size_t top = std::min(kLimit, matches.size());
+        std::partial_sort(matches.begin(), matches.begin() + static_cast<std::ptrdiff_t>(top), matches.end(),
+                          [](const Title* a, const Title* b) { return b->rank < a->rank; });
+        scanned += top;
+        scanSamples.push_back(elapsedNs(start, Clock::now()));
+    }
+    printPercentiles("Varredura, top 10 (tecla)", scanSamples);
+
+    domain::PrefixTrie trie;
+    auto start = Clock::now();
+    for (const auto& title : titles) {
+        trie.insert(title.id, title.text, title.rank);
+    }
+    printThroughput("Carga da trie (titulos)", count, elapsedNs(start, Clock::now()));
+
+    std::vector<std::uint64_t> trieSamples;
+    std::size_t completed = 0;
+    for (const auto& prefix : prefixes) {
+        auto begin = Clock::now();
+        completed += trie.complete(prefix, kLimit).size();
+        trieSamples.push_back(elapsedNs(begin, Clock::now()));
+    }
+    printPercentiles("Trie, top 10 (tecla)", trieSamples);
+
+    const std::size_t updates = std::min<std::size_t>(count, 50000);
+    start = Clock::now();
+    for (std::size_t i = 0; i < updates; ++i) {
+        Title& title = titles[(i * 7919) % count];
+        title.rank.primary = static_cast<std::int64_t>(rng() % 3);
+        title.rank.secondary = static_cast<std::int64_t>(count + i);
+        trie.insert(title.id, title.text, title.rank);
+    }
+    printThroughput("Atualizacao de rank", updates, elapsedNs(start, Clock::now()));
+
+    std::cout << "\nTeclas simuladas: " << prefixes.size() << " (varredura: " << scanKeys << ")"
+              << "; sugestoes da trie: " << completed << ", da varredura: " << scanned << "\n";
+    return 0;
+}
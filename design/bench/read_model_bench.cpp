@@ -0,0 +1,132 @@
+/**
+ * @file read_model_bench.cpp
+ * @brief Benchmark das projeções de leitura (ReadModel)
+ * @details Um board com várias colunas e cards com tags e prioridades. Compara
+ *          as estatísticas do painel (contagem por coluna, cards por tag e por
+ *          prioridade) calculadas percorrendo o board sob readBoard() com a
+ *          leitura da projeçao pronta. Mede também a latência de moveCard()
+ *          com e sem o ReadModel ativo, e o atraso da projeçao ao fim da
+ *          rajada de escritas.
+ *
+ *          Uso: bench_read_model [cards] [movimentos] [leituras]
+ */
+
+#include "BenchUtil.h"
+#include "application/KanbanService.h"
+#include "application/ReadModel.h"
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+namespace {
+
+constexpr std::size_t kColumns = 8;
+
+struct Fixture {
+    std::string boardId;
+    std::vector<std::string> columns;
+    std::vector<std::vector<std::string>> cards;   ///< @brief Cópia local da ocupaçao das colunas
+};
+
+Fixture fill(application::KanbanService& service, std::size_t cards) {
+    Fixture fixture;
+    fixture.boardId = service.createBoard("Painel");
+    for (std::size_t c = 0; c < kColumns; ++c) {
+        fixture.columns.push_back(service.addColumn(fixture.boardId, "Coluna " + std::to_string(c)));
+    }
+    fixture.cards.resize(kColumns);
+    const char* tags[] = {"backend", "frontend", "urgente", "bug", "docs"};
+    for (std::size_t i = 0; i < cards; ++i) {
+        std::size_t c = i % kColumns;
+        std::string cardId = service.addCard(fixture.boardId, fixture.columns[c], "Card " + std::to_string(i));
+        service.updateCardTags(fixture.boardId, cardId, {tags[i % 5], tags[(i / 5) % 5]});
+        fixture.cards[c].push_back(cardId);
+    }
+    return fixture;
+}
+
+/// @brief Move o último card de uma coluna pseudoaleatória, medindo cada chamada
+std::vector<std::uint64_t> moveCards(application::KanbanService& service, Fixture& fixture, std::size_t moves) {
+    std::mt19937 rng(11);
+    std::vector<std::uint64_t> samples;
+    samples.reserve(moves);
+    for (std::size_t m = 0; m < moves; ++m) {
+        std::size_t from = rng() % kColumns;
+        if (fixture.cards[from].empty()) {
+            continue;
+        }
+        std::size_t to = (from + 1 + rng() % (kColumns - 1)) % kColumns;
+        std::string cardId = fixture.cards[from].back();
+        auto start = Clock::now();
+        service.moveCard(fixture.boardId, cardId, fixture.columns[from], fixture.columns[to]);
+        samples.push_back(elapsedNs(start, Clock::now()));
+        fixture.cards[from].pop_back();
+        fixture.cards[to].push_back(std::move(cardId));
+    }
+    return samples;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t cards = argOr(argc, argv, 1, 20000);
+    const std::size_t moves = argOr(argc, argv, 2, 50000);
+    const std::size_t reads = argOr(argc, argv, 3, 200);
+
+    std::cout << "Cards: " << cards << ", colunas: " << kColumns << ", movimentos: " << moves
+              << ", leituras: " << reads << "\n\n";
+
+    // Escritor sem projeções (referência)
+    application::KanbanService plain;
+    Fixture plainFixture = fill(plain, cards);
+    auto samples = moveCards(plain, plainFixture, moves);
+    printPercentiles("moveCard sem ReadModel", samples);
+
+    // Escritor com projeções: só enfileira a atualizaçao
+    application::KanbanService service;
+    auto model = std::make_shared<application::ReadModel>();
+    service.useReadModel(model);
+    Fixture fixture = fill(service, cards);
+    samples = moveCards(service, fixture, moves);
+    printPercentiles("moveCard com ReadModel", samples);
+
+    const auto latest = model->latestVersion(fixture.boardId);
+    auto start = Clock::now();
+    model->waitFor(fixture.boardId, latest, std::chrono::seconds(30));
+    std::cout << "Projecao em dia " << elapsedNs(start, Clock::now()) / 1000 << " us apos a ultima escrita\n\n";
+
+    std::size_t checksum = 0;
+    start = Clock::now();
+    for (std::size_t r = 0; r < reads; ++r) {
+        checksum += service.readBoard(fixture.boardId, [](const domain::Board& board) {
+            std::vector<std::size_t> counts;
+            std::map<std::string, std::vector<std::string>> byTag;
+            std::map<int, std::vector<std::string>> byPriority;
+            for (const auto& column : board.columns()) {
+                counts.push_back(column->size());
+                for (const auto& card : column->cards()) {
+                    for (const auto& tag : card->tags()) {
+                        byTag[tag->name()].push_back(card->id());
+                    }
+                    byPriority[card->priority()].push_back(card->id());
+                }
+            }
+            return counts.size() + byTag.size() + byPriority.size();
+        });
+    }
+    printThroughput("Estatisticas percorrendo", reads, elapsedNs(start, Clock::now()));
+
+    start = Clock::now();
+    for (std::size_t r = 0; r < reads; ++r) {
+        auto projection = model->board(fixture.boardId);
+        checksum += projection->columns.size() + projection->cardsByTag.size() + projection->cardsByPriority.size();
+    }
+    printThroughput("Estatisticas da projecao", reads, elapsedNs(start, Clock::now()));
+
+    std::cout << "\nChecksum: " << checksum << "\n";
+    return 0;
+}
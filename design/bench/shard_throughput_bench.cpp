@@ -0,0 +1,120 @@
+/**
+ * @file shard_throughput_bench.cpp
+ * @brief Benchmark de vazao do ShardedKanbanService contra o KanbanService
+ * @details Carga com vários boards: cada operaçao cria um card e o move para
+ *          a segunda coluna. A referência é um KanbanService usado por uma
+ *          única thread; o ShardedKanbanService é medido com 1 a 32 shards,
+ *          com clientes que mantêm uma operaçao em voo por board.
+ *
+ *          Uso: bench_shard_throughput [boards] [cards_por_board] [clientes]
+ */
+
+#include "BenchUtil.h"
+#include "application/KanbanService.h"
+#include "application/ShardedKanbanService.h"
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+namespace {
+
+/// @brief Um board da carga e suas duas colunas
+struct BoardFixture {
+    std::string board;
+    std::string todo;
+    std::string done;
+};
+
+/**
+ * @brief Cria os boards da carga em qualquer IService
+ */
+std::vector<BoardFixture> createBoards(interfaces::IService& service, std::size_t boards) {
+    std::vector<BoardFixture> fixtures;
+    for (std::size_t i = 0; i < boards; ++i) {
+        BoardFixture f;
+        f.board = service.createBoard("bench " + std::to_string(i));
+        f.todo = service.addColumn(f.board, "To Do");
+        f.done = service.addColumn(f.board, "Done");
+        fixtures.push_back(f);
+    }
+    return fixtures;
+}
+
+/**
+ * @brief Referência: KanbanService em uma única thread
+ */
+void runSingleThreaded(std::size_t boards, std::size_t cards) {
+    application::KanbanService service;
+    auto fixtures = createBoards(service, boards);
+
+    auto start = Clock::now();
+    for (std::size_t i = 0; i < cards; ++i) {
+        for (const auto& f : fixtures) {
+            std::string card = service.addCard(f.board, f.todo, "card");
+            service.moveCard(f.board, card, f.todo, f.done);
+        }
+    }
+    printThroughput("KanbanService (1 thread)", boards * cards * 2, elapsedNs(start, Clock::now()));
+}
+
+/**
+ * @brief ShardedKanbanService com clientes concorrentes
+ * @details O cliente c cuida dos boards c, c + clientes, ...; a cada rodada
+ *          envia um addCard por board, espera os IDs e envia os moveCard.
+ */
+void runSharded(std::size_t shards, std::size_t boards, std::size_t cards, std::size_t clients) {
+    application::ShardedKanbanService service(shards);
+    auto fixtures = createBoards(service, boards);
+
+    auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for (std::size_t c = 0; c < clients; ++c) {
+        workers.emplace_back([&, c] {
+            std::vector<const BoardFixture*> mine;
+            for (std::size_t b = c; b < fixtures.size(); b += clients) {
+                mine.push_back(&fixtures[b]);
+            }
+            std::vector<std::future<std::string>> added(mine.size());
+            std::vector<std::future<void>> moved(mine.size());
+            for (std::size_t i = 0; i < cards; ++i) {
+                for (std::size_t k = 0; k < mine.size(); ++k) {
+                    added[k] = service.addCardAsync(mine[k]->board, mine[k]->todo, "card");
+                }
+                for (std::size_t k = 0; k < mine.size(); ++k) {
+                    moved[k] = service.moveCardAsync(mine[k]->board, added[k].get(),
+                                                     mine[k]->todo, mine[k]->done);
+                }
+                for (auto& m : moved) {
+                    m.get();
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    printThroughput("Sharded (" + std::to_string(shards) + " shards)",
+                    boards * cards * 2, elapsedNs(start, Clock::now()));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t boards = argOr(argc, argv, 1, 64);
+    const std::size_t cards = argOr(argc, argv, 2, 500);
+    const std::size_t clients = argOr(argc, argv, 3, 8);
+
+    std::cout << "Boards: " << boards << ", cards por board: " << cards
+              << ", clientes: " << clients
+              << ", núcleos: " << std::thread::hardware_concurrency() << "\n\n";
+
+    runSingleThreaded(boards, cards);
+    for (std::size_t shards : {1, 2, 4, 8, 16, 32}) {
+        runSharded(shards, boards, cards, clients);
+    }
+    return 0;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file text_search_bench.cpp
+ * @brief Benchmark da busca de texto nos cards
+ * @details Compara, sobre uma massa de cards com título e descriçao:
+ *          - varredura ingênua: normaliza título e descriçao de cada card e
+ *            procura cada termo como trecho (o que um TextFilter faria);
+ *          - domain::TextIndex: consulta ranqueada no índice invertido.
+ *          Mede também a indexaçao inicial e a reindexaçao incremental
+ *          disparada por Card::setDescription().
+ *
+ *          Uso: bench_text_search [cards] [consultas]
+ */
+
+#include "BenchUtil.h"
+#include "domain/Card.h"
+#include "domain/TextIndex.h"
+#include "domain/TextTokenizer.h"
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+namespace {
+
+const char* const kWords[] = {
+    "migração", "banco", "relatório", "usuário", "tela", "login", "erro", "ajuste",
+    "integração", "pagamento", "cadastro", "revisão", "desempenho", "cache", "fila", "notificação",
+    "exportação", "planilha", "permissão", "auditoria", "sessão", "índice", "consulta", "backup",
+    "configuração", "validação", "formulário", "documentação", "teste", "implantação", "serviço", "memória"};
+constexpr std::size_t kWordCount = sizeof(kWords) / sizeof(kWords[0]);
+
+std::string sentence(std::mt19937& rng, std::size_t words) {
+    std::string text;
+    for (std::size_t i = 0; i < words; ++i) {
+        if (i > 0) text += ' ';
+        text += kWords[rng() % kWordCount];
+        text += std::to_string(rng() % 50);   // vocabulário de ~1600 termos
+    }
+    return text;
+}
+
+std::vector<std::shared_ptr<domain::Card>> makeCards(std::size_t count) {
+    std::mt19937 rng(7);
+    std::vector<std::shared_ptr<domain::Card>> cards;
+    cards.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        auto card = std::make_shared<domain::Card>("card_" + std::to_string(i), sentence(rng, 4));
+        card->setDescription(sentence(rng, 20));
+        cards.push_back(std::move(card));
+    }
+    return cards;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = argOr(argc, argv, 1, 200000);
+    const std::size_t queries = argOr(argc, argv, 2, 20);
+
+    std::cout << "Cards: " << count << ", consultas: " << queries << "\n\n";
+    auto cards = makeCards(count);
+
+    std::mt19937 rng(11);
+    std::vector<std::string> terms;
+    for (std::size_t q = 0; q < queries; ++q) {
+        terms.push_back(std::string(kWords[rng() % kWordCount]) + std::to_string(rng() % 50) + " " +
+                        kWords[rng() % kWordCount] + std::to_string(rng() % 50));
+    }
+
+    // Varredura: normaliza o texto a cada consulta, como um filtro por card faria
+    std::size_t scanned = 0;
+    auto start = Clock::now();
+    for (const auto& query : terms) {
+        auto needles = domain::tokenize(query);
+        for (const auto& card : cards) {
+            std::string text = domain::foldText(card->title()) + " " + domain::foldText(*card->description());
+            for (const auto& needle : needles) {
+                if (text.find(needle) != std::string::npos) {
+                    ++scanned;
+                    break;
+                }
+            }
+        }
+    }
+    printThroughput("Varredura (consultas)", queries, elapsedNs(start, Clock::now()));
+
+    auto index = std::make_shared<domain::TextIndex>();
+    start = Clock::now();
+    for (const auto& card : cards) {
+        card->setObserver(index);
+        index->add("board_1", *card);
+    }
+    printThroughput("Indexaçao inicial (cards)", count, elapsedNs(start, Clock::now()));
+
+    std::size_t found = 0;
+    start = Clock::now();
+    for (const auto& query : terms) {
+        found += index->search(query, 20).size();
+    }
+    printThroughput("Índice, top 20 (consultas)", queries, elapsedNs(start, Clock::now()));
+
+    const std::size_t edits = std::min<std::size_t>(count, 50000);
+    start = Clock::now();
+    for (std::size_t i = 0; i < edits; ++i) {
+        cards[(i * 7919) % count]->setDescription(sentence(rng, 20));
+    }
+    printThroughput("setDescription + reindexaçao", edits, elapsedNs(start, Clock::now()));
+
+    std::cout << "\nCards com algum termo (varredura, por consulta): " << scanned / queries
+              << "; resultados do índice: " << found << "\n"
+              << "Termos distintos no índice: " << index->termCount() << "\n";
+    return 0;
+}
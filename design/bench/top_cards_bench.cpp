@@ -0,0 +1,97 @@
+/**
+ * @file top_cards_bench.cpp
+ * @brief Benchmark da consulta "o que vem a seguir" (cards mais urgentes)
+ * @details Muitos boards, consultados em sequência como um painel que
+ *          atualiza todos eles. Compara:
+ *          - ordenaçao por consulta: readBoard(), junta os cards de todas as
+ *            colunas e faz partial_sort pelo Card::operator<;
+ *          - KanbanService::topCards(): índice ordenado mantido a cada
+ *            alteraçao.
+ *          Mede também o custo de manter o índice em setPriority().
+ *
+ *          Uso: bench_top_cards [boards] [cards_por_board] [consultas]
+ */
+
+#include "BenchUtil.h"
+#include "application/KanbanService.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+namespace {
+
+constexpr std::size_t kTop = 10;
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t boards = argOr(argc, argv, 1, 300);
+    const std::size_t cardsPerBoard = argOr(argc, argv, 2, 1000);
+    const std::size_t queries = argOr(argc, argv, 3, 20000);
+
+    std::cout << "Boards: " << boards << ", cards por board: " << cardsPerBoard
+              << ", consultas: " << queries << "\n\n";
+
+    application::KanbanService service;
+    std::mt19937 rng(7);
+    std::vector<std::string> boardIds;
+    std::vector<std::shared_ptr<domain::Card>> cards;
+    for (std::size_t b = 0; b < boards; ++b) {
+        std::string boardId = service.createBoard("Board " + std::to_string(b));
+        std::vector<std::string> columns;
+        for (const char* name : {"To Do", "Doing", "Review", "Done"}) {
+            columns.push_back(service.addColumn(boardId, name));
+        }
+        for (std::size_t i = 0; i < cardsPerBoard; ++i) {
+            service.addCard(boardId, columns[rng() % columns.size()], "Card " + std::to_string(i));
+        }
+        for (const auto& columnId : columns) {
+            for (auto& card : service.listCards(columnId)) {
+                card->setPriority(static_cast<int>(rng() % 4));
+                cards.push_back(std::move(card));
+            }
+        }
+        boardIds.push_back(std::move(boardId));
+    }
+
+    std::size_t checksum = 0;
+    auto start = Clock::now();
+    for (std::size_t q = 0; q < queries; ++q) {
+        const std::string& boardId = boardIds[q % boards];
+        auto top = service.readBoard(boardId, [](const domain::Board& board) {
+            std::vector<std::shared_ptr<domain::Card>> all;
+            for (const auto& column : board.columns()) {
+                all.insert(all.end(), column->cards().begin(), column->cards().end());
+            }
+            std::size_t k = std::min(kTop, all.size());
+            std::partial_sort(all.begin(), all.begin() + static_cast<std::ptrdiff_t>(k), all.end(),
+                              [](const std::shared_ptr<domain::Card>& a, const std::shared_ptr<domain::Card>& b) {
+                                  return *a < *b;
+                              });
+            all.resize(k);
+            return all;
+        });
+        checksum += top.size();
+    }
+    printThroughput("Ordenacao por consulta", queries, elapsedNs(start, Clock::now()));
+
+    start = Clock::now();
+    for (std::size_t q = 0; q < queries; ++q) {
+        checksum += service.topCards(boardIds[q % boards], kTop).size();
+    }
+    printThroughput("topCards (indice)", queries, elapsedNs(start, Clock::now()));
+
+    const std::size_t updates = std::min<std::size_t>(cards.size(), 100000);
+    start = Clock::now();
+    for (std::size_t i = 0; i < updates; ++i) {
+        cards[(i * 7919) % cards.size()]->setPriority(static_cast<int>(rng() % 4));
+    }
+    printThroughput("setPriority + indice", updates, elapsedNs(start, Clock::now()));
+
+    std::cout << "\nCards retornados: " << checksum << "\n";
+    return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file work_stealing_bench.cpp
+ * @brief Benchmark do escalonador com roubo de trabalho
+ * @details Carga desbalanceada: uma árvore de tarefas em que cada nível
+ *          divide o intervalo em partes de tamanhos diferentes, como
+ *          partições de colunas com quantidades muito distintas de cards.
+ *          Mede o tempo da árvore inteira e imprime, por thread, as
+ *          tarefas executadas, os roubos e a utilizaçao.
+ *
+ *          Uso: bench_work_stealing [folhas] [threads]
+ */
+
+#include "BenchUtil.h"
+#include "concurrency/ThreadPool.h"
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+using namespace kanban;
+using namespace kanban::bench;
+
+namespace {
+
+/// @brief Trabalho de uma folha proporcional ao seu tamanho
+double leaf(std::size_t begin, std::size_t end) {
+    double acc = 0.0;
+    for (std::size_t i = begin; i < end; ++i) {
+        acc += std::sqrt(static_cast<double>(i));
+    }
+    return acc;
+}
+
+/// @brief Divide [begin, end) em 1/4 e 3/4 até folhas de 4096 elementos
+double tree(concurrency::ThreadPool& pool, std::size_t begin, std::size_t end) {
+    if (end - begin <= 4096) {
+        return leaf(begin, end);
+    }
+    std::size_t split = begin + (end - begin) / 4;
+    double left = 0.0;
+    concurrency::TaskGroup group(pool);
+    group.run([&] { left = tree(pool, begin, split); });
+    double right = tree(pool, split, end);
+    group.wait();
+    return left + right;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t leaves = argOr(argc, argv, 1, 4096);
+    const std::size_t threads = argOr(argc, argv, 2, std::max(1u, std::thread::hardware_concurrency()));
+    const std::size_t elements = leaves * 4096;
+
+    std::cout << "Elementos: " << elements << ", threads: " << threads
+              << ", nucleos: " << std::thread::hardware_concurrency() << "\n\n";
+
+    auto start = Clock::now();
+    double sequential = leaf(0, elements);
+    printThroughput("Sequencial", elements, elapsedNs(start, Clock::now()));
+
+    concurrency::ThreadPool pool(threads);
+    double parallel = 0.0;
+    concurrency::TaskGroup root(pool);
+    start = Clock::now();
+    root.run([&] { parallel = tree(pool, 0, elements); });
+    root.wait();
+    printThroughput("Arvore de tarefas", elements, elapsedNs(start, Clock::now()));
+
+    std::cout << "\nThread  Tarefas   Roubos   Utilizacao\n";
+    auto stats = pool.stats();
+    for (std::size_t i = 0; i < stats.size(); ++i) {
+        std::printf("%6zu %8llu %8llu %11.1f%%\n", i,
+                    static_cast<unsigned long long>(stats[i].executed),
+                    static_cast<unsigned long long>(stats[i].steals),
+                    100.0 * stats[i].utilization);
+    }
+    std::cout << "\nResultados iguais: "
+              << (std::abs(parallel - sequential) <= 1e-6 * sequential ? "sim" : "nao") << "\n";
+    return 0;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file AsyncKanbanService.h
+ * @brief Declaraçao da fachada assíncrona do KanbanService
+ * @details Cada chamada vira uma mensagem para um executor dedicado (uma
+ *          ActorThread) e devolve um std::future ou entrega o resultado a
+ *          um callback. Com um Dispatcher, os callbacks sao repassados à
+ *          thread do chamador (ex.: o laço de eventos do Qt), que assim só
+ *          recebe resultados prontos e nunca espera o serviço.
+ */
+
+#pragma once
+
+#include "KanbanService.h"
+#include "../concurrency/ActorThread.h"
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kanban {
+namespace application {
+
+// ============================================================================
+// CLASSE AsyncKanbanService
+// ============================================================================
+
+/**
+ * @brief Executa as operações do KanbanService fora da thread chamadora
+ * @details As chamadas sao executadas uma a uma, na ordem de envio: uma
+ *          leitura enviada depois de uma escrita já vê o seu efeito.
+ *
+ *          Exemplo de uso:
+ *          @code
+ *          AsyncKanbanService async(std::make_shared<KanbanService>(), dispatcher);
+ *          async.call([](KanbanService& s) { return s.createBoard("Sprint"); },
+ *                     [](std::string boardId) { ... },            // via dispatcher
+ *                     [](const std::exception& e) { ... });
+ *          @endcode
+ *
+ * @note Os objetos de domínio devolvidos continuam compartilhados com o
+ *       serviço. Quem os lê em outra thread deve fazê-lo quando nenhuma
+ *       escrita enviada por ele estiver em andamento, ou copiar os dados
+ *       necessários dentro da própria chamada.
+ */
+class AsyncKanbanService {
+public:
+    /// @brief Entrega um callback de conclusao à thread de destino
+    using Dispatcher = std::function<void(std::function<void()>)>;
+
+    /// @brief Recebe a exceçao de uma chamada que falhou
+    using ErrorHandler = std::function<void(const std::exception&)>;
+
+    /**
+     * @brief Construtor - inicia o executor
+     * @param service Serviço envolvido (compartilhável com leitores síncronos)
+     * @param dispatcher Destino dos callbacks; vazio = executados no próprio executor
+     * @throws std::invalid_argument Se service for nulo
+     */
+    explicit AsyncKanbanService(std::shared_ptr<KanbanService> service = std::make_shared<KanbanService>(),
+                                Dispatcher dispatcher = {});
+
+    /**
+     * @brief Destrutor - executa as chamadas pendentes e encerra o executor
+     * @details Os callbacks dessas chamadas ainda passam pelo Dispatcher.
+     */
+    ~AsyncKanbanService();
+
+    AsyncKanbanService(const AsyncKanbanService&) = delete;
+    AsyncKanbanService& operator=(const AsyncKanbanService&) = delete;
+
+    // ============================================================================
+    // CHAMADAS GENÉRICAS
+    // ============================================================================
+
+    /**
+     * @brief Executa fn(KanbanService&) no executor
+     * @return Future com o resultado de fn ou a exceçao lançada
+     */
+    template<typename Fn>
+    auto call(Fn&& fn) -> std::future<std::invoke_result_t<std::decay_t<Fn>&, KanbanService&>> {
+        submitted_.fetch_add(1, std::memory_order_relaxed);
+        return executor_.ask([this, service = service_, fn = std::forward<Fn>(fn)]() mutable {
+            Completion completion{completed_};   // contada antes de o future ficar pronto
+            return fn(*service);
+        });
+    }
+
+    /**
+     * @brief Executa fn(KanbanService&) no executor e entrega o resultado a callbacks
+     * @param fn Operaçao executada no executor
+     * @param onDone Chamado com o resultado (sem argumentos se fn retorna void)
+     * @param onError Chamado com a exceçao, se fn falhar (opcional)
+     * @details Os dois callbacks passam pelo Dispatcher; exatamente um deles
+     *          é chamado (nenhum, se onError for vazio e fn falhar).
+     */
+    template<typename Fn, typename Done>
+    void call(Fn&& fn, Done&& onDone, ErrorHandler onError = {}) {
+        using Result = std::invoke_result_t<std::decay_t<Fn>&, KanbanService&>;
+        submitted_.fetch_add(1, std::memory_order_relaxed);
+        executor_.post([this, service = service_, dispatcher = dispatcher_, fn = std::forward<Fn>(fn),
+                        onDone = std::forward<Done>(onDone), onError = std::move(onError)]() mutable {
+            Completion completion{completed_};
+            // Só fn fica no try: uma exceçao do próprio onDone nao vira chamada a onError
+            std::exception_ptr error;
+            if constexpr (std::is_void_v<Result>) {
+                try {
+                    fn(*service);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                if (!error) {
+                    deliver(dispatcher, [onDone = std::move(onDone)]() mutable { onDone(); });
+                    return;
+                }
+            } else {
+                std::optional<Result> result;
+                try {
+                    result.emplace(fn(*service));
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                if (result) {
+                    deliver(dispatcher, [onDone = std::move(onDone), value = std::move(*result)]() mutable {
+                        onDone(std::move(value));
+                    });
+                    return;
+                }
+            }
+            if (onError) {
+                deliver(dispatcher, [onError = std::move(onError), error] { report(onError, error); });
+            }
+        });
+    }
+
+    // ============================================================================
+    // OPERAÇÕES DO IService
+    // ============================================================================
+
+    std::future<void> createSampleData();
+    std::future<std::string> createBoard(const std::string& name);
+    std::future<std::string> addColumn(const std::string& boardId, const std::string& columnName);
+    std::future<std::string> addCard(const std::string& boardId, const std::string& columnId,
+                                     const std::string& title);
+    std::future<void> moveCard(const std::string& boardId, const std::string& cardId,
+                               const std::string& fromColumnId, const std::string& toColumnId);
+    std::future<std::vector<std::string>> applyBatch(const std::string& boardId,
+                                                     std::vector<domain::Command> commands);
+    std::future<std::vector<std::shared_ptr<domain::Board>>> listBoards();
+    std::future<std::optional<std::shared_ptr<domain::Board>>> findBoard(const std::string& boardId);
+    std::future<std::vector<std::shared_ptr<domain::Column>>> listColumns(const std::string& boardId);
+    std::future<std::vector<std::shared_ptr<domain::Card>>> listCards(const std::string& columnId);
+
+    // ============================================================================
+    // ESTADO DO EXECUTOR
+    // ============================================================================
+
+    /**
+     * @brief Serviço envolvido, para leituras síncronas baratas (índices)
+     * @details O KanbanService é seguro entre threads; chamá-lo diretamente
+     *          apenas nao respeita a ordem das chamadas enfileiradas.
+     */
+    KanbanService& service() const noexcept { return *service_; }
+
+    /// @brief Chamadas enviadas e ainda nao concluídas no executor
+    std::uint64_t pending() const noexcept;
+
+    /**
+     * @brief Espera a conclusao de todas as chamadas enviadas até agora
+     * @warning Nao chamar de dentro de uma chamada (bloqueia o executor).
+     *          Os callbacks entregues ao Dispatcher podem ainda nao ter rodado.
+     */
+    void drain();
+
+private:
+    /// @brief Conta a chamada como concluída ao sair do escopo
+    struct Completion {
+        std::atomic<std::uint64_t>& completed;
+        ~Completion() { completed.fetch_add(1, std::memory_order_release); }
+    };
+
+    /// @brief Executa o callback pelo Dispatcher, ou na hora se nao houver
+    static void deliver(const Dispatcher& dispatcher, std::function<void()> callback);
+
+    /// @brief Relança a exceçao capturada e a entrega a onError
+    static void report(const ErrorHandler& onError, std::exception_ptr error);
+
+    std::shared_ptr<KanbanService> service_;      ///< @brief Serviço envolvido
+    Dispatcher dispatcher_;                        ///< @brief Destino dos callbacks
+    std::atomic<std::uint64_t> submitted_{0};      ///< @brief Chamadas enviadas
+    std::atomic<std::uint64_t> completed_{0};      ///< @brief Chamadas concluídas
+    concurrency::ActorThread executor_;            ///< @brief Declarado por último: encerrado primeiro
+};
+
+} // namespace application
+} // namespace kanban
@@ -0,0 +1,120 @@
+/**
+ * @file BatchExecutor.h
+ * @brief Declaraçao do executor de lotes de comandos sobre um board
+ * @details Aplica uma lista de domain::Command de forma tudo-ou-nada: uma
+ *          passada de validaçao sobre uma visao leve do board (sem tocar nos
+ *          objetos de domínio) e, se tudo for válido, uma passada de
+ *          aplicaçao que nao pode falhar. As atividades do lote sao gravadas
+ *          como um único grupo no ActivityLog do board e, no modo
+ *          event-sourced, os eventos do lote como um único grupo no EventStore.
+ */
+
+#pragma once
+
+#include "../domain/Board.h"
+#include "../domain/Card.h"
+#include "../domain/Column.h"
+#include "../domain/Command.h"
+#include "../domain/EventStore.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace kanban {
+namespace application {
+
+// ============================================================================
+// CLASSE BatchException
+// ============================================================================
+
+/**
+ * @brief Exceçao lançada quando um comando do lote é inválido
+ * @details Nenhum comando do lote foi aplicado quando ela é lançada.
+ */
+class BatchException : public std::runtime_error {
+public:
+    /**
+     * @brief Construtor da exceçao BatchException
+     * @param commandIndex Posiçao (base 0) do comando inválido
+     * @param what Mensagem descritiva do erro
+     */
+    BatchException(std::size_t commandIndex, const std::string& what)
+        : std::runtime_error("Comando " + std::to_string(commandIndex) + ": " + what),
+          commandIndex_(commandIndex) {}
+
+    /**
+     * @brief Posiçao do comando que invalidou o lote
+     */
+    std::size_t commandIndex() const noexcept { return commandIndex_; }
+
+private:
+    std::size_t commandIndex_;
+};
+
+/**
+ * @brief Card adicionado, movido ou reposicionado por um lote
+ */
+struct CardPlacement {
+    std::shared_ptr<domain::Card> card;       ///< @brief Card afetado
+    std::shared_ptr<domain::Column> column;   ///< @brief Coluna onde ficou
+    std::size_t position = 0;                 ///< @brief Posiçao logo após o comando
+};
+
+/**
+ * @brief Resultado de um lote aplicado
+ */
+struct BatchResult {
+    std::vector<std::string> ids;                                  ///< @brief ID criado por comando (vazio se nenhum)
+    std::vector<std::shared_ptr<domain::Column>> createdColumns;   ///< @brief Colunas criadas, em ordem
+    std::vector<std::shared_ptr<domain::Card>> createdCards;       ///< @brief Cards criados, em ordem
+    std::vector<CardPlacement> placements;                         ///< @brief Localizações, na ordem de aplicaçao
+};
+
+// ============================================================================
+// CLASSE BatchExecutor
+// ============================================================================
+
+/**
+ * @brief Valida e aplica lotes de comandos em um board
+ * @details O chamador é responsável pela exclusao mútua sobre o board
+ *          (lock do KanbanService ou thread do shard) e pela alocaçao dos
+ *          IDs, fornecidos pelas funções geradoras.
+ */
+class BatchExecutor {
+public:
+    /// @brief Gera o próximo ID de coluna ou de card
+    using IdGenerator = std::function<std::string()>;
+
+    /**
+     * @brief Valida e aplica o lote
+     * @param board Board alvo
+     * @param commands Comandos, aplicados em ordem
+     * @param nextColumnId Gerador de IDs de colunas novas
+     * @param nextCardId Gerador de IDs de cards novos
+     * @param events Log de eventos (opcional): recebe o grupo do lote depois
+     *        da validaçao e antes de qualquer mutaçao
+     * @return IDs criados e as entidades novas (para indexaçao pelo chamador)
+     * @throws BatchException Se algum comando for inválido (o board nao é alterado)
+     */
+    static BatchResult execute(domain::Board& board,
+                               const std::vector<domain::Command>& commands,
+                               const IdGenerator& nextColumnId,
+                               const IdGenerator& nextCardId,
+                               domain::EventStore* events = nullptr);
+
+    /**
+     * @brief Quantos IDs de coluna e de card o lote vai consumir
+     * @param commands Comandos do lote
+     * @param columns Recebe o número de CreateColumn
+     * @param cards Recebe o número de AddCard
+     * @details Permite reservar todos os IDs com um único incremento atômico.
+     */
+    static void countCreations(const std::vector<domain::Command>& commands,
+                               std::size_t& columns, std::size_t& cards) noexcept;
+};
+
+} // namespace application
+} // namespace kanban
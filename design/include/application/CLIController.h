@@ -43,6 +43,8 @@ private:
     void handleCreateBoard(const std::string& args);
     void handleMoveCard(const std::string& args);
     void handleListBoards();
+    void handleUndo(const std::string& args);
+    void handleRedo(const std::string& args);
     void showHelp() const;
 };
 
@@ -9,19 +9,64 @@
 #pragma once
 
 #include "../interfaces/IService.h"
+#include "UndoHistory.h"
+#include "ReadModel.h"
 #include "../persistence/MemoryRepository.h"
+#include "../persistence/AsyncActivitySink.h"
 #include "../domain/Board.h"        // INCLUA ESTES HEADERS COMPLETOS
 #include "../domain/Column.h"
 #include "../domain/Card.h"
 #include "../domain/User.h"         // ESPECIALMENTE ESTE
 #include "../domain/ActivityLog.h"
+#include "../domain/FlowMetrics.h"
+#include "../domain/CumulativeFlow.h"
+#include "../domain/DeliveryForecast.h"
+#include "../domain/Command.h"
+#include "../domain/EventStore.h"
+#include "../domain/CardFilter.h"
+#include "../domain/FilterExpr.h"
+#include "../domain/CardTable.h"
+#include "../domain/TextIndex.h"
+#include "../domain/FuzzyIndex.h"
+#include "../domain/CompletionIndex.h"
+#include "../domain/PriorityIndex.h"
+#include "../interfaces/ICardObserver.h"
+#include "../concurrency/StripedMap.h"
+#include "../concurrency/ThreadPool.h"
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <random>
 
 namespace kanban {
 namespace application {
 
+/**
+ * @brief Notificaçao de alteraçao de um board
+ * @details Emitida uma vez por operaçao de escrita; um lote aplicado por
+ *          applyBatch() gera uma única notificaçao.
+ */
+struct BoardChange {
+    std::string boardId;          ///< @brief Board alterado
+    std::size_t operations = 1;   ///< @brief Mutações aplicadas (tamanho do lote)
+};
+
+/**
+ * @brief Localizaçao de um card (board, coluna e posiçao)
+ * @details Cópia retornada por KanbanService::locateCard(), válida no
+ *          instante da consulta.
+ */
+struct CardLocation {
+    std::string boardId;        ///< @brief Board dono do card
+    std::string columnId;       ///< @brief Coluna onde o card está
+    std::size_t position = 0;   ///< @brief Posiçao (base 0) dentro da coluna
+};
+
 /**
  * @brief Serviço principal do sistema Kanban
  * @details Implementa a interface IService e serve como facade para todas as
@@ -34,6 +79,21 @@ namespace application {
  *          - Gerar IDs únicos para todas as entidades
  *          - Manter a consistência dos dados entre operações
  *          - Fornecer dados para a camada de apresentaçao
+ *
+ *          Concorrência: todas as operações podem ser chamadas de várias threads.
+ *          - Cada board tem seu próprio std::shared_mutex: mutações tomam o
+ *            lock exclusivo e consultas o compartilhado, de modo que boards
+ *            diferentes nunca disputam o mesmo lock.
+ *          - O diretório de boards é um snapshot imutável trocado atomicamente
+ *            (copy-on-write em createBoard); listBoards() e findBoard() nao
+ *            tomam lock algum do serviço.
+ *          - Os índices de colunas e cards sao mapas com lock striping.
+ *          - Os IDs sao alocados com contadores atômicos.
+ *
+ * @note Os objetos de domínio retornados continuam vivos e mutáveis; para ler
+ *       um board de forma consistente enquanto outras threads o alteram, use
+ *       readBoard(). Os métodos de configuraçao (setActivity*) devem ser
+ *       chamados antes do uso concorrente.
  */
 class KanbanService : public interfaces::IService {
 public:
@@ -41,6 +101,22 @@ public:
     std::vector<std::shared_ptr<domain::Tag>> getAllTags(const std::string& boardId);
     void updateCardTags(const std::string& boardId, const std::string& cardId, const std::vector<std::string>& tags);
 
+    /**
+     * @brief Aplica a ediçao completa de um card sob o lock do board
+     * @param boardId ID do board
+     * @param cardId ID do card
+     * @param title Novo título
+     * @param description Nova descriçao
+     * @param priority Nova prioridade
+     * @param tags Nomes das novas tags
+     * @details Só grava o que mudou: cada campo alterado vira um evento
+     *          (título, descriçao, prioridade, tags) e a ediçao inteira é uma
+     *          única entrada do histórico de desfazer.
+     * @throws std::runtime_error Se o card nao existir no board
+     */
+    void updateCard(const std::string& boardId, const std::string& cardId, const std::string& title,
+                    const std::string& description, int priority, const std::vector<std::string>& tags);
+
     /**
      * @brief Reordena um card dentro da mesma coluna
      * @param boardId ID do board
@@ -141,6 +217,62 @@ public:
     void moveCard(const std::string& boardId, const std::string& cardId, 
                   const std::string& fromColumnId, const std::string& toColumnId) override;
 
+    /**
+     * @brief Aplica um lote de comandos ao board, tudo ou nada
+     * @param boardId ID do board alvo
+     * @param commands Comandos aplicados em ordem
+     * @return ID criado por comando (vazio quando o comando nao cria entidades)
+     * @throws std::runtime_error Se o board nao existir
+     * @throws BatchException Se algum comando for inválido (nada é aplicado)
+     * @details Os IDs do lote sao reservados com um incremento atômico por
+     *          tipo, o lock exclusivo do board é tomado uma única vez e os
+     *          índices de colunas/cards sao atualizados ao final. Gera uma
+     *          única notificaçao de alteraçao.
+     */
+    std::vector<std::string> applyBatch(const std::string& boardId,
+                                        const std::vector<domain::Command>& commands) override;
+
+    // ============================================================================
+    // OPERAÇÕES A PARTIR DO ID DO CARD
+    // ============================================================================
+
+    /**
+     * @brief Localiza um card pelo ID
+     * @param cardId ID do card
+     * @return Board, coluna e posiçao atuais, ou std::nullopt se o card nao existir
+     * @details Consulta O(1) ao índice de cards, mantido a cada inserçao e
+     *          movimentaçao. A posiçao gravada é conferida sob o lock
+     *          compartilhado do board; se outro card tiver deslocado o card
+     *          na coluna, apenas essa coluna é percorrida.
+     */
+    std::optional<CardLocation> locateCard(const std::string& cardId) const;
+
+    /**
+     * @brief Move um card para o final de outra coluna do mesmo board
+     * @param cardId ID do card
+     * @param toColumnId ID da coluna de destino
+     * @throws std::runtime_error Se o card ou a coluna nao existirem, ou se a
+     *         coluna pertencer a outro board
+     * @details A coluna de origem vem do índice de cards.
+     */
+    void moveCard(const std::string& cardId, const std::string& toColumnId);
+
+    /**
+     * @brief Reposiciona um card dentro da coluna onde ele está
+     * @param cardId ID do card
+     * @param newIndex Nova posiçao do card
+     * @throws std::runtime_error Se o card nao existir
+     */
+    void moveCardWithinColumn(const std::string& cardId, std::size_t newIndex);
+
+    /**
+     * @brief Substitui as tags de um card
+     * @param cardId ID do card
+     * @param tags Nomes das novas tags
+     * @throws std::runtime_error Se o card nao existir
+     */
+    void updateCardTags(const std::string& cardId, const std::vector<std::string>& tags);
+
     // ============================================================================
     // CONSULTAS E RELATÓRIOS
     // ============================================================================
@@ -183,20 +315,427 @@ public:
      */
     std::vector<std::shared_ptr<domain::Card>> listCards(const std::string& columnId) const override;
 
+    /**
+     * @brief Cards de um board que satisfazem um filtro
+     * @param boardId ID do board
+     * @param filter Árvore de filtros (compilada a cada chamada)
+     * @return Cards aceitos, na ordem das colunas e, dentro delas, dos cards
+     * @throws std::runtime_error Se o board nao existir
+     * @details Compila o filtro com domain::FilterPlan::compile(); para
+     *          reutilizar o mesmo filtro em várias consultas, compile-o uma
+     *          vez e use a sobrecarga que recebe o plano.
+     */
+    std::vector<std::shared_ptr<domain::Card>> query(const std::string& boardId,
+                                                     const interfaces::IFilter& filter) const;
+
+    /**
+     * @brief Cards de um board que satisfazem um plano já compilado
+     * @details Avaliado sob o lock compartilhado do board. Colunas fora do
+     *          escopo do plano nao sao percorridas. Com muitos cards no
+     *          escopo, um plano sem texto nem filtros externos é avaliado
+     *          sobre a CardTable em cache do board, remontada só depois de
+     *          uma alteraçao (seleções vetorizadas combinadas em bitmaps,
+     *          ver FilterPlan::select()); os demais
+     *          têm os trechos das colunas avaliados em paralelo no
+     *          escalonador compartilhado. A ordem do resultado é a mesma.
+     */
+    std::vector<std::shared_ptr<domain::Card>> query(const std::string& boardId,
+                                                     const domain::FilterPlan& plan) const;
+
+    /**
+     * @brief Cards de um board que satisfazem uma expressao de filtro
+     * @param boardId ID do board
+     * @param expression Expressao de domain::expr (ex.: priority >= 2 && hasTag("bug"))
+     * @details Avaliada sob o lock compartilhado do board, sem despacho virtual.
+     */
+    template<typename E>
+    std::vector<std::shared_ptr<domain::Card>> query(const std::string& boardId,
+                                                     const domain::expr::Expr<E>& expression) const {
+        const E& predicate = expression.self();
+        return readBoard(boardId, [&predicate](const domain::Board& board) {
+            std::vector<std::shared_ptr<domain::Card>> result;
+            for (const auto& column : board.columns()) {
+                for (const auto& card : column->cards()) {
+                    if (predicate(*card, column->id())) {
+                        result.push_back(card);
+                    }
+                }
+            }
+            return result;
+        });
+    }
+
+    /**
+     * @brief Foto colunar dos cards de um board para os kernels vetorizados
+     * @param boardId ID do board
+     * @throws std::runtime_error Se o board nao existir
+     * @details Cópia da tabela em cache do board, remontada sob o lock
+     *          compartilhado só se o board mudou desde a última montagem.
+     */
+    domain::CardTable cardTable(const std::string& boardId) const;
+
+    /**
+     * @brief Busca de texto completo no título e na descriçao dos cards
+     * @param query Termos da busca (sem diferenciar maiúsculas nem acentos)
+     * @param limit Máximo de resultados
+     * @return Cards de todos os boards, do mais para o menos relevante
+     * @details Usa o índice invertido mantido a cada addCard()/applyBatch()
+     *          e a cada setTitle()/setDescription() dos cards do serviço,
+     *          inclusive os feitos diretamente sobre o Card (ex.: pela GUI).
+     */
+    std::vector<domain::SearchHit> searchCards(const std::string& query, std::size_t limit = 20) const;
+
+    /**
+     * @brief Busca aproximada nos títulos, tolerante a erros de digitaçao
+     * @param query Palavras digitadas; cada uma deve casar, a menos de
+     *              algumas edições, com o início de uma palavra do título
+     * @param limit Máximo de resultados
+     * @return Cards de todos os boards, do mais para o menos parecido
+     * @details Complementa searchCards(): "implemnt clases" encontra
+     *          "Implementar classes de domínio". Ver domain::FuzzyIndex.
+     */
+    std::vector<domain::SearchHit> fuzzySearchCards(const std::string& query, std::size_t limit = 20) const;
+
+    /**
+     * @brief Completa títulos de cards do board pelo prefixo digitado
+     * @param boardId ID do board
+     * @param prefix Início do título (sem diferenciar maiúsculas nem acentos)
+     * @param limit Máximo de sugestões
+     * @return Sugestões (id = ID do card, text = título), da maior para a
+     *         menor prioridade e, no empate, da alteraçao mais recente
+     * @throws std::runtime_error Se o board nao existir
+     * @details Nao toma o lock do board: consulta apenas a trie mantida a
+     *          cada alteraçao dos cards.
+     */
+    std::vector<domain::Completion> completeCardTitles(const std::string& boardId,
+                                                       const std::string& prefix,
+                                                       std::size_t limit = 10) const;
+
+    /**
+     * @brief Completa nomes de tags usadas no board pelo prefixo digitado
+     * @return Sugestões (id = nome normalizado, text = nome), das tags usadas
+     *         por mais cards para as usadas por menos
+     * @throws std::runtime_error Se o board nao existir
+     */
+    std::vector<domain::Completion> completeTagNames(const std::string& boardId,
+                                                     const std::string& prefix,
+                                                     std::size_t limit = 10) const;
+
+    /**
+     * @brief Nomes de todas as tags usadas no board, em ordem alfabética
+     * @throws std::runtime_error Se o board nao existir
+     */
+    std::vector<std::string> tagNames(const std::string& boardId) const;
+
+    /**
+     * @brief Os k cards mais urgentes do board, de todas as colunas
+     * @param boardId ID do board
+     * @param k Máximo de cards
+     * @return Na ordem de Card::operator< (maior prioridade, depois o mais antigo)
+     * @throws std::runtime_error Se o board nao existir
+     * @details Lê o índice ordenado mantido a cada addCard()/applyBatch() e a
+     *          cada setPriority() dos cards, em O(k), sem tomar o lock do
+     *          board nem ordenar seus cards. Mover cards nao altera o índice.
+     */
+    std::vector<std::shared_ptr<domain::Card>> topCards(const std::string& boardId, std::size_t k) const;
+
+    // ============================================================================
+    // MÉTRICAS DE FLUXO
+    // ============================================================================
+
+    /**
+     * @brief Distribuições de fluxo de uma coluna
+     * @param boardId ID do board
+     * @param columnId ID da coluna
+     * @return Permanência, lead time e cycle time até a coluna (percentis via
+     *         QuantileSketch::quantile) e WIP atual
+     * @throws std::runtime_error Se o board ou a coluna nao existirem
+     * @details Mantidas pelo ActivityLog do board a cada movimentaçao; a
+     *          consulta nao percorre o histórico. O lead time do board é o
+     *          da coluna final.
+     */
+    domain::ColumnFlow columnFlow(const std::string& boardId, const std::string& columnId) const;
+
+    /**
+     * @brief Histórico de fluxo de um card (criaçao, início e chegadas)
+     * @return std::nullopt se o card nunca apareceu no log do board
+     * @throws std::runtime_error Se o board nao existir
+     */
+    std::optional<domain::CardFlow> cardFlow(const std::string& boardId, const std::string& cardId) const;
+
+    /**
+     * @brief Lead time de um card: da criaçao à primeira chegada à última
+     *        coluna do board
+     * @return std::nullopt se o card ainda nao chegou à última coluna
+     * @throws std::runtime_error Se o board nao existir
+     */
+    std::optional<std::chrono::milliseconds> leadTime(const std::string& boardId, const std::string& cardId) const;
+
+    /**
+     * @brief Diagrama de fluxo cumulativo do board em uma janela
+     * @param boardId ID do board
+     * @param from Início da janela
+     * @param to Fim da janela
+     * @param bucket Largura de cada ponto da série (ex.: um dia)
+     * @return Cards por coluna no fim de cada bucket, colunas na ordem do board
+     * @throws std::runtime_error Se o board nao existir
+     * @throws std::invalid_argument Se a janela ou o bucket forem inválidos
+     * @details O estado atual das colunas é lido sob o lock compartilhado do
+     *          board; as atividades desde from sao processadas depois, fora
+     *          do lock, em partições paralelas no escalonador compartilhado
+     *          (ver domain::cumulativeFlow()).
+     */
+    domain::CumulativeFlow cumulativeFlow(const std::string& boardId,
+                                          domain::TimePoint from,
+                                          domain::TimePoint to,
+                                          std::chrono::milliseconds bucket) const;
+
+    /**
+     * @brief Previsao de entrega dos cards ainda nao concluídos do board
+     * @param boardId ID do board
+     * @param historyWeeks Semanas completas de throughput a reamostrar
+     * @param trials Tentativas de Monte Carlo
+     * @return Histograma de semanas até a entrega; datas via dateAt(percentil)
+     * @throws std::runtime_error Se o board nao existir ou nao tiver colunas
+     * @throws std::invalid_argument Se o board ainda nao tiver uma semana
+     *         completa de histórico ou trials for zero
+     * @details Restantes sao os cards fora da última coluna; o throughput é
+     *          o número de chegadas à última coluna por semana, lido dos
+     *          rollups (ver domain::weeklyThroughput()). As tentativas rodam
+     *          no escalonador compartilhado.
+     */
+    domain::DeliveryForecast forecastDelivery(const std::string& boardId,
+                                              std::size_t historyWeeks = domain::kDefaultForecastHistoryWeeks,
+                                              std::size_t trials = domain::kDefaultForecastTrials) const;
+
+    /**
+     * @brief Previsao de entrega de um subconjunto dos cards do board
+     * @param plan Filtro compilado: apenas os cards aceitos fora da última
+     *        coluna contam como restantes
+     * @details O throughput continua sendo o do board inteiro: a previsao
+     *          responde quando a equipe entrega esses cards.
+     */
+    domain::DeliveryForecast forecastDelivery(const std::string& boardId,
+                                              const domain::FilterPlan& plan,
+                                              std::size_t historyWeeks = domain::kDefaultForecastHistoryWeeks,
+                                              std::size_t trials = domain::kDefaultForecastTrials) const;
+
+    // ============================================================================
+    // CONFIGURAÇaO DO HISTÓRICO DE ATIVIDADES
+    // ============================================================================
+
+    /**
+     * @brief Limita o histórico em memória dos boards criados a partir de agora
+     * @param memoryCapacity Máximo de atividades em memória por board (0 = ilimitado)
+     * @param spillDirectory Diretório dos segmentos comprimidos; vazio descarta
+     *        as atividades excedentes em vez de arquivá-las
+     * @details Cada board recebe o subdiretório "<spillDirectory>/<boardId>".
+     *          Boards já existentes nao sao afetados.
+     */
+    void setActivityRetention(std::size_t memoryCapacity, const std::string& spillDirectory = "");
+
+    /**
+     * @brief Ativa a trilha de auditoria em disco para os boards criados a partir de agora
+     * @param directory Diretório dos arquivos de auditoria ("<directory>/<boardId>.log");
+     *        vazio desativa a auditoria
+     * @param options Política de fsync da thread de gravaçao
+     * @details A gravaçao é assíncrona: as mutações apenas enfileiram o evento.
+     */
+    void setActivityAudit(const std::string& directory,
+                          persistence::FsyncOptions options = persistence::FsyncOptions());
+
+    /// @brief Callback de notificaçao de alterações
+    using ChangeListener = std::function<void(const BoardChange&)>;
+
+    /**
+     * @brief Define quem recebe as notificações de alteraçao de boards
+     * @param listener Callback (vazio desativa); chamado fora dos locks do
+     *        serviço, na thread que realizou a alteraçao
+     */
+    void setChangeListener(ChangeListener listener);
+
+    // ============================================================================
+    // MODO EVENT-SOURCED
+    // ============================================================================
+
+    /**
+     * @brief Ativa o modo event-sourced: toda mutaçao é gravada no store antes de aplicada
+     * @param store Log de eventos; se já tiver eventos (ex.: carregado com
+     *        EventStore::load()), os boards sao reconstruídos a partir do seu estado
+     * @throws std::invalid_argument Se store for nulo
+     * @throws std::runtime_error Se o serviço já tiver boards
+     * @details Assim como os demais métodos de configuraçao, deve ser chamado
+     *          antes do uso concorrente do serviço. A reconstruçao restaura a
+     *          estrutura (boards, colunas, ordem dos cards, tags e prioridades)
+     *          e os contadores de ID; o histórico de atividades recomeça vazio.
+     */
+    void useEventStore(std::shared_ptr<domain::EventStore> store);
+
+    /// @brief Log de eventos do modo event-sourced (nullptr se desativado)
+    std::shared_ptr<domain::EventStore> eventStore() const { return events_; }
+
+    // ============================================================================
+    // PROJEÇÕES DE LEITURA
+    // ============================================================================
+
+    /**
+     * @brief Passa a publicar as mutações para as projeções de model
+     * @param model Projeções mantidas pela thread do próprio ReadModel
+     * @throws std::invalid_argument Se model for nulo
+     * @details Os boards existentes sao publicados por inteiro uma única vez;
+     *          daí em diante cada mutaçao publica só o que mudou (o card
+     *          criado, movido ou alterado, ou a lista de colunas), sob o lock
+     *          do board e sem esperar a projeçao. Alterações feitas direto no
+     *          Card (prioridade e tags) chegam pelo observador do card. Deve
+     *          ser chamado antes do uso concorrente do serviço.
+     */
+    void useReadModel(std::shared_ptr<ReadModel> model);
+
+    /// @brief Projeções de leitura (nullptr se desativadas)
+    std::shared_ptr<ReadModel> readModel() const { return readModel_; }
+
+    // ============================================================================
+    // DESFAZER E REFAZER
+    // ============================================================================
+
+    /**
+     * @brief Desfaz a mutaçao mais recente do board
+     * @param boardId ID do board
+     * @return false se nao houver nada a desfazer
+     * @throws std::runtime_error Se o board nao existir, ou se o board mudou
+     *         de forma que a mutaçao nao pode mais ser desfeita (ex.: o card
+     *         saiu da coluna por um lote); a entrada é descartada
+     * @details Entram no histórico as movimentações de cards (entre colunas e
+     *          dentro de uma coluna), a reordenaçao de colunas e a troca de
+     *          tags; criações e lotes (applyBatch) nao entram. Desfazer é uma
+     *          mutaçao como as outras: registra atividades, eventos e notifica.
+     */
+    bool undo(const std::string& boardId);
+
+    /**
+     * @brief Refaz a última mutaçao desfeita do board
+     * @return false se nao houver nada a refazer
+     * @throws std::runtime_error Nas mesmas condições de undo()
+     * @details Uma mutaçao nova no board descarta o que havia para refazer.
+     */
+    bool redo(const std::string& boardId);
+
+    /// @brief Mutações que undo() pode desfazer no board
+    std::size_t undoCount(const std::string& boardId) const;
+
+    /// @brief Mutações que redo() pode refazer no board
+    std::size_t redoCount(const std::string& boardId) const;
+
+    // ============================================================================
+    // ACESSO CONCORRENTE
+    // ============================================================================
+
+    /**
+     * @brief Executa uma leitura sob o lock compartilhado do board
+     * @param boardId ID do board
+     * @param fn Chamado como fn(const domain::Board&); o resultado é repassado
+     * @throws std::runtime_error Se o board nao existir
+     * @details Mutações concorrentes no mesmo board esperam o término de fn;
+     *          fn nao deve chamar operações de escrita do serviço.
+     */
+    template<typename Fn>
+    auto readBoard(const std::string& boardId, Fn&& fn) const {
+        auto slot = slotFor(boardId);
+        std::shared_lock<std::shared_mutex> lock(slot->mutex);
+        return fn(static_cast<const domain::Board&>(*slot->board));
+    }
+
 private:
     // ============================================================================
-    // REPOSITÓRIOS DE PERSISTÊNCIA
+    // ARMAZENAMENTO CONCORRENTE
     // ============================================================================
 
-    /// @brief Repositório para armazenamento de boards em memória
-    persistence::MemoryRepository<domain::Board> boardRepository_;
-    
-    /// @brief Repositório para armazenamento de columns em memória
-    persistence::MemoryRepository<domain::Column> columnRepository_;
-    
-    /// @brief Repositório para armazenamento de cards em memória
-    persistence::MemoryRepository<domain::Card> cardRepository_;
-    
+    /**
+     * @brief Observador dos cards de um board: mantém os índices de texto
+     *        e de trigramas (globais) e os índices de completamento e de
+     *        urgência do board
+     */
+    class CardIndexer : public interfaces::ICardObserver,
+                        public std::enable_shared_from_this<CardIndexer> {
+    public:
+        CardIndexer(KanbanService& service, std::string boardId, std::shared_ptr<domain::TextIndex> textIndex,
+                    std::shared_ptr<domain::FuzzyIndex> fuzzyIndex);
+
+        /// @brief Registra-se como observador do card e o indexa
+        void add(const std::shared_ptr<domain::Card>& card);
+
+        void onCardTextChanged(const domain::Card& card) override;
+        void onCardUpdated(const domain::Card& card) override;
+        void onCardIdChanged(const domain::Card& card, const std::string& previousId) override;
+
+        /// @brief Projeções avisadas das alterações de prioridade e tags
+        void setReadModel(std::shared_ptr<ReadModel> readModel) { readModel_ = std::move(readModel); }
+
+        const domain::CompletionIndex& completions() const noexcept { return completions_; }
+        const domain::PriorityIndex& priorities() const noexcept { return priorities_; }
+
+        /// @brief Alterações de cards notificadas até agora (invalida a CardTable em cache)
+        std::uint64_t changes() const noexcept { return changes_.load(std::memory_order_acquire); }
+
+    private:
+        KanbanService& service_;   ///< @brief Dono do índice de localizaçao (vive mais que o indexador)
+        std::string boardId_;
+        std::shared_ptr<domain::TextIndex> textIndex_;
+        std::shared_ptr<domain::FuzzyIndex> fuzzyIndex_;
+        domain::CompletionIndex completions_;
+        domain::PriorityIndex priorities_;
+        std::shared_ptr<ReadModel> readModel_;
+        std::atomic<std::uint64_t> changes_{0};
+    };
+
+    /// @brief Um board e o lock leitor/escritor que protege sua estrutura
+    struct BoardSlot {
+        std::shared_ptr<domain::Board> board;
+        std::shared_ptr<CardIndexer> indexer;   ///< @brief Observador dos cards do board
+        UndoHistory history;                    ///< @brief Desfazer/refazer (protegido por mutex)
+        mutable std::shared_mutex mutex;
+        std::uint64_t version = 0;              ///< @brief Locks exclusivos adquiridos (ver lockForWrite())
+
+        /// @brief CardTable da última consulta grande e as versões (slot, indexer) em que foi montada
+        mutable std::mutex tableMutex;
+        mutable std::shared_ptr<const domain::CardTable> table;
+        mutable std::uint64_t tableVersion = 0;
+        mutable std::uint64_t tableChanges = 0;
+    };
+
+    /// @brief Snapshot imutável do diretório de boards (ordenado por ID)
+    using BoardDirectory = std::map<std::string, std::shared_ptr<BoardSlot>>;
+
+    /// @brief Coluna indexada com o board ao qual pertence
+    struct ColumnRecord {
+        std::shared_ptr<domain::Column> column;
+        std::string boardId;
+    };
+
+    /// @brief Card indexado com o board e a coluna onde está
+    /// @details Atualizado sob o lock exclusivo do board a cada movimentaçao.
+    ///          A posiçao é a da última escrita sobre o próprio card; mutações
+    ///          em outros cards da coluna podem deslocá-la, por isso é
+    ///          conferida na leitura.
+    struct CardRecord {
+        std::shared_ptr<domain::Card> card;
+        std::string boardId;
+        std::shared_ptr<domain::Column> column;
+        std::size_t position = 0;
+    };
+
+    /// @brief Diretório atual; lido com std::atomic_load, trocado com std::atomic_store
+    std::shared_ptr<const BoardDirectory> boards_;
+
+    /// @brief Serializa os escritores do diretório (copy-on-write)
+    std::mutex boardsWriteMutex_;
+
+    /// @brief Índice global de colunas
+    concurrency::StripedMap<std::string, ColumnRecord> columns_;
+
+    /// @brief Índice global de cards
+    concurrency::StripedMap<std::string, CardRecord> cards_;
+
     /// @brief Repositório para armazenamento de usuários em memória
     persistence::MemoryRepository<domain::User> userRepository_;
 
@@ -204,17 +743,44 @@ private:
     // GERADORES DE ID
     // ============================================================================
 
+    /// @brief Capacidade em memória do ActivityLog de novos boards (0 = ilimitado)
+    std::size_t activityMemoryCapacity_ = 0;
+
+    /// @brief Diretório base dos segmentos de atividades arquivadas
+    std::string activitySpillDirectory_;
+
+    /// @brief Diretório dos arquivos de auditoria (vazio = desativado)
+    std::string activityAuditDirectory_;
+
+    /// @brief Política de fsync da auditoria
+    persistence::FsyncOptions activityAuditOptions_;
+
+    /// @brief Destino das notificações de alteraçao
+    ChangeListener changeListener_;
+
+    /// @brief Log de eventos (nullptr = modo event-sourced desativado)
+    std::shared_ptr<domain::EventStore> events_;
+
+    /// @brief Projeções de leitura (nullptr = desativadas)
+    std::shared_ptr<ReadModel> readModel_;
+
+    /// @brief Índice de texto completo de todos os boards (ver CardIndexer)
+    std::shared_ptr<domain::TextIndex> textIndex_;
+
+    /// @brief Índice de trigramas dos títulos de todos os boards (ver CardIndexer)
+    std::shared_ptr<domain::FuzzyIndex> fuzzyIndex_;
+
     /// @brief Contador sequencial para geraçao de IDs de boards
-    int nextBoardId_;
+    std::atomic<int> nextBoardId_;
     
     /// @brief Contador sequencial para geraçao de IDs de columns
-    int nextColumnId_;
+    std::atomic<int> nextColumnId_;
     
     /// @brief Contador sequencial para geraçao de IDs de cards
-    int nextCardId_;
+    std::atomic<int> nextCardId_;
     
     /// @brief Contador sequencial para geraçao de IDs de usuários
-    int nextUserId_;
+    std::atomic<int> nextUserId_;
 
     // ============================================================================
     // MÉTODOS AUXILIARES PRIVADOS
@@ -261,6 +827,130 @@ private:
      * @throws std::runtime_error Se a coluna nao for encontrada
      */
     void validateColumnExists(const std::string& columnId) const;
+
+    /**
+     * @brief Cria um board com o ActivityLog configurado, ainda fora do diretório
+     */
+    std::shared_ptr<BoardSlot> makeBoardSlot(const std::string& boardId, const std::string& name);
+
+    /**
+     * @brief Localiza o slot (board + lock) de um board
+     * @param boardId ID do board
+     * @return Slot do board no snapshot atual do diretório
+     * @throws std::runtime_error Se o board nao for encontrado
+     */
+    std::shared_ptr<BoardSlot> slotFor(const std::string& boardId) const;
+
+    /**
+     * @brief Adquire o lock exclusivo do board e invalida a CardTable em cache
+     */
+    static std::unique_lock<std::shared_mutex> lockForWrite(BoardSlot& slot);
+
+    /**
+     * @brief CardTable do board, remontada só se o board mudou desde a última
+     * @details Exige o lock compartilhado (ou exclusivo) do board. Alterações
+     *          feitas sob lockForWrite() ou notificadas pelos cards ao
+     *          CardIndexer invalidam a tabela.
+     */
+    static std::shared_ptr<const domain::CardTable> cachedCardTable(const BoardSlot& slot);
+
+    /**
+     * @brief Localiza uma coluna e valida que ela pertence ao board
+     * @param boardId ID do board esperado
+     * @param columnId ID da coluna
+     * @return Coluna encontrada
+     * @throws std::runtime_error Se a coluna nao existir ou pertencer a outro board
+     * @details Garante que o lock do board cubra todas as colunas alteradas.
+     */
+    std::shared_ptr<domain::Column> columnOf(const std::string& boardId, const std::string& columnId) const;
+
+    /**
+     * @brief Registro de um card no índice
+     * @throws std::runtime_error Se o card nao for encontrado
+     */
+    CardRecord cardRecord(const std::string& cardId) const;
+
+    /**
+     * @brief Atualiza a localizaçao de um card no índice
+     * @details Chamado sob o lock exclusivo do board (lock do board antes do
+     *          lock do stripe).
+     */
+    void placeCard(const std::shared_ptr<domain::Card>& card, const std::string& boardId,
+                   const std::shared_ptr<domain::Column>& column, std::size_t position);
+
+    /**
+     * @brief Posiçao de um card na coluna, partindo da posiçao gravada
+     * @return Posiçao atual, ou o tamanho da coluna se o card nao estiver nela
+     */
+    static std::size_t positionIn(const domain::Column& column, const std::string& cardId,
+                                  std::size_t hint) noexcept;
+
+    /**
+     * @brief Leva a entrada de localizaçao de um card reatribuído para o novo ID
+     * @param previousId ID anterior à atribuiçao
+     * @param released Recebe true se previousId era deste card e foi liberado
+     * @return Registro sob o novo ID, ou nullopt se o card nao está no board
+     * @details Se previousId já aponta para outro card (ex.: no meio de um
+     *          std::swap), ele é mantido e o card é procurado nas colunas.
+     */
+    std::optional<CardRecord> relocateRenamedCard(const std::string& boardId, const domain::Card& card,
+                                                  const std::string& previousId, bool& released);
+
+    /// @name Mutações sob o lock exclusivo do board (já adquirido)
+    /// @details Devolvem o estado anterior para o histórico de desfazer:
+    ///          a posiçao de origem do card ou da coluna, ou as tags (ou o
+    ///          conteúdo) antigos.
+    /// @{
+    std::size_t moveCardLocked(BoardSlot& slot, const std::string& boardId, const std::string& cardId,
+                               const std::string& fromColumnId, const std::shared_ptr<domain::Column>& toColumn,
+                               std::size_t toIndex = std::numeric_limits<std::size_t>::max());
+    std::size_t reorderCardLocked(BoardSlot& slot, const std::string& boardId,
+                                  const std::shared_ptr<domain::Column>& column,
+                                  const std::string& cardId, std::size_t newIndex);
+    std::vector<std::string> retagCardLocked(BoardSlot& slot, const std::shared_ptr<domain::Card>& card,
+                                             const std::shared_ptr<domain::Column>& column,
+                                             const std::vector<std::string>& tagNames);
+    CardContent editCardLocked(BoardSlot& slot, const std::shared_ptr<domain::Card>& card,
+                               const std::shared_ptr<domain::Column>& column, const CardContent& content);
+    std::size_t moveColumnLocked(BoardSlot& slot, const std::string& boardId,
+                                 const std::string& columnId, std::size_t toIndex);
+    /// @}
+
+    /**
+     * @brief Aplica o lado "before" (undo) ou "after" (redo) de um delta
+     * @details Chamado sob o lock exclusivo do board.
+     */
+    void applyDelta(BoardSlot& slot, const std::string& boardId, const UndoDelta& delta, bool forward);
+
+    /**
+     * @brief Registra o indexador do board como observador do card e o indexa
+     * @details Chamado fora do lock do board.
+     */
+    void indexCard(const std::string& boardId, const std::shared_ptr<domain::Card>& card);
+
+    /**
+     * @brief Publica o board inteiro (layout e todos os cards) nas projeções
+     * @details Chamado com o board inacessível a outras threads ou sob o seu lock.
+     */
+    void publishBoard(const std::string& boardId, const BoardSlot& slot) const;
+
+    /**
+     * @brief Escalonador das análises e consultas paralelas (ThreadPool::shared())
+     */
+    static concurrency::ThreadPool& scheduler();
+
+    /**
+     * @brief Previsao de entrega dos cards restantes aceitos por plan (nullptr = todos)
+     */
+    domain::DeliveryForecast forecastRemaining(const std::string& boardId,
+                                               const domain::FilterPlan* plan,
+                                               std::size_t historyWeeks,
+                                               std::size_t trials) const;
+
+    /**
+     * @brief Emite a notificaçao de alteraçao, se houver listener
+     */
+    void notifyChanged(const std::string& boardId, std::size_t operations = 1) const;
 };
 
 } // namespace application
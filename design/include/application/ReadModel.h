@@ -0,0 +1,230 @@
+/**
+ * @file ReadModel.h
+ * @brief Declaraçao das projeções de leitura mantidas fora do caminho de escrita
+ * @details O KanbanService publica cada mutaçao como uma ProjectionUpdate
+ *          pequena (layout do board, localizaçao ou conteúdo de um card). Uma
+ *          thread própria (ActorThread) aplica as atualizações a um estado
+ *          incremental e publica, por board, uma BoardProjection imutável:
+ *          contagem por coluna, cards por tag, cards por prioridade e totais.
+ *
+ *          Quem escreve só enfileira: nunca espera a projeçao ser aplicada.
+ *          Quem lê recebe a última projeçao pronta, sem locks do board e sem
+ *          percorrê-lo; o carimbo de versao diz o quanto ela está atrasada.
+ */
+
+#pragma once
+
+#include "../concurrency/ActorThread.h"
+#include "../domain/Board.h"
+#include "../domain/Card.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace kanban {
+namespace application {
+
+// ============================================================================
+// ATUALIZAÇÕES PUBLICADAS PELO SERVIÇO
+// ============================================================================
+
+/**
+ * @brief Tipo de atualizaçao de projeçao
+ */
+enum class ProjectionUpdateKind : std::uint8_t {
+    BoardLayout,    ///< @brief Nome do board e colunas na ordem (criaçao, nova coluna, coluna movida)
+    CardPlaced,     ///< @brief Card criado ou movido: coluna, prioridade e tags atuais
+    CardUpdated,    ///< @brief Prioridade ou tags alteradas; a coluna nao muda
+    CardRemoved     ///< @brief O ID deixou de existir no board (ex.: card reatribuído com outro ID)
+};
+
+/**
+ * @brief Mutaçao publicada para as projeções
+ * @details Carrega o estado resultante (e nao a operaçao), entao aplicar a
+ *          mesma atualizaçao duas vezes nao altera o resultado. O tamanho
+ *          depende apenas do card afetado ou, no layout, do número de colunas.
+ */
+struct ProjectionUpdate {
+    ProjectionUpdateKind kind = ProjectionUpdateKind::BoardLayout;
+    std::string boardId;
+    std::string boardName;                                       ///< @brief BoardLayout
+    std::vector<std::pair<std::string, std::string>> columns;    ///< @brief BoardLayout: (ID, nome) em ordem
+    std::string cardId;                                          ///< @brief CardPlaced, CardUpdated e CardRemoved
+    std::string columnId;                                        ///< @brief CardPlaced
+    int priority = 0;
+    std::vector<std::string> tags;
+
+    static ProjectionUpdate layout(const std::string& boardId, const domain::Board& board);
+    static ProjectionUpdate placed(const std::string& boardId, const domain::Card& card,
+                                   const std::string& columnId);
+    static ProjectionUpdate updated(const std::string& boardId, const domain::Card& card);
+    static ProjectionUpdate removed(const std::string& boardId, const std::string& cardId);
+};
+
+// ============================================================================
+// PROJEÇÕES PUBLICADAS PARA OS LEITORES
+// ============================================================================
+
+/**
+ * @brief Coluna com a sua contagem de cards
+ */
+struct ColumnCount {
+    std::string id;
+    std::string name;
+    std::size_t cards = 0;
+};
+
+/// @brief Lista imutável de IDs de cards, compartilhada entre projeções sucessivas
+using CardIdList = std::shared_ptr<const std::vector<std::string>>;
+
+/**
+ * @brief Projeçao imutável de um board
+ * @details As listas de cards ficam ordenadas por ID. Tags sem cards nao
+ *          aparecem em cardsByTag. Uma lista que nao mudou é a mesma
+ *          (mesmo ponteiro) da projeçao anterior.
+ */
+struct BoardProjection {
+    std::string boardId;
+    std::string name;
+    std::uint64_t version = 0;                                   ///< @brief Última atualizaçao aplicada
+    std::size_t totalCards = 0;
+    std::vector<ColumnCount> columns;                            ///< @brief Na ordem do board
+    std::map<std::string, CardIdList> cardsByTag;
+    std::map<int, CardIdList, std::greater<int>> cardsByPriority;   ///< @brief Maior primeiro
+};
+
+// ============================================================================
+// CLASSE ReadModel
+// ============================================================================
+
+/**
+ * @brief Projeções de leitura atualizadas de forma assíncrona
+ * @details publish() pode ser chamado de qualquer thread; o KanbanService o
+ *          chama sob o lock exclusivo do board, o que mantém as atualizações
+ *          de cada board na ordem das mutações. As atualizações pendentes
+ *          sao aplicadas em rajada por uma única mensagem ao projetor.
+ *
+ *          Exemplo de uso:
+ *          @code
+ *          auto model = std::make_shared<ReadModel>();
+ *          service.useReadModel(model);
+ *          service.moveCard(boardId, cardId, from, to);
+ *          if (auto projection = model->board(boardId)) {
+ *              auto atraso = model->latestVersion(boardId) - projection->version;
+ *          }
+ *          @endcode
+ */
+class ReadModel {
+public:
+    /// @brief Chamado na thread do projetor após publicar a projeçao de um board
+    using Listener = std::function<void(const std::string& boardId, std::uint64_t version)>;
+
+    ReadModel();
+
+    /**
+     * @brief Destrutor - aplica as atualizações pendentes e encerra o projetor
+     */
+    ~ReadModel();
+
+    ReadModel(const ReadModel&) = delete;
+    ReadModel& operator=(const ReadModel&) = delete;
+
+    /**
+     * @brief Enfileira uma atualizaçao (nao bloqueia esperando o projetor)
+     * @return Versao atribuída à atualizaçao no seu board (base 1)
+     */
+    std::uint64_t publish(ProjectionUpdate update);
+
+    /**
+     * @brief Última projeçao publicada do board
+     * @return nullptr se o board ainda nao tiver projeçao
+     */
+    std::shared_ptr<const BoardProjection> board(const std::string& boardId) const;
+
+    /// @brief Versao da atualizaçao mais recente enfileirada para o board (0 se nenhuma)
+    std::uint64_t latestVersion(const std::string& boardId) const;
+
+    /**
+     * @brief Espera a projeçao do board alcançar version
+     * @return false se o tempo esgotar antes
+     */
+    bool waitFor(const std::string& boardId, std::uint64_t version, std::chrono::milliseconds timeout) const;
+
+    /**
+     * @brief Define quem é avisado a cada projeçao publicada
+     * @details Deve ser definido antes do primeiro publish().
+     */
+    void setListener(Listener listener);
+
+private:
+    /// @brief Card como visto pela projeçao
+    struct CardState {
+        std::string columnId;
+        int priority = 0;
+        std::vector<std::string> tags;
+    };
+
+    /// @brief Estado incremental de um board (só tocado pela thread do projetor)
+    struct BoardState {
+        std::string name;
+        std::uint64_t version = 0;
+        std::vector<ColumnCount> columns;
+        std::unordered_map<std::string, CardState> cards;
+        std::map<std::string, std::set<std::string>> byTag;
+        std::map<int, std::set<std::string>, std::greater<int>> byPriority;
+        std::map<std::string, CardIdList> tagLists;                   ///< @brief Já publicadas
+        std::map<int, CardIdList, std::greater<int>> priorityLists;   ///< @brief Já publicadas
+        std::set<std::string> dirtyTags;                              ///< @brief Mudaram desde a última projeçao
+        std::set<int> dirtyPriorities;
+    };
+
+    /// @brief Aplica as atualizações enfileiradas (thread do projetor)
+    void drain();
+
+    /// @brief Aplica uma atualizaçao ao estado do board
+    static void apply(BoardState& state, ProjectionUpdate& update);
+
+    /// @brief Retira o card das listas de tag e prioridade
+    static void unlist(BoardState& state, const std::string& cardId, const CardState& card);
+
+    /// @brief Inclui o card nas listas de tag e prioridade
+    static void list(BoardState& state, const std::string& cardId, const CardState& card);
+
+    /**
+     * @brief Monta a projeçao imutável do estado
+     * @details Só as listas de tag e prioridade alteradas desde a última
+     *          projeçao sao recopiadas; as demais sao compartilhadas. Um card
+     *          movido sem mudar de tags nem de prioridade custa apenas as
+     *          contagens das colunas.
+     */
+    static std::shared_ptr<const BoardProjection> snapshot(const std::string& boardId, BoardState& state);
+
+    // Caixa de entrada: protegida por inboxMutex_
+    mutable std::mutex inboxMutex_;
+    std::vector<std::pair<std::uint64_t, ProjectionUpdate>> inbox_;   ///< @brief (versao, atualizaçao)
+    std::unordered_map<std::string, std::uint64_t> latest_;           ///< @brief Última versao por board
+    bool drainPosted_ = false;                                        ///< @brief Mensagem de drain na fila
+
+    std::unordered_map<std::string, BoardState> states_;              ///< @brief Só na thread do projetor
+
+    // Projeções publicadas: protegidas por publishedMutex_
+    mutable std::mutex publishedMutex_;
+    mutable std::condition_variable publishedChanged_;
+    std::unordered_map<std::string, std::shared_ptr<const BoardProjection>> published_;
+
+    Listener listener_;
+    concurrency::ActorThread projector_;   ///< @brief Último membro: encerrado antes dos demais
+};
+
+} // namespace application
+} // namespace kanban
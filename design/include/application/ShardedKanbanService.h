@@ -0,0 +1,216 @@
+/**
+ * @file ShardedKanbanService.h
+ * @brief Declaraçao do serviço Kanban particionado em atores (shared-nothing)
+ * @details Cada board pertence a exatamente um shard, e cada shard é uma
+ *          ActorThread. As operações do IService viram mensagens enviadas
+ *          ao shard dono do board por uma fila lock-free; os resultados
+ *          voltam como std::future. Board, Column e Card sao tocados por uma
+ *          única thread e dispensam locks.
+ */
+
+#pragma once
+
+#include "../interfaces/IService.h"
+#include "../concurrency/ActorThread.h"
+#include "../concurrency/StripedMap.h"
+#include "../domain/Board.h"
+#include "../domain/Column.h"
+#include "../domain/Card.h"
+#include "../domain/Command.h"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace kanban {
+namespace application {
+
+// ============================================================================
+// CLASSE ShardedKanbanService
+// ============================================================================
+
+/**
+ * @brief Serviço Kanban em que cada board vive em um único shard (ator)
+ * @details Roteamento:
+ *          - boards: hash do ID do board módulo o número de shards;
+ *          - colunas (listCards): tabela columnId -> boardId, preenchida pelo
+ *            shard quando a coluna é criada.
+ *
+ *          As variantes *Async() devolvem futures e permitem ao cliente
+ *          manter várias operações em voo; os métodos do IService sao
+ *          equivalentes síncronos (enviam a mensagem e esperam o future).
+ *          Mensagens para o mesmo board sao executadas na ordem de envio de
+ *          cada cliente.
+ *
+ * @note Os objetos de domínio devolvidos (listBoards, listColumns, ...)
+ *       sao cópias montadas na thread do shard: podem ser lidas de qualquer
+ *       thread, mas nao refletem mutações posteriores e alterá-las nao afeta
+ *       o serviço. Para ler sem copiar use withBoard(), que executa o
+ *       código na thread do shard.
+ */
+class ShardedKanbanService : public interfaces::IService {
+public:
+    /**
+     * @brief Construtor - inicia uma thread por shard
+     * @param shards Número de shards (0 = std::thread::hardware_concurrency())
+     */
+    explicit ShardedKanbanService(std::size_t shards = 0);
+
+    /**
+     * @brief Destrutor - processa as mensagens pendentes e encerra os shards
+     */
+    ~ShardedKanbanService() override;
+
+    ShardedKanbanService(const ShardedKanbanService&) = delete;
+    ShardedKanbanService& operator=(const ShardedKanbanService&) = delete;
+
+    // ============================================================================
+    // OPERAÇÕES ASSÍNCRONAS
+    // ============================================================================
+
+    /**
+     * @brief Cria um board no shard correspondente ao seu ID
+     * @return Future com o ID do board
+     */
+    std::future<std::string> createBoardAsync(const std::string& name);
+
+    /**
+     * @brief Adiciona uma coluna a um board
+     * @return Future com o ID da coluna (ou std::runtime_error se o board nao existir)
+     */
+    std::future<std::string> addColumnAsync(const std::string& boardId, const std::string& columnName);
+
+    /**
+     * @brief Adiciona um card a uma coluna do board
+     * @return Future com o ID do card (ou std::runtime_error se board/coluna nao existirem)
+     */
+    std::future<std::string> addCardAsync(const std::string& boardId,
+                                          const std::string& columnId,
+                                          const std::string& title);
+
+    /**
+     * @brief Move um card entre colunas do board
+     * @return Future concluído após a movimentaçao (ou com a exceçao do domínio)
+     */
+    std::future<void> moveCardAsync(const std::string& boardId,
+                                    const std::string& cardId,
+                                    const std::string& fromColumnId,
+                                    const std::string& toColumnId);
+
+    /**
+     * @brief Aplica um lote de comandos, tudo ou nada
+     * @return Future com os IDs criados por comando (ou com a BatchException)
+     */
+    std::future<std::vector<std::string>> applyBatchAsync(const std::string& boardId,
+                                                          std::vector<domain::Command> commands);
+
+    /**
+     * @brief Colunas de um board (cópias, com os seus cards)
+     */
+    std::future<std::vector<std::shared_ptr<domain::Column>>> listColumnsAsync(const std::string& boardId) const;
+
+    /**
+     * @brief Cards de uma coluna (cópias)
+     */
+    std::future<std::vector<std::shared_ptr<domain::Card>>> listCardsAsync(const std::string& columnId) const;
+
+    /**
+     * @brief Executa código arbitrário na thread do shard dono do board
+     * @param boardId ID do board
+     * @param fn Chamado como fn(domain::Board&) na thread do shard
+     * @return Future com o resultado de fn (ou std::runtime_error se o board nao existir)
+     * @warning fn nao deve esperar por outras operações deste serviço.
+     */
+    template<typename Fn>
+    auto withBoard(const std::string& boardId, Fn&& fn) const {
+        Shard& shard = shardFor(boardId);
+        return shard.actor.ask([&shard, boardId, fn = std::forward<Fn>(fn)]() mutable {
+            return fn(*boardIn(shard.state, boardId));
+        });
+    }
+
+    // ============================================================================
+    // IMPLEMENTAÇaO DA INTERFACE IService (síncrona)
+    // ============================================================================
+
+    /**
+     * @brief Cria o board de exemplo (To Do / Doing / Done com quatro cards)
+     */
+    void createSampleData() override;
+
+    std::string createBoard(const std::string& name) override;
+    std::string addColumn(const std::string& boardId, const std::string& columnName) override;
+    std::string addCard(const std::string& boardId, const std::string& columnId, const std::string& title) override;
+    void moveCard(const std::string& boardId, const std::string& cardId,
+                  const std::string& fromColumnId, const std::string& toColumnId) override;
+
+    /**
+     * @brief Aplica um lote de comandos na thread do shard dono do board
+     * @details Tudo ou nada, com as mesmas regras do KanbanService::applyBatch().
+     */
+    std::vector<std::string> applyBatch(const std::string& boardId,
+                                        const std::vector<domain::Command>& commands) override;
+
+    /**
+     * @brief Todos os boards, em ordem crescente de ID (cópias)
+     * @details Consulta todos os shards em paralelo e junta os resultados.
+     */
+    std::vector<std::shared_ptr<domain::Board>> listBoards() const override;
+
+    std::optional<std::shared_ptr<domain::Board>> findBoard(const std::string& boardId) const override;
+    std::vector<std::shared_ptr<domain::Column>> listColumns(const std::string& boardId) const override;
+    std::vector<std::shared_ptr<domain::Card>> listCards(const std::string& columnId) const override;
+
+    // ============================================================================
+    // INFORMAÇÕES DOS SHARDS
+    // ============================================================================
+
+    /**
+     * @brief Número de shards
+     */
+    std::size_t shardCount() const noexcept;
+
+    /**
+     * @brief Índice do shard dono de um board
+     */
+    std::size_t shardOf(const std::string& boardId) const noexcept;
+
+private:
+    /// @brief Estado de um shard; acessado apenas pela thread do shard
+    struct ShardState {
+        std::unordered_map<std::string, std::shared_ptr<domain::Board>> boards;
+    };
+
+    /// @brief Um shard: a thread-ator e os boards que ela possui
+    struct Shard {
+        ShardState state;                 ///< @brief Declarado antes: destruído depois da thread
+        concurrency::ActorThread actor;
+    };
+
+    /// @brief Shard dono de um board
+    Shard& shardFor(const std::string& boardId) const;
+
+    /**
+     * @brief Busca um board no estado do shard (na thread do shard)
+     * @throws std::runtime_error Se o board nao existir
+     */
+    static std::shared_ptr<domain::Board> boardIn(ShardState& state, const std::string& boardId);
+
+    /**
+     * @brief Board dono de uma coluna, pela tabela de roteamento
+     * @throws std::runtime_error Se a coluna nao existir
+     */
+    std::string boardOfColumn(const std::string& columnId) const;
+
+    std::vector<std::unique_ptr<Shard>> shards_;                              ///< @brief Shards
+    concurrency::StripedMap<std::string, std::string> columnRoutes_;          ///< @brief columnId -> boardId
+
+    std::atomic<int> nextBoardId_{1};    ///< @brief Contador de IDs de boards
+    std::atomic<int> nextColumnId_{1};   ///< @brief Contador de IDs de colunas
+    std::atomic<int> nextCardId_{1};     ///< @brief Contador de IDs de cards
+};
+
+} // namespace application
+} // namespace kanban
@@ -0,0 +1,159 @@
+/**
+ * @file UndoHistory.h
+ * @brief Declaraçao do histórico de desfazer/refazer de um board
+ * @details Cada mutaçao desfazível guarda apenas o delta inverso: a coluna e
+ *          a posiçao anteriores de um card movido, a posiçao anterior de uma
+ *          coluna, as tags (ou o conteúdo editável) anteriores de um card. O
+ *          tamanho de cada entrada nao depende do tamanho do board.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kanban {
+namespace application {
+
+/**
+ * @brief Tipo de mutaçao registrada no histórico
+ */
+enum class UndoKind : std::uint8_t {
+    CardMoved,          ///< @brief Card entre colunas
+    CardReordered,      ///< @brief Card dentro da coluna
+    ColumnMoved,        ///< @brief Coluna dentro do board
+    CardTagsUpdated,    ///< @brief Tags do card substituídas
+    CardEdited          ///< @brief Título, descriçao, prioridade e tags editados juntos
+};
+
+/**
+ * @brief Conteúdo editável de um card (CardEdited)
+ */
+struct CardContent {
+    std::string title;
+    std::string description;
+    int priority = 0;
+    std::vector<std::string> tags;
+
+    bool operator==(const CardContent& other) const {
+        return priority == other.priority && title == other.title &&
+               description == other.description && tags == other.tags;
+    }
+    bool operator!=(const CardContent& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Estado antes e depois de uma mutaçao
+ * @details "before" é aplicado por undo() e "after" por redo(). Campos nao
+ *          usados pelo tipo ficam vazios.
+ */
+struct UndoDelta {
+    UndoKind kind = UndoKind::CardMoved;
+    std::string id;                         ///< @brief Card ou coluna (ColumnMoved) alterado
+    std::string beforeColumn;               ///< @brief Coluna anterior do card
+    std::string afterColumn;                ///< @brief Coluna do card após a mutaçao
+    std::size_t beforeIndex = 0;            ///< @brief Posiçao anterior
+    std::size_t afterIndex = 0;             ///< @brief Posiçao após a mutaçao
+    std::vector<std::string> beforeTags;    ///< @brief Tags anteriores (CardTagsUpdated)
+    std::vector<std::string> afterTags;     ///< @brief Tags novas (CardTagsUpdated)
+    CardContent beforeContent;              ///< @brief Conteúdo anterior (CardEdited)
+    CardContent afterContent;               ///< @brief Conteúdo editado (CardEdited)
+
+    static UndoDelta cardMoved(const std::string& cardId, const std::string& fromColumnId, std::size_t fromIndex,
+                               const std::string& toColumnId, std::size_t toIndex) {
+        UndoDelta d;
+        d.kind = UndoKind::CardMoved;
+        d.id = cardId;
+        d.beforeColumn = fromColumnId;
+        d.afterColumn = toColumnId;
+        d.beforeIndex = fromIndex;
+        d.afterIndex = toIndex;
+        return d;
+    }
+
+    static UndoDelta cardReordered(const std::string& cardId, const std::string& columnId,
+                                   std::size_t fromIndex, std::size_t toIndex) {
+        UndoDelta d = cardMoved(cardId, columnId, fromIndex, columnId, toIndex);
+        d.kind = UndoKind::CardReordered;
+        return d;
+    }
+
+    static UndoDelta columnMoved(const std::string& columnId, std::size_t fromIndex, std::size_t toIndex) {
+        UndoDelta d;
+        d.kind = UndoKind::ColumnMoved;
+        d.id = columnId;
+        d.beforeIndex = fromIndex;
+        d.afterIndex = toIndex;
+        return d;
+    }
+
+    static UndoDelta cardTagsUpdated(const std::string& cardId, std::vector<std::string> previousTags,
+                                     std::vector<std::string> tags) {
+        UndoDelta d;
+        d.kind = UndoKind::CardTagsUpdated;
+        d.id = cardId;
+        d.beforeTags = std::move(previousTags);
+        d.afterTags = std::move(tags);
+        return d;
+    }
+
+    static UndoDelta cardEdited(const std::string& cardId, CardContent previous, CardContent content) {
+        UndoDelta d;
+        d.kind = UndoKind::CardEdited;
+        d.id = cardId;
+        d.beforeContent = std::move(previous);
+        d.afterContent = std::move(content);
+        return d;
+    }
+};
+
+// ============================================================================
+// CLASSE UndoHistory
+// ============================================================================
+
+/**
+ * @brief Pilhas de desfazer e refazer com profundidade limitada
+ * @details Nao é sincronizada: o KanbanService guarda uma por board e a
+ *          acessa sob o lock exclusivo do board.
+ */
+class UndoHistory {
+public:
+    /// @brief Profundidade padrao (entradas mais antigas sao descartadas)
+    static constexpr std::size_t kDefaultDepth = 256;
+
+    explicit UndoHistory(std::size_t depth = kDefaultDepth) noexcept;
+
+    /// @brief Registra uma mutaçao nova (descarta o que havia para refazer)
+    void record(UndoDelta delta);
+
+    /// @brief Retira a mutaçao mais recente a desfazer
+    std::optional<UndoDelta> takeUndo();
+
+    /// @brief Retira a mutaçao mais recente a refazer
+    std::optional<UndoDelta> takeRedo();
+
+    /// @brief Guarda uma mutaçao desfeita para refazer
+    void pushRedo(UndoDelta delta);
+
+    /// @brief Guarda uma mutaçao refeita para desfazer (sem limpar a pilha de refazer)
+    void pushUndo(UndoDelta delta);
+
+    std::size_t undoCount() const noexcept { return undo_.size(); }
+    std::size_t redoCount() const noexcept { return redo_.size(); }
+
+    /// @brief Esvazia as duas pilhas
+    void clear() noexcept;
+
+private:
+    std::size_t depth_;
+    std::deque<UndoDelta> undo_;   ///< @brief Mais recente no fim
+    std::deque<UndoDelta> redo_;   ///< @brief Mais recente no fim
+};
+
+} // namespace application
+} // namespace kanban
@@ -0,0 +1,120 @@
+/**
+ * @file ActorThread.h
+ * @brief Declaraçao da thread-ator com caixa de mensagens lock-free
+ * @details Uma ActorThread é dona de uma única thread que executa, em ordem,
+ *          as mensagens (funções) recebidas pela sua caixa de entrada. Todo
+ *          estado acessado apenas por mensagens de um mesmo ator dispensa
+ *          locks: só existe uma thread tocando nele.
+ */
+
+#pragma once
+
+#include "MpmcQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace kanban {
+namespace concurrency {
+
+// ============================================================================
+// CLASSE ActorThread
+// ============================================================================
+
+/**
+ * @brief Thread única que processa mensagens de uma fila lock-free
+ * @details Produtores publicam com post() ou ask() (que devolve um
+ *          std::future com o resultado ou a exceçao da mensagem). A thread
+ *          processa as mensagens na ordem de chegada; quando a caixa fica
+ *          vazia, gira brevemente e depois dorme até a próxima mensagem.
+ *
+ *          Exemplo de uso:
+ *          @code
+ *          ActorThread actor;
+ *          std::future<int> answer = actor.ask([] { return 42; });
+ *          answer.get();
+ *          @endcode
+ *
+ * @warning Uma mensagem nunca deve esperar (future::get) por outra mensagem
+ *          do mesmo ator: isso bloqueia a thread para sempre.
+ */
+class ActorThread {
+public:
+    /// @brief Capacidade padrao da caixa de mensagens
+    static constexpr std::size_t kDefaultMailboxCapacity = 4096;
+
+    /**
+     * @brief Construtor - inicia a thread do ator
+     * @param mailboxCapacity Capacidade da caixa (potência de dois)
+     * @throws std::invalid_argument Se a capacidade nao for potência de dois
+     */
+    explicit ActorThread(std::size_t mailboxCapacity = kDefaultMailboxCapacity);
+
+    /**
+     * @brief Destrutor - equivale a stop()
+     */
+    ~ActorThread();
+
+    ActorThread(const ActorThread&) = delete;
+    ActorThread& operator=(const ActorThread&) = delete;
+
+    /**
+     * @brief Publica uma mensagem sem esperar pelo resultado
+     * @param message Funçao executada na thread do ator
+     * @details Com a caixa cheia, o produtor cede a CPU até haver espaço
+     *          (contrapressao). Exceções lançadas pela mensagem sao descartadas.
+     */
+    void post(std::function<void()> message);
+
+    /**
+     * @brief Publica uma mensagem e devolve um future com o seu resultado
+     * @param fn Funçao sem argumentos executada na thread do ator
+     * @return Future com o valor de retorno de fn ou a exceçao lançada
+     */
+    template<typename Fn>
+    auto ask(Fn&& fn) -> std::future<std::invoke_result_t<std::decay_t<Fn>>> {
+        using Result = std::invoke_result_t<std::decay_t<Fn>>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+        auto future = task->get_future();
+        post([task] { (*task)(); });
+        return future;
+    }
+
+    /**
+     * @brief Processa as mensagens pendentes e encerra a thread
+     * @details Idempotente. Mensagens publicadas depois de stop() nao sao executadas.
+     */
+    void stop();
+
+    /**
+     * @brief Verifica se o chamador está na thread do ator
+     */
+    bool isCurrentThread() const noexcept;
+
+    /**
+     * @brief Número de mensagens já processadas
+     */
+    std::uint64_t processed() const noexcept;
+
+private:
+    /// @brief Laço da thread do ator
+    void run();
+
+    BoundedMpmcQueue<std::function<void()>> mailbox_;   ///< @brief Caixa de mensagens
+    std::mutex sleepMutex_;                             ///< @brief Protege a espera da thread ociosa
+    std::condition_variable wake_;                      ///< @brief Acorda a thread ociosa
+    std::atomic<bool> sleeping_{false};                 ///< @brief Thread dormindo em wake_
+    std::atomic<bool> stopping_{false};                 ///< @brief stop() em andamento
+    std::atomic<std::uint64_t> processed_{0};           ///< @brief Mensagens processadas
+    std::thread thread_;                                ///< @brief Thread do ator
+};
+
+} // namespace concurrency
+} // namespace kanban
@@ -0,0 +1,177 @@
+/**
+ * @file MpmcQueue.h
+ * @brief Declaraçao e implementaçao da fila limitada lock-free MPMC
+ * @details Fila de múltiplos produtores e múltiplos consumidores baseada em
+ *          um anel de células com número de sequência (algoritmo de Vyukov).
+ *          Cada operaçao faz um único compare-and-swap no contador de posiçao
+ *          correspondente; produtores e consumidores nunca bloqueiam.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kanban {
+namespace concurrency {
+
+/// @brief Tamanho assumido da linha de cache, usado para evitar false sharing
+constexpr std::size_t kCacheLineSize = 64;
+
+// ============================================================================
+// CLASSE BoundedMpmcQueue
+// ============================================================================
+
+/**
+ * @brief Fila circular limitada, lock-free, para múltiplos produtores e consumidores
+ * @tparam T Tipo dos elementos (deve ser move-constructible)
+ * @details Cada célula guarda um número de sequência que indica se ela está
+ *          livre para o produtor da posiçao p (seq == p) ou pronta para o
+ *          consumidor da posiçao p (seq == p + 1). Os contadores de
+ *          enfileiramento e desenfileiramento ficam em linhas de cache
+ *          separadas.
+ *
+ *          Exemplo de uso:
+ *          @code
+ *          BoundedMpmcQueue<int> queue(1024);
+ *          queue.tryPush(42);
+ *          int value;
+ *          if (queue.tryPop(value)) { ... }
+ *          @endcode
+ *
+ * @note tryPush() retorna false quando a fila está cheia; a política de
+ *       contrapressao fica a cargo do chamador.
+ */
+template<typename T>
+class BoundedMpmcQueue {
+public:
+    /**
+     * @brief Construtor da fila
+     * @param capacity Número de células (deve ser potência de dois, >= 2)
+     * @throws std::invalid_argument Se a capacidade nao for potência de dois
+     */
+    explicit BoundedMpmcQueue(std::size_t capacity)
+        : cells_(capacity), mask_(capacity - 1) {
+        if (capacity < 2 || (capacity & (capacity - 1)) != 0) {
+            throw std::invalid_argument("BoundedMpmcQueue: capacidade deve ser potência de dois");
+        }
+        for (std::size_t i = 0; i < capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Destrutor - destrói os elementos ainda enfileirados
+     */
+    ~BoundedMpmcQueue() {
+        const std::size_t end = enqueuePos_.load(std::memory_order_relaxed);
+        for (std::size_t pos = dequeuePos_.load(std::memory_order_relaxed); pos != end; ++pos) {
+            Cell& cell = cells_[pos & mask_];
+            if (cell.sequence.load(std::memory_order_relaxed) == pos + 1) {
+                std::launder(reinterpret_cast<T*>(&cell.storage))->~T();
+            }
+        }
+    }
+
+    BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+    BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+    /**
+     * @brief Tenta enfileirar um elemento
+     * @param value Elemento a ser movido para a fila
+     * @return true se enfileirado, false se a fila estava cheia
+     */
+    bool tryPush(T&& value) {
+        Cell* cell;
+        std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // cheia
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        new (&cell->storage) T(std::move(value));
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Sobrecarga por cópia de tryPush()
+    bool tryPush(const T& value) {
+        T copy(value);
+        return tryPush(std::move(copy));
+    }
+
+    /**
+     * @brief Tenta desenfileirar um elemento
+     * @param out Recebe o elemento removido
+     * @return true se um elemento foi removido, false se a fila estava vazia
+     */
+    bool tryPop(T& out) {
+        Cell* cell;
+        std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // vazia
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        T* item = std::launder(reinterpret_cast<T*>(&cell->storage));
+        out = std::move(*item);
+        item->~T();
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Número aproximado de elementos na fila
+     * @details Leitura instantânea e nao sincronizada; útil apenas como heurística.
+     */
+    std::size_t sizeApprox() const noexcept {
+        std::size_t enq = enqueuePos_.load(std::memory_order_relaxed);
+        std::size_t deq = dequeuePos_.load(std::memory_order_relaxed);
+        return enq > deq ? enq - deq : 0;
+    }
+
+    /**
+     * @brief Capacidade da fila
+     */
+    std::size_t capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+private:
+    /// @brief Célula do anel: número de sequência e armazenamento do elemento
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    };
+
+    std::vector<Cell> cells_;                                     ///< @brief Anel de células
+    const std::size_t mask_;                                      ///< @brief capacity - 1
+    alignas(kCacheLineSize) std::atomic<std::size_t> enqueuePos_{0}; ///< @brief Próxima posiçao de escrita
+    alignas(kCacheLineSize) std::atomic<std::size_t> dequeuePos_{0}; ///< @brief Próxima posiçao de leitura
+};
+
+} // namespace concurrency
+} // namespace kanban
@@ -0,0 +1,172 @@
+/**
+ * @file StripedMap.h
+ * @brief Declaraçao e implementaçao do mapa hash com travamento por faixas
+ * @details As chaves sao distribuídas por hash entre várias faixas
+ *          independentes, cada uma com seu próprio std::shared_mutex. Threads
+ *          que acessam chaves de faixas diferentes nunca disputam o mesmo lock.
+ */
+
+#pragma once
+
+#include "MpmcQueue.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace kanban {
+namespace concurrency {
+
+// ============================================================================
+// CLASSE StripedMap
+// ============================================================================
+
+/**
+ * @brief Mapa hash thread-safe com lock striping
+ * @tparam K Tipo da chave
+ * @tparam V Tipo do valor (copiado nas leituras; use shared_ptr para objetos grandes)
+ * @tparam Hash Funçao de hash das chaves
+ * @details Leituras tomam o lock compartilhado da faixa; escritas, o lock
+ *          exclusivo. Cada faixa ocupa linhas de cache próprias para evitar
+ *          false sharing entre os mutexes.
+ *
+ *          Exemplo de uso:
+ *          @code
+ *          StripedMap<std::string, int> map;
+ *          map.insert("a", 1);
+ *          if (auto v = map.find("a")) { ... }
+ *          @endcode
+ */
+template<typename K, typename V, typename Hash = std::hash<K>>
+class StripedMap {
+public:
+    /// @brief Número padrao de faixas
+    static constexpr std::size_t kDefaultStripes = 64;
+
+    /**
+     * @brief Construtor do mapa
+     * @param stripes Número de faixas (deve ser potência de dois)
+     * @throws std::invalid_argument Se stripes nao for potência de dois
+     */
+    explicit StripedMap(std::size_t stripes = kDefaultStripes)
+        : stripes_(new Stripe[stripes]), mask_(stripes - 1) {
+        if (stripes == 0 || (stripes & (stripes - 1)) != 0) {
+            throw std::invalid_argument("StripedMap: número de faixas deve ser potência de dois");
+        }
+    }
+
+    StripedMap(const StripedMap&) = delete;
+    StripedMap& operator=(const StripedMap&) = delete;
+
+    /**
+     * @brief Insere um par chave/valor
+     * @return false se a chave já existia (o valor existente é preservado)
+     */
+    bool insert(const K& key, V value) {
+        Stripe& stripe = stripeFor(key);
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+        return stripe.items.emplace(key, std::move(value)).second;
+    }
+
+    /**
+     * @brief Insere ou substitui o valor de uma chave
+     */
+    void assign(const K& key, V value) {
+        Stripe& stripe = stripeFor(key);
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+        stripe.items[key] = std::move(value);
+    }
+
+    /**
+     * @brief Busca o valor de uma chave
+     * @return Cópia do valor, ou std::nullopt se a chave nao existir
+     */
+    std::optional<V> find(const K& key) const {
+        const Stripe& stripe = stripeFor(key);
+        std::shared_lock<std::shared_mutex> lock(stripe.mutex);
+        auto it = stripe.items.find(key);
+        if (it == stripe.items.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Verifica se a chave existe
+     */
+    bool contains(const K& key) const {
+        const Stripe& stripe = stripeFor(key);
+        std::shared_lock<std::shared_mutex> lock(stripe.mutex);
+        return stripe.items.count(key) > 0;
+    }
+
+    /**
+     * @brief Remove uma chave
+     * @return true se a chave existia
+     */
+    bool erase(const K& key) {
+        Stripe& stripe = stripeFor(key);
+        std::unique_lock<std::shared_mutex> lock(stripe.mutex);
+        return stripe.items.erase(key) > 0;
+    }
+
+    /**
+     * @brief Número de chaves (soma das faixas; aproximado sob concorrência)
+     */
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            std::shared_lock<std::shared_mutex> lock(stripes_[i].mutex);
+            total += stripes_[i].items.size();
+        }
+        return total;
+    }
+
+    /**
+     * @brief Remove todas as chaves
+     */
+    void clear() {
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            std::unique_lock<std::shared_mutex> lock(stripes_[i].mutex);
+            stripes_[i].items.clear();
+        }
+    }
+
+    /**
+     * @brief Visita todos os pares, uma faixa por vez
+     * @param visit Chamado como visit(const K&, const V&) sob o lock compartilhado da faixa
+     * @details Nao é um snapshot atômico do mapa inteiro; o visitante nao deve
+     *          acessar o próprio mapa.
+     */
+    template<typename Fn>
+    void forEach(Fn&& visit) const {
+        for (std::size_t i = 0; i <= mask_; ++i) {
+            std::shared_lock<std::shared_mutex> lock(stripes_[i].mutex);
+            for (const auto& [key, value] : stripes_[i].items) {
+                visit(key, value);
+            }
+        }
+    }
+
+private:
+    /// @brief Uma faixa: mutex próprio e a parte correspondente das chaves
+    struct alignas(kCacheLineSize) Stripe {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<K, V, Hash> items;
+    };
+
+    Stripe& stripeFor(const K& key) const {
+        return stripes_[Hash{}(key) & mask_];
+    }
+
+    std::unique_ptr<Stripe[]> stripes_;   ///< @brief Faixas
+    std::size_t mask_;                    ///< @brief stripes - 1
+};
+
+} // namespace concurrency
+} // namespace kanban
@@ -0,0 +1,250 @@
+/**
+ * @file ThreadPool.h
+ * @brief Declaraçao do escalonador de tarefas com roubo de trabalho
+ * @details Um número fixo de threads executa tarefas independentes em
+ *          paralelo. Ao contrário da ActorThread (uma thread, mensagens em
+ *          ordem), o pool é o lugar para particionar um cálculo grande (ex.:
+ *          o fluxo cumulativo de um board por intervalos de tempo, uma
+ *          consulta sobre um board com muitos cards) e juntar os resultados.
+ *
+ *          Cada thread tem a sua própria fila (deque):
+ *          - tarefas criadas dentro de uma tarefa vao para o fim da fila da
+ *            thread que as criou e sao retomadas por ela em ordem LIFO, com
+ *            os dados ainda no cache;
+ *          - tarefas enviadas de fora do pool sao distribuídas entre as filas
+ *            em rodízio;
+ *          - uma thread sem trabalho rouba do início da fila de outra.
+ *
+ *          TaskGroup agrupa tarefas relacionadas: espera por todas (ajudando
+ *          a executar tarefas pendentes enquanto isso), propaga a primeira
+ *          exceçao e permite cancelar as que ainda nao começaram.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace kanban {
+namespace concurrency {
+
+// ============================================================================
+// CLASSE ThreadPool
+// ============================================================================
+
+/**
+ * @brief Pool de threads de tamanho fixo com filas por thread e roubo de trabalho
+ * @details Exemplo de uso:
+ *          @code
+ *          ThreadPool& pool = ThreadPool::shared();
+ *          std::future<int> parcial = pool.submit([] { return 42; });
+ *          parcial.get();
+ *          @endcode
+ *
+ * @warning Uma tarefa nao deve bloquear em future::get() esperando outra
+ *          tarefa do mesmo pool; use TaskGroup::wait(), que executa tarefas
+ *          pendentes enquanto espera.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Instrumentaçao de uma thread do pool
+     */
+    struct WorkerStats {
+        std::uint64_t executed = 0;         ///< @brief Tarefas iniciadas pela thread
+        std::uint64_t steals = 0;           ///< @brief Tarefas roubadas da fila de outra thread
+        std::chrono::nanoseconds busy{0};   ///< @brief Tempo gasto executando tarefas
+        double utilization = 0.0;           ///< @brief busy / tempo de vida do pool (0 a 1)
+    };
+
+    /**
+     * @brief Construtor - inicia as threads
+     * @param threads Número de threads (0 = std::thread::hardware_concurrency())
+     */
+    explicit ThreadPool(std::size_t threads = 0);
+
+    /**
+     * @brief Destrutor - executa as tarefas pendentes e encerra as threads
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Pool compartilhado pelo processo, criado no primeiro uso
+     * @details Análises, filtros e demais trabalhos paralelos da aplicaçao
+     *          usam este pool em vez de criar threads próprias.
+     */
+    static ThreadPool& shared();
+
+    /**
+     * @brief Enfileira uma tarefa e devolve um future com o seu resultado
+     * @param fn Funçao sem argumentos executada em alguma thread do pool
+     * @return Future com o valor de retorno de fn ou a exceçao lançada
+     */
+    template<typename Fn>
+    auto submit(Fn&& fn) -> std::future<std::invoke_result_t<std::decay_t<Fn>>> {
+        using Result = std::invoke_result_t<std::decay_t<Fn>>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+        auto future = task->get_future();
+        enqueue([task] { (*task)(); });
+        return future;
+    }
+
+    /**
+     * @brief Executa na thread chamadora uma tarefa pendente, se houver
+     * @return false se todas as filas estavam vazias
+     * @details Usado por quem espera resultados do pool (TaskGroup::wait())
+     *          para ajudar em vez de ficar parado.
+     */
+    bool runPending();
+
+    /// @brief Número de threads do pool
+    std::size_t size() const noexcept { return workers_.size(); }
+
+    /// @brief Contadores de cada thread, na ordem das threads
+    std::vector<WorkerStats> stats() const;
+
+private:
+    friend class TaskGroup;
+
+    using Task = std::function<void()>;
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Fila e contadores de uma thread
+    struct Worker {
+        std::mutex mutex;                               ///< @brief Protege tasks
+        std::deque<Task> tasks;                         ///< @brief Dona: fim (LIFO); ladrões: início
+        std::atomic<std::uint64_t> executed{0};
+        std::atomic<std::uint64_t> steals{0};
+        std::atomic<std::uint64_t> busyNs{0};
+        std::thread thread;
+    };
+
+    /// @brief Enfileira: na fila da thread atual, se for do pool; senao em rodízio
+    void enqueue(Task task);
+
+    /**
+     * @brief Retira uma tarefa: da própria fila (self < size()) ou roubando
+     * @param self Índice da thread, ou size() para threads de fora do pool
+     */
+    bool take(std::size_t self, Task& task);
+
+    /// @brief Executa a tarefa contabilizando-a na thread self
+    void execute(std::size_t self, Task& task);
+
+    /// @brief Índice da thread atual neste pool, ou size() se for de fora
+    std::size_t currentIndex() const noexcept;
+
+    void run(std::size_t index);
+
+    std::vector<std::unique_ptr<Worker>> workers_;     ///< @brief Filas e threads
+    std::atomic<std::size_t> queued_{0};                ///< @brief Tarefas nas filas
+    std::atomic<std::size_t> nextQueue_{0};             ///< @brief Rodízio dos envios externos
+    std::mutex sleepMutex_;                             ///< @brief Protege stopping_ e a espera
+    std::condition_variable ready_;                     ///< @brief Acorda threads ociosas
+    bool stopping_ = false;                             ///< @brief Destrutor em andamento
+    Clock::time_point started_;                         ///< @brief Base da utilizaçao
+};
+
+// ============================================================================
+// CLASSE TaskGroup
+// ============================================================================
+
+/**
+ * @brief Conjunto de tarefas com espera conjunta e cancelamento
+ * @details Exemplo de uso:
+ *          @code
+ *          TaskGroup group(ThreadPool::shared());
+ *          for (auto& parte : partes) {
+ *              group.run([&parte] { processar(parte); });
+ *          }
+ *          group.wait();   // relança a primeira exceçao
+ *          @endcode
+ *
+ *          Uma exceçao em qualquer tarefa cancela as demais. Tarefas
+ *          canceladas antes de começar nao executam; as que já estao em
+ *          execuçao podem consultar cancelled() para terminar mais cedo.
+ *          O destrutor espera as tarefas restantes (sem relançar).
+ */
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool);
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /**
+     * @brief Envia uma tarefa do grupo ao pool
+     * @param fn Funçao sem argumentos e sem retorno
+     */
+    template<typename Fn>
+    void run(Fn&& fn) {
+        state_->pending.fetch_add(1, std::memory_order_relaxed);
+        pool_.enqueue([state = state_, fn = std::forward<Fn>(fn)]() mutable {
+            if (!state->cancelled.load(std::memory_order_relaxed)) {
+                try {
+                    fn();
+                } catch (...) {
+                    state->fail(std::current_exception());
+                }
+            }
+            state->finish();
+        });
+    }
+
+    /**
+     * @brief Espera todas as tarefas do grupo
+     * @throws A primeira exceçao lançada por uma tarefa do grupo
+     * @details Enquanto houver tarefas pendentes no pool, a thread chamadora
+     *          as executa; assim uma tarefa pode esperar um subgrupo sem
+     *          bloquear uma thread do pool.
+     * @warning As tarefas executadas ao ajudar podem ser de outros grupos.
+     *          Quem espera segurando um lock nao deve dividir o pool com
+     *          tarefas que tomam esse mesmo lock.
+     */
+    void wait();
+
+    /// @brief Cancela as tarefas que ainda nao começaram
+    void cancel() noexcept { state_->cancelled.store(true, std::memory_order_relaxed); }
+
+    /// @brief Se o grupo foi cancelado (explicitamente ou por uma exceçao)
+    bool cancelled() const noexcept { return state_->cancelled.load(std::memory_order_relaxed); }
+
+private:
+    /// @brief Estado compartilhado com as tarefas enfileiradas
+    struct State {
+        std::atomic<std::size_t> pending{0};
+        std::atomic<bool> cancelled{false};
+        std::mutex mutex;                   ///< @brief Protege error e a espera
+        std::condition_variable done;
+        std::exception_ptr error;
+
+        void fail(std::exception_ptr e);
+        void finish();
+    };
+
+    /// @brief Espera sem relançar
+    void join();
+
+    ThreadPool& pool_;
+    std::shared_ptr<State> state_;
+};
+
+} // namespace concurrency
+} // namespace kanban
@@ -4,13 +4,35 @@
  * @details Este header define o sistema de logging de atividades do Kanban,
  *          permitindo rastrear todas as ações significativas realizadas no sistema
  *          como movimentaçao de cards, criaçao de entidades, etc.
+ *
+ *          As atividades sao registros tipados e compactos (tipo, handles de
+ *          card/colunas, índice e timestamp HLC). O texto legível é gerado
+ *          apenas quando uma view o solicita, através de ActivityLog::describe()
+ *          ou Board::describe().
  */
 
 #pragma once
 
+#include "HybridClock.h"
+#include "../concurrency/MpmcQueue.h"
+#include "../interfaces/IActivityArchive.h"
+#include "../interfaces/IActivitySink.h"
 #include <string>
 #include <vector>
+#include <deque>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <ostream>
 
@@ -24,16 +46,53 @@ namespace domain {
  */
 using TimePoint = std::chrono::system_clock::time_point;
 
+/**
+ * @brief Handle compacto para uma string internada no ActivityLog
+ * @details IDs de cards e colunas (e textos livres) sao armazenados uma única
+ *          vez no dicionário do log; as atividades guardam apenas o handle.
+ */
+using ActivityHandle = std::uint32_t;
+
+/// @brief Valor sentinela para handles ausentes
+constexpr ActivityHandle kNoActivityHandle = std::numeric_limits<ActivityHandle>::max();
+
+/**
+ * @brief Tipos de atividade registráveis
+ */
+enum class ActivityKind : std::uint8_t {
+    Note = 0,         ///< @brief Texto livre (handle do texto em subject)
+    CardMoved,        ///< @brief Card movido entre colunas
+    CardReordered,    ///< @brief Card reposicionado dentro da mesma coluna
+    CardTagsUpdated   ///< @brief Conjunto de tags do card substituído
+};
+
+/// @brief Número de tipos distintos de ActivityKind
+constexpr std::size_t kActivityKindCount = 4;
+
+/**
+ * @brief Nome estável do tipo de atividade (útil para logs e consultas)
+ */
+const char* toString(ActivityKind kind) noexcept;
+
+class ActivityRollup;
+struct RollupPoint;
+enum class RollupGranularity;
+class FlowMetrics;
+struct ColumnFlow;
+struct CardFlow;
+
 // ============================================================================
 // CLASSE Activity
 // ============================================================================
 
 /**
  * @brief Representa uma atividade individual no sistema Kanban
- * @details Registra uma açao específica realizada no sistema (ex.: movimentaçao
- *          de card, criaçao de entidade). Cada atividade possui ID único,
- *          descriçao textual e timestamp preciso.
- * 
+ * @details Registro tipado de uma açao realizada no sistema. Em vez de uma
+ *          descriçao pré-formatada, guarda apenas o tipo do evento, handles
+ *          para o card e as colunas envolvidas, um índice e o timestamp HLC.
+ *          O ID é um número de sequência único atribuído pelo ActivityLog
+ *          no momento da inserçao.
+ *
  *          A classe é designed para ser imutável após criaçao, garantindo
  *          integridade dos registros históricos.
  */
@@ -41,15 +100,50 @@ class Activity {
 public:
     /**
      * @brief Construtor explícito da Activity
-     * @param id Identificador único da atividade
-     * @param description Descriçao textual da açao realizada
-     * @param when Timestamp do momento em que a atividade ocorreu
-     * @details Construtor explícito previne conversões implícitas indesejadas
-     *          e garante que todos os campos essenciais sejam fornecidos.
+     * @param kind Tipo da atividade
+     * @param subject Handle do card (ou do texto, para ActivityKind::Note)
+     * @param fromColumn Handle da coluna de origem (ou kNoActivityHandle)
+     * @param toColumn Handle da coluna de destino (ou kNoActivityHandle)
+     * @param index Posiçao do card na coluna de destino após a açao
+     * @param when Timestamp HLC do momento em que a atividade ocorreu
+     */
+    explicit Activity(ActivityKind kind,
+                      ActivityHandle subject,
+                      ActivityHandle fromColumn,
+                      ActivityHandle toColumn,
+                      std::uint32_t index,
+                      HybridTimestamp when) noexcept;
+
+    // ============================================================================
+    // FÁBRICAS POR TIPO DE EVENTO
+    // ============================================================================
+
+    /// @brief Card movido de fromColumn para toColumn, ocupando a posiçao index
+    static Activity cardMoved(ActivityHandle card, ActivityHandle fromColumn,
+                              ActivityHandle toColumn, std::uint32_t index,
+                              HybridTimestamp when) noexcept;
+
+    /// @brief Card reposicionado para index dentro de column
+    static Activity cardReordered(ActivityHandle card, ActivityHandle column,
+                                  std::uint32_t index, HybridTimestamp when) noexcept;
+
+    /// @brief Tags do card (localizado em column) substituídas
+    static Activity cardTagsUpdated(ActivityHandle card, ActivityHandle column,
+                                    HybridTimestamp when) noexcept;
+
+    /// @brief Nota em texto livre (text é um handle internado)
+    static Activity note(ActivityHandle text, HybridTimestamp when) noexcept;
+
+    /**
+     * @brief Reconstrói uma atividade já sequenciada (ex.: lida de um segmento)
+     * @param id Número de sequência original
+     * @details Destinado à camada de persistência; atividades novas devem
+     *          usar as fábricas acima e receber o ID do ActivityLog.
      */
-    explicit Activity(const std::string& id,
-                      const std::string& description,
-                      TimePoint when) noexcept;
+    static Activity restore(std::uint64_t id, ActivityKind kind,
+                            ActivityHandle subject, ActivityHandle fromColumn,
+                            ActivityHandle toColumn, std::uint32_t index,
+                            HybridTimestamp when) noexcept;
 
     // ============================================================================
     // REGRA DOS CINCO (FIVE RULE)
@@ -57,31 +151,27 @@ public:
 
     /**
      * @brief Construtor de cópia padrao
-     * @details Seguro para std::string e TimePoint - realiza cópia profunda.
+     * @details Todos os membros sao triviais - a cópia é um memcpy.
      */
     Activity(const Activity&) = default;
 
     /**
      * @brief Construtor de movimentaçao padrao
-     * @details Realiza movimentaçao eficiente dos membros da classe.
      */
     Activity(Activity&&) noexcept = default;
 
     /**
      * @brief Operador de atribuiçao por cópia padrao
-     * @details Mantém consistência com o construtor de cópia.
      */
     Activity& operator=(const Activity&) = default;
 
     /**
      * @brief Operador de atribuiçao por movimentaçao padrao
-     * @details Mantém consistência com o construtor de movimentaçao.
      */
     Activity& operator=(Activity&&) noexcept = default;
 
     /**
      * @brief Destrutor padrao
-     * @details Realiza limpeza automática dos recursos.
      */
     ~Activity() = default;
 
@@ -91,20 +181,33 @@ public:
 
     /**
      * @brief Retorna o ID único da atividade
-     * @return Referência constante para o ID da atividade
-     * @details O ID é imutável e serve como identificador único no sistema.
+     * @return Número de sequência atribuído pelo ActivityLog (0 se ainda nao inserida)
      */
-    const std::string& id() const noexcept;
+    std::uint64_t id() const noexcept;
+
+    /// @brief Tipo da atividade
+    ActivityKind kind() const noexcept;
+
+    /// @brief Handle do card (ou do texto livre, em ActivityKind::Note)
+    ActivityHandle subject() const noexcept;
+
+    /// @brief Handle da coluna de origem (kNoActivityHandle se nao se aplica)
+    ActivityHandle fromColumn() const noexcept;
+
+    /// @brief Handle da coluna de destino (kNoActivityHandle se nao se aplica)
+    ActivityHandle toColumn() const noexcept;
+
+    /// @brief Posiçao do card na coluna de destino após a açao
+    std::uint32_t index() const noexcept;
 
     /**
-     * @brief Retorna a descriçao da atividade
-     * @return Referência constante para a descriçao textual
-     * @details A descriçao explica em linguagem natural qual açao foi executada.
+     * @brief Retorna o timestamp HLC da atividade
+     * @details Permite ordenaçao causal precisa, mesmo dentro do mesmo milissegundo.
      */
-    const std::string& description() const noexcept;
+    HybridTimestamp timestamp() const noexcept;
 
     /**
-     * @brief Retorna o timestamp da atividade
+     * @brief Retorna o timestamp da atividade como TimePoint
      * @return TimePoint representando o momento exato da ocorrência
      * @details Permite ordenaçao cronológica precisa das atividades.
      */
@@ -119,15 +222,39 @@ public:
      * @param os Stream de saída onde a atividade será formatada
      * @param a Referência para a atividade a ser formatada
      * @return Referência para a stream de saída
-     * @details Formata a atividade em um formato legível para debug,
-     *          incluindo ID, descriçao e timestamp formatado.
+     * @details Formata os campos brutos (sem resolver handles), útil para debug.
      */
     friend std::ostream& operator<<(std::ostream& os, const Activity& a);
 
 private:
-    std::string id_;           ///< @brief Identificador único da atividade
-    std::string description_;  ///< @brief Descriçao textual da açao realizada
-    TimePoint when_;          ///< @brief Momento exato em que a atividade ocorreu
+    friend class ActivityLog;
+
+    std::uint64_t id_ = 0;          ///< @brief Número de sequência único (atribuído pelo log)
+    HybridTimestamp when_;          ///< @brief Momento HLC em que a atividade ocorreu
+    ActivityHandle subject_;        ///< @brief Card (ou texto livre) envolvido
+    ActivityHandle fromColumn_;     ///< @brief Coluna de origem
+    ActivityHandle toColumn_;       ///< @brief Coluna de destino
+    std::uint32_t index_;           ///< @brief Posiçao resultante do card
+    ActivityKind kind_;             ///< @brief Tipo do evento
+};
+
+// ============================================================================
+// POLÍTICA DE RETENÇaO
+// ============================================================================
+
+/**
+ * @brief Política de retençao do ActivityLog
+ * @details Com memoryCapacity == 0 o log é ilimitado (comportamento original).
+ *          Caso contrário, apenas as memoryCapacity atividades mais recentes
+ *          ficam em memória; ao atingir o limite, as spillBatch mais antigas
+ *          sao entregues ao archive (ou descartadas, se nao houver archive).
+ *          A gravaçao no archive é feita por uma thread de descarga do log:
+ *          até lá o lote continua em memória e visível às consultas.
+ */
+struct ActivityRetention {
+    std::size_t memoryCapacity = 0;   ///< @brief Máximo de atividades em memória (0 = ilimitado)
+    std::size_t spillBatch = 1024;    ///< @brief Atividades descarregadas por vez
+    std::shared_ptr<interfaces::IActivityArchive> archive; ///< @brief Camada fria (opcional)
 };
 
 // ============================================================================
@@ -139,20 +266,55 @@ private:
  * @details Mantém um histórico temporal de todas as atividades realizadas
  *          no sistema. Fornece interface para adiçao, consulta e limpeza
  *          de atividades, garantindo ordenaçao cronológica.
+ *
+ *          Também é dono do dicionário de strings internadas (IDs de cards,
+ *          colunas e textos livres) e do relógio HLC que carimba os eventos.
+ *
+ *          Concorrência: add(), intern() e now() podem ser chamados de várias
+ *          threads. add() apenas enfileira a atividade em uma fila lock-free
+ *          (BoundedMpmcQueue); as atividades pendentes sao publicadas em lote
+ *          no histórico legível (números de sequência, listas de postagem,
+ *          retençao) por publish(), que também é executado automaticamente
+ *          quando a fila acumula kPublishBatch atividades e no início de
+ *          toda leitura. Leituras e publicações sao serializadas por um mutex
+ *          interno que os produtores nunca precisam adquirir.
+ *
+ *          Os lotes descarregados pela retençao sao gravados no archive por
+ *          uma thread de descarga própria: add() e publish() nunca fazem I/O.
  */
 class ActivityLog {
 public:
+    /**
+     * @brief Funçao de resoluçao de nomes usada na renderizaçao de texto
+     * @details Recebe um ID (de card ou coluna) e devolve o nome a exibir.
+     */
+    using NameLookup = std::function<std::string(const std::string& id)>;
+
+    /// @brief Funçao chamada para cada atividade em leituras por streaming
+    using Visitor = std::function<void(const Activity&)>;
+
+    /// @brief Capacidade da fila de atividades pendentes (potência de dois)
+    static constexpr std::size_t kPendingCapacity = 1024;
+
+    /// @brief Quantidade de pendentes a partir da qual um produtor tenta publicar
+    static constexpr std::size_t kPublishBatch = 256;
+
     /**
      * @brief Construtor padrao do ActivityLog
      * @details Inicializa um log vazio, pronto para receber atividades.
      */
-    ActivityLog() = default;
+    ActivityLog();
 
     /**
-     * @brief Destrutor padrao do ActivityLog
-     * @details Realiza limpeza automática de todas as atividades armazenadas.
+     * @brief Destrutor do ActivityLog
+     * @details Fecha o sink configurado e encerra a thread de descarga (ambos
+     *          ainda podem precisar do dicionário para gravar as últimas
+     *          atividades) antes de liberar o restante.
      */
-    ~ActivityLog() = default;
+    ~ActivityLog();
+
+    ActivityLog(const ActivityLog&) = delete;
+    ActivityLog& operator=(const ActivityLog&) = delete;
 
     // ============================================================================
     // MÉTODOS PRINCIPAIS
@@ -161,25 +323,295 @@ public:
     /**
      * @brief Adiciona uma nova atividade ao log
      * @param act Atividade a ser adicionada (recebida por valor para permitir move)
-     * @details Recebe a atividade por valor para permitir movimentaçao eficiente.
+     * @details Thread-safe e lock-free no caso comum: a atividade é
+     *          enfileirada e recebe seu número de sequência único na
+     *          publicaçao. Se a fila estiver cheia, o produtor publica o
+     *          lote pendente antes de tentar novamente.
      *          Exemplos de uso:
      *          @code
-     *          log.add(Activity("id1", "Card movido", now));
-     *          // ou
-     *          Activity a("id2", "Card criado", now);
-     *          log.add(std::move(a));
+     *          log.add(Activity::cardMoved(log.intern("card_1"), log.intern("todo"),
+     *                                      log.intern("doing"), 0, log.now()));
      *          @endcode
      */
     void add(Activity act);
 
+    /**
+     * @brief Registra uma nota em texto livre
+     * @param text Texto da nota (internado no dicionário do log)
+     */
+    void note(const std::string& text);
+
+    /**
+     * @brief Registra um grupo de atividades com números de sequência contíguos
+     * @param group Atividades na ordem desejada (ex.: as mutações de um lote)
+     * @details Publica primeiro as pendentes e depois o grupo inteiro sob um
+     *          único lock, de modo que nenhuma outra atividade se intercala
+     *          entre as do grupo.
+     * @throws std::runtime_error Se uma gravaçao anterior no archive falhou
+     *         (o restante do grupo permanece pendente)
+     */
+    void addGroup(std::vector<Activity> group);
+
+    /**
+     * @brief Publica as atividades pendentes no histórico legível
+     * @return Quantidade de atividades publicadas
+     * @throws std::runtime_error Se uma gravaçao anterior no archive falhou
+     *         (as atividades nao publicadas permanecem pendentes)
+     * @details As pendentes sao ordenadas por timestamp; uma atividade
+     *          carimbada antes da última já publicada (corrida entre
+     *          produtores em lotes diferentes) recebe um novo timestamp,
+     *          preservando a ordem cronológica exigida pelas consultas.
+     */
+    std::size_t publish();
+
     /**
      * @brief Retorna todas as atividades do log
-     * @return Referência constante para o vetor interno de atividades
-     * @details Expõe o vetor interno apenas para leitura, evitando cópia
-     *          desnecessária mas mantendo a imutabilidade do log.
-     *          As atividades sao retornadas em ordem cronológica de inserçao.
+     * @return Cópia das atividades (arquivadas e em memória)
+     * @details As atividades sao retornadas em ordem cronológica de inserçao.
+     *          Em logs com retençao configurada, prefira forEach() ou
+     *          forEachInRange(), que nao materializam o histórico inteiro.
+     */
+    std::vector<Activity> activities() const;
+
+    /**
+     * @brief Percorre todas as atividades em ordem cronológica
+     * @param visit Funçao chamada para cada atividade
+     * @details Lê primeiro os segmentos arquivados, depois os lotes ainda em
+     *          gravaçao e por fim o anel em memória.
+     *          O visitante é chamado com o mutex interno adquirido e nao deve
+     *          consultar ou modificar este log (exceto describe/resolve).
+     */
+    void forEach(const Visitor& visit) const;
+
+    /**
+     * @brief Percorre as atividades com timestamp em [from, to]
+     * @param from Limite inferior (inclusivo)
+     * @param to Limite superior (inclusivo)
+     * @param visit Funçao chamada para cada atividade, em ordem cronológica
+     * @details A leitura é transparente entre a camada arquivada e a memória.
+     */
+    void forEachInRange(HybridTimestamp from, HybridTimestamp to, const Visitor& visit) const;
+
+    // ============================================================================
+    // CONSULTAS INDEXADAS
+    // ============================================================================
+
+    /**
+     * @brief Histórico de um card
+     * @param cardId ID do card
+     * @param limit Se maior que zero, retorna apenas as limit atividades mais recentes
+     * @return Atividades do card em ordem cronológica
+     * @details Usa a lista de postagem do card: O(k) para k resultados, sem
+     *          percorrer o restante do log. As listas cobrem só o anel; o
+     *          histórico arquivado vem do índice de cards dos segmentos, que
+     *          abre apenas os segmentos em que o card aparece.
+     */
+    std::vector<Activity> forCard(const std::string& cardId, std::size_t limit = 0) const;
+
+    /**
+     * @brief Atividades com timestamp em [from, to]
+     * @return Atividades em ordem cronológica
+     * @details Localiza o início do intervalo por busca binária: O(log n + k).
+     */
+    std::vector<Activity> between(HybridTimestamp from, HybridTimestamp to) const;
+
+    /**
+     * @brief Atividades ocorridas entre dois instantes (inclusivo, precisao de ms)
+     */
+    std::vector<Activity> between(TimePoint from, TimePoint to) const;
+
+    /**
+     * @brief As n atividades mais recentes de um tipo
+     * @return Atividades em ordem cronológica (a mais recente por último)
+     * @details Como forCard(): lista de postagem no anel e contagens por
+     *          tipo de cada segmento na camada arquivada.
+     */
+    std::vector<Activity> lastOfKind(ActivityKind kind, std::size_t n) const;
+
+    /**
+     * @brief As n atividades mais recentes do log
+     * @return Atividades em ordem cronológica (a mais recente por último)
+     */
+    std::vector<Activity> recent(std::size_t n) const;
+
+    // ============================================================================
+    // RETENÇaO
+    // ============================================================================
+
+    /**
+     * @brief Configura a política de retençao do log
+     * @param retention Capacidade em memória, tamanho do lote e archive
+     * @details Atividades já presentes que excedam a nova capacidade sao
+     *          descarregadas imediatamente (entregues à thread de descarga).
+     */
+    void setRetention(const ActivityRetention& retention);
+
+    /**
+     * @brief Bloqueia até que os lotes descarregados estejam gravados no archive
+     * @throws std::runtime_error Se a gravaçao de um lote falhou (o lote
+     *         continua em memória e será gravado novamente)
+     * @details Publica antes as pendentes e, após uma falha, pede uma nova
+     *          tentativa. Útil antes de inspecionar o archive diretamente
+     *          (ex.: segmentos em disco).
      */
-    const std::vector<Activity>& activities() const noexcept;
+    void flushArchive();
+
+    /**
+     * @brief Erro da última gravaçao no archive, se ela falhou
+     * @return Mensagem do erro, ou std::nullopt se a última gravaçao teve sucesso
+     * @details add() nunca lança por falha do archive: o lote que falhou
+     *          continua legível em memória e é gravado de novo no próximo
+     *          lote descarregado ou em flushArchive().
+     */
+    std::optional<std::string> spillError() const;
+
+    /**
+     * @brief Retorna a política de retençao atual
+     */
+    const ActivityRetention& retention() const noexcept;
+
+    /**
+     * @brief Número de atividades mantidas em memória
+     */
+    std::size_t inMemorySize() const;
+
+    // ============================================================================
+    // AGREGADOS (ROLLUPS)
+    // ============================================================================
+
+    /**
+     * @brief Série agregada de um tipo de atividade
+     * @param kind Tipo de atividade (ex.: CardMoved)
+     * @param columnId Coluna de interesse, ou string vazia para o board inteiro
+     * @param granularity Hora, dia ou semana
+     * @param from Início do intervalo (inclusivo)
+     * @param to Fim do intervalo (inclusivo)
+     * @return Buckets nao vazios em ordem cronológica
+     * @details Os rollups sao atualizados a cada atividade publicada, inclusive
+     *          as que depois forem arquivadas ou descartadas pela retençao.
+     *          Exemplo - entradas em "Done" por semana:
+     *          @code
+     *          log.rollup(ActivityKind::CardMoved, "column_3", RollupGranularity::Week, inicio, fim);
+     *          @endcode
+     */
+    std::vector<RollupPoint> rollup(ActivityKind kind,
+                                    const std::string& columnId,
+                                    RollupGranularity granularity,
+                                    TimePoint from,
+                                    TimePoint to) const;
+
+    /**
+     * @brief Grava os rollups (para persistir junto aos segmentos do log)
+     */
+    void saveRollups(std::ostream& os) const;
+
+    /**
+     * @brief Soma aos rollups os contadores gravados por saveRollups()
+     * @throws std::runtime_error Se o conteúdo estiver malformado
+     */
+    void loadRollups(std::istream& is);
+
+    // ============================================================================
+    // MÉTRICAS DE FLUXO
+    // ============================================================================
+
+    /**
+     * @brief Registra a criaçao de um card (início do seu lead time)
+     * @param cardId ID do card
+     * @param columnId Coluna em que o card foi criado
+     * @param createdAt Instante de criaçao (Card::createdAt())
+     * @details A criaçao nao é uma atividade do log; quem cria o card informa
+     *          o instante aqui para que as chegadas seguintes gerem amostras
+     *          de lead time. Cards nunca registrados ainda contribuem com
+     *          permanência e cycle time a partir da primeira movimentaçao.
+     */
+    void registerCard(const std::string& cardId, const std::string& columnId, TimePoint createdAt);
+
+    /**
+     * @brief Distribuições de fluxo de uma coluna (ver FlowMetrics)
+     * @return Permanência, lead time e cycle time até a coluna e WIP atual;
+     *         vazias se a coluna nunca apareceu no log
+     * @details Lidas do estado mantido a cada atividade publicada: o custo
+     *          nao depende do tamanho do histórico.
+     */
+    ColumnFlow columnFlow(const std::string& columnId) const;
+
+    /**
+     * @brief Histórico de fluxo de um card
+     * @return Criaçao, início do trabalho, coluna atual e primeira chegada a
+     *         cada coluna; std::nullopt se o card nunca foi visto
+     */
+    std::optional<CardFlow> cardFlow(const std::string& cardId) const;
+
+    /**
+     * @brief Criações de cards registradas a partir de um instante
+     * @return (ms de criaçao, handle da coluna) de cada card, sem ordem definida
+     * @details Complementa as atividades no cálculo do fluxo cumulativo
+     *          (ver CumulativeFlow.h), já que a criaçao nao é uma atividade.
+     */
+    std::vector<std::pair<std::uint64_t, ActivityHandle>> creationsSince(TimePoint from) const;
+
+    // ============================================================================
+    // TRILHA DE AUDITORIA
+    // ============================================================================
+
+    /**
+     * @brief Configura o destino que recebe cada atividade publicada
+     * @param sink Destino (ex.: AsyncActivitySink), ou nullptr para remover
+     * @details O sink recebe a atividade na publicaçao, já com número de
+     *          sequência e timestamp definitivos, na ordem do histórico.
+     *          Atividades ainda pendentes chegam ao sink no próximo publish().
+     */
+    void setSink(std::shared_ptr<interfaces::IActivitySink> sink);
+
+    /**
+     * @brief Retorna o destino configurado (ou nullptr)
+     */
+    std::shared_ptr<interfaces::IActivitySink> sink() const;
+
+    // ============================================================================
+    // DICIONÁRIO E RELÓGIO
+    // ============================================================================
+
+    /**
+     * @brief Interna uma string e retorna seu handle compacto
+     * @param key ID de card/coluna ou texto livre
+     * @return Handle estável enquanto o log existir
+     */
+    ActivityHandle intern(const std::string& key);
+
+    /**
+     * @brief Resolve um handle para a string internada
+     * @return Referência para a string, ou string vazia para handles inválidos
+     */
+    const std::string& resolve(ActivityHandle handle) const;
+
+    /**
+     * @brief Procura o handle de uma string sem interná-la
+     * @return Handle existente, ou kNoActivityHandle se a string nunca foi vista
+     */
+    ActivityHandle find(const std::string& key) const;
+
+    /**
+     * @brief Gera um novo timestamp HLC para uma atividade
+     */
+    HybridTimestamp now() noexcept;
+
+    // ============================================================================
+    // RENDERIZAÇaO SOB DEMANDA
+    // ============================================================================
+
+    /**
+     * @brief Gera a descriçao textual de uma atividade
+     * @param act Atividade a ser descrita
+     * @param cardTitle Resolve o ID do card para o título a exibir (opcional)
+     * @param columnName Resolve o ID da coluna para o nome a exibir (opcional)
+     * @return Texto em linguagem natural (ex.: "Card 'X' movido de 'A' para 'B'")
+     * @details Sem funções de resoluçao, os próprios IDs sao exibidos.
+     */
+    std::string describe(const Activity& act,
+                         const NameLookup& cardTitle = nullptr,
+                         const NameLookup& columnName = nullptr) const;
 
     // ============================================================================
     // MÉTODOS UTILITÁRIOS
@@ -190,33 +622,136 @@ public:
      * @return Quantidade de atividades armazenadas
      * @details Útil para estatísticas e monitoramento do volume de atividades.
      */
-    std::size_t size() const noexcept;
+    std::size_t size() const;
 
     /**
      * @brief Verifica se o log está vazio
      * @return true se nao há atividades no log, false caso contrário
      * @details Método de conveniência para verificar existência de atividades.
      */
-    bool empty() const noexcept;
+    bool empty() const;
 
     /**
      * @brief Retorna a última atividade adicionada ao log
-     * @return Ponteiro para a última atividade, ou nullptr se o log estiver vazio
-     * @details Evita lançamento de exceções quando o log está vazio,
-     *          retornando nullptr em vez de acessar elementos inválidos.
+     * @return Cópia da última atividade, ou std::nullopt se o log estiver vazio
+     * @details Retorna por valor: um ponteiro para o anel poderia ser
+     *          invalidado por uma publicaçao concorrente.
      */
-    const Activity* last() const noexcept;
+    std::optional<Activity> last() const;
 
     /**
      * @brief Limpa todas as atividades do log
-     * @details Remove todas as entradas do histórico de atividades.
-     *          Operaçao irreversível - use com cuidado.
+     * @details Remove todas as entradas do histórico de atividades, inclusive
+     *          as arquivadas. O dicionário de handles é preservado, pois
+     *          handles já distribuídos continuam válidos. Operaçao irreversível - use com cuidado.
      */
-    void clear() noexcept;
+    void clear();
 
 private:
-    std::vector<Activity> activities_;  ///< @brief Armazenamento interno das atividades em ordem cronológica
+    /// @brief Lote retirado do anel e ainda nao gravado no archive
+    struct SpillBatch {
+        std::shared_ptr<interfaces::IActivityArchive> archive;   ///< @brief Destino do lote
+        std::vector<Activity> activities;                        ///< @brief Em ordem cronológica
+    };
+
+    /// @brief Locks de uma leitura que também consulta a camada arquivada
+    struct ArchiveReadLock {
+        std::unique_lock<std::mutex> archive;   ///< @brief archiveMutex_ (adquirido primeiro)
+        std::unique_lock<std::mutex> log;       ///< @brief mutex_
+    };
+
+    /// @brief Adquire o mutex interno e publica as pendentes antes de uma leitura
+    std::unique_lock<std::mutex> lockForRead() const;
+
+    /// @brief Como lockForRead(), excluindo também a thread de descarga
+    ArchiveReadLock lockForArchiveRead() const;
+
+    /// @brief Percorre os lotes em gravaçao com timestamp em [from, to] (lockForArchiveRead)
+    void visitSpilling(HybridTimestamp from, HybridTimestamp to, const Visitor& visit) const;
+
+    /// @brief Laço da thread de descarga
+    void runSpillWriter();
+
+    /// @brief Publica as pendentes (mutex_ já adquirido)
+    std::size_t publishLocked();
+
+    /// @brief Insere uma atividade já ordenada no anel (mutex_ já adquirido)
+    void insertLocked(Activity act);
+
+    /// @brief i-ésima atividade em memória (0 = mais antiga)
+    const Activity& ringAt(std::size_t i) const noexcept;
+
+    /// @brief Posiçao no anel da primeira atividade com timestamp >= from (mutex_ já adquirido)
+    std::size_t ringLowerBound(HybridTimestamp from) const noexcept;
+
+    /// @brief Entrega as n atividades mais antigas à thread de descarga
+    void spillOldest(std::size_t n);
+
+    /// @brief Reorganiza o anel para começar no índice 0
+    void linearize();
+
+    /// @brief Materializa as atividades cujos IDs estao em ids[begin, end)
+    std::vector<Activity> collect(const std::vector<std::uint64_t>& ids, std::size_t begin) const;
+
+    /// @brief Consulta à camada arquivada: (limite, visitante); limite 0 = todas
+    using ArchivedQuery = std::function<void(std::size_t, const Visitor&)>;
+
+    /**
+     * @brief As limit atividades mais recentes de uma lista de postagem (0 = todas)
+     * @param ids Lista de postagem (apenas IDs do anel)
+     * @param match Critério da lista, aplicado aos lotes em gravaçao
+     * @param archived Mesma consulta na camada arquivada
+     */
+    std::vector<Activity> lastMatching(const std::vector<std::uint64_t>& ids, std::size_t limit,
+                                       const std::function<bool(const Activity&)>& match,
+                                       const ArchivedQuery& archived) const;
+
+    /// @brief Retira das listas de postagem as n atividades mais antigas do anel
+    void trimPostings(std::size_t n);
+
+    /// @brief Número de tipos distintos de ActivityKind
+    static constexpr std::size_t kKindCount = kActivityKindCount;
+
+    std::vector<Activity> ring_;        ///< @brief Anel das atividades recentes em ordem cronológica
+    std::size_t head_ = 0;              ///< @brief Posiçao da atividade mais antiga no anel
+    std::size_t count_ = 0;             ///< @brief Atividades presentes no anel
+    ActivityRetention retention_;       ///< @brief Política de retençao
+    std::shared_ptr<interfaces::IActivitySink> sink_; ///< @brief Trilha de auditoria (opcional)
+    std::uint64_t nextId_ = 1;          ///< @brief Próximo número de sequência a atribuir
+    HybridTimestamp lastPublished_;     ///< @brief Timestamp da última atividade publicada
+
+    concurrency::BoundedMpmcQueue<Activity> pending_{kPendingCapacity}; ///< @brief Atividades ainda nao publicadas
+    std::vector<Activity> backlog_;     ///< @brief Lote retirado da fila e ainda nao inserido no anel
+    mutable std::mutex mutex_;          ///< @brief Serializa publicaçao e leituras do histórico
+
+    // Descarga para o archive. Ordem dos locks: archiveMutex_, mutex_, spillMutex_.
+    // Quem segura archiveMutex_ e mutex_ pode ler spilling_ sem spillMutex_.
+    mutable std::mutex archiveMutex_;   ///< @brief Serializa o índice do archive entre leitores e a publicaçao de lotes
+    mutable std::mutex spillMutex_;     ///< @brief Protege spilling_, spillError_, spillRetry_ e spillStopping_
+    std::condition_variable spillWake_;     ///< @brief Acorda a thread de descarga
+    std::condition_variable spillDrained_;  ///< @brief Acorda quem espera em flushArchive()
+    std::deque<SpillBatch> spilling_;   ///< @brief Lotes ainda nao gravados, em ordem cronológica
+    std::string spillError_;            ///< @brief Falha da última gravaçao (o lote fica em spilling_)
+    bool spillRetry_ = false;           ///< @brief Nova tentativa pedida após uma falha
+    std::uint64_t spillGeneration_ = 0; ///< @brief Incrementado por clear() ao descartar spilling_
+    bool spillStopping_ = false;        ///< @brief Destrutor em andamento
+    std::thread spillWriter_;           ///< @brief Thread de descarga (iniciada no primeiro lote)
+
+    /// @brief Listas de postagem do anel: handle do card -> IDs das suas atividades (crescentes)
+    std::unordered_map<ActivityHandle, std::vector<std::uint64_t>> cardPostings_;
+    /// @brief Listas de postagem do anel por tipo de atividade (IDs crescentes)
+    std::vector<std::uint64_t> kindPostings_[kKindCount];
+    /// @brief Contadores agregados por tipo, coluna e bucket de tempo
+    std::unique_ptr<ActivityRollup> rollup_;
+
+    /// @brief Lead time, cycle time e permanência por coluna
+    std::unique_ptr<FlowMetrics> flow_;
+
+    mutable std::shared_mutex namesMutex_; ///< @brief Protege o dicionário (leituras compartilhadas)
+    std::deque<std::string> names_;     ///< @brief Strings internadas (endereços estáveis)
+    std::unordered_map<std::string_view, ActivityHandle> handles_; ///< @brief Índice string -> handle
+    HybridClock clock_;                 ///< @brief Relógio HLC que carimba as atividades
 };
 
 } // namespace domain
-} // namespace kanban
\ No newline at end of file
+} // namespace kanban
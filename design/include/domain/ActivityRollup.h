@@ -0,0 +1,131 @@
+/**
+ * @file ActivityRollup.h
+ * @brief Declaraçao dos agregados incrementais de atividades (rollups)
+ * @details Mantém contagens de atividades por tipo, coluna e intervalo de
+ *          tempo (hora e dia, em UTC), atualizadas a cada atividade publicada
+ *          no ActivityLog. Relatórios de longo prazo leem algumas centenas
+ *          de buckets em vez de reprocessar o log bruto.
+ */
+
+#pragma once
+
+#include "ActivityLog.h"
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+/**
+ * @brief Granularidade de uma série agregada
+ * @details Semanas sao derivadas dos buckets diários e começam na segunda-feira (UTC).
+ */
+enum class RollupGranularity {
+    Hour,
+    Day,
+    Week
+};
+
+/**
+ * @brief Um ponto de uma série agregada
+ */
+struct RollupPoint {
+    TimePoint start;                 ///< @brief Início do bucket (UTC)
+    std::uint64_t events = 0;        ///< @brief Atividades com destino na coluna (ou todas, no agregado do board)
+    std::uint64_t departures = 0;    ///< @brief Cards que saíram da coluna (apenas CardMoved)
+};
+
+// ============================================================================
+// CLASSE ActivityRollup
+// ============================================================================
+
+/**
+ * @brief Contadores agregados por (tipo, coluna, bucket de tempo)
+ * @details Para cada atividade registrada:
+ *          - o agregado do board (coluna kNoActivityHandle) conta +1 evento;
+ *          - a coluna de destino conta +1 evento;
+ *          - em CardMoved, a coluna de origem conta +1 saída.
+ *
+ *          Apenas buckets nao vazios sao armazenados, em mapas ordenados por
+ *          (tipo, coluna, bucket): uma consulta é O(log n + buckets no intervalo).
+ *
+ * @note Nao é thread-safe; o ActivityLog dono serializa o acesso.
+ */
+class ActivityRollup {
+public:
+    /**
+     * @brief Construtor padrao - rollup vazio
+     */
+    ActivityRollup() = default;
+
+    /**
+     * @brief Contabiliza uma atividade
+     * @param act Atividade publicada
+     */
+    void record(const Activity& act);
+
+    /**
+     * @brief Série agregada de um tipo de atividade
+     * @param kind Tipo de atividade
+     * @param column Handle da coluna, ou kNoActivityHandle para o board inteiro
+     * @param granularity Tamanho dos buckets
+     * @param from Início do intervalo (inclusivo)
+     * @param to Fim do intervalo (inclusivo)
+     * @return Buckets nao vazios do intervalo, em ordem cronológica
+     */
+    std::vector<RollupPoint> series(ActivityKind kind,
+                                    ActivityHandle column,
+                                    RollupGranularity granularity,
+                                    TimePoint from,
+                                    TimePoint to) const;
+
+    /**
+     * @brief Número de buckets armazenados (horários + diários)
+     */
+    std::size_t bucketCount() const noexcept;
+
+    /**
+     * @brief Remove todos os contadores
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Grava os contadores em formato texto (uma linha por bucket)
+     * @param os Stream de destino
+     * @param dictionary Log usado para traduzir handles de coluna em IDs
+     */
+    void save(std::ostream& os, const ActivityLog& dictionary) const;
+
+    /**
+     * @brief Soma ao rollup os contadores gravados por save()
+     * @param is Stream de origem
+     * @param dictionary Log usado para internar os IDs de coluna
+     * @throws std::runtime_error Se o conteúdo estiver malformado
+     */
+    void load(std::istream& is, ActivityLog& dictionary);
+
+private:
+    /// @brief Chave ordenada: (tipo, coluna, número do bucket)
+    using Key = std::tuple<std::uint8_t, ActivityHandle, std::uint64_t>;
+
+    /// @brief Contadores de um bucket
+    struct Counts {
+        std::uint64_t events = 0;
+        std::uint64_t departures = 0;
+    };
+
+    using BucketMap = std::map<Key, Counts>;
+
+    /// @brief Incrementa os buckets horário e diário de (kind, column)
+    void bump(ActivityKind kind, ActivityHandle column, std::uint64_t ms, bool departure);
+
+    BucketMap hourly_;   ///< @brief Buckets de uma hora
+    BucketMap daily_;    ///< @brief Buckets de um dia
+};
+
+} // namespace domain
+} // namespace kanban
@@ -19,6 +19,7 @@ namespace domain {
 // Forward declarations
 class Column;
 class ActivityLog;
+class Activity;
 
 // ============================================================================
 // CLASSE Board
@@ -172,6 +173,17 @@ public:
                   const Id& fromColumnId,
                   const Id& toColumnId);
 
+    /**
+     * @brief Move um card entre duas colunas, inserindo-o em uma posiçao
+     * @param toIndex Posiçao no destino (além do fim, o card vai para o fim)
+     * @details Como moveCard(), mas em um único passo: a atividade registrada
+     *          já traz a posiçao final do card no destino.
+     */
+    void moveCard(const std::string& cardId,
+                  const Id& fromColumnId,
+                  const Id& toColumnId,
+                  std::size_t toIndex);
+
     // ============================================================================
     // GERENCIAMENTO DO ACTIVITY LOG
     // ============================================================================
@@ -190,6 +202,15 @@ public:
      */
     std::shared_ptr<ActivityLog> activityLog() const noexcept;
 
+    /**
+     * @brief Gera a descriçao textual de uma atividade deste board
+     * @param activity Atividade registrada no ActivityLog do board
+     * @return Texto legível com títulos de cards e nomes de colunas atuais
+     * @details A renderizaçao é feita sob demanda (apenas quando uma view
+     *          solicita), mantendo o registro da atividade compacto.
+     */
+    std::string describe(const Activity& activity) const;
+
     // ============================================================================
     // MÉTODOS UTILITÁRIOS
     // ============================================================================
@@ -14,6 +14,7 @@
 #include <optional>
 #include <chrono>
 #include <ostream>
+#include "../interfaces/ICardObserver.h"
 
 namespace kanban {
 namespace domain {
@@ -133,17 +134,17 @@ public:
     // REGRA DOS CINCO (FIVE RULE)
     // ============================================================================
 
-    /// @brief Construtor de cópia padrao (strings e time_point suportam)
-    Card(const Card&) = default;
+    /// @brief Construtor de cópia (a cópia nao herda o observador)
+    Card(const Card& other);
     
-    /// @brief Construtor de movimentaçao padrao
-    Card(Card&&) noexcept = default;
+    /// @brief Construtor de movimentaçao (como na cópia, o observador nao é transferido)
+    Card(Card&& other) noexcept;
     
-    /// @brief Operador de atribuiçao por cópia padrao
-    Card& operator=(const Card&) = default;
+    /// @brief Operador de atribuiçao por cópia (mantém e avisa o observador atual)
+    Card& operator=(const Card& other);
     
-    /// @brief Operador de atribuiçao por movimentaçao padrao
-    Card& operator=(Card&&) noexcept = default;
+    /// @brief Operador de atribuiçao por movimentaçao (mesmas regras da cópia)
+    Card& operator=(Card&& other) noexcept;
     
     /// @brief Destrutor padrao
     ~Card() = default;
@@ -248,6 +249,14 @@ public:
      */
     void clearTags() noexcept;
 
+    /**
+     * @brief Substitui todas as tags do card de uma vez
+     * @param tags Novas tags (duplicatas por ID sao descartadas)
+     * @details Emite uma única notificaçao ao observador, ao contrário de
+     *          clearTags() seguido de addTag() para cada tag.
+     */
+    void setTags(std::vector<std::shared_ptr<Tag>> tags);
+
     /**
      * @brief Retorna todas as tags do card
      * @return Referência constante para o vetor de tags
@@ -255,6 +264,18 @@ public:
      */
     const std::vector<std::shared_ptr<Tag>>& tags() const noexcept;
 
+    // ============================================================================
+    // OBSERVADOR
+    // ============================================================================
+
+    /**
+     * @brief Define quem é avisado das alterações do card
+     * @param observer Observador (weak_ptr vazio remove o atual)
+     * @details Referência fraca: o card nao prolonga a vida do observador
+     *          e deixa de avisá-lo quando ele é destruído.
+     */
+    void setObserver(std::weak_ptr<interfaces::ICardObserver> observer) noexcept;
+
     // ============================================================================
     // OPERADORES DE COMPARAÇaO E ORDENAÇaO
     // ============================================================================
@@ -285,6 +306,24 @@ public:
      */
     void touchUpdated() noexcept;
 
+    /**
+     * @brief Avisa o observador, se houver, de uma alteraçao de texto
+     */
+    void notifyTextChanged() const;
+
+    /**
+     * @brief Avisa o observador, se houver, de alteraçao de prioridade ou tags
+     * @details Descarta exceções do observador para preservar o noexcept
+     *          dos métodos que o chamam.
+     */
+    void notifyUpdated() const noexcept;
+
+    /**
+     * @brief Avisa o observador, se houver, após uma atribuiçao
+     * @param previousId ID antes da atribuiçao (igual ao atual se nao mudou)
+     */
+    void notifyAssigned(const std::string& previousId) const noexcept;
+
     // ============================================================================
     // OPERADOR DE SAÍDA
     // ============================================================================
@@ -307,6 +346,7 @@ private:
     TimePoint createdAt_;                    ///< @brief Momento de criaçao do card
     TimePoint updatedAt_;                    ///< @brief Momento da última atualizaçao
     std::vector<std::shared_ptr<Tag>> tags_; ///< @brief Coleçao de tags associadas
+    std::weak_ptr<interfaces::ICardObserver> observer_; ///< @brief Avisado das alterações do card
 
     // ============================================================================
     // NOTA SOBRE CONCORRÊNCIA
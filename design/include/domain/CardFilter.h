@@ -0,0 +1,348 @@
+/**
+ * @file CardFilter.h
+ * @brief Declaraçao da biblioteca de filtros de cards e do plano compilado
+ * @details Implementações de interfaces::IFilter para os critérios usuais
+ *          (prioridade, tags, texto, datas e coluna) e os combinadores
+ *          And/Or/Not. Uma árvore de filtros é compilada em um FilterPlan:
+ *          um vetor plano de testes com destinos de curto-circuito, em que os
+ *          predicados de cada conjunçao/disjunçao sao avaliados do mais
+ *          barato para o mais caro.
+ */
+
+#pragma once
+
+#include "../interfaces/IFilter.h"
+#include "Card.h"
+#include "../simd/Bitmap.h"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+class CardTable;
+
+/**
+ * @brief Como um TagFilter combina as tags pedidas
+ */
+enum class TagMatch {
+    Any,    ///< @brief O card tem ao menos uma das tags
+    All,    ///< @brief O card tem todas as tags
+    None,   ///< @brief O card nao tem nenhuma das tags
+    AnyContaining   ///< @brief O nome de alguma tag contém um dos trechos
+};
+
+/**
+ * @brief Campo de texto avaliado por um TextFilter
+ */
+enum class TextField {
+    Title,          ///< @brief Apenas o título
+    Description,    ///< @brief Apenas a descriçao
+    Any             ///< @brief Título ou descriçao
+};
+
+/**
+ * @brief Campo de data avaliado por um TimeFilter
+ */
+enum class TimeField {
+    Created,    ///< @brief Momento de criaçao
+    Updated     ///< @brief Momento da última modificaçao
+};
+
+// ============================================================================
+// FILTROS SIMPLES
+// ============================================================================
+
+/**
+ * @brief Prioridade dentro de um conjunto
+ */
+class PrioritySetFilter : public interfaces::IFilter {
+public:
+    explicit PrioritySetFilter(std::vector<int> priorities);
+    bool matches(const Card& card) const override;
+    std::unique_ptr<interfaces::IFilter> clone() const override;
+    const std::vector<int>& priorities() const noexcept { return priorities_; }
+
+private:
+    std::vector<int> priorities_;   ///< @brief Ordenado e sem repetições
+};
+
+/**
+ * @brief Prioridade no intervalo fechado [min, max]
+ */
+class PriorityRangeFilter : public interfaces::IFilter {
+public:
+    PriorityRangeFilter(int min, int max) noexcept;
+    bool matches(const Card& card) const override;
+    std::unique_ptr<interfaces::IFilter> clone() const override;
+    int min() const noexcept { return min_; }
+    int max() const noexcept { return max_; }
+
+private:
+    int min_;
+    int max_;
+};
+
+/**
+ * @brief Tags do card, comparadas pelo nome sem diferenciar maiúsculas
+ */
+class TagFilter : public interfaces::IFilter {
+public:
+    TagFilter(TagMatch mode, std::vector<std::string> names);
+    bool matches(const Card& card) const override;
+    std::unique_ptr<interfaces::IFilter> clone() const override;
+    TagMatch mode() const noexcept { return mode_; }
+    const std::vector<std::string>& names() const noexcept { return names_; }
+
+private:
+    TagMatch mode_;
+    std::vector<std::string> names_;   ///< @brief Em minúsculas
+};
+
+/**
+ * @brief Trecho de texto no título e/ou na descriçao, sem diferenciar maiúsculas
+ * @note A comparaçao ignora maiúsculas apenas em caracteres ASCII.
+ */
+class TextFilter : public interfaces::IFilter {
+public:
+    TextFilter(TextField field, std::string needle);
+    bool matches(const Card& card) const override;
+    std::unique_ptr<interfaces::IFilter> clone() const override;
+    TextField field() const noexcept { return field_; }
+    const std::string& needle() const noexcept { return needle_; }
+
+private:
+    TextField field_;
+    std::string needle_;   ///< @brief Em minúsculas
+};
+
+/**
+ * @brief Data de criaçao ou de modificaçao no intervalo fechado [from, to]
+ */
+class TimeFilter : public interfaces::IFilter {
+public:
+    TimeFilter(TimeField field, TimePoint from, TimePoint to) noexcept;
+    bool matches(const Card& card) const override;
+    std::unique_ptr<interfaces::IFilter> clone() const override;
+    TimeField field() const noexcept { return field_; }
+    TimePoint from() const noexcept { return from_; }
+    TimePoint to() const noexcept { return to_; }
+
+private:
+    TimeField field_;
+    TimePoint from_;
+    TimePoint to_;
+};
+
+/**
+ * @brief O card está em uma das colunas informadas
+ * @details A coluna nao faz parte do Card: o critério é avaliado por
+ *          matchesInColumn(), FilterPlan::matches(card, columnId) e
+ *          KanbanService::query(), que o usa para restringir as colunas
+ *          percorridas.
+ * @note Avaliado por matches(card), sem coluna, nenhum card pertence às colunas.
+ */
+class ColumnFilter : public interfaces::IFilter {
+public:
+    explicit ColumnFilter(std::vector<std::string> columnIds);
+    bool matches(const Card& card) const override;
+    bool matchesInColumn(const Card& card, const std::string& columnId) const override;
+    std::unique_ptr<interfaces::IFilter> clone() const override;
+    bool containsColumn(const std::string& columnId) const noexcept;
+    const std::vector<std::string>& columnIds() const noexcept { return columnIds_; }
+
+private:
+    std::vector<std::string> columnIds_;   ///< @brief Ordenado e sem repetições
+};
+
+// ============================================================================
+// COMBINADORES
+// ============================================================================
+
+/**
+ * @brief Base de And/Or: uma lista de filtros filhos
+ */
+class CompositeFilter : public interfaces::IFilter {
+public:
+    CompositeFilter() = default;
+    CompositeFilter(const CompositeFilter& other);
+    CompositeFilter& operator=(const CompositeFilter& other);
+    CompositeFilter(CompositeFilter&&) noexcept = default;
+    CompositeFilter& operator=(CompositeFilter&&) noexcept = default;
+
+    /**
+     * @brief Acrescenta um filtro filho
+     * @return *this, para encadear chamadas
+     */
+    CompositeFilter& add(std::unique_ptr<interfaces::IFilter> filter);
+
+    /// @brief Acrescenta uma cópia de um filtro filho
+    CompositeFilter& add(const interfaces::IFilter& filter) { return add(filter.clone()); }
+
+    const std::vector<std::unique_ptr<interfaces::IFilter>>& children() const noexcept { return children_; }
+
+protected:
+    std::vector<std::unique_ptr<interfaces::IFilter>> children_;
+};
+
+/**
+ * @brief Todos os filhos aceitam o card (sem filhos, aceita tudo)
+ */
+class AndFilter : public CompositeFilter {
+public:
+    bool matches(const Card& card) const override;
+    bool matchesInColumn(const Card& card, const std::string& columnId) const override;
+    std::unique_ptr<interfaces::IFilter> clone() const override;
+};
+
+/**
+ * @brief Algum filho aceita o card (sem filhos, rejeita tudo)
+ */
+class OrFilter : public CompositeFilter {
+public:
+    bool matches(const Card& card) const override;
+    bool matchesInColumn(const Card& card, const std::string& columnId) const override;
+    std::unique_ptr<interfaces::IFilter> clone() const override;
+};
+
+/**
+ * @brief Negaçao de um filtro
+ */
+class NotFilter : public interfaces::IFilter {
+public:
+    explicit NotFilter(std::unique_ptr<interfaces::IFilter> inner);
+    explicit NotFilter(const interfaces::IFilter& inner) : NotFilter(inner.clone()) {}
+    bool matches(const Card& card) const override;
+    bool matchesInColumn(const Card& card, const std::string& columnId) const override;
+    std::unique_ptr<interfaces::IFilter> clone() const override;
+    const interfaces::IFilter& inner() const noexcept { return *inner_; }
+
+private:
+    std::unique_ptr<interfaces::IFilter> inner_;
+};
+
+// ============================================================================
+// CLASSE FilterPlan
+// ============================================================================
+
+/**
+ * @brief Árvore de filtros compilada em instruções planas
+ * @details A compilaçao:
+ *          - achata And/Or aninhados do mesmo tipo e elimina Not duplos;
+ *          - converte cada filtro conhecido em um predicado com os dados já
+ *            normalizados (minúsculas, conjuntos ordenados);
+ *          - ordena os filhos de cada And/Or pelo custo estimado, para que o
+ *            curto-circuito descarte o card com os testes mais baratos;
+ *          - extrai os ColumnFilter do nível superior como escopo de colunas,
+ *            que o chamador usa para nem percorrer as demais colunas.
+ *
+ *          Filtros de outros tipos (implementações próprias de IFilter) sao
+ *          clonados e avaliados por matchesInColumn(), com o maior custo.
+ *
+ *          Cada instruçao testa um predicado e traz os dois destinos (próxima
+ *          instruçao, aceitar ou rejeitar): And, Or e Not viram apenas saltos,
+ *          sem instruções próprias, e cada card executa no máximo uma
+ *          instruçao por predicado no caminho. Nao há recursao nem chamadas
+ *          virtuais para os filtros da biblioteca. O plano é imutável e pode
+ *          ser avaliado por várias threads ao mesmo tempo.
+ */
+class FilterPlan {
+public:
+    /**
+     * @brief Compila uma árvore de filtros
+     * @param filter Raiz da árvore (nao é referenciada após a compilaçao)
+     */
+    static FilterPlan compile(const interfaces::IFilter& filter);
+
+    /**
+     * @brief Avalia o plano para um card
+     * @param card Card avaliado
+     * @param columnId Coluna onde o card está (vazia se desconhecida)
+     */
+    bool matches(const Card& card, const std::string& columnId = std::string()) const;
+
+    /**
+     * @brief Colunas às quais o resultado se restringe
+     * @return IDs ordenados, ou std::nullopt se qualquer coluna pode ter resultados
+     * @details Os testes de coluna do nível superior sao removidos do plano;
+     *          o chamador que percorre apenas estas colunas nao precisa repeti-los.
+     */
+    const std::optional<std::vector<std::string>>& columnScope() const noexcept { return columnScope_; }
+
+    /**
+     * @brief Se nenhum card pode satisfazer o plano (ex.: escopo de colunas vazio)
+     */
+    bool rejectsAll() const noexcept;
+
+    /**
+     * @brief Se todos os predicados têm seleçao equivalente na CardTable
+     * @details Falso quando o plano testa texto ou um filtro externo.
+     */
+    bool vectorizable() const noexcept;
+
+    /**
+     * @brief Avalia o plano sobre uma tabela colunar inteira
+     * @param table Tabela do board (linhas na ordem das colunas)
+     * @return Linhas aceitas, incluindo o escopo de colunas; nullopt se algum
+     *         predicado nao pode ser respondido pela tabela (ver vectorizable()
+     *         e CardTable::whereTags())
+     * @details Cada predicado vira uma seleçao vetorizada e as instruções sao
+     *          resolvidas de trás para frente: as linhas aceitas a partir de
+     *          uma instruçao sao (P & aceitas(verdadeiro)) | (~P & aceitas(falso)).
+     */
+    std::optional<simd::Bitmap> select(const CardTable& table) const;
+
+    /**
+     * @brief Descriçao legível das instruções, na ordem de avaliaçao
+     */
+    std::string explain() const;
+
+private:
+    class Compiler;
+
+    /// @brief Destinos terminais de uma instruçao
+    static constexpr std::uint32_t kAccept = 0xFFFFFFFFu;
+    static constexpr std::uint32_t kReject = 0xFFFFFFFEu;
+
+    /// @brief Testa um predicado e segue para onTrue ou onFalse
+    struct Instruction {
+        std::uint32_t predicate;
+        std::uint32_t onTrue;
+        std::uint32_t onFalse;
+    };
+
+    /// @brief Predicado compilado (apenas os campos do seu tipo sao usados)
+    struct Predicate {
+        enum class Kind : std::uint8_t {
+            PrioritySet, PriorityRange, Tags, Text, Time, Column, Custom
+        };
+        Kind kind = Kind::Custom;
+        unsigned cost = 0;                                 ///< @brief Custo estimado de avaliaçao
+        int min = 0;                                       ///< @brief PriorityRange
+        int max = 0;                                       ///< @brief PriorityRange
+        TagMatch tagMatch = TagMatch::Any;                 ///< @brief Tags
+        TextField textField = TextField::Any;              ///< @brief Text
+        TimeField timeField = TimeField::Created;          ///< @brief Time
+        TimePoint from{};                                  ///< @brief Time
+        TimePoint to{};                                    ///< @brief Time
+        std::vector<int> priorities;                       ///< @brief PrioritySet (ordenado)
+        std::vector<std::string> strings;                  ///< @brief Tags (minúsculas) ou Column (ordenado)
+        std::string needle;                                ///< @brief Text (minúsculas)
+        std::shared_ptr<const interfaces::IFilter> custom; ///< @brief Custom
+    };
+
+    FilterPlan() = default;
+
+    static bool test(const Predicate& predicate, const Card& card, const std::string& columnId);
+
+    std::vector<Instruction> code_;
+    std::uint32_t entry_ = kAccept;   ///< @brief Primeira instruçao (ou destino terminal)
+    std::vector<Predicate> predicates_;
+    std::optional<std::vector<std::string>> columnScope_;
+};
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,133 @@
+/**
+ * @file CardTable.h
+ * @brief Declaraçao da tabela colunar de atributos dos cards de um board
+ * @details Foto de um board em arrays contíguos (prioridade, datas, máscara
+ *          de tags, coluna), um elemento por card, para que filtros e
+ *          estatísticas sobre centenas de milhares de cards sejam avaliados
+ *          pelos kernels vetorizados de simd/PredicateKernels.h em vez de um
+ *          predicado por card. Cada seleçao devolve um simd::Bitmap; os
+ *          bitmaps sao combinados com &=, |= e andNot() e convertidos de
+ *          volta em cards com cardsIn().
+ *
+ *          A tabela é imutável e nao acompanha alterações posteriores do
+ *          board: deve ser reconstruída quando o board mudar.
+ */
+
+#pragma once
+
+#include "Card.h"
+#include "CardFilter.h"
+#include "../simd/Bitmap.h"
+#include "../simd/PredicateKernels.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+class Board;
+
+// ============================================================================
+// CLASSE CardTable
+// ============================================================================
+
+/**
+ * @brief Atributos dos cards de um board em layout colunar
+ */
+class CardTable {
+public:
+    /// @brief Máximo de nomes de tag distintos com bit próprio na máscara
+    static constexpr std::size_t kMaxIndexedTags = 64;
+
+    CardTable() = default;
+
+    /**
+     * @brief Monta a tabela a partir do estado atual do board
+     * @details As linhas seguem a ordem das colunas e, dentro delas, dos
+     *          cards. O chamador deve garantir que o board nao é alterado
+     *          durante a chamada (ver KanbanService::cardTable()).
+     */
+    static CardTable fromBoard(const Board& board);
+
+    /**
+     * @brief Instante convertido para a unidade dos arrays de datas
+     */
+    static std::int64_t toTicks(TimePoint time) noexcept;
+
+    // ============================================================================
+    // ARRAYS
+    // ============================================================================
+
+    std::size_t size() const noexcept { return cards_.size(); }
+    const std::vector<std::shared_ptr<Card>>& cards() const noexcept { return cards_; }
+    const std::vector<std::int32_t>& priorities() const noexcept { return priorities_; }
+    const std::vector<std::int64_t>& createdTicks() const noexcept { return created_; }
+    const std::vector<std::int64_t>& updatedTicks() const noexcept { return updated_; }
+    const std::vector<std::uint64_t>& tagMasks() const noexcept { return tagMasks_; }
+    const std::vector<std::int32_t>& columnIndexes() const noexcept { return columnIndexes_; }
+    const std::vector<std::string>& columnIds() const noexcept { return columnIds_; }
+
+    /**
+     * @brief Bit de um nome de tag (sem diferenciar maiúsculas)
+     * @return Máscara com um único bit, ou nullopt se a tag nao está indexada
+     */
+    std::optional<std::uint64_t> tagBit(const std::string& name) const;
+
+    /**
+     * @brief Indica se todos os nomes de tag do board receberam um bit
+     * @details Falso quando o board tem mais de kMaxIndexedTags nomes
+     *          distintos; os excedentes nao aparecem nas máscaras.
+     */
+    bool tagsComplete() const noexcept { return tagsComplete_; }
+
+    // ============================================================================
+    // SELEÇÕES
+    // ============================================================================
+
+    /**
+     * @brief Linhas cuja prioridade satisfaz "prioridade <op> value"
+     */
+    simd::Bitmap wherePriority(simd::Compare op, int value) const;
+
+    /**
+     * @brief Linhas com data de criaçao (ou modificaçao) em [from, to]
+     */
+    simd::Bitmap whereTime(TimeField field, TimePoint from, TimePoint to) const;
+
+    /**
+     * @brief Linhas cujas tags satisfazem mode em relaçao a names
+     * @param mode Any, All ou None (AnyContaining nao é suportado)
+     * @return nullopt quando a resposta depende de uma tag sem bit próprio
+     *         (só ocorre se tagsComplete() for falso) ou para AnyContaining;
+     *         nesses casos use domain::TagFilter
+     */
+    std::optional<simd::Bitmap> whereTags(TagMatch mode, const std::vector<std::string>& names) const;
+
+    /**
+     * @brief Linhas de cards na coluna informada
+     */
+    simd::Bitmap whereColumn(const std::string& columnId) const;
+
+    /**
+     * @brief Cards das linhas selecionadas, na ordem da tabela
+     */
+    std::vector<std::shared_ptr<Card>> cardsIn(const simd::Bitmap& rows) const;
+
+private:
+    std::vector<std::shared_ptr<Card>> cards_;
+    std::vector<std::int32_t> priorities_;
+    std::vector<std::int64_t> created_;
+    std::vector<std::int64_t> updated_;
+    std::vector<std::uint64_t> tagMasks_;
+    std::vector<std::int32_t> columnIndexes_;
+    std::vector<std::string> columnIds_;
+    std::map<std::string, std::uint64_t> tagBits_;   ///< @brief Nome em minúsculas -> bit
+    bool tagsComplete_ = true;
+};
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,118 @@
+/**
+ * @file Command.h
+ * @brief Declaraçao dos comandos de mutaçao aplicados em lote a um board
+ * @details Um Command descreve uma única mutaçao (criar coluna, adicionar,
+ *          mover, reordenar, retaguear ou priorizar um card) sem executá-la.
+ *          Listas de comandos sao aplicadas de forma atômica por
+ *          IService::applyBatch().
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+/**
+ * @brief Tipo de um comando de lote
+ */
+enum class CommandKind {
+    CreateColumn,   ///< @brief Cria uma coluna (text = nome)
+    AddCard,        ///< @brief Adiciona um card (columnId, text = título)
+    MoveCard,       ///< @brief Move um card entre colunas (cardId, fromColumnId, columnId)
+    ReorderCard,    ///< @brief Reposiciona um card na coluna (cardId, columnId, index)
+    RetagCard,      ///< @brief Substitui as tags de um card (cardId, tags)
+    SetPriority     ///< @brief Define a prioridade de um card (cardId, priority)
+};
+
+// ============================================================================
+// CLASSE Command
+// ============================================================================
+
+/**
+ * @brief Uma mutaçao de board, descrita por valor
+ * @details IDs de colunas e cards criados no próprio lote ainda nao sao
+ *          conhecidos pelo chamador; para referenciá-los, use "$<n>", onde n
+ *          é a posiçao (base 0) do comando CreateColumn/AddCard que os criou:
+ *          @code
+ *          std::vector<Command> batch = {
+ *              Command::createColumn("Backlog"),           // $0
+ *              Command::addCard("$0", "Importar planilha"), // $1
+ *              Command::setPriority("$1", 3),
+ *          };
+ *          @endcode
+ *          Os campos nao usados por um tipo de comando ficam vazios.
+ */
+struct Command {
+    CommandKind kind = CommandKind::CreateColumn;  ///< @brief Tipo do comando
+    std::string cardId;                            ///< @brief Card alvo
+    std::string fromColumnId;                      ///< @brief Coluna de origem (MoveCard)
+    std::string columnId;                          ///< @brief Coluna alvo/destino
+    std::string text;                              ///< @brief Nome da coluna ou título do card
+    std::vector<std::string> tags;                 ///< @brief Novas tags (RetagCard)
+    std::size_t index = 0;                         ///< @brief Nova posiçao (ReorderCard)
+    int priority = 0;                              ///< @brief Nova prioridade (SetPriority)
+
+    /// @brief Cria uma coluna com o nome informado
+    static Command createColumn(const std::string& name) {
+        Command c;
+        c.kind = CommandKind::CreateColumn;
+        c.text = name;
+        return c;
+    }
+
+    /// @brief Adiciona um card ao final da coluna
+    static Command addCard(const std::string& columnId, const std::string& title) {
+        Command c;
+        c.kind = CommandKind::AddCard;
+        c.columnId = columnId;
+        c.text = title;
+        return c;
+    }
+
+    /// @brief Move um card para o final de outra coluna
+    static Command moveCard(const std::string& cardId, const std::string& fromColumnId,
+                            const std::string& toColumnId) {
+        Command c;
+        c.kind = CommandKind::MoveCard;
+        c.cardId = cardId;
+        c.fromColumnId = fromColumnId;
+        c.columnId = toColumnId;
+        return c;
+    }
+
+    /// @brief Reposiciona um card dentro da própria coluna
+    static Command reorderCard(const std::string& columnId, const std::string& cardId,
+                               std::size_t index) {
+        Command c;
+        c.kind = CommandKind::ReorderCard;
+        c.columnId = columnId;
+        c.cardId = cardId;
+        c.index = index;
+        return c;
+    }
+
+    /// @brief Substitui todas as tags do card
+    static Command retagCard(const std::string& cardId, const std::vector<std::string>& tags) {
+        Command c;
+        c.kind = CommandKind::RetagCard;
+        c.cardId = cardId;
+        c.tags = tags;
+        return c;
+    }
+
+    /// @brief Define a prioridade do card
+    static Command setPriority(const std::string& cardId, int priority) {
+        Command c;
+        c.kind = CommandKind::SetPriority;
+        c.cardId = cardId;
+        c.priority = priority;
+        return c;
+    }
+};
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,83 @@
+/**
+ * @file CompletionIndex.h
+ * @brief Declaraçao do índice de completamento de títulos e tags de um board
+ * @details Duas PrefixTrie por board:
+ *          - títulos dos cards, ordenados por prioridade e, em seguida, pela
+ *            alteraçao mais recente;
+ *          - nomes de tag (sem diferenciar maiúsculas nem acentos), ordenados
+ *            pelo número de cards que os usam e, em seguida, pelo uso mais
+ *            recente.
+ *          Atualizado card a card (addCard() a cada alteraçao), sem percorrer
+ *          o board.
+ */
+
+#pragma once
+
+#include "PrefixTrie.h"
+#include <cstddef>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+class Card;
+
+// ============================================================================
+// CLASSE CompletionIndex
+// ============================================================================
+
+/**
+ * @brief Completamento thread-safe de títulos de cards e nomes de tags
+ */
+class CompletionIndex {
+public:
+    /**
+     * @brief Inclui o card ou atualiza título, prioridade e tags dele
+     */
+    void addCard(const Card& card);
+
+    /**
+     * @brief Remove o card e libera as tags que só ele usava
+     */
+    void removeCard(const std::string& cardId);
+
+    /**
+     * @brief Títulos que começam com o prefixo
+     * @return Sugestões com id = ID do card e text = título
+     */
+    std::vector<Completion> completeTitles(const std::string& prefix, std::size_t limit) const;
+
+    /**
+     * @brief Nomes de tag que começam com o prefixo
+     * @return Sugestões com id = nome normalizado e text = nome como foi usado
+     *         pela primeira vez
+     */
+    std::vector<Completion> completeTags(const std::string& prefix, std::size_t limit) const;
+
+    /**
+     * @brief Todos os nomes de tag em uso, em ordem alfabética (normalizada)
+     */
+    std::vector<std::string> tagNames() const;
+
+private:
+    /// @brief Uso de um nome de tag no board
+    struct TagUse {
+        std::string name;            ///< @brief Grafia exibida
+        std::size_t cards = 0;       ///< @brief Cards que usam a tag
+        std::int64_t lastUsed = 0;   ///< @brief Ticks da alteraçao mais recente de um desses cards
+    };
+
+    void releaseTagLocked(const std::string& key);
+
+    mutable std::shared_mutex mutex_;
+    PrefixTrie titles_;
+    PrefixTrie tags_;
+    std::unordered_map<std::string, TagUse> tagUses_;                      ///< @brief Nome normalizado -> uso
+    std::unordered_map<std::string, std::vector<std::string>> cardTags_;   ///< @brief Card -> nomes normalizados
+};
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,79 @@
+/**
+ * @file CumulativeFlow.h
+ * @brief Declaraçao do cálculo do diagrama de fluxo cumulativo (CFD)
+ * @details O CFD mostra, no fim de cada intervalo (bucket) de uma janela,
+ *          quantos cards havia em cada coluna. A contagem parte do estado
+ *          conhecido (as colunas no instante da consulta) e desconta, de trás
+ *          para frente, o saldo de cada bucket: chegadas menos saídas das
+ *          movimentações e as criações de cards. Assim só as atividades a
+ *          partir do início da janela sao lidas, mesmo que o histórico mais
+ *          antigo já tenha sido descartado pela retençao.
+ *
+ *          As atividades (em ordem cronológica) sao divididas em partições
+ *          contíguas no tempo, processadas em paralelo no ThreadPool; cada
+ *          uma produz o saldo dos buckets que cobre, e os saldos sao somados
+ *          e acumulados no final.
+ */
+
+#pragma once
+
+#include "ActivityLog.h"
+#include "../concurrency/ThreadPool.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+/**
+ * @brief Série do fluxo cumulativo de um board
+ */
+struct CumulativeFlow {
+    TimePoint from;                                 ///< @brief Início da janela
+    std::chrono::milliseconds bucket{0};            ///< @brief Largura de cada bucket
+    std::vector<std::string> columns;               ///< @brief IDs das colunas, na ordem do board
+    std::vector<std::vector<std::int64_t>> counts;  ///< @brief counts[b][c]: cards na coluna c no fim do bucket b
+    std::size_t events = 0;                         ///< @brief Atividades processadas
+
+    /// @brief Instante em que o bucket b termina
+    TimePoint bucketEnd(std::size_t b) const {
+        return from + bucket * static_cast<std::int64_t>(b + 1);
+    }
+};
+
+/**
+ * @brief Estado e histórico de um board lidos para o cálculo do CFD
+ */
+struct CumulativeFlowInput {
+    std::vector<std::pair<ActivityHandle, std::string>> columns;    ///< @brief Handle e ID de cada coluna
+    std::vector<std::int64_t> current;                              ///< @brief Cards por coluna no instante da leitura
+    std::vector<Activity> events;                                   ///< @brief Atividades desde o início da janela, em ordem
+    std::vector<std::pair<std::uint64_t, ActivityHandle>> creations; ///< @brief (ms, coluna) das criações desde o início
+};
+
+/// @brief Máximo de buckets por série (limita a memória do cálculo)
+constexpr std::size_t kMaxCumulativeFlowBuckets = 100000;
+
+/**
+ * @brief Calcula o fluxo cumulativo de uma janela
+ * @param input Colunas, contagens atuais e atividades a partir de from
+ * @param from Início da janela
+ * @param to Fim da janela (atividades posteriores apenas desfazem o estado atual)
+ * @param bucket Largura de cada bucket (> 0)
+ * @param pool Pool para processar as partições (nullptr = sequencial)
+ * @return Uma linha de contagens por bucket (ao menos uma)
+ * @throws std::invalid_argument Se bucket <= 0, to < from ou a janela tiver
+ *         mais de kMaxCumulativeFlowBuckets buckets
+ */
+CumulativeFlow cumulativeFlow(const CumulativeFlowInput& input,
+                              TimePoint from,
+                              TimePoint to,
+                              std::chrono::milliseconds bucket,
+                              concurrency::ThreadPool* pool = nullptr);
+
+} // namespace domain
+} // namespace kanban
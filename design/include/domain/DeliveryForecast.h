@@ -0,0 +1,107 @@
+/**
+ * @file DeliveryForecast.h
+ * @brief Declaraçao da previsao de entrega por simulaçao de Monte Carlo
+ * @details Cada tentativa sorteia, com reposiçao, semanas do histórico de
+ *          throughput (cards que chegaram à última coluna por semana) até
+ *          somar os cards restantes; o número de semanas sorteadas é a
+ *          duraçao daquela tentativa. Com um milhao de tentativas, os
+ *          percentis do histograma de durações dao as datas de entrega
+ *          (ex.: 85% de chance de terminar até a data do percentil 0.85).
+ *
+ *          As tentativas sao divididas em blocos de tamanho fixo, cada um
+ *          com o seu RandomStream derivado da semente; os blocos sao
+ *          processados em paralelo no ThreadPool e o resultado é o mesmo
+ *          para qualquer número de threads.
+ */
+
+#pragma once
+
+#include "ActivityLog.h"
+#include "../concurrency/ThreadPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+/// @brief Tentativas por previsao, se nao informado
+constexpr std::size_t kDefaultForecastTrials = 1000000;
+
+/// @brief Semanas de histórico de throughput, se nao informado
+constexpr std::size_t kDefaultForecastHistoryWeeks = 12;
+
+/// @brief Horizonte máximo de uma tentativa (dez anos)
+constexpr std::size_t kMaxForecastWeeks = 520;
+
+/// @brief Semente padrao: previsões reproduzíveis
+constexpr std::uint64_t kDefaultForecastSeed = 0x6b616e62616e21ULL;
+
+/**
+ * @brief Resultado de uma previsao de entrega
+ */
+struct DeliveryForecast {
+    TimePoint start;                        ///< @brief Instante a partir do qual as semanas contam
+    std::size_t remaining = 0;              ///< @brief Cards a entregar
+    std::size_t trials = 0;                 ///< @brief Tentativas simuladas
+    std::vector<std::uint32_t> throughput;  ///< @brief Amostras semanais usadas, da mais antiga à mais recente
+    std::vector<std::uint64_t> weeks;       ///< @brief weeks[w]: tentativas concluídas em w semanas
+    std::uint64_t beyondHorizon = 0;        ///< @brief Tentativas nao concluídas em kMaxForecastWeeks
+
+    /**
+     * @brief Semanas necessárias com a probabilidade pedida
+     * @param percentile Probabilidade em (0, 1] (ex.: 0.85)
+     * @return Menor w com ao menos essa fraçao das tentativas concluída em
+     *         até w semanas; std::nullopt se o percentil cair além do horizonte
+     * @throws std::invalid_argument Se percentile estiver fora de (0, 1]
+     */
+    std::optional<std::size_t> weeksAt(double percentile) const;
+
+    /**
+     * @brief Data de entrega com a probabilidade pedida
+     * @return start + weeksAt(percentile) semanas
+     * @throws std::invalid_argument Se percentile estiver fora de (0, 1]
+     */
+    std::optional<TimePoint> dateAt(double percentile) const;
+};
+
+/**
+ * @brief Simula a entrega dos cards restantes
+ * @param weeklyThroughput Cards entregues em cada semana do histórico
+ * @param remaining Cards a entregar
+ * @param start Início da contagem (normalmente agora)
+ * @param trials Número de tentativas
+ * @param pool Pool para os blocos de tentativas (nullptr = sequencial)
+ * @param seed Semente dos fluxos aleatórios
+ * @throws std::invalid_argument Se o histórico estiver vazio ou trials for zero
+ * @details Um histórico só de zeros (ou em que nem a melhor semana alcança
+ *          o restante dentro do horizonte) marca todas as tentativas como
+ *          além do horizonte, sem simular.
+ */
+DeliveryForecast forecastDelivery(const std::vector<std::uint32_t>& weeklyThroughput,
+                                  std::size_t remaining,
+                                  TimePoint start,
+                                  std::size_t trials = kDefaultForecastTrials,
+                                  concurrency::ThreadPool* pool = nullptr,
+                                  std::uint64_t seed = kDefaultForecastSeed);
+
+/**
+ * @brief Throughput semanal de uma coluna lido dos rollups do log
+ * @param log Log de atividades do board
+ * @param columnId Coluna de entrega (normalmente a última do board)
+ * @param now Instante da consulta; a semana corrente, incompleta, fica de fora
+ * @param weeks Semanas completas a considerar (segunda a domingo, UTC)
+ * @return Chegadas à coluna por semana, da mais antiga à mais recente,
+ *         incluindo semanas sem entregas. Semanas anteriores à primeira
+ *         movimentaçao do board sao descartadas (o board ainda nao era usado);
+ *         vazio se nao houver nenhuma.
+ */
+std::vector<std::uint32_t> weeklyThroughput(const ActivityLog& log,
+                                            const std::string& columnId,
+                                            TimePoint now,
+                                            std::size_t weeks = kDefaultForecastHistoryWeeks);
+
+} // namespace domain
+} // namespace kanban
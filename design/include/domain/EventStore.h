@@ -0,0 +1,355 @@
+/**
+ * @file EventStore.h
+ * @brief Declaraçao do log de eventos do modo event-sourced
+ * @details Cada mutaçao do KanbanService vira um Event de tamanho fixo
+ *          (32 bytes, sem ponteiros) gravado antes de ser aplicada. O estado
+ *          estrutural dos boards (colunas, ordem dos cards, tags e
+ *          prioridades) é uma dobra (fold) sobre esses eventos: EventState.
+ *
+ *          Strings (IDs, nomes, títulos, tags) sao internadas uma única vez
+ *          e referenciadas por handles, como no ActivityLog. Assim a
+ *          reproduçao percorre um vetor contíguo de eventos sem alocar nem
+ *          lançar exceções por evento: um evento inconsistente com o estado
+ *          é apenas contado e ignorado.
+ *
+ *          A cada snapshotInterval eventos o EventStore guarda uma cópia do
+ *          estado; replay() parte do snapshot mais próximo e reproduz apenas
+ *          a cauda. save()/load() persistem o log junto com o último snapshot.
+ */
+
+#pragma once
+
+#include "HybridClock.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <istream>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+/// @brief Handle de uma string internada no EventStore
+using EventHandle = std::uint32_t;
+
+/// @brief Handle ausente
+constexpr EventHandle kNoEventHandle = std::numeric_limits<EventHandle>::max();
+
+/// @brief Posiçao desconhecida (a reproduçao procura o card na coluna)
+constexpr std::uint32_t kNoEventPosition = std::numeric_limits<std::uint32_t>::max();
+
+// ============================================================================
+// EVENTOS
+// ============================================================================
+
+/**
+ * @brief Tipo de um evento
+ */
+enum class EventKind : std::uint8_t {
+    BoardCreated,       ///< @brief subject = board, text = nome
+    ColumnAdded,        ///< @brief subject = coluna, target = board, text = nome
+    CardAdded,          ///< @brief subject = card, target = coluna, text = título
+    CardMoved,          ///< @brief subject = card, source/target = colunas, index/text = posiçao na origem/destino
+    ColumnMoved,        ///< @brief subject = coluna, target = board, source/index = posiçao antiga/nova
+    CardReordered,      ///< @brief subject = card, target = coluna, source/index = posiçao antiga/nova
+    CardTagsUpdated,    ///< @brief subject = card, text/index = início/quantidade no pool de tags
+    CardPrioritySet,    ///< @brief subject = card, index = prioridade
+    CardTitleSet,       ///< @brief subject = card, text = título
+    CardDescriptionSet  ///< @brief subject = card, text = descriçao
+};
+
+/**
+ * @brief Converte EventKind para texto
+ */
+const char* toString(EventKind kind) noexcept;
+
+/**
+ * @brief Evento de tamanho fixo do log
+ * @details Os campos sao reaproveitados conforme o tipo (ver EventKind). As
+ *          posições gravadas sao dicas: se a dica nao confere (ou é
+ *          kNoEventPosition), a reproduçao procura o elemento na lista.
+ */
+struct Event {
+    HybridTimestamp when;                   ///< @brief Instante da gravaçao (atribuído pelo EventStore)
+    EventHandle subject = kNoEventHandle;   ///< @brief Entidade criada ou alterada
+    EventHandle source = kNoEventHandle;    ///< @brief Coluna de origem ou posiçao antiga
+    EventHandle target = kNoEventHandle;    ///< @brief Board ou coluna de destino
+    EventHandle text = kNoEventHandle;      ///< @brief Nome/título ou início das tags no pool
+    std::uint32_t index = 0;                ///< @brief Posiçao, quantidade de tags ou prioridade
+    EventKind kind = EventKind::BoardCreated;
+
+    // ============================================================================
+    // FÁBRICAS
+    // ============================================================================
+
+    static Event boardCreated(EventHandle board, EventHandle name) noexcept;
+    static Event columnAdded(EventHandle column, EventHandle board, EventHandle name) noexcept;
+    static Event cardAdded(EventHandle card, EventHandle column, EventHandle title) noexcept;
+    static Event cardMoved(EventHandle card, EventHandle fromColumn, EventHandle toColumn,
+                           std::uint32_t fromPosition, std::uint32_t toPosition = kNoEventPosition) noexcept;
+    static Event columnMoved(EventHandle column, EventHandle board,
+                             std::uint32_t fromIndex, std::uint32_t toIndex) noexcept;
+    static Event cardReordered(EventHandle card, EventHandle column,
+                               std::uint32_t fromPosition, std::uint32_t toPosition) noexcept;
+    static Event cardTagsUpdated(EventHandle card, std::uint32_t firstTag, std::uint32_t tagCount) noexcept;
+    static Event cardPrioritySet(EventHandle card, int priority) noexcept;
+    static Event cardTitleSet(EventHandle card, EventHandle title) noexcept;
+    static Event cardDescriptionSet(EventHandle card, EventHandle description) noexcept;
+
+    /// @brief Prioridade de um CardPrioritySet
+    int priority() const noexcept { return static_cast<int>(static_cast<std::int32_t>(index)); }
+};
+
+static_assert(sizeof(Event) == 32, "Event deve caber em meia linha de cache");
+
+// ============================================================================
+// CLASSE EventState
+// ============================================================================
+
+/**
+ * @brief Estado estrutural dos boards obtido pela dobra dos eventos
+ * @details Entidades ficam em vetores densos (na ordem de criaçao) e se
+ *          referenciam por índices; um vetor indexado pelo handle leva do ID
+ *          à entidade. Nenhuma entidade é removida pelos eventos atuais.
+ */
+class EventState {
+public:
+    /// @brief Índice ausente nas listas de entidades
+    static constexpr std::uint32_t kNone = std::numeric_limits<std::uint32_t>::max();
+
+    struct BoardEntry {
+        EventHandle id = kNoEventHandle;
+        EventHandle name = kNoEventHandle;
+        std::vector<std::uint32_t> columns;   ///< @brief Índices em columns(), na ordem do board
+    };
+
+    struct ColumnEntry {
+        EventHandle id = kNoEventHandle;
+        EventHandle name = kNoEventHandle;
+        std::uint32_t board = kNone;          ///< @brief Índice em boards()
+        std::vector<std::uint32_t> cards;     ///< @brief Índices em cards(), na ordem da coluna
+    };
+
+    struct CardEntry {
+        EventHandle id = kNoEventHandle;
+        EventHandle title = kNoEventHandle;
+        EventHandle description = kNoEventHandle;   ///< @brief kNoEventHandle se nunca definida
+        std::uint32_t column = kNone;         ///< @brief Índice em columns()
+        std::uint32_t firstTag = 0;           ///< @brief Início das tags no pool do EventStore
+        std::uint32_t tagCount = 0;
+        int priority = 0;
+    };
+
+    /**
+     * @brief Aplica um evento ao estado
+     * @return false (e o estado fica intacto) se o evento for inconsistente
+     *         com o estado, ex.: card fora da coluna de origem
+     * @details Nao lança exceções de validaçao; só aloca quando uma lista
+     *          cresce além da sua capacidade.
+     */
+    bool apply(const Event& event);
+
+    /**
+     * @brief Aplica uma sequência de eventos
+     * @details Eventos rejeitados sao contados em rejected().
+     */
+    void apply(const Event* first, const Event* last);
+
+    /// @brief Reserva espaço para handles até count (evita realocações na reproduçao)
+    void reserveHandles(std::size_t count);
+
+    const std::vector<BoardEntry>& boards() const noexcept { return boards_; }
+    const std::vector<ColumnEntry>& columns() const noexcept { return columns_; }
+    const std::vector<CardEntry>& cards() const noexcept { return cards_; }
+
+    /// @brief Entidade pelo handle do seu ID (nullptr se nao existir)
+    const BoardEntry* findBoard(EventHandle id) const noexcept;
+    const ColumnEntry* findColumn(EventHandle id) const noexcept;
+    const CardEntry* findCard(EventHandle id) const noexcept;
+
+    /// @brief Eventos dobrados até aqui (aplicados ou rejeitados)
+    std::uint64_t sequence() const noexcept { return sequence_; }
+
+    /// @brief Eventos ignorados por inconsistência
+    std::uint64_t rejected() const noexcept { return rejected_; }
+
+    /// @brief Grava o estado em formato binário
+    void save(std::ostream& os) const;
+
+    /**
+     * @brief Lê um estado gravado por save()
+     * @throws std::runtime_error Se o conteúdo estiver truncado ou malformado
+     */
+    static EventState load(std::istream& is);
+
+private:
+    /// @brief Índices das entidades cujo ID é um handle
+    struct Slot {
+        std::uint32_t board = kNone;
+        std::uint32_t column = kNone;
+        std::uint32_t card = kNone;
+    };
+
+    Slot& slot(EventHandle id);
+    const Slot* findSlot(EventHandle id) const noexcept;
+
+    std::vector<BoardEntry> boards_;
+    std::vector<ColumnEntry> columns_;
+    std::vector<CardEntry> cards_;
+    std::vector<Slot> slots_;             ///< @brief Indexado pelo handle
+    std::uint64_t sequence_ = 0;
+    std::uint64_t rejected_ = 0;
+};
+
+// ============================================================================
+// CLASSE EventStore
+// ============================================================================
+
+/**
+ * @brief Log de eventos com dicionário de strings e snapshots periódicos
+ * @details Seguro entre threads. O estado atual é mantido junto com o log
+ *          (cada append() o atualiza), entao state() é uma cópia e nao uma
+ *          reproduçao. O chamador valida a mutaçao antes de gravá-la: o log
+ *          nao recusa eventos, e os inconsistentes aparecem em rejected().
+ *
+ *          Exemplo de uso:
+ *          @code
+ *          EventStore store;
+ *          auto board = store.intern("board_1");
+ *          store.append(Event::boardCreated(board, store.intern("Sprint")));
+ *          EventState state = store.replay(store.size());
+ *          @endcode
+ */
+class EventStore {
+public:
+    /// @brief Intervalo padrao entre snapshots (em eventos)
+    static constexpr std::size_t kDefaultSnapshotInterval = 1 << 16;
+
+    /// @brief Snapshots mantidos em memória (os mais antigos sao descartados)
+    static constexpr std::size_t kMaxSnapshots = 8;
+
+    /**
+     * @brief Construtor
+     * @param snapshotInterval Eventos entre snapshots (0 = sem snapshots)
+     */
+    explicit EventStore(std::size_t snapshotInterval = kDefaultSnapshotInterval);
+
+    EventStore(const EventStore&) = delete;
+    EventStore& operator=(const EventStore&) = delete;
+
+    // ============================================================================
+    // DICIONÁRIO
+    // ============================================================================
+
+    /// @brief Interna uma string e retorna seu handle
+    EventHandle intern(std::string_view key);
+
+    /// @brief String de um handle (vazia para handles inválidos)
+    const std::string& resolve(EventHandle handle) const;
+
+    /// @brief Strings internadas até agora
+    std::size_t handleCount() const;
+
+    /**
+     * @brief Interna as tags e as grava em sequência no pool
+     * @return Posiçao da primeira tag no pool (para Event::cardTagsUpdated)
+     */
+    std::uint32_t appendTags(const std::vector<std::string>& tags);
+
+    /// @brief Nomes das tags gravadas por appendTags()
+    std::vector<std::string> tags(std::uint32_t firstTag, std::uint32_t tagCount) const;
+
+    // ============================================================================
+    // LOG
+    // ============================================================================
+
+    /**
+     * @brief Grava um evento, atribuindo o seu timestamp
+     * @return Número de sequência (base 1)
+     */
+    std::uint64_t append(Event event);
+
+    /**
+     * @brief Grava um grupo de eventos contíguos (ex.: as mutações de um lote)
+     * @return Número de sequência do último evento do grupo
+     */
+    std::uint64_t appendGroup(std::vector<Event> group);
+
+    /// @brief Eventos gravados
+    std::uint64_t size() const;
+
+    /// @brief Evento de número de sequência sequence (base 1)
+    Event at(std::uint64_t sequence) const;
+
+    /**
+     * @brief Percorre os eventos a partir de from (base 1), em ordem
+     * @details Para auditoria e replicaçao. O log fica bloqueado para escrita
+     *          durante a visita.
+     */
+    void forEach(std::uint64_t from, const std::function<void(std::uint64_t, const Event&)>& visit) const;
+
+    // ============================================================================
+    // ESTADO E SNAPSHOTS
+    // ============================================================================
+
+    /// @brief Cópia do estado após o último evento
+    EventState state() const;
+
+    /**
+     * @brief Reconstrói o estado após os primeiros upTo eventos
+     * @details Parte do snapshot mais recente que nao ultrapassa upTo e
+     *          reproduz apenas a cauda.
+     */
+    EventState replay(std::uint64_t upTo) const;
+
+    /// @brief Snapshots em memória
+    std::size_t snapshotCount() const;
+
+    // ============================================================================
+    // PERSISTÊNCIA
+    // ============================================================================
+
+    /**
+     * @brief Grava dicionário, pool de tags, eventos e o último snapshot
+     * @details Os eventos sao gravados como um bloco binário contíguo (na
+     *          ordem de bytes da máquina).
+     */
+    void save(std::ostream& os) const;
+
+    /**
+     * @brief Carrega um log gravado por save() em um EventStore vazio
+     * @details Recupera o estado a partir do snapshot gravado, reproduzindo
+     *          só os eventos posteriores a ele.
+     * @throws std::runtime_error Se o store nao estiver vazio ou o conteúdo
+     *         estiver malformado
+     */
+    void load(std::istream& is);
+
+private:
+    /// @brief Grava o evento no log e no estado (mutex_ já adquirido)
+    void appendLocked(Event event);
+
+    const std::size_t snapshotInterval_;
+
+    mutable std::shared_mutex namesMutex_;                          ///< @brief Protege names_ e handles_
+    std::deque<std::string> names_;                                 ///< @brief Endereços estáveis
+    std::unordered_map<std::string_view, EventHandle> handles_;
+
+    mutable std::shared_mutex mutex_;                               ///< @brief Protege o restante
+    std::vector<Event> events_;
+    std::vector<EventHandle> tagPool_;
+    EventState current_;                                            ///< @brief Estado após o último evento
+    std::deque<EventState> snapshots_;                              ///< @brief Em ordem de sequência
+    HybridClock clock_;
+};
+
+} // namespace domain
+} // namespace kanban
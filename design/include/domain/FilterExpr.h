@@ -0,0 +1,259 @@
+/**
+ * @file FilterExpr.h
+ * @brief Filtros de cards como expression templates (sem despacho virtual)
+ * @details DSL header-only para montar predicados em tempo de compilaçao:
+ *          @code
+ *          using namespace kanban::domain::expr;
+ *          auto urgent = priority >= 2 && hasTag("bug") && !inColumn(doneId);
+ *          bool ok = urgent(card, columnId);
+ *          @endcode
+ *          O tipo de `urgent` codifica a árvore inteira; a avaliaçao é um
+ *          único predicado que o compilador pode expandir em linha, sem
+ *          chamadas virtuais nem clone() por nó. Quando for necessário
+ *          polimorfismo em tempo de execuçao, toFilter() embrulha a expressao
+ *          em um interfaces::IFilter.
+ *
+ *          A semântica de cada termo é a mesma dos filtros de CardFilter.h:
+ *          tags e texto ignoram maiúsculas (ASCII) e a pertinência a coluna
+ *          só é verdadeira quando a coluna do card é informada.
+ */
+
+#pragma once
+
+#include "../interfaces/IFilter.h"
+#include "Card.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace kanban {
+namespace domain {
+namespace expr {
+
+namespace detail {
+
+inline char lowerAscii(char c) noexcept {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+inline std::string toLower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), lowerAscii);
+    return text;
+}
+
+/// @brief Igualdade sem diferenciar maiúsculas; lower já está em minúsculas
+inline bool equalsLower(const std::string& text, const std::string& lower) noexcept {
+    return text.size() == lower.size() &&
+           std::equal(text.begin(), text.end(), lower.begin(),
+                      [](char a, char b) { return lowerAscii(a) == b; });
+}
+
+/// @brief Busca de trecho sem diferenciar maiúsculas; needle já está em minúsculas
+inline bool containsLower(const std::string& text, const std::string& needle) noexcept {
+    return std::search(text.begin(), text.end(), needle.begin(), needle.end(),
+                       [](char a, char b) { return lowerAscii(a) == b; }) != text.end();
+}
+
+} // namespace detail
+
+// ============================================================================
+// BASE (CRTP)
+// ============================================================================
+
+/**
+ * @brief Marca um tipo como expressao de filtro
+ * @details Derived implementa `bool operator()(const Card&, const std::string& columnId) const`.
+ */
+template<typename Derived>
+struct Expr {
+    const Derived& self() const noexcept { return static_cast<const Derived&>(*this); }
+
+    /// @brief Avalia sem coluna conhecida (inColumn() é falso)
+    bool operator()(const Card& card) const { return self()(card, std::string()); }
+};
+
+// ============================================================================
+// TERMOS
+// ============================================================================
+
+/**
+ * @brief Comparaçao da prioridade com uma constante
+ */
+template<typename Compare>
+struct PriorityCompare : Expr<PriorityCompare<Compare>> {
+    int value;
+    explicit PriorityCompare(int v) noexcept : value(v) {}
+    using Expr<PriorityCompare<Compare>>::operator();
+    bool operator()(const Card& card, const std::string&) const noexcept {
+        return Compare{}(card.priority(), value);
+    }
+};
+
+/**
+ * @brief Termo "prioridade", usado apenas em comparações (priority >= 2)
+ */
+struct PriorityTerm {};
+
+/// @brief Prioridade do card
+constexpr PriorityTerm priority{};
+
+inline PriorityCompare<std::equal_to<int>> operator==(PriorityTerm, int v) noexcept { return PriorityCompare<std::equal_to<int>>(v); }
+inline PriorityCompare<std::not_equal_to<int>> operator!=(PriorityTerm, int v) noexcept { return PriorityCompare<std::not_equal_to<int>>(v); }
+inline PriorityCompare<std::less<int>> operator<(PriorityTerm, int v) noexcept { return PriorityCompare<std::less<int>>(v); }
+inline PriorityCompare<std::less_equal<int>> operator<=(PriorityTerm, int v) noexcept { return PriorityCompare<std::less_equal<int>>(v); }
+inline PriorityCompare<std::greater<int>> operator>(PriorityTerm, int v) noexcept { return PriorityCompare<std::greater<int>>(v); }
+inline PriorityCompare<std::greater_equal<int>> operator>=(PriorityTerm, int v) noexcept { return PriorityCompare<std::greater_equal<int>>(v); }
+
+/**
+ * @brief O card tem uma tag com o nome informado
+ */
+struct HasTag : Expr<HasTag> {
+    std::string name;   ///< @brief Em minúsculas
+    explicit HasTag(std::string n) : name(detail::toLower(std::move(n))) {}
+    using Expr<HasTag>::operator();
+    bool operator()(const Card& card, const std::string&) const noexcept {
+        for (const auto& tag : card.tags()) {
+            if (detail::equalsLower(tag->name(), name)) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief O título (ou a descriçao) contém um trecho
+ */
+struct TextContains : Expr<TextContains> {
+    std::string needle;        ///< @brief Em minúsculas
+    bool description = false;  ///< @brief Procura na descriçao em vez do título
+    TextContains(std::string n, bool inDescription)
+        : needle(detail::toLower(std::move(n))), description(inDescription) {}
+    using Expr<TextContains>::operator();
+    bool operator()(const Card& card, const std::string&) const noexcept {
+        if (!description) {
+            return detail::containsLower(card.title(), needle);
+        }
+        return card.description() && detail::containsLower(*card.description(), needle);
+    }
+};
+
+/**
+ * @brief O card está na coluna informada
+ */
+struct InColumn : Expr<InColumn> {
+    std::string columnId;
+    explicit InColumn(std::string id) : columnId(std::move(id)) {}
+    using Expr<InColumn>::operator();
+    bool operator()(const Card&, const std::string& column) const noexcept {
+        return column == columnId;
+    }
+};
+
+/**
+ * @brief Data de criaçao (ou de modificaçao) no intervalo fechado [from, to]
+ */
+struct TimeBetween : Expr<TimeBetween> {
+    TimePoint from;
+    TimePoint to;
+    bool updated = false;   ///< @brief Usa updatedAt() em vez de createdAt()
+    TimeBetween(TimePoint f, TimePoint t, bool useUpdated) noexcept : from(f), to(t), updated(useUpdated) {}
+    using Expr<TimeBetween>::operator();
+    bool operator()(const Card& card, const std::string&) const noexcept {
+        TimePoint t = updated ? card.updatedAt() : card.createdAt();
+        return t >= from && t <= to;
+    }
+};
+
+inline HasTag hasTag(std::string name) { return HasTag(std::move(name)); }
+inline TextContains titleContains(std::string text) { return TextContains(std::move(text), false); }
+inline TextContains descriptionContains(std::string text) { return TextContains(std::move(text), true); }
+inline InColumn inColumn(std::string columnId) { return InColumn(std::move(columnId)); }
+inline TimeBetween createdBetween(TimePoint from, TimePoint to) noexcept { return TimeBetween(from, to, false); }
+inline TimeBetween updatedBetween(TimePoint from, TimePoint to) noexcept { return TimeBetween(from, to, true); }
+
+// ============================================================================
+// COMBINADORES
+// ============================================================================
+
+template<typename L, typename R>
+struct AndExpr : Expr<AndExpr<L, R>> {
+    L left;
+    R right;
+    AndExpr(L l, R r) : left(std::move(l)), right(std::move(r)) {}
+    using Expr<AndExpr<L, R>>::operator();
+    bool operator()(const Card& card, const std::string& column) const {
+        return left(card, column) && right(card, column);
+    }
+};
+
+template<typename L, typename R>
+struct OrExpr : Expr<OrExpr<L, R>> {
+    L left;
+    R right;
+    OrExpr(L l, R r) : left(std::move(l)), right(std::move(r)) {}
+    using Expr<OrExpr<L, R>>::operator();
+    bool operator()(const Card& card, const std::string& column) const {
+        return left(card, column) || right(card, column);
+    }
+};
+
+template<typename E>
+struct NotExpr : Expr<NotExpr<E>> {
+    E inner;
+    explicit NotExpr(E e) : inner(std::move(e)) {}
+    using Expr<NotExpr<E>>::operator();
+    bool operator()(const Card& card, const std::string& column) const {
+        return !inner(card, column);
+    }
+};
+
+template<typename L, typename R>
+AndExpr<L, R> operator&&(const Expr<L>& l, const Expr<R>& r) {
+    return AndExpr<L, R>(l.self(), r.self());
+}
+
+template<typename L, typename R>
+OrExpr<L, R> operator||(const Expr<L>& l, const Expr<R>& r) {
+    return OrExpr<L, R>(l.self(), r.self());
+}
+
+template<typename E>
+NotExpr<E> operator!(const Expr<E>& e) {
+    return NotExpr<E>(e.self());
+}
+
+// ============================================================================
+// PONTE PARA IFilter
+// ============================================================================
+
+/**
+ * @brief Expressao embrulhada como interfaces::IFilter
+ * @details Uma única chamada virtual por card para a expressao inteira.
+ */
+template<typename E>
+class ExprFilter : public interfaces::IFilter {
+public:
+    explicit ExprFilter(E e) : expr_(std::move(e)) {}
+    bool matches(const Card& card) const override { return expr_(card, std::string()); }
+    bool matchesInColumn(const Card& card, const std::string& columnId) const override { return expr_(card, columnId); }
+    std::unique_ptr<interfaces::IFilter> clone() const override { return std::make_unique<ExprFilter>(*this); }
+    const E& expression() const noexcept { return expr_; }
+
+private:
+    E expr_;
+};
+
+/**
+ * @brief Converte uma expressao em IFilter (para APIs polimórficas)
+ */
+template<typename E>
+std::unique_ptr<interfaces::IFilter> toFilter(const Expr<E>& e) {
+    return std::make_unique<ExprFilter<E>>(e.self());
+}
+
+} // namespace expr
+} // namespace domain
+} // namespace kanban
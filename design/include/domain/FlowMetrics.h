@@ -0,0 +1,127 @@
+/**
+ * @file FlowMetrics.h
+ * @brief Declaraçao das métricas de fluxo (lead time, cycle time e permanência)
+ * @details Mantidas pelo ActivityLog a cada atividade publicada, como os
+ *          rollups: cada CardMoved encerra a permanência do card na coluna de
+ *          origem e registra sua chegada à de destino. Por coluna:
+ *          - permanência: tempo entre a entrada e a saída de cada card;
+ *          - lead time: da criaçao do card até sua primeira chegada à coluna;
+ *          - cycle time: do início do trabalho (primeira saída da coluna de
+ *            entrada) até a primeira chegada à coluna;
+ *          - WIP: cards atualmente na coluna.
+ *          O lead time "do board" é o da coluna final (ex.: "Done").
+ *
+ *          Cada distribuiçao é um QuantileSketch: registrar um evento custa
+ *          O(1) amortizado e as consultas leem apenas o estado mantido, sem
+ *          reprocessar o log.
+ */
+
+#pragma once
+
+#include "ActivityLog.h"
+#include "QuantileSketch.h"
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+/**
+ * @brief Distribuições de fluxo de uma coluna
+ * @details Durações em milissegundos.
+ */
+struct ColumnFlow {
+    QuantileSketch dwell;       ///< @brief Permanência dos cards que já saíram da coluna
+    QuantileSketch leadTime;    ///< @brief Criaçao -> primeira chegada à coluna
+    QuantileSketch cycleTime;   ///< @brief Início do trabalho -> primeira chegada à coluna
+    std::size_t wip = 0;        ///< @brief Cards atualmente na coluna
+};
+
+/**
+ * @brief Histórico de fluxo de um card
+ */
+struct CardFlow {
+    std::optional<TimePoint> createdAt;   ///< @brief Ausente se o card nao foi registrado
+    std::optional<TimePoint> startedAt;   ///< @brief Primeira saída da coluna de entrada
+    std::string column;                   ///< @brief Coluna atual
+    std::optional<TimePoint> enteredAt;   ///< @brief Entrada na coluna atual
+    /// @brief Primeira chegada a cada coluna visitada, em ordem
+    std::vector<std::pair<std::string, TimePoint>> arrivals;
+};
+
+// ============================================================================
+// CLASSE FlowMetrics
+// ============================================================================
+
+/**
+ * @brief Estado incremental de fluxo dos cards e colunas de um board
+ * @note Nao é thread-safe; o ActivityLog dono serializa o acesso.
+ */
+class FlowMetrics {
+public:
+    /**
+     * @brief Registra a criaçao de um card em uma coluna
+     * @param ms Instante de criaçao (ms desde a época)
+     * @details Um card já conhecido (visto antes em alguma atividade) apenas
+     *          recebe o instante de criaçao.
+     */
+    void registerCard(ActivityHandle card, ActivityHandle column, std::uint64_t ms);
+
+    /**
+     * @brief Atualiza o estado com uma atividade publicada
+     * @details CardMoved encerra a permanência na origem e registra a chegada
+     *          ao destino; CardReordered apenas localiza cards ainda
+     *          desconhecidos. Os demais tipos sao ignorados.
+     */
+    void record(const Activity& act);
+
+    /// @brief Distribuições da coluna (vazias se ela nunca foi vista)
+    ColumnFlow column(ActivityHandle column) const;
+
+    /**
+     * @brief Histórico do card
+     * @param dictionary Log dono, para resolver os handles das colunas
+     * @return std::nullopt se o card nunca foi visto
+     */
+    std::optional<CardFlow> card(ActivityHandle card, const ActivityLog& dictionary) const;
+
+    /**
+     * @brief Criações registradas a partir de um instante
+     * @return (ms de criaçao, coluna de criaçao) de cada card registrado com
+     *         registerCard() em ms ou depois, sem ordem definida
+     */
+    std::vector<std::pair<std::uint64_t, ActivityHandle>> creationsSince(std::uint64_t ms) const;
+
+    /// @brief Número de cards acompanhados
+    std::size_t cardCount() const noexcept { return cards_.size(); }
+
+    /// @brief Descarta todo o estado
+    void clear() noexcept;
+
+private:
+    static constexpr std::uint64_t kUnknown = std::numeric_limits<std::uint64_t>::max();
+
+    struct CardState {
+        std::uint64_t createdMs = kUnknown;
+        ActivityHandle createdIn = kNoActivityHandle;
+        std::uint64_t startedMs = kUnknown;
+        std::uint64_t enteredMs = kUnknown;
+        ActivityHandle column = kNoActivityHandle;
+        /// @brief Primeira chegada a cada coluna (poucas colunas: busca linear)
+        std::vector<std::pair<ActivityHandle, std::uint64_t>> arrivals;
+    };
+
+    /// @brief Coloca o card na coluna a partir de ms
+    void enter(CardState& state, ActivityHandle column, std::uint64_t ms);
+
+    std::unordered_map<ActivityHandle, CardState> cards_;
+    std::unordered_map<ActivityHandle, ColumnFlow> columns_;
+};
+
+} // namespace domain
+} // namespace kanban
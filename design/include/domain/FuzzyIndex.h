@@ -0,0 +1,148 @@
+/**
+ * @file FuzzyIndex.h
+ * @brief Declaraçao do índice de trigramas para busca aproximada nos títulos
+ * @details Tolera erros de digitaçao: "implemnt clases" encontra
+ *          "Implementar classes de domínio". Um card é encontrado quando cada
+ *          palavra da consulta está a poucas edições (distância de
+ *          Damerau-Levenshtein, ver maxEdits()) do início de alguma palavra
+ *          do título, normalizada por tokenize().
+ *
+ *          O índice tem dois níveis:
+ *          - vocabulário: cada palavra distinta dos títulos gera trigramas,
+ *            com dois marcadores de início de palavra ("tela": "..t", ".te",
+ *            "tel", "ela"). Para cada palavra da consulta, as palavras do
+ *            vocabulário com algum trigrama em comum sao candidatas e passam
+ *            pela verificaçao de distância;
+ *          - cards: cada palavra do vocabulário lista os cards que a contêm.
+ *            Os cards que têm, para toda palavra da consulta, alguma palavra
+ *            aprovada sao o resultado.
+ *          Uma palavra sem nenhum trigrama em comum com a digitada (erro na
+ *          primeira letra de uma palavra curta: "xas" e "cas") nao é
+ *          encontrada.
+ *
+ *          Mantido como TextIndex: add() ao criar o card e, como
+ *          interfaces::ICardObserver, a cada alteraçao de título. Postings
+ *          obsoletos sao ignorados e compactados quando passam dos válidos.
+ */
+
+#pragma once
+
+#include "../interfaces/ICardObserver.h"
+#include "TextIndex.h"
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+class Card;
+
+// ============================================================================
+// CLASSE FuzzyIndex
+// ============================================================================
+
+/**
+ * @brief Índice thread-safe de trigramas dos títulos com verificaçao por
+ *        distância de ediçao
+ */
+class FuzzyIndex : public interfaces::ICardObserver {
+public:
+    /// @brief Palavras da consulta consideradas (as demais sao ignoradas)
+    static constexpr std::size_t kMaxQueryWords = 16;
+
+    /**
+     * @brief Edições toleradas em uma palavra da consulta
+     * @details 0 até 2 bytes, 1 até 5 bytes, 2 a partir de 6.
+     */
+    static int maxEdits(std::size_t wordLength) noexcept;
+
+    /**
+     * @brief Distância de Damerau-Levenshtein (transposições adjacentes)
+     *        entre a palavra e o prefixo mais próximo de text
+     * @param word Palavra digitada
+     * @param text Palavra do título
+     * @param bound Distância máxima de interesse
+     * @return A distância, ou bound + 1 se ela passar de bound
+     */
+    static int prefixDistance(const std::string& word, const std::string& text, int bound);
+
+    /**
+     * @brief Indexa (ou reindexa) o título de um card
+     */
+    void add(const std::string& boardId, const Card& card);
+
+    /**
+     * @brief Remove um card do índice (sem efeito se ele nao estiver indexado)
+     */
+    void remove(const std::string& cardId);
+
+    /**
+     * @brief Reindexa o card se o título mudou
+     * @details Cards que nao foram adicionados com add() sao ignorados.
+     */
+    void onCardTextChanged(const Card& card) override;
+
+    /**
+     * @brief Cards cujo título contém todas as palavras da consulta, a menos
+     *        de erros de digitaçao
+     * @param query Palavras digitadas
+     * @param limit Máximo de resultados
+     * @return Do mais para o menos parecido: score = 1 - edições / bytes da
+     *         consulta (1 = todas as palavras sao prefixos exatos); empates
+     *         pelo ID do card
+     */
+    std::vector<SearchHit> search(const std::string& query, std::size_t limit = 20) const;
+
+    /// @brief Número de cards indexados
+    std::size_t size() const;
+
+    /// @brief Número de palavras distintas presentes em algum título
+    std::size_t wordCount() const;
+
+private:
+    /// @brief Presença de uma palavra em uma versao de um documento
+    struct Posting {
+        std::uint32_t document;
+        std::uint32_t generation;
+    };
+
+    /// @brief Palavra do vocabulário
+    struct Word {
+        std::string text;
+        std::vector<Posting> postings;
+        std::uint32_t documents = 0;   ///< @brief Documentos válidos com a palavra
+    };
+
+    /// @brief Título indexado
+    struct Document {
+        std::string cardId;
+        std::string boardId;
+        std::uint32_t generation = 0;
+        bool alive = false;
+        std::vector<std::string> tokens;     ///< @brief tokenize(título), para detectar mudanças
+        std::vector<std::uint32_t> words;    ///< @brief Palavras distintas da versao atual
+    };
+
+    std::uint32_t wordIdLocked(const std::string& text);
+    void indexLocked(std::uint32_t index, std::vector<std::string>& tokens);
+    void unindexLocked(Document& document);
+    void compactLocked();
+
+    mutable std::shared_mutex mutex_;
+    std::vector<Word> words_;
+    std::unordered_map<std::string, std::uint32_t> wordIds_;
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> grams_;   ///< @brief Trigrama -> palavras
+    std::vector<Document> documents_;
+    std::vector<std::uint32_t> generations_;   ///< @brief Geraçao atual de cada documento (compacto, lido por posting)
+    std::unordered_map<std::string, std::uint32_t> byCard_;
+    std::vector<std::uint32_t> freeDocuments_;
+    std::size_t livePostings_ = 0;
+    std::size_t stalePostings_ = 0;
+};
+
+} // namespace domain
+} // namespace kanban
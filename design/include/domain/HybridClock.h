@@ -0,0 +1,130 @@
+/**
+ * @file HybridClock.h
+ * @brief Declaraçao do relógio lógico híbrido (HLC) usado para carimbar atividades
+ * @details Um Hybrid Logical Clock combina o tempo físico (milissegundos da
+ *          system_clock) com um contador lógico, garantindo timestamps
+ *          estritamente crescentes mesmo quando o relógio do sistema retrocede
+ *          ou quando várias atividades ocorrem no mesmo milissegundo.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace kanban {
+namespace domain {
+
+// ============================================================================
+// CLASSE HybridTimestamp
+// ============================================================================
+
+/**
+ * @brief Timestamp compacto de um Hybrid Logical Clock
+ * @details Empacota em 64 bits os 48 bits superiores de tempo físico
+ *          (milissegundos desde a época Unix) e 16 bits inferiores de
+ *          contador lógico. A ordenaçao numérica do valor empacotado
+ *          coincide com a ordenaçao causal dos eventos.
+ */
+class HybridTimestamp {
+public:
+    /// @brief Número de bits reservados ao contador lógico
+    static constexpr unsigned kLogicalBits = 16;
+
+    /**
+     * @brief Construtor padrao (timestamp zero)
+     */
+    constexpr HybridTimestamp() noexcept : packed_(0) {}
+
+    /**
+     * @brief Constrói a partir do valor empacotado
+     * @param packed Valor de 64 bits (tempo físico << 16 | lógico)
+     */
+    constexpr explicit HybridTimestamp(std::uint64_t packed) noexcept : packed_(packed) {}
+
+    /**
+     * @brief Constrói a partir de um TimePoint da system_clock
+     * @param tp Momento físico (o contador lógico é zerado)
+     * @return Timestamp com a parte física correspondente a tp
+     */
+    static HybridTimestamp fromTimePoint(std::chrono::system_clock::time_point tp) noexcept;
+
+    /// @brief Valor empacotado de 64 bits
+    constexpr std::uint64_t packed() const noexcept { return packed_; }
+
+    /// @brief Parte física em milissegundos desde a época Unix
+    constexpr std::uint64_t physicalMs() const noexcept { return packed_ >> kLogicalBits; }
+
+    /// @brief Contador lógico dentro do mesmo milissegundo
+    constexpr std::uint16_t logical() const noexcept {
+        return static_cast<std::uint16_t>(packed_ & ((1u << kLogicalBits) - 1));
+    }
+
+    /**
+     * @brief Converte para TimePoint da system_clock
+     * @return Momento físico (precisao de milissegundos)
+     */
+    std::chrono::system_clock::time_point toTimePoint() const noexcept;
+
+    constexpr bool operator==(HybridTimestamp o) const noexcept { return packed_ == o.packed_; }
+    constexpr bool operator!=(HybridTimestamp o) const noexcept { return packed_ != o.packed_; }
+    constexpr bool operator<(HybridTimestamp o) const noexcept { return packed_ < o.packed_; }
+    constexpr bool operator<=(HybridTimestamp o) const noexcept { return packed_ <= o.packed_; }
+    constexpr bool operator>(HybridTimestamp o) const noexcept { return packed_ > o.packed_; }
+    constexpr bool operator>=(HybridTimestamp o) const noexcept { return packed_ >= o.packed_; }
+
+    /**
+     * @brief Operador de saída no formato "<ms>.<lógico>"
+     */
+    friend std::ostream& operator<<(std::ostream& os, HybridTimestamp ts);
+
+private:
+    std::uint64_t packed_; ///< @brief Tempo físico e contador lógico empacotados
+};
+
+// ============================================================================
+// CLASSE HybridClock
+// ============================================================================
+
+/**
+ * @brief Gerador de HybridTimestamp monotônicos
+ * @details Cada chamada a now() retorna um timestamp estritamente maior que
+ *          o anterior. A implementaçao usa compare-and-swap sobre um único
+ *          std::atomic, sendo segura para chamadas concorrentes sem mutex.
+ */
+class HybridClock {
+public:
+    /**
+     * @brief Construtor padrao
+     */
+    HybridClock() noexcept : last_(0) {}
+
+    HybridClock(const HybridClock&) = delete;
+    HybridClock& operator=(const HybridClock&) = delete;
+
+    /**
+     * @brief Gera um novo timestamp local
+     * @return Timestamp estritamente maior que todos os anteriores deste relógio
+     */
+    HybridTimestamp now() noexcept;
+
+    /**
+     * @brief Incorpora um timestamp observado externamente (ex.: replicaçao)
+     * @param observed Timestamp recebido de outra origem
+     * @return Novo timestamp local maior que observed e que o último emitido
+     */
+    HybridTimestamp observe(HybridTimestamp observed) noexcept;
+
+    /**
+     * @brief Último timestamp emitido (sem avançar o relógio)
+     */
+    HybridTimestamp last() const noexcept;
+
+private:
+    std::atomic<std::uint64_t> last_; ///< @brief Último valor empacotado emitido
+};
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,115 @@
+/**
+ * @file PrefixTrie.h
+ * @brief Declaraçao da trie radix (compactada) para completamento por prefixo
+ * @details Cada entrada tem um ID, um texto exibido e um rank. A chave é o
+ *          texto normalizado por domain::foldText(), de modo que "aca"
+ *          completa "Ação". Cada nó guarda as kCachedTop melhores entradas
+ *          da sua subárvore, mantidas a cada inserçao e remoçao: completar
+ *          um prefixo com até kCachedTop resultados custa apenas a descida
+ *          pelo prefixo, independentemente de quantas entradas ele cobre.
+ *
+ *          Nao é thread-safe; ver domain::CompletionIndex.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+/**
+ * @brief Ordem das entradas: maior primary primeiro, depois maior secondary
+ */
+struct CompletionRank {
+    std::int64_t primary = 0;     ///< @brief Ex.: prioridade do card
+    std::int64_t secondary = 0;   ///< @brief Ex.: instante da última alteraçao
+
+    bool operator<(const CompletionRank& other) const noexcept {
+        return primary != other.primary ? primary < other.primary : secondary < other.secondary;
+    }
+};
+
+/**
+ * @brief Uma sugestao de completamento
+ */
+struct Completion {
+    std::string id;     ///< @brief ID da entrada (ex.: ID do card)
+    std::string text;   ///< @brief Texto original, como inserido
+};
+
+// ============================================================================
+// CLASSE PrefixTrie
+// ============================================================================
+
+/**
+ * @brief Trie radix de textos normalizados com top-K por nó
+ */
+class PrefixTrie {
+public:
+    /// @brief Entradas melhor ranqueadas guardadas em cada nó
+    static constexpr std::size_t kCachedTop = 16;
+
+    PrefixTrie();
+    ~PrefixTrie();
+    PrefixTrie(PrefixTrie&&) noexcept;
+    PrefixTrie& operator=(PrefixTrie&&) noexcept;
+
+    /**
+     * @brief Insere a entrada, ou atualiza texto e rank se o ID já existir
+     */
+    void insert(const std::string& id, const std::string& text, CompletionRank rank);
+
+    /**
+     * @brief Remove a entrada
+     * @return false se o ID nao existir
+     */
+    bool erase(const std::string& id);
+
+    /**
+     * @brief Entradas cujo texto normalizado começa com o prefixo normalizado
+     * @param prefix Prefixo digitado (vazio = todas)
+     * @param limit Máximo de sugestões
+     * @return Da melhor para a pior (rank decrescente, depois ID crescente)
+     */
+    std::vector<Completion> complete(const std::string& prefix, std::size_t limit) const;
+
+    /**
+     * @brief Todas as entradas, em ordem alfabética do texto normalizado
+     */
+    std::vector<Completion> entries() const;
+
+    /// @brief Número de entradas
+    std::size_t size() const noexcept { return byId_.size(); }
+
+private:
+    struct Node;
+
+    /// @brief Entrada armazenada (slot reutilizável)
+    struct Entry {
+        std::string id;
+        std::string text;
+        std::string key;   ///< @brief foldText(text)
+        CompletionRank rank;
+    };
+
+    bool better(std::uint32_t a, std::uint32_t b) const noexcept;
+    std::vector<Node*> pathTo(const std::string& key) const;
+    void promote(const std::vector<Node*>& path, std::uint32_t entry);
+    void recompute(Node& node);
+    void remove(std::uint32_t entry);
+    void collect(const Node& node, std::vector<std::uint32_t>& out) const;
+
+    std::unique_ptr<Node> root_;
+    std::vector<Entry> entries_;
+    std::vector<std::uint32_t> freeEntries_;
+    std::unordered_map<std::string, std::uint32_t> byId_;
+};
+
+} // namespace domain
+} // namespace kanban
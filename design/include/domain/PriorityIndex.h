@@ -0,0 +1,78 @@
+/**
+ * @file PriorityIndex.h
+ * @brief Declaraçao do índice ordenado de cards por urgência
+ * @details Mantém os cards de um board na ordem de Card::operator< (maior
+ *          prioridade primeiro, depois o mais antigo), em um std::set
+ *          atualizado a cada inclusao e a cada mudança de prioridade: os K
+ *          mais urgentes sao os K primeiros elementos, sem ordenar o board a
+ *          cada consulta. Atualizar um card custa O(log n); consultar, O(K).
+ */
+
+#pragma once
+
+#include "Card.h"
+#include <cstddef>
+#include <memory>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+// ============================================================================
+// CLASSE PriorityIndex
+// ============================================================================
+
+/**
+ * @brief Cards de um board ordenados por urgência, thread-safe
+ */
+class PriorityIndex {
+public:
+    /**
+     * @brief Inclui o card ou reposiciona-o se já estiver no índice
+     */
+    void add(const std::shared_ptr<Card>& card);
+
+    /**
+     * @brief Reposiciona o card após mudança de prioridade
+     * @details Cards que nao foram incluídos com add() sao ignorados.
+     */
+    void update(const Card& card);
+
+    /**
+     * @brief Remove o card (sem efeito se ele nao estiver no índice)
+     */
+    void remove(const std::string& cardId);
+
+    /**
+     * @brief Os k cards mais urgentes
+     * @return Na ordem de Card::operator< (empates pelo ID do card)
+     */
+    std::vector<std::shared_ptr<Card>> top(std::size_t k) const;
+
+    /// @brief Número de cards no índice
+    std::size_t size() const;
+
+private:
+    /// @brief Elemento do conjunto: campos de ordenaçao copiados na última atualizaçao
+    struct Key {
+        int priority;
+        TimePoint createdAt;
+        std::string cardId;
+        std::shared_ptr<Card> card;   ///< @brief Nao participa da ordem
+
+        bool operator<(const Key& other) const noexcept;
+    };
+
+    static Key keyOf(const std::shared_ptr<Card>& card);
+
+    mutable std::shared_mutex mutex_;
+    std::set<Key> order_;
+    std::unordered_map<std::string, std::set<Key>::const_iterator> positions_;
+};
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,99 @@
+/**
+ * @file QuantileSketch.h
+ * @brief Declaraçao do sketch de quantis com erro relativo limitado
+ * @details Distribuiçao de durações (em milissegundos) resumida em buckets
+ *          de largura logarítmica: o valor v cai no bucket
+ *          ceil(log(v) / log(gamma)), com gamma = (1 + a) / (1 - a). Qualquer
+ *          quantil é estimado com erro relativo de no máximo a (1% por
+ *          padrao), seja a duraçao de segundos ou de meses.
+ *
+ *          add() é O(1); quantile() percorre os buckets ocupados (algumas
+ *          centenas para durações de até um ano). A memória nao cresce com o
+ *          número de amostras.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+// ============================================================================
+// CLASSE QuantileSketch
+// ============================================================================
+
+/**
+ * @brief Histograma logarítmico de durações com quantis aproximados
+ * @note Nao é thread-safe; o dono serializa o acesso.
+ */
+class QuantileSketch {
+public:
+    /// @brief Erro relativo padrao dos quantis
+    static constexpr double kDefaultAccuracy = 0.01;
+
+    /// @brief Cria um sketch vazio com a precisao padrao
+    QuantileSketch() : QuantileSketch(kDefaultAccuracy) {}
+
+    /**
+     * @brief Cria um sketch vazio
+     * @param relativeAccuracy Erro relativo máximo, em (0, 1)
+     * @throws std::invalid_argument Se a precisao estiver fora do intervalo
+     */
+    explicit QuantileSketch(double relativeAccuracy);
+
+    /**
+     * @brief Registra uma amostra
+     * @param ms Duraçao em milissegundos
+     */
+    void add(std::uint64_t ms);
+
+    /**
+     * @brief Soma as amostras de outro sketch
+     * @details Os dois devem ter sido criados com a mesma precisao.
+     */
+    void merge(const QuantileSketch& other);
+
+    /**
+     * @brief Valor aproximado do quantil q
+     * @param q Em [0, 1] (0.5 = mediana, 0.85 = percentil 85)
+     * @return Duraçao em ms, exata nos extremos (min e max); 0 se vazio
+     */
+    std::uint64_t quantile(double q) const;
+
+    /// @brief Número de amostras
+    std::uint64_t count() const noexcept { return count_; }
+
+    /// @brief Média exata das amostras (0 se vazio)
+    double mean() const noexcept;
+
+    /// @brief Menor amostra (0 se vazio)
+    std::uint64_t min() const noexcept { return count_ == 0 ? 0 : min_; }
+
+    /// @brief Maior amostra
+    std::uint64_t max() const noexcept { return max_; }
+
+    /// @brief true se nenhuma amostra foi registrada
+    bool empty() const noexcept { return count_ == 0; }
+
+    /// @brief Descarta todas as amostras
+    void clear() noexcept;
+
+private:
+    std::size_t bucketOf(std::uint64_t ms) const;
+    std::uint64_t valueOf(std::size_t bucket) const;
+
+    double gamma_;
+    double logGamma_;
+    std::vector<std::uint64_t> buckets_;   ///< @brief buckets_[i]: amostras em (gamma^(i-1), gamma^i]
+    std::uint64_t zeros_ = 0;              ///< @brief Amostras iguais a 0
+    std::uint64_t count_ = 0;
+    std::uint64_t min_ = 0;
+    std::uint64_t max_ = 0;
+    long double sum_ = 0;
+};
+
+} // namespace domain
+} // namespace kanban
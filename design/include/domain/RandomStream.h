@@ -0,0 +1,94 @@
+/**
+ * @file RandomStream.h
+ * @brief Declaraçao do gerador pseudoaleatório para simulações paralelas
+ * @details xoshiro256** (Blackman e Vigna): 256 bits de estado, período
+ *          2^256 - 1 e poucas instruções por número. jump() avança o estado
+ *          2^128 posições, o que permite derivar de uma única semente fluxos
+ *          independentes e sem sobreposiçao, um por tarefa; o resultado de
+ *          uma simulaçao nao depende de quantas threads a executam.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+// ============================================================================
+// CLASSE RandomStream
+// ============================================================================
+
+/**
+ * @brief Fluxo de números pseudoaleatórios (xoshiro256**)
+ * @details Satisfaz UniformRandomBitGenerator, podendo ser usado com as
+ *          distribuições e algoritmos da biblioteca padrao.
+ * @note Nao é thread-safe: cada thread usa o seu próprio fluxo.
+ */
+class RandomStream {
+public:
+    using result_type = std::uint64_t;
+
+    /**
+     * @brief Constrói o fluxo a partir de uma semente
+     * @details O estado é expandido da semente com splitmix64, que nunca
+     *          produz o estado todo zero.
+     */
+    explicit RandomStream(std::uint64_t seed) noexcept;
+
+    /**
+     * @brief Próximo número de 64 bits
+     */
+    std::uint64_t next() noexcept {
+        const std::uint64_t result = rotl(state_[1] * 5, 7) * 9;
+        const std::uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+
+    /**
+     * @brief Inteiro uniforme em [0, bound)
+     * @param bound Limite exclusivo (> 0)
+     * @details Multiplicaçao e deslocamento (Lemire) sobre os 32 bits altos,
+     *          sem divisao; o viés é de no máximo bound / 2^32.
+     */
+    std::uint32_t below(std::uint32_t bound) noexcept {
+        return static_cast<std::uint32_t>(((next() >> 32) * bound) >> 32);
+    }
+
+    /**
+     * @brief Avança o fluxo 2^128 posições
+     */
+    void jump() noexcept;
+
+    /**
+     * @brief Fluxos independentes derivados de uma semente
+     * @param seed Semente comum
+     * @param count Número de fluxos
+     * @return count fluxos, cada um 2^128 posições à frente do anterior
+     */
+    static std::vector<RandomStream> streams(std::uint64_t seed, std::size_t count);
+
+    result_type operator()() noexcept { return next(); }
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return std::numeric_limits<result_type>::max(); }
+
+private:
+    static std::uint64_t rotl(std::uint64_t x, int k) noexcept {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    std::array<std::uint64_t, 4> state_;
+};
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,133 @@
+/**
+ * @file TextIndex.h
+ * @brief Declaraçao do índice invertido de texto completo dos cards
+ * @details Indexa título e descriçao de cards de todos os boards, com os
+ *          tokens normalizados por domain::tokenize() (sem maiúsculas nem
+ *          acentos). É atualizado incrementalmente: add() ao criar o card e,
+ *          como interfaces::ICardObserver, a cada setTitle()/setDescription().
+ *
+ *          As consultas têm vários termos e devolvem os cards ordenados por
+ *          relevância (BM25), com os termos do título valendo kTitleWeight
+ *          vezes os da descriçao. Cards que contêm mais termos da consulta,
+ *          termos mais raros ou com mais ocorrências ficam à frente.
+ *
+ *          Postings obsoletos (de cards reindexados ou removidos) sao
+ *          ignorados na consulta e compactados quando passam do número de
+ *          postings válidos, de modo que editar um card nao percorre as
+ *          listas dos termos que ele continha.
+ */
+
+#pragma once
+
+#include "../interfaces/ICardObserver.h"
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+class Card;
+
+/**
+ * @brief Um card encontrado por TextIndex::search()
+ */
+struct SearchHit {
+    std::string cardId;    ///< @brief Card encontrado
+    std::string boardId;   ///< @brief Board dono do card
+    double score = 0.0;    ///< @brief Relevância (maior = mais relevante)
+};
+
+// ============================================================================
+// CLASSE TextIndex
+// ============================================================================
+
+/**
+ * @brief Índice invertido thread-safe sobre título e descriçao dos cards
+ */
+class TextIndex : public interfaces::ICardObserver {
+public:
+    /// @brief Peso de uma ocorrência no título em relaçao à descriçao
+    static constexpr float kTitleWeight = 2.0f;
+
+    /**
+     * @brief Indexa (ou reindexa) um card
+     * @param boardId Board dono do card
+     * @param card Card a indexar
+     */
+    void add(const std::string& boardId, const Card& card);
+
+    /**
+     * @brief Remove um card do índice (sem efeito se ele nao estiver indexado)
+     */
+    void remove(const std::string& cardId);
+
+    /**
+     * @brief Reindexa o card após alteraçao de texto
+     * @details Cards que nao foram adicionados com add() sao ignorados.
+     */
+    void onCardTextChanged(const Card& card) override;
+
+    /**
+     * @brief Cards mais relevantes para a consulta
+     * @param query Texto livre; cada token é um termo
+     * @param limit Máximo de resultados
+     * @return Cards com ao menos um termo, do mais para o menos relevante
+     *         (empates pelo ID do card)
+     */
+    std::vector<SearchHit> search(const std::string& query, std::size_t limit = 20) const;
+
+    /// @brief Número de cards indexados
+    std::size_t size() const;
+
+    /// @brief Número de termos distintos presentes em algum card
+    std::size_t termCount() const;
+
+private:
+    /// @brief Ocorrência de um termo em um documento
+    struct Posting {
+        std::uint32_t document;
+        std::uint32_t generation;   ///< @brief Versao do documento que gerou o posting
+        float frequency;            ///< @brief Ocorrências ponderadas (título x kTitleWeight)
+    };
+
+    /// @brief Lista de postings de um termo
+    struct Term {
+        std::vector<Posting> postings;
+        std::uint32_t documents = 0;   ///< @brief Documentos válidos com o termo
+    };
+
+    /// @brief Card indexado
+    struct Document {
+        std::string cardId;
+        std::string boardId;
+        std::uint32_t generation = 0;
+        float length = 0;            ///< @brief Tokens ponderados
+        bool alive = false;
+        std::vector<Term*> terms;    ///< @brief Termos distintos da versao atual
+    };
+
+    /// @brief Termos distintos de um card com as ocorrências ponderadas
+    using WeightedTerms = std::vector<std::pair<std::string, float>>;
+
+    static WeightedTerms weighTerms(const Card& card);
+    void indexLocked(std::uint32_t index, WeightedTerms& weighted);
+    void unindexLocked(Document& document);
+    void compactLocked();
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, Term> terms_;   ///< @brief Nós estáveis: Document guarda Term*
+    std::vector<Document> documents_;
+    std::unordered_map<std::string, std::uint32_t> byCard_;
+    std::vector<std::uint32_t> freeDocuments_;
+    std::size_t livePostings_ = 0;
+    std::size_t stalePostings_ = 0;
+    double totalLength_ = 0;
+};
+
+} // namespace domain
+} // namespace kanban
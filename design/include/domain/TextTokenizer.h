@@ -0,0 +1,42 @@
+/**
+ * @file TextTokenizer.h
+ * @brief Declaraçao da normalizaçao e tokenizaçao de texto para busca
+ * @details Texto UTF-8 é normalizado para comparaçao sem diferenciar
+ *          maiúsculas nem acentos: "Ação", "AÇÃO" e "acao" viram "acao".
+ *
+ *          - Latin-1 (U+00C0-U+00FF), que cobre o português, é convertido
+ *            para a letra base minúscula (ç -> c, ã -> a, ß -> ss, æ -> ae);
+ *          - marcas combinantes (U+0300-U+036F, texto decomposto) sao
+ *            descartadas, de modo que "a" + U+0303 também vira "a";
+ *          - pontuaçao ASCII, pontuaçao Latin-1 (U+00A0-U+00BF, × e ÷) e
+ *            pontuaçao geral (U+2000-U+206F) separam tokens;
+ *          - demais caracteres nao ASCII sao mantidos como estao;
+ *          - bytes UTF-8 inválidos sao tratados como separadores.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+
+/// @brief Tamanho máximo, em bytes, de um token
+constexpr std::size_t kMaxTokenBytes = 64;
+
+/**
+ * @brief Texto em minúsculas e sem acentos, com a pontuaçao preservada
+ */
+std::string foldText(const std::string& text);
+
+/**
+ * @brief Divide o texto em tokens normalizados (ver foldText())
+ * @return Tokens na ordem em que aparecem, com repetições
+ * @details Tokens com mais de kMaxTokenBytes bytes sao truncados.
+ */
+std::vector<std::string> tokenize(const std::string& text);
+
+} // namespace domain
+} // namespace kanban
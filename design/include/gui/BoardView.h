@@ -0,0 +1,64 @@
+#ifndef BOARDVIEW_H
+#define BOARDVIEW_H
+
+#include <QString>
+#include <QStringList>
+#include <string>
+#include <vector>
+
+#include "domain/Card.h"
+
+namespace kanban {
+namespace gui {
+
+// Cópias dos dados exibidos, montadas dentro de AsyncKanbanService::call:
+// os widgets nunca leem objetos do domínio na thread da interface.
+
+struct CardView {
+    std::string id;
+    QString title;
+    QString description;
+    int priority = 0;
+    QStringList tags;
+    bool visible = true;   // aceito pelos filtros ativos
+
+    static CardView of(const domain::Card& card) {
+        CardView view;
+        view.id = card.id();
+        view.title = QString::fromStdString(card.title());
+        if (card.description().has_value()) {
+            view.description = QString::fromStdString(*card.description());
+        }
+        view.priority = card.priority();
+        for (const auto& tag : card.tags()) {
+            view.tags << QString::fromStdString(tag->name());
+        }
+        return view;
+    }
+};
+
+struct ColumnView {
+    std::string id;
+    QString name;
+    std::vector<CardView> cards;   // todos os cards, na ordem da coluna
+
+    // Posição de um card na coluna (entre todos, não só os visíveis), ou -1
+    int indexOf(const QString& cardId) const {
+        const std::string id = cardId.toStdString();
+        for (int i = 0; i < static_cast<int>(cards.size()); ++i) {
+            if (cards[i].id == id) return i;
+        }
+        return -1;
+    }
+};
+
+struct BoardView {
+    std::string id;
+    QString name;
+    std::vector<ColumnView> columns;
+};
+
+} // namespace gui
+} // namespace kanban
+
+#endif // BOARDVIEW_H
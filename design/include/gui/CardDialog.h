@@ -14,8 +14,11 @@
 // ADICIONE ESTES INCLUDES:
 #include <QListWidget>
 #include <QStringList>
+#include <QStringListModel>
+#include <functional>
+#include <optional>
 
-#include "domain/Card.h"
+#include "gui/BoardView.h"
 
 namespace kanban {
 namespace gui {
@@ -24,19 +27,25 @@ class CardDialog : public QDialog {
     Q_OBJECT
 
 public:
-    explicit CardDialog(std::shared_ptr<domain::Card> card = nullptr, QWidget *parent = nullptr);
+    explicit CardDialog(const std::optional<CardView>& card = std::nullopt, QWidget *parent = nullptr);
 
     QString getTitle() const;
     QString getDescription() const;
     int getPriority() const;
     QStringList getTags() const;  // ADICIONE ESTE MÉTODO
 
+    // Fonte das sugestões de tags (prefixo -> nomes); nula = só as tags comuns
+    using TagCompletionProvider = std::function<QStringList(const QString& prefix)>;
+    static void setTagCompletionProvider(TagCompletionProvider provider);
+
 private:
     void setupUI();
     void addTag();     // ADICIONE ESTE
     void removeTag();  // ADICIONE ESTE
+    void updateTagCompletions(const QString& prefix);
+    
+    static TagCompletionProvider tagCompletionProvider_;
     
-    std::shared_ptr<domain::Card> card_;
     QLineEdit *titleEdit_;
     QTextEdit *descriptionEdit_;
     QComboBox *priorityCombo_;
@@ -46,6 +55,7 @@ private:
     // ADICIONE ESTES:
     QListWidget *tagsListWidget_;
     QComboBox *tagsComboBox_;
+    QStringListModel *tagCompletionModel_;
     QPushButton *addTagButton_;
     QPushButton *removeTagButton_;
 };
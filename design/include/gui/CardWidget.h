@@ -6,13 +6,14 @@
 #include <QVBoxLayout>
 #include <QMouseEvent>
 #include <QDrag>
+#include <QStringList>
 #include <QMimeData>
 #include <QApplication>
 #include <QHBoxLayout>  // ADICIONE ESTE
 #include <QFrame>       // ADICIONE ESTE
 #include <QPushButton>
 
-#include "domain/Card.h"
+#include "gui/BoardView.h"
 
 namespace kanban {
 namespace gui {
@@ -21,9 +22,9 @@ class CardWidget : public QWidget {
     Q_OBJECT
 
 public:
-    explicit CardWidget(std::shared_ptr<domain::Card> card, QWidget *parent = nullptr);
-    std::string getCardId() const { return card_->id(); }
-    std::shared_ptr<domain::Card> getCard() const { return card_; }
+    explicit CardWidget(CardView card, QWidget *parent = nullptr);
+    std::string getCardId() const { return card_.id; }
+    const CardView& getCard() const { return card_; }
     void applyFilter(bool visible);
 
 protected:
@@ -36,7 +37,7 @@ private:
     void updateUI();
     void updateTagsDisplay();  // ADICIONE ESTE MÉTODO
 
-    std::shared_ptr<domain::Card> card_;
+    CardView card_;   // cópia: o card do domínio pertence ao executor do serviço
     QPoint dragStartPosition_;
     QLabel *titleLabel_;
     QLabel *descriptionLabel_;
@@ -48,6 +49,9 @@ private:
 signals:
     void moveUpRequested(const QString& cardId);
     void moveDownRequested(const QString& cardId);
+    // Edição confirmada no diálogo: quem aplica é o serviço, não o widget
+    void editRequested(const QString& cardId, const QString& title, const QString& description,
+                       int priority, const QStringList& tags);
 };
 
 } // namespace gui
@@ -15,7 +15,7 @@
 #include <QMouseEvent>
 #include <QDrag>
 #include "gui/CardWidget.h" // ADICIONE ESTE INCLUD
-#include "domain/Column.h"
+#include "gui/BoardView.h"
 
 namespace kanban {
 namespace gui {
@@ -26,11 +26,11 @@ class ColumnWidget : public QFrame {
     Q_OBJECT
 
 public:
-    explicit ColumnWidget(std::shared_ptr<domain::Column> column, QWidget *parent = nullptr);
-    std::string getColumnId() const { return column_->id(); }
-    // Now accepts an optional predicate to filter which cards are displayed.
-    // If predicate is empty, all cards are shown.
-    void refreshCards(std::function<bool(std::shared_ptr<kanban::domain::Card>)> predicate = nullptr);
+    explicit ColumnWidget(ColumnView column, QWidget *parent = nullptr);
+    std::string getColumnId() const { return column_.id; }
+    // Substitui os cards exibidos pela cópia mais recente da coluna; só os
+    // cards marcados como visíveis pelos filtros são criados.
+    void setColumn(ColumnView column);
     
     // ADICIONE ESTE MÉTODO:
     std::vector<CardWidget*> cardWidgets() const;
@@ -42,6 +42,8 @@ signals:
     void cardMoved(const QString& cardId, const QString& fromColumnId, const QString& toColumnId);
     void cardAdded(const QString& columnId, const QString& title);
     void cardReordered(const QString& columnId, const QString& cardId, int newIndex);
+    void cardEdited(const QString& columnId, const QString& cardId, const QString& title,
+                    const QString& description, int priority, const QStringList& tags);
     void columnMoved(const QString& fromColumnId, const QString& toColumnId);
 
 protected:
@@ -54,11 +56,13 @@ protected:
 
 private:
     void setupUI();
+    void refreshCards();
     int calculateDropIndex(const QPoint& pos);
     int calculateDropIndicatorPosition(int index); // ADICIONE ESTA LINHA
 
-    std::shared_ptr<domain::Column> column_;
+    ColumnView column_;
     QVBoxLayout *mainLayout_;
+    QLabel *countLabel_;
     QVBoxLayout *cardsLayout_;
     QScrollArea *scrollArea_;
     QWidget *scrollWidget_;
@@ -0,0 +1,36 @@
+#ifndef CUMULATIVEFLOWWIDGET_H
+#define CUMULATIVEFLOWWIDGET_H
+
+#include <QWidget>
+#include <QStringList>
+#include <QPaintEvent>
+
+#include "domain/CumulativeFlow.h"
+
+namespace kanban {
+namespace gui {
+
+// Diagrama de fluxo cumulativo: uma faixa empilhada por coluna, com a
+// última coluna do board (ex.: "Done") na base, como é usual em CFDs.
+class CumulativeFlowWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit CumulativeFlowWidget(QWidget *parent = nullptr);
+
+    void setFlow(const domain::CumulativeFlow& flow, const QStringList& columnNames);
+    void clear();
+    QSize sizeHint() const override;
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+
+private:
+    domain::CumulativeFlow flow_;
+    QStringList columnNames_;
+};
+
+} // namespace gui
+} // namespace kanban
+
+#endif // CUMULATIVEFLOWWIDGET_H
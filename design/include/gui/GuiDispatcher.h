@@ -0,0 +1,27 @@
+#ifndef GUIDISPATCHER_H
+#define GUIDISPATCHER_H
+
+#include <QMetaObject>
+#include <QObject>
+#include <functional>
+
+#include "application/AsyncKanbanService.h"
+
+namespace kanban {
+namespace gui {
+
+// Dispatcher do AsyncKanbanService que entrega os callbacks no laço de
+// eventos da thread de `context` (a thread da interface, para widgets).
+// Callbacks ainda na fila quando `context` é destruído são descartados pelo Qt.
+// Atenção: o serviço assíncrono deve ser destruído antes de `context`, pois
+// o executor usa o ponteiro ao entregar as conclusões pendentes.
+inline application::AsyncKanbanService::Dispatcher guiDispatcher(QObject *context) {
+    return [context](std::function<void()> callback) {
+        QMetaObject::invokeMethod(context, std::move(callback), Qt::QueuedConnection);
+    };
+}
+
+} // namespace gui
+} // namespace kanban
+
+#endif // GUIDISPATCHER_H
@@ -23,10 +23,19 @@
 #include <QGroupBox>
 #include <QCheckBox>
 #include <QComboBox>
+#include <QStringListModel>
 #include <set>
-
-#include "application/KanbanService.h"
+#include <optional>
+#include <unordered_set>
+#include <vector>
+#include <functional>
+#include <cstdint>
+
+#include "application/AsyncKanbanService.h"
+#include "application/ReadModel.h"
+#include "gui/BoardView.h"
 #include "gui/ColumnWidget.h"
+#include "gui/CumulativeFlowWidget.h"
 
 namespace kanban {
 namespace gui {
@@ -48,6 +57,11 @@ private slots:
     void onCardMoved(const QString& cardId, const QString& fromColumnId, const QString& toColumnId);
     void onCardAdded(const QString& columnId, const QString& title);
     void onCardReordered(const QString& columnId, const QString& cardId, int newIndex);
+    void onCardEdited(const QString& columnId, const QString& cardId, const QString& title,
+                      const QString& description, int priority, const QStringList& tags);
+    void updateCumulativeFlow();
+    void undoLastChange();
+    void redoLastChange();
 
 private:
     void setupUI();
@@ -55,20 +69,36 @@ private:
     void setupMenuBar();
     void loadSampleData();
     void refreshCurrentBoard(bool forceRebuild = false);
+    void renderBoard(const BoardView& view, bool forceRebuild);   // desenha a cópia, sem ler o domínio
     void refreshSpecificColumns(const std::string& fromColumnId, const std::string& toColumnId);
     void clearBoardTab();
     void refreshActivityLog();
     void updateStatistics();
+    void renderStatistics();   // lê a projeçao do board atual, sem consultar o serviço
 
     // ADICIONE ESTAS DECLARAÇÕES DOS NOVOS MÉTODOS:
     void setupFilterPanel();
     void applyFilters();
     void clearFilters();
     void refreshFilterTags();
-    bool cardMatchesFilter(std::shared_ptr<domain::Card> card);
-
-    // Serviço de aplicação
-    std::unique_ptr<application::KanbanService> service_;
+    void rebuildFilterPlan();
+    void updateTitleCompletions(const QString& prefix);
+
+    // Alterações enviadas ao serviço assíncrono; a conclusão volta ao laço de eventos
+    template<typename Fn, typename Done>
+    void mutate(Fn&& fn, Done&& onDone, const QString& errorText);
+
+    // Serviço de aplicação: as chamadas rodam no executor, nunca na thread da interface
+    std::unique_ptr<application::AsyncKanbanService> service_;
+    std::shared_ptr<application::ReadModel> readModel_;   // estatísticas e tags pré-calculadas
+    std::uint64_t boardRequest_ = 0;                     // descarta resultados obsoletos
+    bool rebuildPending_ = false;                        // um redesenho descartado pedia reconstrução
+    std::uint64_t flowRequest_ = 0;
+    std::uint64_t searchRequest_ = 0;
+    std::uint64_t completionRequest_ = 0;
+    std::uint64_t activityRequest_ = 0;
+    std::vector<std::pair<std::string, QString>> boardList_;   // (ID, nome) na ordem da lista lateral
+    std::string selectAfterRefresh_;                     // board a selecionar quando a lista chegar
 
     // Componentes da UI
     QTabWidget *boardsTabWidget_;
@@ -80,10 +110,14 @@ private:
     QTextEdit *activityLogTextEdit_;
     QPushButton *refreshActivityLogButton_;
     QLabel *statsLabel_;
+    QComboBox *cfdWindowCombo_;               // janela do fluxo cumulativo
+    CumulativeFlowWidget *cfdWidget_;
 
     // ADICIONE ESTES NOVOS COMPONENTES:
     QGroupBox *filterGroup_;
     QComboBox *tagFilterCombo_;
+    QLineEdit *textSearchEdit_;
+    QStringListModel *titleCompletionModel_;   // sugestões de título do board atual
     QCheckBox *highPriorityFilter_;
     QCheckBox *mediumPriorityFilter_;
     QCheckBox *lowPriorityFilter_;
@@ -93,6 +127,8 @@ private:
     // Estado dos filtros
     QString currentTagFilter_;
     std::set<int> currentPriorityFilters_;
+    std::optional<domain::FilterPlan> filterPlan_;   // filtros acima, compilados
+    std::optional<std::unordered_set<std::string>> textMatches_;   // cards da busca de texto
 
     // Mapeamento de widgets por board
     std::map<std::string, std::map<std::string, ColumnWidget*>> columnWidgetsByBoard_;
@@ -0,0 +1,154 @@
+/**
+ * @file IActivityArchive.h
+ * @brief Declaraçao da interface IActivityArchive para arquivamento de atividades antigas
+ * @details Define o contrato usado pelo ActivityLog para descarregar (spill)
+ *          atividades que excedem a capacidade em memória para um meio
+ *          secundário, e para lê-las de volta de forma transparente em
+ *          consultas por intervalo de tempo.
+ */
+
+#pragma once
+
+#include "../domain/HybridClock.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace kanban {
+namespace domain {
+    // Forward declarations para reduzir acoplamento
+    class Activity;
+    class ActivityLog;
+    enum class ActivityKind : std::uint8_t;
+    using ActivityHandle = std::uint32_t;
+}
+
+namespace interfaces {
+
+// ============================================================================
+// INTERFACE IActivityArchive
+// ============================================================================
+
+/**
+ * @brief Interface para a camada fria (arquivada) do ActivityLog
+ * @details O ActivityLog mantém em memória apenas as atividades mais recentes.
+ *          Quando a capacidade é atingida, os lotes mais antigos sao entregues
+ *          a um IActivityArchive, que os grava em formato imutável.
+ *
+ *          O ActivityLog é passado como dicionário para que a implementaçao
+ *          possa traduzir handles em strings na gravaçao e strings em handles
+ *          na leitura.
+ *
+ * @note Lotes sao sempre entregues em ordem cronológica crescente.
+ */
+class IActivityArchive {
+public:
+    /// @brief Funçao chamada para cada atividade lida do arquivo
+    using Visitor = std::function<void(const domain::Activity&)>;
+
+    /**
+     * @brief Destrutor virtual padrao
+     */
+    virtual ~IActivityArchive() = default;
+
+    /**
+     * @brief Lote já gravado e ainda invisível às consultas
+     * @details Destruído sem publish(), descarta o que foi gravado.
+     */
+    class PendingAppend {
+    public:
+        virtual ~PendingAppend() = default;
+    };
+
+    /**
+     * @brief Grava um lote de atividades (as mais antigas do log) sem publicá-lo
+     * @param batch Atividades em ordem cronológica
+     * @param dictionary Log dono dos handles presentes nas atividades
+     * @return Gravaçao pendente, a ser entregue a publish()
+     * @throws std::runtime_error ou derivada em caso de falha de gravaçao
+     * @details Chamado pela thread de descarga do ActivityLog, nunca no
+     *          caminho de mutaçao, e sem excluir os leitores: pode executar
+     *          em paralelo com as consultas abaixo.
+     */
+    virtual std::unique_ptr<PendingAppend> write(const std::vector<domain::Activity>& batch,
+                                                 const domain::ActivityLog& dictionary) = 0;
+
+    /**
+     * @brief Torna visível às consultas um lote gravado por write()
+     * @param pending Resultado de write() deste mesmo archive
+     * @details Só atualiza o índice em memória, sem I/O; é chamado com as
+     *          consultas excluídas.
+     */
+    virtual void publish(std::unique_ptr<PendingAppend> pending) = 0;
+
+    /**
+     * @brief Grava e publica um lote de uma vez
+     * @throws std::runtime_error ou derivada em caso de falha de gravaçao
+     */
+    void append(const std::vector<domain::Activity>& batch,
+                const domain::ActivityLog& dictionary) {
+        publish(write(batch, dictionary));
+    }
+
+    /**
+     * @brief Percorre as atividades arquivadas com timestamp em [from, to]
+     * @param from Limite inferior (inclusivo)
+     * @param to Limite superior (inclusivo)
+     * @param dictionary Log usado para traduzir strings de volta em handles
+     * @param visit Funçao chamada para cada atividade, em ordem cronológica
+     */
+    virtual void scan(domain::HybridTimestamp from,
+                      domain::HybridTimestamp to,
+                      const domain::ActivityLog& dictionary,
+                      const Visitor& visit) const = 0;
+
+    /**
+     * @brief Lê atividades arquivadas pelos seus números de sequência
+     * @param ids IDs procurados, em ordem crescente
+     * @param dictionary Log usado para traduzir strings de volta em handles
+     * @param visit Funçao chamada para cada atividade encontrada, em ordem crescente de ID
+     * @details Usado pelas listas de postagem do ActivityLog (ex.: histórico
+     *          de um card); IDs inexistentes no archive sao ignorados.
+     */
+    virtual void fetch(const std::vector<std::uint64_t>& ids,
+                       const domain::ActivityLog& dictionary,
+                       const Visitor& visit) const = 0;
+
+    /**
+     * @brief As atividades arquivadas mais recentes de um card
+     * @param subject Handle do card
+     * @param limit Quantidade máxima (0 = todas), mantendo as mais recentes
+     * @param dictionary Log usado para traduzir strings de volta em handles
+     * @param visit Funçao chamada para cada atividade, em ordem cronológica
+     * @details Substitui, para a camada arquivada, a lista de postagem do
+     *          card que o ActivityLog só mantém para o anel em memória.
+     */
+    virtual void lastForSubject(domain::ActivityHandle subject,
+                                std::size_t limit,
+                                const domain::ActivityLog& dictionary,
+                                const Visitor& visit) const = 0;
+
+    /**
+     * @brief As n atividades arquivadas mais recentes de um tipo
+     * @param visit Funçao chamada para cada atividade, em ordem cronológica
+     */
+    virtual void lastOfKind(domain::ActivityKind kind,
+                            std::size_t n,
+                            const domain::ActivityLog& dictionary,
+                            const Visitor& visit) const = 0;
+
+    /**
+     * @brief Número total de atividades arquivadas
+     */
+    virtual std::size_t size() const = 0;
+
+    /**
+     * @brief Remove todas as atividades arquivadas
+     */
+    virtual void clear() = 0;
+};
+
+} // namespace interfaces
+} // namespace kanban
@@ -0,0 +1,66 @@
+/**
+ * @file IActivitySink.h
+ * @brief Declaraçao da interface IActivitySink para trilhas de auditoria
+ * @details Define o contrato de um destino que recebe cada atividade no
+ *          momento em que ela é registrada no ActivityLog (por exemplo, um
+ *          arquivo de auditoria gravado em segundo plano).
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace kanban {
+namespace domain {
+    // Forward declaration para reduzir acoplamento
+    class Activity;
+}
+
+namespace interfaces {
+
+// ============================================================================
+// INTERFACE IActivitySink
+// ============================================================================
+
+/**
+ * @brief Interface para destinos de atividades (trilha de auditoria)
+ * @details O ActivityLog chama submit() ao publicar cada atividade, sob o
+ *          seu mutex interno e em ordem de número de sequência, a partir da
+ *          thread que estiver publicando (possivelmente uma que está
+ *          executando uma mutaçao). Implementações devem apenas enfileirar a
+ *          atividade e nunca realizar I/O dentro de submit().
+ */
+class IActivitySink {
+public:
+    /**
+     * @brief Destrutor virtual padrao
+     */
+    virtual ~IActivitySink() = default;
+
+    /**
+     * @brief Entrega uma atividade ao destino
+     * @param activity Atividade publicada (número de sequência e timestamp definitivos)
+     * @details Deve ser thread-safe e nao bloquear em I/O.
+     */
+    virtual void submit(const domain::Activity& activity) = 0;
+
+    /**
+     * @brief Bloqueia até que todas as atividades entregues estejam duráveis
+     * @throws std::runtime_error ou derivada se a gravaçao tiver falhado
+     */
+    virtual void flush() = 0;
+
+    /**
+     * @brief Esvazia a fila, grava o restante e libera os recursos
+     * @details Após close(), novas chamadas a submit() sao ignoradas.
+     */
+    virtual void close() = 0;
+
+    /**
+     * @brief Número de atividades já gravadas de forma durável
+     */
+    virtual std::uint64_t durableCount() const = 0;
+};
+
+} // namespace interfaces
+} // namespace kanban
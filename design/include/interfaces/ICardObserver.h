@@ -0,0 +1,63 @@
+/**
+ * @file ICardObserver.h
+ * @brief Declaraçao da interface ICardObserver para acompanhar alterações de Cards.
+ * @details Um Card pode ter um observador (ver Card::setObserver()) avisado
+ *          após cada alteraçao do seu texto, da prioridade ou das tags. Usado
+ *          por índices derivados do conteúdo dos cards (texto completo,
+ *          completamento de títulos e tags) para se manterem atualizados sem
+ *          percorrer os boards.
+ */
+
+#pragma once
+
+#include <string>
+
+namespace kanban {
+namespace domain { class Card; } ///< @brief Declaraçao antecipada da classe Card para evitar dependência circular
+
+namespace interfaces {
+
+/**
+ * @class ICardObserver
+ * @brief Interface para observadores de alterações em Cards.
+ * @details As notificações sao síncronas: chegam na thread que alterou o
+ *          card, logo após a alteraçao. Implementações devem ser thread-safe
+ *          se cards diferentes puderem ser alterados em paralelo.
+ */
+class ICardObserver {
+public:
+    /**
+     * @brief Destrutor virtual padrao.
+     */
+    virtual ~ICardObserver() = default;
+
+    /**
+     * @brief Chamado após setTitle() ou setDescription().
+     * @param card Card já com o novo texto.
+     */
+    virtual void onCardTextChanged(const domain::Card& card) = 0;
+
+    /**
+     * @brief Chamado após setPriority() e após alterações nas tags.
+     * @param card Card já alterado.
+     * @details Chamado a partir de métodos noexcept do Card: exceções
+     *          lançadas aqui sao descartadas. A implementaçao padrao nao faz nada.
+     */
+    virtual void onCardUpdated(const domain::Card& card) { (void)card; }
+
+    /**
+     * @brief Chamado após uma atribuiçao que trocou o ID do card.
+     * @param card Card já com o novo ID e o novo conteúdo.
+     * @param previousId ID sob o qual o card estava indexado.
+     * @details Substitui onCardTextChanged() e onCardUpdated() nessa
+     *          atribuiçao: o card deve ser reindexado por inteiro. Exceções
+     *          lançadas aqui sao descartadas. A implementaçao padrao nao faz nada.
+     */
+    virtual void onCardIdChanged(const domain::Card& card, const std::string& previousId) {
+        (void)card;
+        (void)previousId;
+    }
+};
+
+} // namespace interfaces
+} // namespace kanban
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 namespace kanban {
 namespace domain { class Card; } ///< @brief Declaraçao antecipada da classe Card para evitar dependência circular
@@ -44,6 +45,20 @@ public:
      */
     virtual bool matches(const domain::Card& card) const = 0;
 
+    /**
+     * @brief Verifica o card sabendo em qual coluna ele está.
+     * @param card Referência constante ao Card a ser avaliado.
+     * @param columnId ID da coluna que contém o card.
+     * @return `true` se o Card atende ao critério, `false` caso contrário.
+     * @details Critérios que dependem da coluna (que nao faz parte do Card)
+     *          sobrescrevem este método; os demais herdam a implementaçao
+     *          padrao, que ignora a coluna.
+     */
+    virtual bool matchesInColumn(const domain::Card& card, const std::string& columnId) const {
+        (void)columnId;
+        return matches(card);
+    }
+
     /**
      * @brief Cria uma cópia polimórfica do filtro.
      * @return `std::unique_ptr<IFilter>` apontando para a nova instância clonada.
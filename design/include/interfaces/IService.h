@@ -20,6 +20,7 @@ namespace domain {
     class Board;
     class Column;
     class Card;
+    struct Command;
 }
 
 namespace interfaces {
@@ -131,6 +132,20 @@ public:
                           const std::string& fromColumnId,
                           const std::string& toColumnId) = 0;
 
+    /**
+     * @brief Aplica uma lista de comandos a um board, tudo ou nada
+     * @param boardId ID do board alvo
+     * @param commands Comandos aplicados em ordem (ver domain::Command)
+     * @return ID criado por comando (vazio para comandos que nao criam entidades)
+     * @throws std::runtime_error Se o board nao existir ou algum comando for
+     *         inválido; nesse caso nenhum comando é aplicado
+     * @details O lote inteiro é validado e aplicado em uma única passada,
+     *          sob uma única aquisiçao de exclusividade sobre o board, e
+     *          registrado como um grupo contíguo no ActivityLog.
+     */
+    virtual std::vector<std::string> applyBatch(const std::string& boardId,
+                                                const std::vector<domain::Command>& commands) = 0;
+
     // ============================================================================
     // OPERAÇÕES DE CONSULTA (QUERIES)
     // ============================================================================
@@ -0,0 +1,201 @@
+/**
+ * @file AsyncActivitySink.h
+ * @brief Declaraçao do destino de auditoria assíncrono com group commit
+ * @details Uma thread de gravaçao dedicada recebe as atividades por uma fila
+ *          lock-free e as anexa a um arquivo de log em lotes, chamando fsync
+ *          conforme a política configurada. O caminho de mutaçao (ex.:
+ *          Board::moveCard) nunca espera por I/O.
+ */
+
+#pragma once
+
+#include "../interfaces/IActivitySink.h"
+#include "../concurrency/MpmcQueue.h"
+#include "../domain/ActivityLog.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace kanban {
+namespace persistence {
+
+// ============================================================================
+// CLASSE ActivitySinkException
+// ============================================================================
+
+/**
+ * @brief Exceçao para falhas do destino de auditoria
+ * @details Lançada na construçao (arquivo nao pôde ser aberto) e em flush()
+ *          quando a thread de gravaçao encontrou um erro de I/O.
+ */
+class ActivitySinkException : public std::runtime_error {
+public:
+    /**
+     * @brief Construtor da exceçao ActivitySinkException
+     * @param what Mensagem descritiva do erro ocorrido
+     */
+    explicit ActivitySinkException(const std::string& what)
+        : std::runtime_error(what) {}
+};
+
+// ============================================================================
+// POLÍTICA DE SINCRONIZAÇaO
+// ============================================================================
+
+/**
+ * @brief Quando a thread de gravaçao chama fsync
+ */
+enum class FsyncPolicy {
+    EveryCommit,  ///< @brief Após cada lote gravado: toda atividade fica durável no seu group commit
+    Interval,     ///< @brief No máximo a cada FsyncOptions::interval
+    BatchSize,    ///< @brief A cada FsyncOptions::batchSize atividades gravadas
+    Never         ///< @brief Nunca explicitamente (o sistema operacional decide)
+};
+
+/**
+ * @brief Configuraçao do AsyncActivitySink
+ */
+struct FsyncOptions {
+    FsyncPolicy policy = FsyncPolicy::Interval;        ///< @brief Política de fsync
+    std::chrono::milliseconds interval{50};            ///< @brief Cadência para FsyncPolicy::Interval
+    std::size_t batchSize = 1024;                      ///< @brief Limite para FsyncPolicy::BatchSize
+    std::size_t maxGroup = 4096;                       ///< @brief Máximo de atividades por escrita
+};
+
+// ============================================================================
+// CLASSE AsyncActivitySink
+// ============================================================================
+
+/**
+ * @brief Trilha de auditoria em arquivo, gravada em segundo plano
+ * @details Formato: uma linha por atividade, campos separados por TAB:
+ *          @code
+ *          <sequência>  <ms>.<lógico>  <tipo>  <card|texto>  <coluna origem>  <coluna destino>  <posiçao>
+ *          @endcode
+ *          As linhas seguem a ordem de publicaçao do ActivityLog (sequência
+ *          e timestamp HLC crescentes). Os IDs sao resolvidos pelo dicionário do ActivityLog na thread de
+ *          gravaçao; TAB, quebra de linha e barra invertida sao escapados.
+ *
+ *          submit() é lock-free (BoundedMpmcQueue); se a fila estiver cheia,
+ *          a atividade vai para uma lista de transbordo protegida por mutex,
+ *          sem I/O. A thread de gravaçao agrupa tudo o que estiver pendente
+ *          em uma única escrita (group commit).
+ *
+ * @note O ActivityLog passado na construçao deve viver mais que o sink;
+ *       ActivityLog::setSink() cuida disso fechando o sink no destrutor do log.
+ */
+class AsyncActivitySink : public interfaces::IActivitySink {
+public:
+    /**
+     * @brief Construtor do AsyncActivitySink
+     * @param path Arquivo de auditoria (criado ou estendido)
+     * @param dictionary Log cujos handles serao resolvidos na gravaçao
+     * @param options Política de fsync e tamanho dos grupos
+     * @throws ActivitySinkException Se o arquivo nao puder ser aberto
+     */
+    AsyncActivitySink(const std::string& path,
+                      const domain::ActivityLog& dictionary,
+                      FsyncOptions options = FsyncOptions());
+
+    /**
+     * @brief Destrutor - equivale a close()
+     */
+    ~AsyncActivitySink() override;
+
+    AsyncActivitySink(const AsyncActivitySink&) = delete;
+    AsyncActivitySink& operator=(const AsyncActivitySink&) = delete;
+
+    // ============================================================================
+    // IMPLEMENTAÇaO DA INTERFACE IActivitySink
+    // ============================================================================
+
+    /**
+     * @brief Enfileira uma atividade para gravaçao (nao bloqueia em I/O)
+     */
+    void submit(const domain::Activity& activity) override;
+
+    /**
+     * @brief Aguarda até que tudo o que foi submetido esteja gravado e sincronizado
+     * @throws ActivitySinkException Se a thread de gravaçao falhou
+     */
+    void flush() override;
+
+    /**
+     * @brief Grava o restante, sincroniza, fecha o arquivo e encerra a thread
+     */
+    void close() override;
+
+    /**
+     * @brief Número de atividades já sincronizadas em disco
+     */
+    std::uint64_t durableCount() const override;
+
+    // ============================================================================
+    // MÉTODOS ADICIONAIS
+    // ============================================================================
+
+    /**
+     * @brief Caminho do arquivo de auditoria
+     */
+    const std::string& path() const noexcept;
+
+    /**
+     * @brief Quantidade de atividades que precisaram da lista de transbordo
+     */
+    std::uint64_t overflowCount() const noexcept;
+
+    /**
+     * @brief Quantidade de chamadas a fsync realizadas
+     */
+    std::uint64_t syncCount() const noexcept;
+
+private:
+    /// @brief Laço da thread de gravaçao
+    void run();
+
+    /// @brief Move até options_.maxGroup atividades pendentes para group
+    std::size_t collect(std::vector<domain::Activity>& group);
+
+    /// @brief Formata e grava um grupo em uma única escrita
+    void writeGroup(const std::vector<domain::Activity>& group);
+
+    /// @brief Chama fsync e atualiza o contador de atividades duráveis
+    void sync();
+
+    std::string path_;                                   ///< @brief Arquivo de auditoria
+    const domain::ActivityLog& dictionary_;              ///< @brief Dicionário de handles
+    FsyncOptions options_;                               ///< @brief Política de fsync
+    int fd_ = -1;                                        ///< @brief Descritor do arquivo
+
+    concurrency::BoundedMpmcQueue<domain::Activity> queue_; ///< @brief Fila lock-free de entrada
+    std::mutex overflowMutex_;                           ///< @brief Protege overflow_
+    std::vector<domain::Activity> overflow_;             ///< @brief Transbordo quando a fila está cheia
+    std::atomic<std::size_t> overflowPending_{0};        ///< @brief Tamanho de overflow_ (lido sem o mutex)
+
+    std::atomic<std::uint64_t> submitted_{0};            ///< @brief Atividades aceitas por submit()
+    std::uint64_t written_ = 0;                          ///< @brief Gravadas (thread de gravaçao)
+    std::uint64_t unsyncedEvents_ = 0;                   ///< @brief Gravadas desde o último fsync
+    std::atomic<std::uint64_t> durable_{0};              ///< @brief Sincronizadas em disco
+    std::atomic<std::uint64_t> overflowed_{0};           ///< @brief Quantidade de transbordos
+    std::atomic<std::uint64_t> syncs_{0};                ///< @brief Quantidade de fsync
+    std::chrono::steady_clock::time_point lastSync_;     ///< @brief Momento do último fsync
+
+    mutable std::mutex stateMutex_;                      ///< @brief Protege espera/sinalizaçao
+    std::condition_variable wake_;                       ///< @brief Acorda a thread de gravaçao
+    std::condition_variable durableChanged_;             ///< @brief Acorda quem espera em flush()
+    std::atomic<bool> sleeping_{false};                  ///< @brief Thread de gravaçao aguardando
+    std::atomic<bool> flushRequested_{false};            ///< @brief flush() pediu fsync imediato
+    std::atomic<bool> stopping_{false};                  ///< @brief close() em andamento
+    std::atomic<bool> closed_{false};                    ///< @brief Thread de gravaçao encerrada
+    std::string error_;                                  ///< @brief Último erro de I/O (stateMutex_)
+    std::thread writer_;                                 ///< @brief Thread de gravaçao
+};
+
+} // namespace persistence
+} // namespace kanban
@@ -0,0 +1,205 @@
+/**
+ * @file SegmentedActivityArchive.h
+ * @brief Declaraçao do archive de atividades em segmentos comprimidos em disco
+ * @details Implementa IActivityArchive gravando cada lote descarregado pelo
+ *          ActivityLog como um arquivo de segmento imutável. Os segmentos
+ *          usam codificaçao compacta: timestamps e IDs em delta com varints
+ *          e IDs de cards/colunas codificados por dicionário local.
+ */
+
+#pragma once
+
+#include "../interfaces/IActivityArchive.h"
+#include "../domain/ActivityLog.h"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace kanban {
+namespace persistence {
+
+// ============================================================================
+// CLASSE ActivityArchiveException
+// ============================================================================
+
+/**
+ * @brief Exceçao específica para falhas de leitura/gravaçao de segmentos
+ * @details Especializa std::runtime_error para erros como:
+ *          - Falha ao criar o diretório ou o arquivo de segmento
+ *          - Segmento corrompido ou com formato desconhecido
+ */
+class ActivityArchiveException : public std::runtime_error {
+public:
+    /**
+     * @brief Construtor da exceçao ActivityArchiveException
+     * @param what Mensagem descritiva do erro ocorrido
+     */
+    explicit ActivityArchiveException(const std::string& what)
+        : std::runtime_error(what) {}
+};
+
+// ============================================================================
+// CLASSE SegmentedActivityArchive
+// ============================================================================
+
+/**
+ * @brief Camada fria do ActivityLog em segmentos imutáveis comprimidos
+ * @details Cada chamada a write() produz um arquivo
+ *          "segment-<primeiroId>.kseg" no diretório configurado, com o formato:
+ *
+ *          - cabeçalho: "KSEG", versao, quantidade, primeiro ID, timestamp base
+ *          - dicionário local: strings (IDs de cards/colunas) usadas no segmento
+ *          - registros: tipo (1 byte) e varints de delta de ID, delta de
+ *            timestamp, índices no dicionário local e posiçao
+ *
+ *          Em memória fica apenas um pequeno índice por segmento (intervalo
+ *          de IDs e timestamps, cards presentes e contagem por tipo),
+ *          ordenado, no qual consultas por tempo, ID, card ou tipo localizam
+ *          os segmentos relevantes sem abrir os demais.
+ *
+ * @note write() nao toca o índice e pode executar em paralelo com as
+ *       consultas; publish(), clear() e as consultas sao serializados pelo
+ *       ActivityLog dono.
+ */
+class SegmentedActivityArchive : public interfaces::IActivityArchive {
+public:
+    /**
+     * @brief Metadados de um segmento gravado
+     */
+    struct SegmentInfo {
+        std::string path;            ///< @brief Caminho do arquivo
+        std::uint64_t firstId = 0;   ///< @brief ID da primeira atividade
+        std::uint64_t lastId = 0;    ///< @brief ID da última atividade
+        std::uint64_t firstTs = 0;   ///< @brief Timestamp HLC (empacotado) da primeira atividade
+        std::uint64_t lastTs = 0;    ///< @brief Timestamp HLC (empacotado) da última atividade
+        std::size_t count = 0;       ///< @brief Quantidade de atividades
+        std::size_t bytes = 0;       ///< @brief Tamanho do arquivo em bytes
+        std::vector<domain::ActivityHandle> subjects;   ///< @brief Cards presentes (ordenados, sem notas)
+        std::array<std::uint32_t, domain::kActivityKindCount> kinds{};   ///< @brief Atividades por tipo
+    };
+
+    /**
+     * @brief Construtor do SegmentedActivityArchive
+     * @param directory Diretório onde os segmentos serao gravados
+     * @details O diretório é criado na primeira gravaçao, se necessário.
+     */
+    explicit SegmentedActivityArchive(const std::string& directory);
+
+    /**
+     * @brief Destrutor padrao
+     * @details Os segmentos permanecem em disco.
+     */
+    ~SegmentedActivityArchive() override = default;
+
+    // ============================================================================
+    // IMPLEMENTAÇaO DA INTERFACE IActivityArchive
+    // ============================================================================
+
+    /**
+     * @brief Grava um lote como um novo segmento imutável
+     * @throws ActivityArchiveException Em caso de falha de I/O
+     * @details O arquivo é escrito com nome temporário e renomeado ao final,
+     *          de modo que um segmento em disco está sempre completo. Se a
+     *          gravaçao pendente for descartada, o arquivo é removido.
+     */
+    std::unique_ptr<PendingAppend> write(const std::vector<domain::Activity>& batch,
+                                         const domain::ActivityLog& dictionary) override;
+
+    /**
+     * @brief Acrescenta ao índice o segmento gravado por write()
+     */
+    void publish(std::unique_ptr<PendingAppend> pending) override;
+
+    /**
+     * @brief Percorre as atividades arquivadas no intervalo [from, to]
+     * @throws ActivityArchiveException Se um segmento estiver corrompido
+     */
+    void scan(domain::HybridTimestamp from,
+              domain::HybridTimestamp to,
+              const domain::ActivityLog& dictionary,
+              const Visitor& visit) const override;
+
+    /**
+     * @brief Lê atividades arquivadas pelos seus números de sequência
+     * @details Cada segmento envolvido é decodificado uma única vez.
+     */
+    void fetch(const std::vector<std::uint64_t>& ids,
+               const domain::ActivityLog& dictionary,
+               const Visitor& visit) const override;
+
+    /**
+     * @brief As atividades arquivadas mais recentes de um card
+     * @details Abre, do mais recente para o mais antigo, apenas os segmentos
+     *          cujo índice contém o card, até reunir limit atividades.
+     */
+    void lastForSubject(domain::ActivityHandle subject,
+                        std::size_t limit,
+                        const domain::ActivityLog& dictionary,
+                        const Visitor& visit) const override;
+
+    /**
+     * @brief As n atividades arquivadas mais recentes de um tipo
+     * @details Segmentos sem atividades do tipo nao sao abertos.
+     */
+    void lastOfKind(domain::ActivityKind kind,
+                    std::size_t n,
+                    const domain::ActivityLog& dictionary,
+                    const Visitor& visit) const override;
+
+    /**
+     * @brief Número total de atividades arquivadas
+     */
+    std::size_t size() const override;
+
+    /**
+     * @brief Remove todos os arquivos de segmento
+     */
+    void clear() override;
+
+    // ============================================================================
+    // MÉTODOS ADICIONAIS
+    // ============================================================================
+
+    /**
+     * @brief Metadados dos segmentos em ordem cronológica
+     */
+    const std::vector<SegmentInfo>& segments() const noexcept;
+
+    /**
+     * @brief Diretório dos segmentos
+     */
+    const std::string& directory() const noexcept;
+
+    /**
+     * @brief Total de bytes ocupados pelos segmentos em disco
+     */
+    std::size_t bytesOnDisk() const noexcept;
+
+private:
+    /// @brief Segmento gravado por write() e ainda fora do índice
+    struct PendingSegment : PendingAppend {
+        SegmentInfo info;          ///< @brief Metadados do segmento
+        bool published = false;    ///< @brief false: o arquivo é removido no destrutor
+        ~PendingSegment() override;
+    };
+
+    /// @brief Decodifica todas as atividades de um segmento, em ordem cronológica
+    std::vector<domain::Activity> readSegment(const SegmentInfo& info,
+                                              const domain::ActivityLog& dictionary) const;
+
+    /// @brief As limit atividades mais recentes aceitas por match, abrindo só os segmentos aceitos por candidate
+    void lastMatching(const std::function<bool(const SegmentInfo&)>& candidate,
+                      const std::function<bool(const domain::Activity&)>& match,
+                      std::size_t limit,
+                      const domain::ActivityLog& dictionary,
+                      const Visitor& visit) const;
+
+    std::string directory_;              ///< @brief Diretório dos segmentos
+    std::vector<SegmentInfo> segments_;  ///< @brief Índice em memória dos segmentos gravados
+    std::size_t total_ = 0;              ///< @brief Total de atividades arquivadas
+};
+
+} // namespace persistence
+} // namespace kanban
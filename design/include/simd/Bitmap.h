@@ -0,0 +1,143 @@
+/**
+ * @file Bitmap.h
+ * @brief Declaraçao do bitmap de seleçao produzido pelos kernels vetorizados
+ * @details Um bit por linha de uma tabela de atributos (1 = selecionada),
+ *          em palavras de 64 bits. Os bits além de size() ficam sempre em
+ *          zero, de modo que count() e as combinações nao precisam de
+ *          tratamento especial para a última palavra.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace kanban {
+namespace simd {
+
+/**
+ * @brief Número de bits 1 de uma palavra
+ */
+inline unsigned popcount64(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_popcountll(x));
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<unsigned>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * @brief Posiçao do bit 1 menos significativo (x != 0)
+ */
+inline unsigned lowestBit64(std::uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#else
+    return popcount64((x & (~x + 1)) - 1);
+#endif
+}
+
+// ============================================================================
+// CLASSE Bitmap
+// ============================================================================
+
+/**
+ * @brief Conjunto de linhas selecionadas
+ */
+class Bitmap {
+public:
+    Bitmap() = default;
+
+    /**
+     * @brief Cria um bitmap com todos os bits iguais a value
+     */
+    explicit Bitmap(std::size_t size, bool value = false) { assign(size, value); }
+
+    /**
+     * @brief Redimensiona e preenche todos os bits com value
+     */
+    void assign(std::size_t size, bool value) {
+        size_ = size;
+        words_.assign((size + 63) / 64, value ? ~std::uint64_t{0} : 0);
+        clearTail();
+    }
+
+    std::size_t size() const noexcept { return size_; }
+    std::size_t wordCount() const noexcept { return words_.size(); }
+    std::uint64_t* words() noexcept { return words_.data(); }
+    const std::uint64_t* words() const noexcept { return words_.data(); }
+
+    bool test(std::size_t i) const noexcept { return (words_[i / 64] >> (i % 64)) & 1u; }
+    void set(std::size_t i) noexcept { words_[i / 64] |= std::uint64_t{1} << (i % 64); }
+
+    /**
+     * @brief Número de linhas selecionadas
+     */
+    std::size_t count() const noexcept {
+        std::size_t total = 0;
+        for (std::uint64_t w : words_) {
+            total += popcount64(w);
+        }
+        return total;
+    }
+
+    /// @brief Interseçao (ambos os bitmaps devem ter o mesmo tamanho)
+    Bitmap& operator&=(const Bitmap& other) noexcept {
+        for (std::size_t i = 0; i < words_.size(); ++i) words_[i] &= other.words_[i];
+        return *this;
+    }
+
+    /// @brief Uniao (ambos os bitmaps devem ter o mesmo tamanho)
+    Bitmap& operator|=(const Bitmap& other) noexcept {
+        for (std::size_t i = 0; i < words_.size(); ++i) words_[i] |= other.words_[i];
+        return *this;
+    }
+
+    /// @brief Remove as linhas selecionadas em other
+    Bitmap& andNot(const Bitmap& other) noexcept {
+        for (std::size_t i = 0; i < words_.size(); ++i) words_[i] &= ~other.words_[i];
+        return *this;
+    }
+
+    /// @brief Complemento
+    Bitmap& flip() noexcept {
+        for (auto& w : words_) w = ~w;
+        clearTail();
+        return *this;
+    }
+
+    /**
+     * @brief Chama fn(linha) para cada linha selecionada, em ordem crescente
+     */
+    template<typename Fn>
+    void forEachSet(Fn&& fn) const {
+        for (std::size_t i = 0; i < words_.size(); ++i) {
+            for (std::uint64_t w = words_[i]; w != 0; w &= w - 1) {
+                fn(i * 64 + lowestBit64(w));
+            }
+        }
+    }
+
+    /**
+     * @brief Zera os bits além de size() na última palavra
+     */
+    void clearTail() noexcept {
+        if (size_ % 64 != 0) {
+            words_.back() &= (std::uint64_t{1} << (size_ % 64)) - 1;
+        }
+    }
+
+private:
+    std::vector<std::uint64_t> words_;
+    std::size_t size_ = 0;
+};
+
+inline Bitmap operator&(Bitmap a, const Bitmap& b) { return a &= b; }
+inline Bitmap operator|(Bitmap a, const Bitmap& b) { return a |= b; }
+
+} // namespace simd
+} // namespace kanban
@@ -0,0 +1,96 @@
+/**
+ * @file PredicateKernels.h
+ * @brief Declaraçao dos kernels vetorizados de predicados sobre arrays de atributos
+ * @details Cada kernel avalia um predicado simples sobre um array contíguo
+ *          (prioridades, instantes, máscaras de tags) e escreve um Bitmap de
+ *          seleçao, que depois é combinado com &=, |= e andNot().
+ *
+ *          Implementações: escalar (qualquer plataforma), SSE2 e AVX2 (x86).
+ *          A melhor suportada pela CPU é escolhida em tempo de execuçao;
+ *          setActiveIsa() permite forçar uma inferior (testes e benchmarks).
+ */
+
+#pragma once
+
+#include "Bitmap.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace kanban {
+namespace simd {
+
+/**
+ * @brief Conjunto de instruções usado pelos kernels
+ */
+enum class Isa {
+    Scalar,
+    Sse2,
+    Avx2
+};
+
+/**
+ * @brief Operador de comparaçao de compareInt32()
+ */
+enum class Compare {
+    Equal,
+    NotEqual,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual
+};
+
+/**
+ * @brief Como matchMask() compara cada máscara com a máscara pedida
+ */
+enum class MaskMatch {
+    Any,    ///< @brief (valor & máscara) != 0
+    All,    ///< @brief (valor & máscara) == máscara
+    None    ///< @brief (valor & máscara) == 0
+};
+
+/**
+ * @brief Melhor conjunto de instruções suportado pela CPU (e pelo compilador)
+ */
+Isa detectedIsa() noexcept;
+
+/**
+ * @brief Conjunto de instruções em uso
+ */
+Isa activeIsa() noexcept;
+
+/**
+ * @brief Força um conjunto de instruções
+ * @return O conjunto efetivamente ativado (limitado a detectedIsa())
+ */
+Isa setActiveIsa(Isa isa) noexcept;
+
+/**
+ * @brief Nome legível ("escalar", "SSE2", "AVX2")
+ */
+const char* isaName(Isa isa) noexcept;
+
+/**
+ * @brief Seleciona as linhas em que values[i] <op> operand
+ * @param values Array de count inteiros de 32 bits
+ * @param count Número de linhas
+ * @param op Operador de comparaçao
+ * @param operand Valor comparado
+ * @param out Recebe o bitmap (redimensionado para count)
+ */
+void compareInt32(const std::int32_t* values, std::size_t count, Compare op, std::int32_t operand, Bitmap& out);
+
+/**
+ * @brief Seleciona as linhas em que min <= values[i] <= max
+ * @param values Array de count inteiros de 64 bits (ex.: instantes em ticks)
+ */
+void rangeInt64(const std::int64_t* values, std::size_t count, std::int64_t min, std::int64_t max, Bitmap& out);
+
+/**
+ * @brief Seleciona as linhas cuja máscara satisfaz mode em relaçao a mask
+ * @param masks Array de count máscaras de 64 bits (ex.: um bit por tag)
+ */
+void matchMask(const std::uint64_t* masks, std::size_t count, std::uint64_t mask, MaskMatch mode, Bitmap& out);
+
+} // namespace simd
+} // namespace kanban
@@ -0,0 +1,114 @@
+/**
+ * @file AsyncKanbanService.cpp
+ * @brief Implementaçao da fachada assíncrona do KanbanService
+ */
+
+#include "application/AsyncKanbanService.h"
+
+namespace kanban {
+namespace application {
+
+// ============================================================================
+// CONSTRUTOR E DESTRUTOR
+// ============================================================================
+
+AsyncKanbanService::AsyncKanbanService(std::shared_ptr<KanbanService> service, Dispatcher dispatcher)
+    : service_(std::move(service)), dispatcher_(std::move(dispatcher)) {
+    if (!service_) {
+        throw std::invalid_argument("AsyncKanbanService requer um serviço");
+    }
+}
+
+AsyncKanbanService::~AsyncKanbanService() {
+    executor_.stop();
+}
+
+// ============================================================================
+// OPERAÇÕES DO IService
+// ============================================================================
+
+std::future<void> AsyncKanbanService::createSampleData() {
+    return call([](KanbanService& s) { s.createSampleData(); });
+}
+
+std::future<std::string> AsyncKanbanService::createBoard(const std::string& name) {
+    return call([name](KanbanService& s) { return s.createBoard(name); });
+}
+
+std::future<std::string> AsyncKanbanService::addColumn(const std::string& boardId,
+                                                       const std::string& columnName) {
+    return call([boardId, columnName](KanbanService& s) { return s.addColumn(boardId, columnName); });
+}
+
+std::future<std::string> AsyncKanbanService::addCard(const std::string& boardId,
+                                                     const std::string& columnId,
+                                                     const std::string& title) {
+    return call([boardId, columnId, title](KanbanService& s) { return s.addCard(boardId, columnId, title); });
+}
+
+std::future<void> AsyncKanbanService::moveCard(const std::string& boardId, const std::string& cardId,
+                                               const std::string& fromColumnId,
+                                               const std::string& toColumnId) {
+    return call([boardId, cardId, fromColumnId, toColumnId](KanbanService& s) {
+        s.moveCard(boardId, cardId, fromColumnId, toColumnId);
+    });
+}
+
+std::future<std::vector<std::string>> AsyncKanbanService::applyBatch(const std::string& boardId,
+                                                                     std::vector<domain::Command> commands) {
+    return call([boardId, commands = std::move(commands)](KanbanService& s) {
+        return s.applyBatch(boardId, commands);
+    });
+}
+
+std::future<std::vector<std::shared_ptr<domain::Board>>> AsyncKanbanService::listBoards() {
+    return call([](KanbanService& s) { return s.listBoards(); });
+}
+
+std::future<std::optional<std::shared_ptr<domain::Board>>> AsyncKanbanService::findBoard(const std::string& boardId) {
+    return call([boardId](KanbanService& s) { return s.findBoard(boardId); });
+}
+
+std::future<std::vector<std::shared_ptr<domain::Column>>> AsyncKanbanService::listColumns(const std::string& boardId) {
+    return call([boardId](KanbanService& s) { return s.listColumns(boardId); });
+}
+
+std::future<std::vector<std::shared_ptr<domain::Card>>> AsyncKanbanService::listCards(const std::string& columnId) {
+    return call([columnId](KanbanService& s) { return s.listCards(columnId); });
+}
+
+// ============================================================================
+// ESTADO DO EXECUTOR
+// ============================================================================
+
+std::uint64_t AsyncKanbanService::pending() const noexcept {
+    // Lido antes: completed_ nunca passa de submitted_
+    const std::uint64_t completed = completed_.load(std::memory_order_acquire);
+    const std::uint64_t submitted = submitted_.load(std::memory_order_relaxed);
+    return submitted > completed ? submitted - completed : 0;
+}
+
+void AsyncKanbanService::drain() {
+    executor_.ask([] {}).get();
+}
+
+void AsyncKanbanService::deliver(const Dispatcher& dispatcher, std::function<void()> callback) {
+    if (dispatcher) {
+        dispatcher(std::move(callback));
+    } else {
+        callback();
+    }
+}
+
+void AsyncKanbanService::report(const ErrorHandler& onError, std::exception_ptr error) {
+    try {
+        std::rethrow_exception(error);
+    } catch (const std::exception& e) {
+        onError(e);
+    } catch (...) {
+        onError(std::runtime_error("Erro desconhecido no serviço"));
+    }
+}
+
+} // namespace application
+} // namespace kanban
@@ -0,0 +1,314 @@
+/**
+ * @file BatchExecutor.cpp
+ * @brief Implementaçao do executor de lotes de comandos
+ * @details A validaçao trabalha sobre dois índices montados uma única vez
+ *          por lote (coluna por ID e localizaçao de cada card) e atualizados
+ *          à medida que os comandos sao simulados. Todas as alocações
+ *          (colunas, cards, tags) acontecem nessa fase; a aplicaçao apenas
+ *          religa ponteiros e nao lança exceções de validaçao.
+ */
+
+#include "application/BatchExecutor.h"
+#include "domain/ActivityLog.h"
+#include "domain/Card.h"
+#include "domain/Column.h"
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_map>
+
+namespace kanban {
+namespace application {
+
+using domain::Activity;
+using domain::Card;
+using domain::Column;
+using domain::Command;
+using domain::CommandKind;
+
+namespace {
+
+/// @brief Comando validado, com os objetos já resolvidos
+struct PlannedStep {
+    std::shared_ptr<Column> column;       ///< @brief Coluna alvo/destino (ou a coluna do card)
+    std::shared_ptr<Column> fromColumn;   ///< @brief Coluna de origem (MoveCard)
+    std::shared_ptr<Card> card;           ///< @brief Card alvo ou criado
+    std::vector<std::shared_ptr<domain::Tag>> tags; ///< @brief Novas tags (RetagCard)
+    std::size_t index = 0;                ///< @brief Posiçao final, já limitada à coluna (ReorderCard)
+};
+
+/// @brief Card e a coluna onde ele estará após os comandos já simulados
+struct CardLocation {
+    std::shared_ptr<Card> card;
+    std::shared_ptr<Column> column;
+};
+
+} // namespace
+
+// ============================================================================
+// CONTAGEM
+// ============================================================================
+
+/**
+ * @brief Conta os comandos que criam colunas e cards
+ */
+void BatchExecutor::countCreations(const std::vector<Command>& commands,
+                                   std::size_t& columns, std::size_t& cards) noexcept {
+    columns = 0;
+    cards = 0;
+    for (const auto& command : commands) {
+        if (command.kind == CommandKind::CreateColumn) {
+            ++columns;
+        } else if (command.kind == CommandKind::AddCard) {
+            ++cards;
+        }
+    }
+}
+
+// ============================================================================
+// VALIDAÇaO E APLICAÇaO
+// ============================================================================
+
+/**
+ * @brief Valida o lote inteiro e, só entao, o aplica ao board
+ */
+BatchResult BatchExecutor::execute(domain::Board& board,
+                                   const std::vector<Command>& commands,
+                                   const IdGenerator& nextColumnId,
+                                   const IdGenerator& nextCardId,
+                                   domain::EventStore* events) {
+    // Visao leve do board: coluna por ID e localizaçao de cada card
+    std::unordered_map<std::string, std::shared_ptr<Column>> columns;
+    std::unordered_map<std::string, CardLocation> cards;
+    for (const auto& column : board.columns()) {
+        columns.emplace(column->id(), column);
+        for (const auto& card : column->cards()) {
+            cards.emplace(card->id(), CardLocation{card, column});
+        }
+    }
+
+    // Tamanho simulado de cada coluna: limita as posições de ReorderCard
+    std::unordered_map<const Column*, std::size_t> sizes;
+    auto sizeOf = [&sizes](const std::shared_ptr<Column>& column) -> std::size_t& {
+        auto it = sizes.find(column.get());
+        if (it == sizes.end()) {
+            it = sizes.emplace(column.get(), column->size()).first;
+        }
+        return it->second;
+    };
+
+    BatchResult result;
+    result.ids.resize(commands.size());
+    std::vector<PlannedStep> steps(commands.size());
+
+    for (std::size_t i = 0; i < commands.size(); ++i) {
+        const Command& command = commands[i];
+        PlannedStep& step = steps[i];
+
+        // "$n" referencia o ID criado pelo comando n deste lote
+        auto resolve = [&](const std::string& ref) -> const std::string& {
+            if (ref.size() < 2 || ref[0] != '$') {
+                return ref;
+            }
+            char* end = nullptr;
+            unsigned long n = std::strtoul(ref.c_str() + 1, &end, 10);
+            if (*end != '\0' || n >= i || result.ids[n].empty()) {
+                throw BatchException(i, "referência inválida: " + ref);
+            }
+            return result.ids[n];
+        };
+        auto columnFor = [&](const std::string& ref) {
+            const std::string& id = resolve(ref);
+            auto it = columns.find(id);
+            if (it == columns.end()) {
+                throw BatchException(i, "coluna nao encontrada: " + id);
+            }
+            return it->second;
+        };
+        auto locate = [&](const std::string& ref) -> CardLocation& {
+            const std::string& id = resolve(ref);
+            auto it = cards.find(id);
+            if (it == cards.end()) {
+                throw BatchException(i, "card nao encontrado: " + id);
+            }
+            return it->second;
+        };
+
+        switch (command.kind) {
+            case CommandKind::CreateColumn: {
+                if (command.text.empty()) {
+                    throw BatchException(i, "nome de coluna vazio");
+                }
+                std::string id = nextColumnId();
+                step.column = std::make_shared<Column>(id, command.text);
+                columns.emplace(id, step.column);
+                result.createdColumns.push_back(step.column);
+                result.ids[i] = std::move(id);
+                break;
+            }
+            case CommandKind::AddCard: {
+                step.column = columnFor(command.columnId);
+                if (command.text.empty()) {
+                    throw BatchException(i, "título de card vazio");
+                }
+                std::string id = nextCardId();
+                step.card = std::make_shared<Card>(id, command.text);
+                cards.emplace(id, CardLocation{step.card, step.column});
+                ++sizeOf(step.column);
+                result.createdCards.push_back(step.card);
+                result.ids[i] = std::move(id);
+                break;
+            }
+            case CommandKind::MoveCard: {
+                step.fromColumn = columnFor(command.fromColumnId);
+                step.column = columnFor(command.columnId);
+                CardLocation& location = locate(command.cardId);
+                if (location.column != step.fromColumn) {
+                    throw BatchException(i, "card " + location.card->id() + " nao está na coluna " +
+                                            step.fromColumn->id());
+                }
+                location.column = step.column;
+                step.card = location.card;
+                --sizeOf(step.fromColumn);
+                ++sizeOf(step.column);
+                break;
+            }
+            case CommandKind::ReorderCard: {
+                step.column = columnFor(command.columnId);
+                CardLocation& location = locate(command.cardId);
+                if (location.column != step.column) {
+                    throw BatchException(i, "card " + location.card->id() + " nao está na coluna " +
+                                            step.column->id());
+                }
+                step.card = location.card;
+                step.index = std::min(command.index, sizeOf(step.column) - 1);   // além do fim: último lugar
+                break;
+            }
+            case CommandKind::RetagCard: {
+                CardLocation& location = locate(command.cardId);
+                step.card = location.card;
+                step.column = location.column;
+                step.tags.reserve(command.tags.size());
+                for (const auto& name : command.tags) {
+                    step.tags.push_back(std::make_shared<domain::Tag>(name, name));
+                }
+                break;
+            }
+            case CommandKind::SetPriority: {
+                step.card = locate(command.cardId).card;
+                break;
+            }
+        }
+    }
+
+    // Lote válido: gravado no log de eventos antes de tocar no board. As
+    // posições de origem ficam como dica ausente (o lote nao as calcula).
+    if (events) {
+        using domain::Event;
+        const domain::EventHandle boardHandle = events->intern(board.id());
+        std::vector<Event> group;
+        group.reserve(commands.size());
+        for (std::size_t i = 0; i < commands.size(); ++i) {
+            const Command& command = commands[i];
+            const PlannedStep& step = steps[i];
+            switch (command.kind) {
+                case CommandKind::CreateColumn:
+                    group.push_back(Event::columnAdded(events->intern(step.column->id()), boardHandle,
+                                                       events->intern(step.column->name())));
+                    break;
+                case CommandKind::AddCard:
+                    group.push_back(Event::cardAdded(events->intern(step.card->id()),
+                                                     events->intern(step.column->id()),
+                                                     events->intern(step.card->title())));
+                    break;
+                case CommandKind::MoveCard:
+                    group.push_back(Event::cardMoved(events->intern(step.card->id()),
+                                                     events->intern(step.fromColumn->id()),
+                                                     events->intern(step.column->id()),
+                                                     domain::kNoEventPosition));
+                    break;
+                case CommandKind::ReorderCard:
+                    group.push_back(Event::cardReordered(
+                        events->intern(step.card->id()), events->intern(step.column->id()),
+                        domain::kNoEventPosition, static_cast<std::uint32_t>(step.index)));
+                    break;
+                case CommandKind::RetagCard:
+                    group.push_back(Event::cardTagsUpdated(events->intern(step.card->id()),
+                                                           events->appendTags(command.tags),
+                                                           static_cast<std::uint32_t>(command.tags.size())));
+                    break;
+                case CommandKind::SetPriority:
+                    group.push_back(Event::cardPrioritySet(events->intern(step.card->id()), command.priority));
+                    break;
+            }
+        }
+        events->appendGroup(std::move(group));
+    }
+
+    // Aplicaçao: nenhum comando pode falhar a partir daqui
+    auto log = board.activityLog();
+    std::vector<Activity> activities;
+    if (log) {
+        activities.reserve(commands.size() + 1);
+        activities.push_back(Activity::note(
+            log->intern("Lote de " + std::to_string(commands.size()) + " comandos"), log->now()));
+    }
+
+    for (std::size_t i = 0; i < commands.size(); ++i) {
+        const Command& command = commands[i];
+        PlannedStep& step = steps[i];
+        switch (command.kind) {
+            case CommandKind::CreateColumn:
+                board.addColumn(step.column);
+                break;
+            case CommandKind::AddCard:
+                step.column->addCard(step.card);
+                result.placements.push_back(CardPlacement{step.card, step.column, step.column->size() - 1});
+                if (log) {
+                    // Antes do grupo: movimentações do mesmo lote já encontram o card
+                    log->registerCard(step.card->id(), step.column->id(), step.card->createdAt());
+                }
+                break;
+            case CommandKind::MoveCard:
+                step.fromColumn->removeCardById(step.card->id());
+                step.column->addCard(step.card);
+                result.placements.push_back(CardPlacement{step.card, step.column, step.column->size() - 1});
+                if (log) {
+                    activities.push_back(Activity::cardMoved(log->intern(step.card->id()),
+                                                             log->intern(step.fromColumn->id()),
+                                                             log->intern(step.column->id()),
+                                                             static_cast<std::uint32_t>(step.column->size() - 1),
+                                                             log->now()));
+                }
+                break;
+            case CommandKind::ReorderCard:
+                step.column->moveCardToPosition(step.card->id(), step.index);
+                result.placements.push_back(CardPlacement{step.card, step.column, step.index});
+                if (log) {
+                    activities.push_back(Activity::cardReordered(log->intern(step.card->id()),
+                                                                 log->intern(step.column->id()),
+                                                                 static_cast<std::uint32_t>(step.index),
+                                                                 log->now()));
+                }
+                break;
+            case CommandKind::RetagCard:
+                step.card->setTags(step.tags);
+                if (log) {
+                    activities.push_back(Activity::cardTagsUpdated(log->intern(step.card->id()),
+                                                                   log->intern(step.column->id()),
+                                                                   log->now()));
+                }
+                break;
+            case CommandKind::SetPriority:
+                step.card->setPriority(command.priority);
+                break;
+        }
+    }
+
+    if (log) {
+        log->addGroup(std::move(activities));
+    }
+    return result;
+}
+
+} // namespace application
+} // namespace kanban
@@ -44,6 +44,14 @@ void CLIController::run() {
             handleMoveCard(args);
         } else if (cmd == "list-boards") {
             handleListBoards();
+        } else if (cmd == "undo") {
+            std::string boardId;
+            iss >> boardId;
+            handleUndo(boardId);
+        } else if (cmd == "redo") {
+            std::string boardId;
+            iss >> boardId;
+            handleRedo(boardId);
         } else {
             view_.showError("Comando desconhecido. Digite 'help' para ver os comandos.");
         }
@@ -84,11 +92,45 @@ void CLIController::handleListBoards() {
     view_.displayBoards(boards);
 }
 
+void CLIController::handleUndo(const std::string& args) {
+    if (args.empty()) {
+        view_.showError("Uso: undo <boardId>");
+        return;
+    }
+    try {
+        if (service_.undo(args)) {
+            view_.showMessage("Última alteração desfeita no board " + args);
+        } else {
+            view_.showMessage("Nada para desfazer no board " + args);
+        }
+    } catch (const std::exception& e) {
+        view_.showError(std::string("Falha ao desfazer: ") + e.what());
+    }
+}
+
+void CLIController::handleRedo(const std::string& args) {
+    if (args.empty()) {
+        view_.showError("Uso: redo <boardId>");
+        return;
+    }
+    try {
+        if (service_.redo(args)) {
+            view_.showMessage("Alteração refeita no board " + args);
+        } else {
+            view_.showMessage("Nada para refazer no board " + args);
+        }
+    } catch (const std::exception& e) {
+        view_.showError(std::string("Falha ao refazer: ") + e.what());
+    }
+}
+
 void CLIController::showHelp() const {
     std::cout << "Comandos disponiveis:\n";
     std::cout << "  create-board <nome do board>    - Cria um novo quadro e imprime o ID\n";
     std::cout << "  move-card <boardId> <cardId> <fromColumnId> <toColumnId> - Move um card entre colunas\n";
     std::cout << "  list-boards                     - Lista todos os boards\n";
+    std::cout << "  undo <boardId>                  - Desfaz a última alteração do board\n";
+    std::cout << "  redo <boardId>                  - Refaz a última alteração desfeita\n";
     std::cout << "  help                            - Mostra esta ajuda\n";
     std::cout << "  exit                            - Sai do programa\n";
 }
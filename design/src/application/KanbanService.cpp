@@ -7,11 +7,19 @@
  */
 
 #include "application/KanbanService.h"
+#include "application/BatchExecutor.h"
 #include "domain/Board.h"
 #include "domain/Column.h"
 #include "domain/Card.h"
 #include "domain/User.h"
 #include "domain/ActivityLog.h"
+#include "persistence/SegmentedActivityArchive.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <filesystem>
+#include <iterator>
+#include <map>
 #include <stdexcept>
 #include <sstream>
 
@@ -20,20 +28,41 @@ using namespace kanban::domain;
 namespace kanban {
 namespace application {
 
+namespace {
+
+/// @brief A partir de quantos cards no escopo uma consulta usa a CardTable ou é avaliada em paralelo
+constexpr std::size_t kParallelQueryCards = 1 << 15;
+
+/// @brief Cards por tarefa de uma consulta paralela
+constexpr std::size_t kQueryChunkCards = 1 << 13;
+
+/// @brief Número de um ID gerado pelo serviço ("card_12" -> 12), ou 0 se nao for do formato
+int idNumber(const std::string& id, const std::string& prefix) {
+    if (id.size() <= prefix.size() || id.compare(0, prefix.size(), prefix) != 0) {
+        return 0;
+    }
+    char* end = nullptr;
+    long n = std::strtol(id.c_str() + prefix.size(), &end, 10);
+    return (*end == '\0' && n > 0 && n < INT_MAX) ? static_cast<int>(n) : 0;
+}
+
+} // namespace
+
 // ============================================================================
 // CONSTRUTOR E INICIALIZAÇaO
 // ============================================================================
 
 /**
  * @brief Construtor do KanbanService
- * @details Inicializa os contadores de ID para cada tipo de entidade.
- *          Os repositórios sao inicializados automaticamente com seus construtores padrao.
- *          Usa sequências numéricas simples para geraçao de IDs únicos.
+ * @details Inicializa os contadores de ID para cada tipo de entidade e
+ *          publica um diretório de boards vazio. Os índices de colunas e
+ *          cards sao inicializados automaticamente com seus construtores padrao.
  */
 KanbanService::KanbanService() 
-    : nextBoardId_(1), nextColumnId_(1), nextCardId_(1), nextUserId_(1) {
-    // Os repositórios (boardRepository_, columnRepository_, etc.) sao 
-    // inicializados automaticamente com seus construtores padrao
+    : boards_(std::make_shared<const BoardDirectory>()),
+      textIndex_(std::make_shared<domain::TextIndex>()),
+      fuzzyIndex_(std::make_shared<domain::FuzzyIndex>()),
+      nextBoardId_(1), nextColumnId_(1), nextCardId_(1), nextUserId_(1) {
 }
 
 // ============================================================================
@@ -43,11 +72,12 @@ KanbanService::KanbanService()
 /**
  * @brief Gera um ID único para um novo Board
  * @return String no formato "board_X" onde X é um número sequencial
- * @details Mantém um contador interno que é incrementado a cada chamada.
- *          Garante IDs únicos durante a sessao da aplicaçao.
+ * @details Mantém um contador atômico incrementado a cada chamada.
+ *          Garante IDs únicos durante a sessao da aplicaçao, mesmo com
+ *          chamadas concorrentes.
  */
 std::string KanbanService::generateBoardId() {
-    return "board_" + std::to_string(nextBoardId_++);
+    return "board_" + std::to_string(nextBoardId_.fetch_add(1, std::memory_order_relaxed));
 }
 
 /**
@@ -56,7 +86,7 @@ std::string KanbanService::generateBoardId() {
  * @details Contador separado para columns, independente de outras entidades.
  */
 std::string KanbanService::generateColumnId() {
-    return "column_" + std::to_string(nextColumnId_++);
+    return "column_" + std::to_string(nextColumnId_.fetch_add(1, std::memory_order_relaxed));
 }
 
 /**
@@ -65,7 +95,7 @@ std::string KanbanService::generateColumnId() {
  * @details Cada card recebe um ID único, mesmo que esteja em columns diferentes.
  */
 std::string KanbanService::generateCardId() {
-    return "card_" + std::to_string(nextCardId_++);
+    return "card_" + std::to_string(nextCardId_.fetch_add(1, std::memory_order_relaxed));
 }
 
 /**
@@ -74,7 +104,7 @@ std::string KanbanService::generateCardId() {
  * @details Preparado para futura implementaçao de sistema de usuários.
  */
 std::string KanbanService::generateUserId() {
-    return "user_" + std::to_string(nextUserId_++);
+    return "user_" + std::to_string(nextUserId_.fetch_add(1, std::memory_order_relaxed));
 }
 
 // ============================================================================
@@ -85,11 +115,11 @@ std::string KanbanService::generateUserId() {
  * @brief Valida se um Board existe no sistema
  * @param boardId ID do board a ser validado
  * @throws std::runtime_error Se o board nao for encontrado
- * @details Consulta o repositório de boards para verificar existência.
+ * @details Consulta o snapshot atual do diretório de boards.
  *          Lança exceçao com mensagem descritiva em caso de nao existência.
  */
 void KanbanService::validateBoardExists(const std::string& boardId) const {
-    if (!boardRepository_.exists(boardId)) {
+    if (std::atomic_load(&boards_)->count(boardId) == 0) {
         throw std::runtime_error("Board nao encontrado: " + boardId);
     }
 }
@@ -98,13 +128,114 @@ void KanbanService::validateBoardExists(const std::string& boardId) const {
  * @brief Valida se uma Column existe no sistema
  * @param columnId ID da coluna a ser validada
  * @throws std::runtime_error Se a coluna nao for encontrada
- * @details Verifica no repositório de columns se a coluna existe.
+ * @details Verifica no índice de columns se a coluna existe.
  *          Importante para operações que dependem de columns válidas.
  */
 void KanbanService::validateColumnExists(const std::string& columnId) const {
-    if (!columnRepository_.exists(columnId)) {
+    if (!columns_.contains(columnId)) {
+        throw std::runtime_error("Coluna nao encontrada: " + columnId);
+    }
+}
+
+/**
+ * @brief Localiza o slot de um board no snapshot atual do diretório
+ * @param boardId ID do board
+ * @return Slot com o board e seu lock
+ * @throws std::runtime_error Se o board nao for encontrado
+ * @details O shared_ptr retornado mantém o slot vivo mesmo que um novo
+ *          snapshot seja publicado durante a operaçao.
+ */
+std::shared_ptr<KanbanService::BoardSlot> KanbanService::slotFor(const std::string& boardId) const {
+    auto directory = std::atomic_load(&boards_);
+    auto it = directory->find(boardId);
+    if (it == directory->end()) {
+        throw std::runtime_error("Board nao encontrado: " + boardId);
+    }
+    return it->second;
+}
+
+/**
+ * @brief Adquire o lock exclusivo do board e invalida a CardTable em cache
+ * @details Toda alteraçao estrutural do board passa por aqui; a versao é
+ *          lida pelos leitores sob o lock compartilhado.
+ */
+std::unique_lock<std::shared_mutex> KanbanService::lockForWrite(BoardSlot& slot) {
+    std::unique_lock<std::shared_mutex> lock(slot.mutex);
+    ++slot.version;
+    return lock;
+}
+
+/**
+ * @brief CardTable do board, remontada só se o board mudou desde a última
+ * @details Leitores concorrentes disputam apenas tableMutex; quem encontra a
+ *          tabela desatualizada a remonta uma vez para todos.
+ */
+std::shared_ptr<const domain::CardTable> KanbanService::cachedCardTable(const BoardSlot& slot) {
+    const std::uint64_t changes = slot.indexer->changes();
+    std::lock_guard<std::mutex> lock(slot.tableMutex);
+    if (!slot.table || slot.tableVersion != slot.version || slot.tableChanges != changes) {
+        slot.table = std::make_shared<const domain::CardTable>(domain::CardTable::fromBoard(*slot.board));
+        slot.tableVersion = slot.version;
+        slot.tableChanges = changes;
+    }
+    return slot.table;
+}
+
+/**
+ * @brief Localiza uma coluna e confirma que ela pertence ao board
+ * @param boardId ID do board esperado
+ * @param columnId ID da coluna
+ * @return Coluna encontrada
+ * @throws std::runtime_error Se a coluna nao existir ou for de outro board
+ * @details Sem essa verificaçao, uma operaçao poderia alterar uma coluna de
+ *          outro board sob o lock errado.
+ */
+std::shared_ptr<domain::Column> KanbanService::columnOf(const std::string& boardId,
+                                                        const std::string& columnId) const {
+    auto record = columns_.find(columnId);
+    if (!record) {
         throw std::runtime_error("Coluna nao encontrada: " + columnId);
     }
+    if (record->boardId != boardId) {
+        throw std::runtime_error("Coluna " + columnId + " nao pertence ao board " + boardId);
+    }
+    return record->column;
+}
+
+/**
+ * @brief Cria o board, seu ActivityLog (retençao e auditoria configuradas) e o indexador
+ * @details O slot ainda nao está no diretório: quem chama o publica.
+ */
+std::shared_ptr<KanbanService::BoardSlot> KanbanService::makeBoardSlot(const std::string& boardId,
+                                                                       const std::string& name) {
+    // Criar instância do Board usando smart pointer
+    auto board = std::make_shared<domain::Board>(boardId, name);
+    
+    // Criar e configurar ActivityLog para o board (rastreamento de atividades)
+    auto activityLog = std::make_shared<domain::ActivityLog>();
+    if (activityMemoryCapacity_ > 0) {
+        domain::ActivityRetention retention;
+        retention.memoryCapacity = activityMemoryCapacity_;
+        retention.spillBatch = std::max<std::size_t>(1, activityMemoryCapacity_ / 4);
+        if (!activitySpillDirectory_.empty()) {
+            retention.archive = std::make_shared<persistence::SegmentedActivityArchive>(
+                (std::filesystem::path(activitySpillDirectory_) / boardId).string());
+        }
+        activityLog->setRetention(retention);
+    }
+    if (!activityAuditDirectory_.empty()) {
+        std::filesystem::create_directories(activityAuditDirectory_);
+        auto path = std::filesystem::path(activityAuditDirectory_) / (boardId + ".log");
+        activityLog->setSink(std::make_shared<persistence::AsyncActivitySink>(
+            path.string(), *activityLog, activityAuditOptions_));
+    }
+    board->setActivityLog(activityLog);
+    
+    auto slot = std::make_shared<BoardSlot>();
+    slot->board = board;
+    slot->indexer = std::make_shared<CardIndexer>(*this, boardId, textIndex_, fuzzyIndex_);
+    slot->indexer->setReadModel(readModel_);
+    return slot;
 }
 
 // ============================================================================
@@ -138,21 +269,28 @@ void KanbanService::createSampleData() {
  * @param name Nome do board a ser criado
  * @return ID único do board criado
  * @details Cria a entidade Board, configura um ActivityLog para ela,
- *          e persiste no repositório apropriado.
+ *          e publica um novo snapshot do diretório contendo o board. A cópia
+ *          do diretório é O(boards), aceitável pois criar boards é raro
+ *          comparado às leituras, que ficam livres de lock.
+ *          O evento só é gravado depois que o slot foi montado (a criaçao do
+ *          ActivityLog pode falhar) e sob o mesmo lock que publica o board.
  */
 std::string KanbanService::createBoard(const std::string& name) {
     // Gerar ID único para o novo board
     std::string boardId = generateBoardId();
-    
-    // Criar instância do Board usando smart pointer
-    auto board = std::make_shared<domain::Board>(boardId, name);
-    
-    // Criar e configurar ActivityLog para o board (rastreamento de atividades)
-    auto activityLog = std::make_shared<domain::ActivityLog>();
-    board->setActivityLog(activityLog);
-    
-    // Persistir o board no repositório
-    boardRepository_.add(board);
+    auto slot = makeBoardSlot(boardId, name);
+
+    // Publicar o board: copy-on-write do diretório, trocado atomicamente
+    std::lock_guard<std::mutex> lock(boardsWriteMutex_);
+    if (events_) {
+        events_->append(domain::Event::boardCreated(events_->intern(boardId), events_->intern(name)));
+    }
+    if (readModel_) {
+        readModel_->publish(ProjectionUpdate::layout(boardId, *slot->board));
+    }
+    auto directory = std::make_shared<BoardDirectory>(*std::atomic_load(&boards_));
+    directory->emplace(boardId, std::move(slot));
+    std::atomic_store(&boards_, std::shared_ptr<const BoardDirectory>(std::move(directory)));
     
     return boardId;
 }
@@ -163,27 +301,35 @@ std::string KanbanService::createBoard(const std::string& name) {
  * @param columnName Nome da nova coluna
  * @return ID único da coluna criada
  * @throws std::runtime_error Se o board nao existir
- * @details Valida a existência do board, cria a coluna, persiste no repositório
- *          de columns e adiciona ao board especificado.
+ * @details Valida a existência do board, cria a coluna, adiciona ao board
+ *          especificado (sob o lock exclusivo do board) e a registra no
+ *          índice de columns.
  */
 std::string KanbanService::addColumn(const std::string& boardId, const std::string& columnName) {
     // Validar que o board existe antes de prosseguir
-    validateBoardExists(boardId);
+    auto slot = slotFor(boardId);
     
     // Gerar ID único para a nova coluna
     std::string columnId = generateColumnId();
     auto column = std::make_shared<domain::Column>(columnId, columnName);
     
-    // Adicionar ao repositório de colunas (persistência independente)
-    columnRepository_.add(column);
-    
     // Adicionar a coluna ao board específico
-    auto boardOpt = boardRepository_.findById(boardId);
-    if (boardOpt.has_value()) {
-        auto board = boardOpt.value();
-        board->addColumn(column);
+    {
+        auto lock = lockForWrite(*slot);
+        if (events_) {
+            events_->append(domain::Event::columnAdded(events_->intern(columnId), events_->intern(boardId),
+                                                       events_->intern(columnName)));
+        }
+        slot->board->addColumn(column);
+        if (readModel_) {
+            readModel_->publish(ProjectionUpdate::layout(boardId, *slot->board));
+        }
     }
     
+    // Registrar no índice de colunas (com o board dono)
+    columns_.insert(columnId, ColumnRecord{column, boardId});
+    notifyChanged(boardId);
+    
     return columnId;
 }
 
@@ -194,27 +340,37 @@ std::string KanbanService::addColumn(const std::string& boardId, const std::stri
  * @param title Título do novo card
  * @return ID único do card criado
  * @throws std::runtime_error Se board ou coluna nao existirem
- * @details Realiza validações em cascata, cria o card e o adiciona
- *          tanto ao repositório quanto à coluna específica.
+ * @details Realiza validações em cascata (a coluna deve pertencer ao board),
+ *          cria o card, o adiciona à coluna sob o lock exclusivo do board e
+ *          o registra no índice de cards (board, coluna e posiçao).
  */
 std::string KanbanService::addCard(const std::string& boardId, const std::string& columnId, const std::string& title) {
     // Validações em cascata para garantir integridade referencial
-    validateBoardExists(boardId);
-    validateColumnExists(columnId);
+    auto slot = slotFor(boardId);
+    auto column = columnOf(boardId, columnId);
     
     // Gerar ID único para o novo card
     std::string cardId = generateCardId();
     auto card = std::make_shared<domain::Card>(cardId, title);
     
-    // Adicionar ao repositório de cards (persistência centralizada)
-    cardRepository_.add(card);
-    
-    // Adicionar o card à coluna específica
-    auto columnOpt = columnRepository_.findById(columnId);
-    if (columnOpt.has_value()) {
-        auto column = columnOpt.value();
+    // Adicionar o card à coluna específica e registrar sua localizaçao
+    {
+        auto lock = lockForWrite(*slot);
+        if (events_) {
+            events_->append(domain::Event::cardAdded(events_->intern(cardId), events_->intern(columnId),
+                                                     events_->intern(title)));
+        }
         column->addCard(card);
+        placeCard(card, boardId, column, column->size() - 1);
+        if (auto activityLog = slot->board->activityLog()) {
+            activityLog->registerCard(cardId, columnId, card->createdAt());
+        }
+        if (readModel_) {
+            readModel_->publish(ProjectionUpdate::placed(boardId, *card, columnId));
+        }
     }
+    indexCard(boardId, card);
+    notifyChanged(boardId);
     
     return cardId;
 }
@@ -233,31 +389,31 @@ std::string KanbanService::addCard(const std::string& boardId, const std::string
 void KanbanService::moveCard(const std::string& boardId, const std::string& cardId, 
                             const std::string& fromColumnId, const std::string& toColumnId) {
     // Validações extensivas para garantir que todas as entidades envolvidas existem
-    validateBoardExists(boardId);
-    validateColumnExists(fromColumnId);
-    validateColumnExists(toColumnId);
+    auto slot = slotFor(boardId);
+    columnOf(boardId, fromColumnId);
+    auto toColumn = columnOf(boardId, toColumnId);
     
-    // Recuperar o board do repositório
-    auto boardOpt = boardRepository_.findById(boardId);
-    if (!boardOpt.has_value()) {
-        throw std::runtime_error("Board nao encontrado: " + boardId);
-    }
-    
-    auto board = boardOpt.value();
-    
-    // Delegar a operaçao de movimentaçao para a classe Board (domínio)
-    // Esta operaçao também acionará o registro no ActivityLog se configurado
-    board->moveCard(cardId, fromColumnId, toColumnId);
+    auto lock = lockForWrite(*slot);
+    std::size_t position = moveCardLocked(*slot, boardId, cardId, fromColumnId, toColumn);
+    slot->history.record(UndoDelta::cardMoved(cardId, fromColumnId, position, toColumnId, toColumn->size() - 1));
+    lock.unlock();
+    notifyChanged(boardId);
 }
 
 /**
  * @brief Retorna todos os Boards do sistema
  * @return Vector contendo shared_ptr para todos os boards
- * @details Consulta simples ao repositório que retorna todos os boards
- *          existentes, independente de seu estado ou conteúdo.
+ * @details Lê o snapshot atual do diretório sem tomar lock do serviço;
+ *          os boards sao retornados em ordem crescente de ID.
  */
 std::vector<std::shared_ptr<domain::Board>> KanbanService::listBoards() const {
-    return boardRepository_.getAll();
+    auto directory = std::atomic_load(&boards_);
+    std::vector<std::shared_ptr<domain::Board>> result;
+    result.reserve(directory->size());
+    for (const auto& entry : *directory) {
+        result.push_back(entry.second->board);
+    }
+    return result;
 }
 
 /**
@@ -267,9 +423,15 @@ std::vector<std::shared_ptr<domain::Board>> KanbanService::listBoards() const {
  *         ou std::nullopt se nao existir
  * @details Usa std::optional para representar claramente a possibilidade
  *          de o board nao existir, evitando exceções em casos normais.
+ *          Assim como listBoards(), nao toma lock do serviço.
  */
 std::optional<std::shared_ptr<domain::Board>> KanbanService::findBoard(const std::string& boardId) const {
-    return boardRepository_.findById(boardId);
+    auto directory = std::atomic_load(&boards_);
+    auto it = directory->find(boardId);
+    if (it == directory->end()) {
+        return std::nullopt;
+    }
+    return it->second->board;
 }
 
 /**
@@ -281,14 +443,10 @@ std::optional<std::shared_ptr<domain::Board>> KanbanService::findBoard(const std
  *          Retorna vector vazio se o board nao tiver colunas.
  */
 std::vector<std::shared_ptr<domain::Column>> KanbanService::listColumns(const std::string& boardId) const {
-    validateBoardExists(boardId);
+    auto slot = slotFor(boardId);
     
-    auto boardOpt = boardRepository_.findById(boardId);
-    if (boardOpt.has_value()) {
-        auto board = boardOpt.value();
-        return board->columns();
-    }
-    return {}; // Retorna vector vazio se board nao for encontrado (apesar da validaçao)
+    std::shared_lock<std::shared_mutex> lock(slot->mutex);
+    return slot->board->columns();
 }
 
 /**
@@ -300,106 +458,284 @@ std::vector<std::shared_ptr<domain::Column>> KanbanService::listColumns(const st
  *          Retorna vector vazio se a coluna nao tiver cards.
  */
 std::vector<std::shared_ptr<domain::Card>> KanbanService::listCards(const std::string& columnId) const {
-    validateColumnExists(columnId);
+    auto record = columns_.find(columnId);
+    if (!record) {
+        throw std::runtime_error("Coluna nao encontrada: " + columnId);
+    }
     
-    auto columnOpt = columnRepository_.findById(columnId);
-    if (columnOpt.has_value()) {
-        auto column = columnOpt.value();
-        return column->cards();
+    auto slot = slotFor(record->boardId);
+    std::shared_lock<std::shared_mutex> lock(slot->mutex);
+    return record->column->cards();
+}
+
+// ============================================================================
+// CONFIGURAÇaO DO HISTÓRICO DE ATIVIDADES
+// ============================================================================
+
+/**
+ * @brief Define a retençao do ActivityLog para os próximos boards
+ * @param memoryCapacity Máximo de atividades em memória por board (0 = ilimitado)
+ * @param spillDirectory Diretório base dos segmentos (vazio = descartar excedente)
+ * @details Os lotes descarregados correspondem a um quarto da capacidade,
+ *          equilibrando o número de arquivos e o pico de memória.
+ */
+void KanbanService::setActivityRetention(std::size_t memoryCapacity, const std::string& spillDirectory) {
+    activityMemoryCapacity_ = memoryCapacity;
+    activitySpillDirectory_ = spillDirectory;
+}
+
+/**
+ * @brief Define o diretório e a política da trilha de auditoria dos próximos boards
+ * @param directory Diretório dos arquivos de auditoria (vazio = desativado)
+ * @param options Política de fsync
+ */
+void KanbanService::setActivityAudit(const std::string& directory, persistence::FsyncOptions options) {
+    activityAuditDirectory_ = directory;
+    activityAuditOptions_ = options;
+}
+
+// ============================================================================
+// MODO EVENT-SOURCED
+// ============================================================================
+
+/**
+ * @brief Reconstrói os boards a partir do estado do store e passa a gravar as mutações
+ * @details O diretório inteiro é montado antes de ser publicado. Os IDs
+ *          gerados daqui em diante continuam depois dos maiores do log.
+ */
+void KanbanService::useEventStore(std::shared_ptr<domain::EventStore> store) {
+    if (!store) {
+        throw std::invalid_argument("useEventStore requer um EventStore");
+    }
+    if (!std::atomic_load(&boards_)->empty()) {
+        throw std::runtime_error("O modo event-sourced deve ser ativado antes de criar boards");
+    }
+
+    const domain::EventState state = store->state();
+    auto directory = std::make_shared<BoardDirectory>();
+    int lastBoard = 0;
+    int lastColumn = 0;
+    int lastCard = 0;
+    for (const auto& boardEntry : state.boards()) {
+        const std::string& boardId = store->resolve(boardEntry.id);
+        auto slot = makeBoardSlot(boardId, store->resolve(boardEntry.name));
+        auto activityLog = slot->board->activityLog();
+        lastBoard = std::max(lastBoard, idNumber(boardId, "board_"));
+
+        for (std::uint32_t c : boardEntry.columns) {
+            const auto& columnEntry = state.columns()[c];
+            auto column = std::make_shared<domain::Column>(store->resolve(columnEntry.id),
+                                                           store->resolve(columnEntry.name));
+            slot->board->addColumn(column);
+            columns_.insert(column->id(), ColumnRecord{column, boardId});
+            lastColumn = std::max(lastColumn, idNumber(column->id(), "column_"));
+
+            for (std::uint32_t k : columnEntry.cards) {
+                const auto& cardEntry = state.cards()[k];
+                auto card = std::make_shared<domain::Card>(store->resolve(cardEntry.id),
+                                                           store->resolve(cardEntry.title));
+                card->setPriority(cardEntry.priority);
+                if (cardEntry.description != domain::kNoEventHandle) {
+                    card->setDescription(store->resolve(cardEntry.description));
+                }
+                for (const auto& tagName : store->tags(cardEntry.firstTag, cardEntry.tagCount)) {
+                    card->addTag(std::make_shared<domain::Tag>(tagName, tagName));
+                }
+                column->addCard(card);
+                placeCard(card, boardId, column, column->size() - 1);
+                if (activityLog) {
+                    activityLog->registerCard(card->id(), column->id(), card->createdAt());
+                }
+                slot->indexer->add(card);
+                lastCard = std::max(lastCard, idNumber(card->id(), "card_"));
+            }
+        }
+        directory->emplace(boardId, std::move(slot));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(boardsWriteMutex_);
+        std::atomic_store(&boards_, std::shared_ptr<const BoardDirectory>(std::move(directory)));
     }
-    return {}; // Retorna vector vazio se coluna nao for encontrada (apesar da validaçao)
+    nextBoardId_.store(std::max(nextBoardId_.load(), lastBoard + 1));
+    nextColumnId_.store(std::max(nextColumnId_.load(), lastColumn + 1));
+    nextCardId_.store(std::max(nextCardId_.load(), lastCard + 1));
+    events_ = std::move(store);
+
+    if (readModel_) {
+        for (const auto& [boardId, slot] : *std::atomic_load(&boards_)) {
+            publishBoard(boardId, *slot);
+        }
+    }
+}
+
+// ============================================================================
+// PROJEÇÕES DE LEITURA
+// ============================================================================
+
+void KanbanService::useReadModel(std::shared_ptr<ReadModel> model) {
+    if (!model) {
+        throw std::invalid_argument("useReadModel requer um ReadModel");
+    }
+    readModel_ = std::move(model);
+    for (const auto& [boardId, slot] : *std::atomic_load(&boards_)) {
+        auto lock = lockForWrite(*slot);
+        slot->indexer->setReadModel(readModel_);
+        publishBoard(boardId, *slot);
+    }
+}
+
+void KanbanService::publishBoard(const std::string& boardId, const BoardSlot& slot) const {
+    readModel_->publish(ProjectionUpdate::layout(boardId, *slot.board));
+    for (const auto& column : slot.board->columns()) {
+        for (const auto& card : column->cards()) {
+            readModel_->publish(ProjectionUpdate::placed(boardId, *card, column->id()));
+        }
+    }
+}
+
+// ============================================================================
+// LOTES E NOTIFICAÇÕES
+// ============================================================================
+
+/**
+ * @brief Aplica um lote de comandos ao board
+ * @details Uma única busca do board, uma reserva de IDs por tipo e uma
+ *          única aquisiçao do lock exclusivo para o lote inteiro. A
+ *          validaçao é feita pelo BatchExecutor antes de qualquer mutaçao.
+ */
+std::vector<std::string> KanbanService::applyBatch(const std::string& boardId,
+                                                   const std::vector<domain::Command>& commands) {
+    auto slot = slotFor(boardId);
+    if (commands.empty()) {
+        return {};
+    }
+
+    std::size_t columnCount = 0;
+    std::size_t cardCount = 0;
+    BatchExecutor::countCreations(commands, columnCount, cardCount);
+    int nextColumn = nextColumnId_.fetch_add(static_cast<int>(columnCount), std::memory_order_relaxed);
+    int nextCard = nextCardId_.fetch_add(static_cast<int>(cardCount), std::memory_order_relaxed);
+
+    BatchResult result;
+    {
+        auto lock = lockForWrite(*slot);
+        result = BatchExecutor::execute(
+            *slot->board, commands,
+            [&nextColumn] { return "column_" + std::to_string(nextColumn++); },
+            [&nextCard] { return "card_" + std::to_string(nextCard++); },
+            events_.get());
+
+        // Localizações na ordem de aplicaçao: a última de cada card prevalece
+        for (const auto& placement : result.placements) {
+            placeCard(placement.card, boardId, placement.column, placement.position);
+        }
+
+        // Tags e prioridades de cards já existentes chegam pelo observador;
+        // os cards novos só passam a ser observados depois do lote
+        if (readModel_) {
+            if (!result.createdColumns.empty()) {
+                readModel_->publish(ProjectionUpdate::layout(boardId, *slot->board));
+            }
+            for (const auto& placement : result.placements) {
+                readModel_->publish(ProjectionUpdate::placed(boardId, *placement.card, placement.column->id()));
+            }
+        }
+    }
+
+    for (const auto& column : result.createdColumns) {
+        columns_.insert(column->id(), ColumnRecord{column, boardId});
+    }
+    for (const auto& card : result.createdCards) {
+        indexCard(boardId, card);
+    }
+    notifyChanged(boardId, commands.size());
+    return std::move(result.ids);
+}
+
+/**
+ * @brief Define o destino das notificações de alteraçao
+ * @details Assim como os demais métodos de configuraçao, deve ser chamado
+ *          antes do uso concorrente do serviço.
+ */
+void KanbanService::setChangeListener(ChangeListener listener) {
+    changeListener_ = std::move(listener);
 }
 
+/**
+ * @brief Emite uma notificaçao de alteraçao
+ */
+void KanbanService::notifyChanged(const std::string& boardId, std::size_t operations) const {
+    if (changeListener_) {
+        changeListener_(BoardChange{boardId, operations});
+    }
+}
+
+/**
+ * @brief Move a coluna de origem para a posiçao atual da coluna de destino
+ */
 void KanbanService::moveColumn(const std::string& boardId, 
                               const std::string& fromColumnId, 
                               const std::string& toColumnId) {
-    validateBoardExists(boardId);
+    auto slot = slotFor(boardId);
     validateColumnExists(fromColumnId);
     validateColumnExists(toColumnId);
     
-    auto boardOpt = boardRepository_.findById(boardId);
-    if (!boardOpt.has_value()) {
-        throw std::runtime_error("Board não encontrado: " + boardId);
-    }
-    
-    auto board = boardOpt.value();
-    auto columns = board->columns();
-    
-    // Encontrar índices das colunas
-    int fromIndex = -1;
-    int toIndex = -1;
-    
-    for (size_t i = 0; i < columns.size(); ++i) {
-        if (columns[i]->id() == fromColumnId) fromIndex = i;
-        if (columns[i]->id() == toColumnId) toIndex = i;
-    }
-    
-    if (fromIndex == -1 || toIndex == -1) {
+    auto lock = lockForWrite(*slot);
+    const auto& columns = slot->board->columns();
+    auto target = std::find_if(columns.begin(), columns.end(),
+                               [&toColumnId](const auto& column) { return column->id() == toColumnId; });
+    if (target == columns.end()) {
         throw std::runtime_error("Coluna de origem ou destino não encontrada no board");
     }
-    
-    // Reordenar: remover da posição atual e inserir na nova posição
-    auto columnToMove = columns[fromIndex];
-    
-    // Se movendo para frente
-    if (fromIndex < toIndex) {
-        columns.insert(columns.begin() + toIndex + 1, columnToMove);
-        columns.erase(columns.begin() + fromIndex);
-    } 
-    // Se movendo para trás  
-    else {
-        columns.insert(columns.begin() + toIndex, columnToMove);
-        columns.erase(columns.begin() + fromIndex + 1);
-    }
-    
-    // ATUALIZAR O BOARD COM A NOVA ORDEM - ADICIONE ESTA LINHA:
-    board->setColumns(columns);
+    auto toIndex = static_cast<std::size_t>(target - columns.begin());
+    std::size_t fromIndex = moveColumnLocked(*slot, boardId, fromColumnId, toIndex);
+    slot->history.record(UndoDelta::columnMoved(fromColumnId, fromIndex, toIndex));
+    lock.unlock();
+    notifyChanged(boardId);
 }
 
 void KanbanService::moveCardWithinColumn(const std::string& boardId, 
                                         const std::string& columnId, 
                                         const std::string& cardId, 
                                         std::size_t newIndex) {
-    auto boardOpt = findBoard(boardId);
-    if (!boardOpt) {
-        throw std::runtime_error("Board não encontrado: " + boardId);
-    }
+    auto slot = slotFor(boardId);
     
-    auto board = *boardOpt;
-    auto columnOpt = board->findColumn(columnId);
+    auto lock = lockForWrite(*slot);
+    auto columnOpt = slot->board->findColumn(columnId);
     if (!columnOpt) {
         throw std::runtime_error("Coluna não encontrada: " + columnId);
     }
     
-    auto column = *columnOpt;
-    bool success = column->moveCardToPosition(cardId, newIndex);
-    
-    if (!success) {
-        throw std::runtime_error("Card não encontrado na coluna: " + cardId);
+    std::size_t position = reorderCardLocked(*slot, boardId, *columnOpt, cardId, newIndex);
+    slot->history.record(UndoDelta::cardReordered(cardId, columnId, position,
+                                                  std::min(newIndex, (*columnOpt)->size() - 1)));
+    lock.unlock();
+    notifyChanged(boardId);
+}
+
+/**
+ * @brief Reordena um card na coluna, descobrindo o board pelo índice de colunas
+ */
+void KanbanService::moveCardWithinColumn(const std::string& columnId, const std::string& cardId, int newIndex) {
+    auto record = columns_.find(columnId);
+    if (!record) {
+        throw std::runtime_error("Coluna nao encontrada: " + columnId);
     }
-    
-    // Registrar a atividade de reordenação se o board tiver ActivityLog
-    auto activityLog = board->activityLog();
-    if (activityLog) {
-        auto now = std::chrono::system_clock::now();
-        auto cardOpt = column->findCard(cardId);
-        if (cardOpt) {
-            auto card = *cardOpt;
-            std::string description = "Card '" + card->title() + "' reordenado na coluna '" + column->name() + "' para posição " + std::to_string(newIndex + 1);
-            
-            // CORREÇÃO: Adicionar namespace domain::
-            domain::Activity activity(cardId + "_reorder", description, now);
-            activityLog->add(std::move(activity));
-        }
+    if (newIndex < 0) {
+        throw std::runtime_error("Posiçao inválida: " + std::to_string(newIndex));
     }
+    moveCardWithinColumn(record->boardId, columnId, cardId, static_cast<std::size_t>(newIndex));
 }
 
 std::vector<std::shared_ptr<domain::Tag>> KanbanService::getAllTags(const std::string& boardId) {
-    auto boardOpt = findBoard(boardId);
-    if (!boardOpt) return {};
+    auto directory = std::atomic_load(&boards_);
+    auto entry = directory->find(boardId);
+    if (entry == directory->end()) return {};
     
     std::map<std::string, std::shared_ptr<domain::Tag>> uniqueTags;
-    auto board = *boardOpt;
+    std::shared_lock<std::shared_mutex> lock(entry->second->mutex);
+    auto board = entry->second->board;
     
     for (const auto& column : board->columns()) {
         for (const auto& card : column->cards()) {
@@ -418,47 +754,770 @@ std::vector<std::shared_ptr<domain::Tag>> KanbanService::getAllTags(const std::s
 }
 
 void KanbanService::updateCardTags(const std::string& boardId, const std::string& cardId, const std::vector<std::string>& tagNames) {
-    auto boardOpt = findBoard(boardId);
-    if (!boardOpt) throw std::runtime_error("Board não encontrado");
+    auto slot = slotFor(boardId);
     
-    auto board = *boardOpt;
+    auto lock = lockForWrite(*slot);
     
-    // Encontrar o card em qualquer coluna
-    std::shared_ptr<domain::Card> targetCard;
-    std::shared_ptr<domain::Column> parentColumn;
+    // A coluna do card vem do índice, sem percorrer o board
+    auto record = cards_.find(cardId);
+    if (!record || record->boardId != boardId) throw std::runtime_error("Card não encontrado");
     
-    for (const auto& column : board->columns()) {
-        auto cardOpt = column->findCard(cardId);
-        if (cardOpt) {
-            targetCard = *cardOpt;
-            parentColumn = column;
-            break;
+    auto previous = retagCardLocked(*slot, record->card, record->column, tagNames);
+    slot->history.record(UndoDelta::cardTagsUpdated(cardId, std::move(previous), tagNames));
+    lock.unlock();
+    notifyChanged(boardId);
+}
+
+/**
+ * @brief Aplica a ediçao completa de um card sob o lock do board
+ */
+void KanbanService::updateCard(const std::string& boardId, const std::string& cardId, const std::string& title,
+                               const std::string& description, int priority,
+                               const std::vector<std::string>& tagNames) {
+    auto slot = slotFor(boardId);
+
+    auto lock = lockForWrite(*slot);
+    auto record = cards_.find(cardId);
+    if (!record || record->boardId != boardId) throw std::runtime_error("Card não encontrado");
+
+    CardContent content{title, description, priority, tagNames};
+    CardContent previous = editCardLocked(*slot, record->card, record->column, content);
+    if (previous != content) {
+        slot->history.record(UndoDelta::cardEdited(cardId, std::move(previous), std::move(content)));
+    }
+    lock.unlock();
+    notifyChanged(boardId);
+}
+
+// ============================================================================
+// CONSULTAS FILTRADAS
+// ============================================================================
+
+/**
+ * @brief Compila o filtro e executa a consulta
+ */
+std::vector<std::shared_ptr<domain::Card>> KanbanService::query(const std::string& boardId,
+                                                                const interfaces::IFilter& filter) const {
+    return query(boardId, domain::FilterPlan::compile(filter));
+}
+
+/**
+ * @brief Avalia o plano sobre as colunas do board dentro do seu escopo
+ */
+std::vector<std::shared_ptr<domain::Card>> KanbanService::query(const std::string& boardId,
+                                                                const domain::FilterPlan& plan) const {
+    auto slot = slotFor(boardId);
+    std::vector<std::shared_ptr<domain::Card>> result;
+    if (plan.rejectsAll()) {
+        return result;
+    }
+
+    const auto& scope = plan.columnScope();
+    std::shared_lock<std::shared_mutex> lock(slot->mutex);
+
+    // Trechos [begin, end) das colunas no escopo, na ordem do board
+    struct Chunk {
+        const domain::Column* column;
+        std::size_t begin;
+        std::size_t end;
+    };
+    std::vector<Chunk> chunks;
+    std::size_t total = 0;
+    for (const auto& column : slot->board->columns()) {
+        if (scope && !std::binary_search(scope->begin(), scope->end(), column->id())) {
+            continue;   // coluna fora do escopo: seus cards nem sao avaliados
         }
+        const std::size_t size = column->size();
+        for (std::size_t begin = 0; begin < size; begin += kQueryChunkCards) {
+            chunks.push_back(Chunk{column.get(), begin, std::min(begin + kQueryChunkCards, size)});
+        }
+        total += size;
     }
+    auto evaluate = [&plan](const Chunk& chunk, std::vector<std::shared_ptr<domain::Card>>& out) {
+        const auto& cards = chunk.column->cards();
+        for (std::size_t i = chunk.begin; i < chunk.end; ++i) {
+            if (plan.matches(*cards[i], chunk.column->id())) {
+                out.push_back(cards[i]);
+            }
+        }
+    };
+
+    if (total < kParallelQueryCards) {
+        for (const auto& chunk : chunks) {
+            evaluate(chunk, result);
+        }
+        return result;
+    }
+
+    // Board grande e plano só com prioridade, datas, tags e colunas: kernels da CardTable
+    if (plan.vectorizable()) {
+        auto table = cachedCardTable(*slot);
+        if (auto rows = plan.select(*table)) {
+            return table->cardsIn(*rows);
+        }
+    }
+
+    // Board grande: um trecho por tarefa, ainda sob o lock compartilhado
+    std::vector<std::vector<std::shared_ptr<domain::Card>>> parts(chunks.size());
+    {
+        concurrency::TaskGroup group(scheduler());
+        for (std::size_t i = 1; i < chunks.size(); ++i) {
+            group.run([&evaluate, &chunks, &parts, i] { evaluate(chunks[i], parts[i]); });
+        }
+        evaluate(chunks[0], parts[0]);
+        group.wait();
+    }
+    std::size_t accepted = 0;
+    for (const auto& part : parts) {
+        accepted += part.size();
+    }
+    result.reserve(accepted);
+    for (auto& part : parts) {
+        std::move(part.begin(), part.end(), std::back_inserter(result));
+    }
+    return result;
+}
+
+domain::CardTable KanbanService::cardTable(const std::string& boardId) const {
+    auto slot = slotFor(boardId);
+    std::shared_lock<std::shared_mutex> lock(slot->mutex);
+    return *cachedCardTable(*slot);
+}
+
+std::vector<domain::SearchHit> KanbanService::searchCards(const std::string& query, std::size_t limit) const {
+    return textIndex_->search(query, limit);
+}
+
+std::vector<domain::SearchHit> KanbanService::fuzzySearchCards(const std::string& query, std::size_t limit) const {
+    return fuzzyIndex_->search(query, limit);
+}
+
+std::vector<domain::Completion> KanbanService::completeCardTitles(const std::string& boardId,
+                                                                 const std::string& prefix,
+                                                                 std::size_t limit) const {
+    return slotFor(boardId)->indexer->completions().completeTitles(prefix, limit);
+}
+
+std::vector<domain::Completion> KanbanService::completeTagNames(const std::string& boardId,
+                                                               const std::string& prefix,
+                                                               std::size_t limit) const {
+    return slotFor(boardId)->indexer->completions().completeTags(prefix, limit);
+}
+
+std::vector<std::string> KanbanService::tagNames(const std::string& boardId) const {
+    return slotFor(boardId)->indexer->completions().tagNames();
+}
+
+std::vector<std::shared_ptr<domain::Card>> KanbanService::topCards(const std::string& boardId, std::size_t k) const {
+    return slotFor(boardId)->indexer->priorities().top(k);
+}
+
+domain::ColumnFlow KanbanService::columnFlow(const std::string& boardId, const std::string& columnId) const {
+    auto slot = slotFor(boardId);
+    columnOf(boardId, columnId);
+    auto activityLog = slot->board->activityLog();
+    return activityLog ? activityLog->columnFlow(columnId) : domain::ColumnFlow{};
+}
+
+std::optional<domain::CardFlow> KanbanService::cardFlow(const std::string& boardId, const std::string& cardId) const {
+    auto activityLog = slotFor(boardId)->board->activityLog();
+    return activityLog ? activityLog->cardFlow(cardId) : std::nullopt;
+}
+
+std::optional<std::chrono::milliseconds> KanbanService::leadTime(const std::string& boardId,
+                                                                 const std::string& cardId) const {
+    auto columns = listColumns(boardId);
+    auto flow = cardFlow(boardId, cardId);
+    if (columns.empty() || !flow || !flow->createdAt) {
+        return std::nullopt;
+    }
+    const std::string& done = columns.back()->id();
+    for (const auto& [column, arrivedAt] : flow->arrivals) {
+        if (column == done) {
+            auto lead = std::chrono::duration_cast<std::chrono::milliseconds>(arrivedAt - *flow->createdAt);
+            return std::max(lead, std::chrono::milliseconds(0));
+        }
+    }
+    return std::nullopt;
+}
+
+domain::CumulativeFlow KanbanService::cumulativeFlow(const std::string& boardId,
+                                                     domain::TimePoint from,
+                                                     domain::TimePoint to,
+                                                     std::chrono::milliseconds bucket) const {
+    auto slot = slotFor(boardId);
+    auto activityLog = slot->board->activityLog();
+    domain::CumulativeFlowInput input;
+    std::optional<domain::Activity> last;
+    {
+        // Contagens e limite do histórico lidos juntos: nenhuma mutaçao entre eles
+        std::shared_lock<std::shared_mutex> lock(slot->mutex);
+        for (const auto& column : slot->board->columns()) {
+            input.columns.emplace_back(activityLog ? activityLog->find(column->id()) : domain::kNoActivityHandle,
+                                       column->id());
+            input.current.push_back(static_cast<std::int64_t>(column->size()));
+        }
+        if (activityLog) {
+            last = activityLog->last();
+            input.creations = activityLog->creationsSince(from);
+        }
+    }
+    if (last) {
+        input.events = activityLog->between(domain::HybridTimestamp::fromTimePoint(from), last->timestamp());
+    }
+    return domain::cumulativeFlow(input, from, to, bucket, &scheduler());
+}
+
+domain::DeliveryForecast KanbanService::forecastDelivery(const std::string& boardId,
+                                                         std::size_t historyWeeks,
+                                                         std::size_t trials) const {
+    return forecastRemaining(boardId, nullptr, historyWeeks, trials);
+}
+
+domain::DeliveryForecast KanbanService::forecastDelivery(const std::string& boardId,
+                                                         const domain::FilterPlan& plan,
+                                                         std::size_t historyWeeks,
+                                                         std::size_t trials) const {
+    return forecastRemaining(boardId, &plan, historyWeeks, trials);
+}
+
+/**
+ * @brief Conta os restantes sob o lock compartilhado e simula fora dele
+ */
+domain::DeliveryForecast KanbanService::forecastRemaining(const std::string& boardId,
+                                                          const domain::FilterPlan* plan,
+                                                          std::size_t historyWeeks,
+                                                          std::size_t trials) const {
+    auto slot = slotFor(boardId);
+    auto activityLog = slot->board->activityLog();
+    std::string doneColumn;
+    std::size_t remaining = 0;
+    {
+        std::shared_lock<std::shared_mutex> lock(slot->mutex);
+        const auto& columns = slot->board->columns();
+        if (columns.empty()) {
+            throw std::runtime_error("Board sem colunas: " + boardId);
+        }
+        doneColumn = columns.back()->id();
+        const auto* scope = plan ? &plan->columnScope() : nullptr;
+        for (std::size_t c = 0; c + 1 < columns.size(); ++c) {
+            const auto& column = columns[c];
+            if (!plan) {
+                remaining += column->size();
+                continue;
+            }
+            if (plan->rejectsAll()) {
+                break;
+            }
+            if (*scope && !std::binary_search((*scope)->begin(), (*scope)->end(), column->id())) {
+                continue;
+            }
+            for (const auto& card : column->cards()) {
+                if (plan->matches(*card, column->id())) {
+                    ++remaining;
+                }
+            }
+        }
+    }
+
+    const auto now = std::chrono::system_clock::now();
+    std::vector<std::uint32_t> throughput;
+    if (activityLog) {
+        throughput = domain::weeklyThroughput(*activityLog, doneColumn, now, historyWeeks);
+    }
+    return domain::forecastDelivery(throughput, remaining, now, trials, &scheduler());
+}
+
+concurrency::ThreadPool& KanbanService::scheduler() {
+    return concurrency::ThreadPool::shared();
+}
+
+void KanbanService::indexCard(const std::string& boardId, const std::shared_ptr<domain::Card>& card) {
+    slotFor(boardId)->indexer->add(card);
+}
+
+// ============================================================================
+// INDEXADOR DOS CARDS DE UM BOARD
+// ============================================================================
+
+KanbanService::CardIndexer::CardIndexer(KanbanService& service, std::string boardId,
+                                        std::shared_ptr<domain::TextIndex> textIndex,
+                                        std::shared_ptr<domain::FuzzyIndex> fuzzyIndex)
+    : service_(service), boardId_(std::move(boardId)), textIndex_(std::move(textIndex)),
+      fuzzyIndex_(std::move(fuzzyIndex)) {}
+
+void KanbanService::CardIndexer::add(const std::shared_ptr<domain::Card>& card) {
+    card->setObserver(shared_from_this());
+    textIndex_->add(boardId_, *card);
+    fuzzyIndex_->add(boardId_, *card);
+    completions_.addCard(*card);
+    priorities_.add(card);
+}
+
+void KanbanService::CardIndexer::onCardTextChanged(const domain::Card& card) {
+    changes_.fetch_add(1, std::memory_order_release);
+    textIndex_->onCardTextChanged(card);
+    fuzzyIndex_->onCardTextChanged(card);
+    completions_.addCard(card);
+    priorities_.update(card);   // atribuiçao de Card pode trocar a prioridade também
+}
+
+void KanbanService::CardIndexer::onCardUpdated(const domain::Card& card) {
+    changes_.fetch_add(1, std::memory_order_release);
+    completions_.addCard(card);
+    priorities_.update(card);
+    if (readModel_) {
+        readModel_->publish(ProjectionUpdate::updated(boardId_, card));
+    }
+}
+
+/**
+ * @details O ID antigo só sai dos índices se ainda era deste card; em um
+ *          std::swap entre dois cards do board, o segundo passo encontra o
+ *          ID antigo já tomado pelo primeiro card.
+ */
+void KanbanService::CardIndexer::onCardIdChanged(const domain::Card& card, const std::string& previousId) {
+    changes_.fetch_add(1, std::memory_order_release);
+    bool released = false;
+    auto record = service_.relocateRenamedCard(boardId_, card, previousId, released);
+    if (released) {
+        textIndex_->remove(previousId);
+        fuzzyIndex_->remove(previousId);
+        completions_.removeCard(previousId);
+        priorities_.remove(previousId);
+        if (readModel_) {
+            readModel_->publish(ProjectionUpdate::removed(boardId_, previousId));
+        }
+    }
+    textIndex_->add(boardId_, card);
+    fuzzyIndex_->add(boardId_, card);
+    completions_.addCard(card);
+    if (record) {
+        priorities_.add(record->card);
+        if (readModel_) {
+            readModel_->publish(ProjectionUpdate::placed(boardId_, card, record->column->id()));
+        }
+    }
+}
+
+// ============================================================================
+// OPERAÇÕES A PARTIR DO ID DO CARD
+// ============================================================================
+
+/**
+ * @brief Localiza um card pelo índice de cards
+ * @details O board e a coluna vêm do índice; a posiçao gravada é conferida
+ *          sob o lock compartilhado do board, que também garante que o card
+ *          nao esteja no meio de uma movimentaçao.
+ */
+std::optional<CardLocation> KanbanService::locateCard(const std::string& cardId) const {
+    auto known = cards_.find(cardId);
+    if (!known) {
+        return std::nullopt;
+    }
+    auto slot = slotFor(known->boardId);
+
+    std::shared_lock<std::shared_mutex> lock(slot->mutex);
+    // Relido sob o lock: movimentações atualizam o índice com o lock exclusivo
+    auto record = cards_.find(cardId);
+    std::size_t position = positionIn(*record->column, cardId, record->position);
+    if (position == record->column->size()) {
+        return std::nullopt;   // removido diretamente do domínio, fora do serviço
+    }
+    return CardLocation{record->boardId, record->column->id(), position};
+}
+
+/**
+ * @brief Move um card para outra coluna usando a origem registrada no índice
+ */
+void KanbanService::moveCard(const std::string& cardId, const std::string& toColumnId) {
+    std::string boardId = cardRecord(cardId).boardId;
+    auto slot = slotFor(boardId);
+    auto toColumn = columnOf(boardId, toColumnId);
+
+    auto lock = lockForWrite(*slot);
+    auto record = cardRecord(cardId);
+    std::size_t position = moveCardLocked(*slot, boardId, cardId, record.column->id(), toColumn);
+    slot->history.record(UndoDelta::cardMoved(cardId, record.column->id(), position,
+                                              toColumnId, toColumn->size() - 1));
+    lock.unlock();
+    notifyChanged(boardId);
+}
+
+/**
+ * @brief Reposiciona um card na coluna registrada no índice
+ */
+void KanbanService::moveCardWithinColumn(const std::string& cardId, std::size_t newIndex) {
+    std::string boardId = cardRecord(cardId).boardId;
+    auto slot = slotFor(boardId);
+
+    auto lock = lockForWrite(*slot);
+    auto record = cardRecord(cardId);
+    std::size_t position = reorderCardLocked(*slot, boardId, record.column, cardId, newIndex);
+    slot->history.record(UndoDelta::cardReordered(cardId, record.column->id(), position,
+                                                  std::min(newIndex, record.column->size() - 1)));
+    lock.unlock();
+    notifyChanged(boardId);
+}
+
+/**
+ * @brief Substitui as tags de um card localizado pelo índice
+ */
+void KanbanService::updateCardTags(const std::string& cardId, const std::vector<std::string>& tagNames) {
+    std::string boardId = cardRecord(cardId).boardId;
+    auto slot = slotFor(boardId);
+
+    auto lock = lockForWrite(*slot);
+    auto record = cardRecord(cardId);
+    auto previous = retagCardLocked(*slot, record.card, record.column, tagNames);
+    slot->history.record(UndoDelta::cardTagsUpdated(cardId, std::move(previous), tagNames));
+    lock.unlock();
+    notifyChanged(boardId);
+}
+
+// ============================================================================
+// ÍNDICE DE LOCALIZAÇaO E MUTAÇÕES SOB LOCK
+// ============================================================================
+
+/**
+ * @brief Registro de um card no índice
+ */
+KanbanService::CardRecord KanbanService::cardRecord(const std::string& cardId) const {
+    auto record = cards_.find(cardId);
+    if (!record) {
+        throw std::runtime_error("Card nao encontrado: " + cardId);
+    }
+    return std::move(*record);
+}
+
+/**
+ * @brief Grava a localizaçao de um card (insere ou substitui)
+ */
+void KanbanService::placeCard(const std::shared_ptr<domain::Card>& card, const std::string& boardId,
+                              const std::shared_ptr<domain::Column>& column, std::size_t position) {
+    cards_.assign(card->id(), CardRecord{card, boardId, column, position});
+}
+
+/**
+ * @brief Leva a entrada de localizaçao de um card reatribuído para o novo ID
+ * @details Chamado pela notificaçao do card, na thread que fez a atribuiçao
+ *          (que já deve ter o board só para si, como em qualquer alteraçao
+ *          direta de um card).
+ */
+std::optional<KanbanService::CardRecord> KanbanService::relocateRenamedCard(const std::string& boardId,
+                                                                           const domain::Card& card,
+                                                                           const std::string& previousId,
+                                                                           bool& released) {
+    auto record = cards_.find(previousId);
+    released = record && record->card.get() == &card;
+    if (released) {
+        cards_.erase(previousId);
+    } else {
+        record.reset();
+        for (const auto& column : slotFor(boardId)->board->columns()) {
+            const auto& cards = column->cards();
+            for (std::size_t i = 0; i < cards.size() && !record; ++i) {
+                if (cards[i].get() == &card) {
+                    record = CardRecord{cards[i], boardId, column, i};
+                }
+            }
+        }
+    }
+    if (record) {
+        cards_.assign(card.id(), *record);
+    }
+    return record;
+}
+
+/**
+ * @brief Confere a posiçao gravada e, se ela estiver desatualizada, procura na coluna
+ */
+std::size_t KanbanService::positionIn(const domain::Column& column, const std::string& cardId,
+                                      std::size_t hint) noexcept {
+    const auto& cards = column.cards();
+    if (hint < cards.size() && cards[hint]->id() == cardId) {
+        return hint;
+    }
+    for (std::size_t i = 0; i < cards.size(); ++i) {
+        if (cards[i]->id() == cardId) {
+            return i;
+        }
+    }
+    return cards.size();
+}
+
+/**
+ * @brief Move o card (o domínio registra a atividade) e atualiza o índice
+ * @param toIndex Posiçao no destino; além do fim (o padrao), o card vai para o fim
+ * @return Posiçao que o card ocupava na coluna de origem
+ * @throws std::runtime_error Se o card nao estiver na coluna de origem
+ * @details Um único evento e uma única atividade, já com a posiçao final.
+ *          O evento só é gravado depois da validaçao, sob o lock exclusivo
+ *          do board que o chamador mantém durante a mutaçao.
+ */
+std::size_t KanbanService::moveCardLocked(BoardSlot& slot, const std::string& boardId, const std::string& cardId,
+                                          const std::string& fromColumnId,
+                                          const std::shared_ptr<domain::Column>& toColumn, std::size_t toIndex) {
+    auto fromColumn = columnOf(boardId, fromColumnId);
+    auto known = cards_.find(cardId);
+    std::size_t position = positionIn(*fromColumn, cardId, known ? known->position : 0);
+    if (position == fromColumn->size()) {
+        throw std::runtime_error("Card nao encontrado na coluna de origem: " + cardId);
+    }
+    // Posiçao final no destino (sem contar o próprio card, se a coluna é a mesma)
+    const bool sameColumn = toColumn == fromColumn;
+    toIndex = std::min(toIndex, toColumn->size() - (sameColumn ? 1 : 0));
+    if (events_) {
+        events_->append(domain::Event::cardMoved(events_->intern(cardId), events_->intern(fromColumnId),
+                                                 events_->intern(toColumn->id()),
+                                                 static_cast<std::uint32_t>(position),
+                                                 static_cast<std::uint32_t>(toIndex)));
+    }
+
+    // Delegar a operaçao de movimentaçao para a classe Board (domínio)
+    // Esta operaçao também acionará o registro no ActivityLog se configurado
+    slot.board->moveCard(cardId, fromColumnId, toColumn->id(), toIndex);
+    const auto& card = toColumn->cards()[toIndex];
+    placeCard(card, boardId, toColumn, toIndex);
+    if (readModel_) {
+        readModel_->publish(ProjectionUpdate::placed(boardId, *card, toColumn->id()));
+    }
+    return position;
+}
+
+/**
+ * @brief Reposiciona o card, registra a atividade e atualiza o índice
+ * @return Posiçao anterior do card na coluna
+ */
+std::size_t KanbanService::reorderCardLocked(BoardSlot& slot, const std::string& boardId,
+                                             const std::shared_ptr<domain::Column>& column,
+                                             const std::string& cardId, std::size_t newIndex) {
+    auto known = cards_.find(cardId);
+    std::size_t from = positionIn(*column, cardId, known ? known->position : 0);
+    if (from == column->size()) {
+        throw std::runtime_error("Card não encontrado na coluna: " + cardId);
+    }
+    // Posiçao final: além do fim, o card vai para o último lugar. A mesma
+    // posiçao vai para o evento, a atividade e o índice de cards.
+    newIndex = std::min(newIndex, column->size() - 1);
+    if (events_) {
+        events_->append(domain::Event::cardReordered(events_->intern(cardId), events_->intern(column->id()),
+                                                     static_cast<std::uint32_t>(from),
+                                                     static_cast<std::uint32_t>(newIndex)));
+    }
+
+    bool success = column->moveCardToPosition(cardId, newIndex);
     
-    if (!targetCard) throw std::runtime_error("Card não encontrado");
-    
-    // Limpar tags atuais
-    targetCard->clearTags();
+    if (!success) {
+        throw std::runtime_error("Card não encontrado na coluna: " + cardId);
+    }
     
-    // Adicionar novas tags
+    // Registrar a atividade de reordenação se o board tiver ActivityLog
+    auto activityLog = slot.board->activityLog();
+    if (activityLog) {
+        activityLog->add(domain::Activity::cardReordered(activityLog->intern(cardId),
+                                                         activityLog->intern(column->id()),
+                                                         static_cast<std::uint32_t>(newIndex),
+                                                         activityLog->now()));
+    }
+
+    placeCard(column->cards()[newIndex], boardId, column, newIndex);
+    return from;
+}
+
+/**
+ * @brief Substitui as tags do card e registra a atividade
+ * @return Nomes das tags anteriores
+ */
+std::vector<std::string> KanbanService::retagCardLocked(BoardSlot& slot, const std::shared_ptr<domain::Card>& card,
+                                                        const std::shared_ptr<domain::Column>& column,
+                                                        const std::vector<std::string>& tagNames) {
+    std::vector<std::string> previous;
+    previous.reserve(card->tags().size());
+    for (const auto& tag : card->tags()) {
+        previous.push_back(tag->name());
+    }
+
+    if (events_) {
+        events_->append(domain::Event::cardTagsUpdated(events_->intern(card->id()), events_->appendTags(tagNames),
+                                                       static_cast<std::uint32_t>(tagNames.size())));
+    }
+
+    // Substituir as tags com uma única notificaçao
+    std::vector<std::shared_ptr<domain::Tag>> tags;
+    tags.reserve(tagNames.size());
     for (const auto& tagName : tagNames) {
-        auto tag = std::make_shared<domain::Tag>(tagName, tagName);
-        targetCard->addTag(tag);
+        tags.push_back(std::make_shared<domain::Tag>(tagName, tagName));
     }
+    card->setTags(std::move(tags));
     
     // Registrar atividade
-    auto activityLog = board->activityLog();
+    auto activityLog = slot.board->activityLog();
     if (activityLog) {
-        auto now = std::chrono::system_clock::now();
-        std::string description = "Tags do card '" + targetCard->title() + "' atualizadas";
-        domain::Activity activity(cardId + "_tags_update", description, now);
-        activityLog->add(std::move(activity));
+        activityLog->add(domain::Activity::cardTagsUpdated(activityLog->intern(card->id()),
+                                                           activityLog->intern(column->id()),
+                                                           activityLog->now()));
+    }
+    return previous;
+}
+
+/**
+ * @brief Aplica o conteúdo editável ao card, campo a campo
+ * @return Conteúdo anterior
+ * @details Só os campos que mudam sao gravados: um evento por campo, antes
+ *          de alterar o card. As tags seguem por retagCardLocked().
+ */
+CardContent KanbanService::editCardLocked(BoardSlot& slot, const std::shared_ptr<domain::Card>& card,
+                                          const std::shared_ptr<domain::Column>& column,
+                                          const CardContent& content) {
+    CardContent previous{card->title(), card->description().value_or(""), card->priority(), {}};
+    previous.tags.reserve(card->tags().size());
+    for (const auto& tag : card->tags()) {
+        previous.tags.push_back(tag->name());
+    }
+
+    if (previous.title != content.title) {
+        if (events_) {
+            events_->append(domain::Event::cardTitleSet(events_->intern(card->id()), events_->intern(content.title)));
+        }
+        card->setTitle(content.title);
+    }
+    if (previous.description != content.description) {
+        if (events_) {
+            events_->append(domain::Event::cardDescriptionSet(events_->intern(card->id()),
+                                                              events_->intern(content.description)));
+        }
+        card->setDescription(content.description);
+    }
+    if (previous.priority != content.priority) {
+        if (events_) {
+            events_->append(domain::Event::cardPrioritySet(events_->intern(card->id()), content.priority));
+        }
+        card->setPriority(content.priority);
+    }
+    if (previous.tags != content.tags) {
+        retagCardLocked(slot, card, column, content.tags);
+    }
+    return previous;
+}
+
+/**
+ * @brief Leva a coluna para toIndex (limitado à última posiçao)
+ * @return Posiçao anterior da coluna
+ * @throws std::runtime_error Se a coluna nao estiver no board
+ */
+std::size_t KanbanService::moveColumnLocked(BoardSlot& slot, const std::string& boardId,
+                                            const std::string& columnId, std::size_t toIndex) {
+    auto columns = slot.board->columns();
+    auto it = std::find_if(columns.begin(), columns.end(),
+                           [&columnId](const auto& column) { return column->id() == columnId; });
+    if (it == columns.end()) {
+        throw std::runtime_error("Coluna não encontrada no board: " + columnId);
+    }
+    auto fromIndex = static_cast<std::size_t>(it - columns.begin());
+    toIndex = std::min(toIndex, columns.size() - 1);
+
+    if (events_) {
+        events_->append(domain::Event::columnMoved(events_->intern(columnId), events_->intern(boardId),
+                                                   static_cast<std::uint32_t>(fromIndex),
+                                                   static_cast<std::uint32_t>(toIndex)));
+    }
+
+    // Remover da posiçao atual e inserir na nova: a coluna termina em toIndex
+    auto column = *it;
+    columns.erase(it);
+    columns.insert(columns.begin() + static_cast<std::ptrdiff_t>(toIndex), std::move(column));
+    slot.board->setColumns(columns);
+    if (readModel_) {
+        readModel_->publish(ProjectionUpdate::layout(boardId, *slot.board));
     }
+    return fromIndex;
 }
 
+// ============================================================================
+// DESFAZER E REFAZER
+// ============================================================================
 
+bool KanbanService::undo(const std::string& boardId) {
+    auto slot = slotFor(boardId);
+    auto lock = lockForWrite(*slot);
+    auto delta = slot->history.takeUndo();
+    if (!delta) {
+        return false;
+    }
+    applyDelta(*slot, boardId, *delta, false);   // se falhar, a entrada já saiu da pilha
+    slot->history.pushRedo(std::move(*delta));
+    lock.unlock();
+    notifyChanged(boardId);
+    return true;
+}
 
+bool KanbanService::redo(const std::string& boardId) {
+    auto slot = slotFor(boardId);
+    auto lock = lockForWrite(*slot);
+    auto delta = slot->history.takeRedo();
+    if (!delta) {
+        return false;
+    }
+    applyDelta(*slot, boardId, *delta, true);
+    slot->history.pushUndo(std::move(*delta));
+    lock.unlock();
+    notifyChanged(boardId);
+    return true;
+}
+
+std::size_t KanbanService::undoCount(const std::string& boardId) const {
+    auto slot = slotFor(boardId);
+    std::shared_lock<std::shared_mutex> lock(slot->mutex);
+    return slot->history.undoCount();
+}
+
+std::size_t KanbanService::redoCount(const std::string& boardId) const {
+    auto slot = slotFor(boardId);
+    std::shared_lock<std::shared_mutex> lock(slot->mutex);
+    return slot->history.redoCount();
+}
+
+/**
+ * @brief Reaplica um lado do delta pelas mesmas mutações sob lock
+ * @details Cada passo valida o estado antes de alterá-lo (o card precisa
+ *          estar na coluna esperada), entao um delta que nao se aplica mais
+ *          lança sem mudar o board. Um card que volta de outra coluna é
+ *          inserido direto no índice gravado (um evento, uma atividade).
+ */
+void KanbanService::applyDelta(BoardSlot& slot, const std::string& boardId, const UndoDelta& delta, bool forward) {
+    const std::size_t index = forward ? delta.afterIndex : delta.beforeIndex;
+    switch (delta.kind) {
+        case UndoKind::CardMoved: {
+            const std::string& from = forward ? delta.beforeColumn : delta.afterColumn;
+            auto toColumn = columnOf(boardId, forward ? delta.afterColumn : delta.beforeColumn);
+            moveCardLocked(slot, boardId, delta.id, from, toColumn, index);
+            break;
+        }
+        case UndoKind::CardReordered:
+            reorderCardLocked(slot, boardId, columnOf(boardId, delta.beforeColumn), delta.id, index);
+            break;
+        case UndoKind::ColumnMoved:
+            moveColumnLocked(slot, boardId, delta.id, index);
+            break;
+        case UndoKind::CardTagsUpdated: {
+            auto record = cardRecord(delta.id);
+            if (record.boardId != boardId) {
+                throw std::runtime_error("Card nao pertence ao board " + boardId + ": " + delta.id);
+            }
+            retagCardLocked(slot, record.card, record.column, forward ? delta.afterTags : delta.beforeTags);
+            break;
+        }
+        case UndoKind::CardEdited: {
+            auto record = cardRecord(delta.id);
+            if (record.boardId != boardId) {
+                throw std::runtime_error("Card nao pertence ao board " + boardId + ": " + delta.id);
+            }
+            editCardLocked(slot, record.card, record.column, forward ? delta.afterContent : delta.beforeContent);
+            break;
+        }
+    }
+}
 
 } // namespace application
 } // namespace kanban
\ No newline at end of file
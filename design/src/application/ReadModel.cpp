@@ -0,0 +1,308 @@
+/**
+ * @file ReadModel.cpp
+ * @brief Implementaçao das projeções de leitura
+ */
+
+#include "application/ReadModel.h"
+#include "domain/Column.h"
+#include <algorithm>
+#include <unordered_set>
+
+namespace kanban {
+namespace application {
+
+namespace {
+
+ColumnCount* findColumn(std::vector<ColumnCount>& columns, const std::string& columnId) {
+    auto it = std::find_if(columns.begin(), columns.end(),
+                           [&columnId](const ColumnCount& column) { return column.id == columnId; });
+    return it == columns.end() ? nullptr : &*it;
+}
+
+std::vector<std::string> tagNamesOf(const domain::Card& card) {
+    std::vector<std::string> names;
+    names.reserve(card.tags().size());
+    for (const auto& tag : card.tags()) {
+        names.push_back(tag->name());
+    }
+    return names;
+}
+
+} // namespace
+
+// ============================================================================
+// FÁBRICAS DE ATUALIZAÇÕES
+// ============================================================================
+
+ProjectionUpdate ProjectionUpdate::layout(const std::string& boardId, const domain::Board& board) {
+    ProjectionUpdate update;
+    update.kind = ProjectionUpdateKind::BoardLayout;
+    update.boardId = boardId;
+    update.boardName = board.name();
+    update.columns.reserve(board.columns().size());
+    for (const auto& column : board.columns()) {
+        update.columns.emplace_back(column->id(), column->name());
+    }
+    return update;
+}
+
+ProjectionUpdate ProjectionUpdate::placed(const std::string& boardId, const domain::Card& card,
+                                          const std::string& columnId) {
+    ProjectionUpdate update = updated(boardId, card);
+    update.kind = ProjectionUpdateKind::CardPlaced;
+    update.columnId = columnId;
+    return update;
+}
+
+ProjectionUpdate ProjectionUpdate::updated(const std::string& boardId, const domain::Card& card) {
+    ProjectionUpdate update;
+    update.kind = ProjectionUpdateKind::CardUpdated;
+    update.boardId = boardId;
+    update.cardId = card.id();
+    update.priority = card.priority();
+    update.tags = tagNamesOf(card);
+    return update;
+}
+
+ProjectionUpdate ProjectionUpdate::removed(const std::string& boardId, const std::string& cardId) {
+    ProjectionUpdate update;
+    update.kind = ProjectionUpdateKind::CardRemoved;
+    update.boardId = boardId;
+    update.cardId = cardId;
+    return update;
+}
+
+// ============================================================================
+// CICLO DE VIDA
+// ============================================================================
+
+ReadModel::ReadModel() = default;
+
+ReadModel::~ReadModel() {
+    projector_.stop();
+}
+
+void ReadModel::setListener(Listener listener) {
+    listener_ = std::move(listener);
+}
+
+// ============================================================================
+// LADO DE ESCRITA
+// ============================================================================
+
+/**
+ * @brief Enfileira a atualizaçao e, se preciso, agenda um drain
+ * @details Existe no máximo uma mensagem de drain na caixa do projetor,
+ *          entao post() nunca encontra a caixa cheia: o produtor paga só a
+ *          inserçao no vetor sob inboxMutex_.
+ */
+std::uint64_t ReadModel::publish(ProjectionUpdate update) {
+    std::uint64_t version = 0;
+    bool post = false;
+    {
+        std::lock_guard<std::mutex> lock(inboxMutex_);
+        version = ++latest_[update.boardId];
+        inbox_.emplace_back(version, std::move(update));
+        post = !drainPosted_;
+        drainPosted_ = true;
+    }
+    if (post) {
+        projector_.post([this] { drain(); });
+    }
+    return version;
+}
+
+// ============================================================================
+// PROJETOR
+// ============================================================================
+
+void ReadModel::drain() {
+    std::vector<std::pair<std::uint64_t, ProjectionUpdate>> pending;
+    {
+        std::lock_guard<std::mutex> lock(inboxMutex_);
+        pending.swap(inbox_);
+        drainPosted_ = false;
+    }
+
+    std::vector<std::string> touched;
+    std::unordered_set<std::string> seen;
+    for (auto& [version, update] : pending) {
+        BoardState& state = states_[update.boardId];
+        apply(state, update);
+        state.version = version;
+        if (seen.insert(update.boardId).second) {
+            touched.push_back(update.boardId);
+        }
+    }
+
+    // Uma projeçao por board tocado, qualquer que seja o tamanho da rajada
+    std::vector<std::pair<std::string, std::shared_ptr<const BoardProjection>>> projections;
+    projections.reserve(touched.size());
+    for (const auto& boardId : touched) {
+        projections.emplace_back(boardId, snapshot(boardId, states_[boardId]));
+    }
+    {
+        std::lock_guard<std::mutex> lock(publishedMutex_);
+        for (const auto& [boardId, projection] : projections) {
+            published_[boardId] = projection;
+        }
+    }
+    publishedChanged_.notify_all();
+
+    if (listener_) {
+        for (const auto& [boardId, projection] : projections) {
+            listener_(boardId, projection->version);
+        }
+    }
+}
+
+void ReadModel::apply(BoardState& state, ProjectionUpdate& update) {
+    switch (update.kind) {
+        case ProjectionUpdateKind::BoardLayout: {
+            std::vector<ColumnCount> columns;
+            columns.reserve(update.columns.size());
+            for (auto& [id, name] : update.columns) {
+                const ColumnCount* previous = findColumn(state.columns, id);
+                columns.push_back(ColumnCount{std::move(id), std::move(name), previous ? previous->cards : 0});
+            }
+            state.name = std::move(update.boardName);
+            state.columns = std::move(columns);
+            break;
+        }
+        case ProjectionUpdateKind::CardPlaced: {
+            auto it = state.cards.find(update.cardId);
+            bool relist = true;
+            if (it != state.cards.end()) {
+                if (ColumnCount* column = findColumn(state.columns, it->second.columnId)) {
+                    --column->cards;
+                }
+                // Movimento simples: as listas de tag e prioridade nao mudam
+                relist = it->second.priority != update.priority || it->second.tags != update.tags;
+                if (relist) {
+                    unlist(state, it->first, it->second);
+                }
+            } else {
+                it = state.cards.emplace(update.cardId, CardState()).first;
+            }
+            it->second = CardState{std::move(update.columnId), update.priority, std::move(update.tags)};
+            if (ColumnCount* column = findColumn(state.columns, it->second.columnId)) {
+                ++column->cards;
+            }
+            if (relist) {
+                list(state, it->first, it->second);
+            }
+            break;
+        }
+        case ProjectionUpdateKind::CardUpdated: {
+            auto it = state.cards.find(update.cardId);
+            if (it == state.cards.end()) {
+                break;   // card ainda nao posicionado: o CardPlaced trará o conteúdo
+            }
+            if (it->second.priority == update.priority && it->second.tags == update.tags) {
+                break;
+            }
+            unlist(state, it->first, it->second);
+            it->second.priority = update.priority;
+            it->second.tags = std::move(update.tags);
+            list(state, it->first, it->second);
+            break;
+        }
+        case ProjectionUpdateKind::CardRemoved: {
+            auto it = state.cards.find(update.cardId);
+            if (it == state.cards.end()) {
+                break;
+            }
+            if (ColumnCount* column = findColumn(state.columns, it->second.columnId)) {
+                --column->cards;
+            }
+            unlist(state, it->first, it->second);
+            state.cards.erase(it);
+            break;
+        }
+    }
+}
+
+void ReadModel::unlist(BoardState& state, const std::string& cardId, const CardState& card) {
+    for (const auto& tag : card.tags) {
+        auto it = state.byTag.find(tag);
+        if (it != state.byTag.end() && it->second.erase(cardId) && it->second.empty()) {
+            state.byTag.erase(it);
+        }
+        state.dirtyTags.insert(tag);
+    }
+    auto it = state.byPriority.find(card.priority);
+    if (it != state.byPriority.end() && it->second.erase(cardId) && it->second.empty()) {
+        state.byPriority.erase(it);
+    }
+    state.dirtyPriorities.insert(card.priority);
+}
+
+void ReadModel::list(BoardState& state, const std::string& cardId, const CardState& card) {
+    for (const auto& tag : card.tags) {
+        state.byTag[tag].insert(cardId);
+        state.dirtyTags.insert(tag);
+    }
+    state.byPriority[card.priority].insert(cardId);
+    state.dirtyPriorities.insert(card.priority);
+}
+
+std::shared_ptr<const BoardProjection> ReadModel::snapshot(const std::string& boardId, BoardState& state) {
+    for (const auto& tag : state.dirtyTags) {
+        auto cards = state.byTag.find(tag);
+        if (cards == state.byTag.end()) {
+            state.tagLists.erase(tag);
+        } else {
+            state.tagLists[tag] = std::make_shared<const std::vector<std::string>>(cards->second.begin(),
+                                                                                   cards->second.end());
+        }
+    }
+    for (int priority : state.dirtyPriorities) {
+        auto cards = state.byPriority.find(priority);
+        if (cards == state.byPriority.end()) {
+            state.priorityLists.erase(priority);
+        } else {
+            state.priorityLists[priority] = std::make_shared<const std::vector<std::string>>(cards->second.begin(),
+                                                                                             cards->second.end());
+        }
+    }
+    state.dirtyTags.clear();
+    state.dirtyPriorities.clear();
+
+    auto projection = std::make_shared<BoardProjection>();
+    projection->boardId = boardId;
+    projection->name = state.name;
+    projection->version = state.version;
+    projection->totalCards = state.cards.size();
+    projection->columns = state.columns;
+    projection->cardsByTag = state.tagLists;
+    projection->cardsByPriority = state.priorityLists;
+    return projection;
+}
+
+// ============================================================================
+// LADO DE LEITURA
+// ============================================================================
+
+std::shared_ptr<const BoardProjection> ReadModel::board(const std::string& boardId) const {
+    std::lock_guard<std::mutex> lock(publishedMutex_);
+    auto it = published_.find(boardId);
+    return it == published_.end() ? nullptr : it->second;
+}
+
+std::uint64_t ReadModel::latestVersion(const std::string& boardId) const {
+    std::lock_guard<std::mutex> lock(inboxMutex_);
+    auto it = latest_.find(boardId);
+    return it == latest_.end() ? 0 : it->second;
+}
+
+bool ReadModel::waitFor(const std::string& boardId, std::uint64_t version,
+                        std::chrono::milliseconds timeout) const {
+    std::unique_lock<std::mutex> lock(publishedMutex_);
+    return publishedChanged_.wait_for(lock, timeout, [&] {
+        auto it = published_.find(boardId);
+        return it != published_.end() && it->second->version >= version;
+    });
+}
+
+} // namespace application
+} // namespace kanban
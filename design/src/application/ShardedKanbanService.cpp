@@ -0,0 +1,371 @@
+/**
+ * @file ShardedKanbanService.cpp
+ * @brief Implementaçao do serviço Kanban particionado em atores
+ * @details Cada operaçao é empacotada em uma mensagem e enviada ao shard dono
+ *          do board. Os IDs sao alocados no chamador (contadores atômicos)
+ *          para que nenhuma mensagem precise consultar outro shard.
+ */
+
+#include "application/ShardedKanbanService.h"
+#include "application/BatchExecutor.h"
+#include "domain/ActivityLog.h"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+namespace kanban {
+namespace application {
+
+using domain::Board;
+using domain::Card;
+using domain::Column;
+
+// ============================================================================
+// CONSTRUTOR E DESTRUTOR
+// ============================================================================
+
+/**
+ * @brief Construtor do ShardedKanbanService
+ * @details Sem valor explícito, usa um shard por núcleo disponível.
+ */
+ShardedKanbanService::ShardedKanbanService(std::size_t shards) {
+    if (shards == 0) {
+        shards = std::max(1u, std::thread::hardware_concurrency());
+    }
+    shards_.reserve(shards);
+    for (std::size_t i = 0; i < shards; ++i) {
+        shards_.push_back(std::make_unique<Shard>());
+    }
+}
+
+/**
+ * @brief Destrutor - encerra todos os shards antes de liberar o roteamento
+ * @details As mensagens pendentes ainda podem acessar columnRoutes_.
+ */
+ShardedKanbanService::~ShardedKanbanService() {
+    for (auto& shard : shards_) {
+        shard->actor.stop();
+    }
+}
+
+// ============================================================================
+// ROTEAMENTO
+// ============================================================================
+
+/**
+ * @brief Shard dono de um board (hash do ID)
+ */
+ShardedKanbanService::Shard& ShardedKanbanService::shardFor(const std::string& boardId) const {
+    return *shards_[shardOf(boardId)];
+}
+
+/**
+ * @brief Índice do shard dono de um board
+ */
+std::size_t ShardedKanbanService::shardOf(const std::string& boardId) const noexcept {
+    return std::hash<std::string>{}(boardId) % shards_.size();
+}
+
+/**
+ * @brief Número de shards
+ */
+std::size_t ShardedKanbanService::shardCount() const noexcept {
+    return shards_.size();
+}
+
+/**
+ * @brief Busca um board no estado de um shard
+ * @details Chamado apenas na thread do shard.
+ */
+std::shared_ptr<Board> ShardedKanbanService::boardIn(ShardState& state, const std::string& boardId) {
+    auto it = state.boards.find(boardId);
+    if (it == state.boards.end()) {
+        throw std::runtime_error("Board nao encontrado: " + boardId);
+    }
+    return it->second;
+}
+
+/**
+ * @brief Board dono de uma coluna
+ */
+std::string ShardedKanbanService::boardOfColumn(const std::string& columnId) const {
+    auto boardId = columnRoutes_.find(columnId);
+    if (!boardId) {
+        throw std::runtime_error("Coluna nao encontrada: " + columnId);
+    }
+    return *boardId;
+}
+
+namespace {
+
+/**
+ * @brief Coluna de um board, na thread do shard
+ */
+std::shared_ptr<Column> columnIn(const Board& board, const std::string& columnId) {
+    auto column = board.findColumn(columnId);
+    if (!column) {
+        throw std::runtime_error("Coluna nao encontrada: " + columnId);
+    }
+    return *column;
+}
+
+// ============================================================================
+// CÓPIAS PARA LEITURA FORA DO SHARD
+// ============================================================================
+
+/// @brief Cópias independentes dos cards (sem observador), na thread do shard
+std::vector<std::shared_ptr<Card>> snapshotOf(const std::vector<std::shared_ptr<Card>>& cards) {
+    std::vector<std::shared_ptr<Card>> copies;
+    copies.reserve(cards.size());
+    for (const auto& card : cards) {
+        copies.push_back(std::make_shared<Card>(*card));
+    }
+    return copies;
+}
+
+/// @brief Cópia independente de uma coluna e dos seus cards
+std::shared_ptr<Column> snapshotOf(const Column& column) {
+    auto copy = std::make_shared<Column>(column.id(), column.name());
+    for (auto& card : snapshotOf(column.cards())) {
+        copy->addCard(card);
+    }
+    return copy;
+}
+
+/// @brief Cópias independentes das colunas
+std::vector<std::shared_ptr<Column>> snapshotOf(const std::vector<std::shared_ptr<Column>>& columns) {
+    std::vector<std::shared_ptr<Column>> copies;
+    copies.reserve(columns.size());
+    for (const auto& column : columns) {
+        copies.push_back(snapshotOf(*column));
+    }
+    return copies;
+}
+
+/**
+ * @brief Cópia independente de um board
+ * @details O ActivityLog é compartilhado: ele é thread-safe e continua
+ *          recebendo as atividades do board original.
+ */
+std::shared_ptr<Board> snapshotOf(const Board& board) {
+    auto copy = std::make_shared<Board>(board.id(), board.name());
+    for (auto& column : snapshotOf(board.columns())) {
+        copy->addColumn(column);
+    }
+    copy->setActivityLog(board.activityLog());
+    return copy;
+}
+
+} // namespace
+
+// ============================================================================
+// OPERAÇÕES ASSÍNCRONAS
+// ============================================================================
+
+/**
+ * @brief Cria um board (com ActivityLog) no shard correspondente ao ID
+ */
+std::future<std::string> ShardedKanbanService::createBoardAsync(const std::string& name) {
+    std::string boardId = "board_" + std::to_string(nextBoardId_.fetch_add(1, std::memory_order_relaxed));
+    Shard& shard = shardFor(boardId);
+    return shard.actor.ask([&shard, boardId, name] {
+        auto board = std::make_shared<Board>(boardId, name);
+        board->setActivityLog(std::make_shared<domain::ActivityLog>());
+        shard.state.boards.emplace(boardId, board);
+        return boardId;
+    });
+}
+
+/**
+ * @brief Adiciona uma coluna e registra sua rota
+ */
+std::future<std::string> ShardedKanbanService::addColumnAsync(const std::string& boardId,
+                                                              const std::string& columnName) {
+    std::string columnId = "column_" + std::to_string(nextColumnId_.fetch_add(1, std::memory_order_relaxed));
+    Shard& shard = shardFor(boardId);
+    return shard.actor.ask([this, &shard, boardId, columnId, columnName] {
+        auto board = boardIn(shard.state, boardId);
+        board->addColumn(std::make_shared<Column>(columnId, columnName));
+        columnRoutes_.insert(columnId, boardId);
+        return columnId;
+    });
+}
+
+/**
+ * @brief Adiciona um card a uma coluna do board
+ */
+std::future<std::string> ShardedKanbanService::addCardAsync(const std::string& boardId,
+                                                            const std::string& columnId,
+                                                            const std::string& title) {
+    std::string cardId = "card_" + std::to_string(nextCardId_.fetch_add(1, std::memory_order_relaxed));
+    Shard& shard = shardFor(boardId);
+    return shard.actor.ask([&shard, boardId, columnId, cardId, title] {
+        auto board = boardIn(shard.state, boardId);
+        auto card = std::make_shared<Card>(cardId, title);
+        columnIn(*board, columnId)->addCard(card);
+        if (auto log = board->activityLog()) {
+            log->registerCard(cardId, columnId, card->createdAt());
+        }
+        return cardId;
+    });
+}
+
+/**
+ * @brief Move um card entre colunas (delegado ao domínio, que registra a atividade)
+ */
+std::future<void> ShardedKanbanService::moveCardAsync(const std::string& boardId,
+                                                      const std::string& cardId,
+                                                      const std::string& fromColumnId,
+                                                      const std::string& toColumnId) {
+    Shard& shard = shardFor(boardId);
+    return shard.actor.ask([&shard, boardId, cardId, fromColumnId, toColumnId] {
+        boardIn(shard.state, boardId)->moveCard(cardId, fromColumnId, toColumnId);
+    });
+}
+
+/**
+ * @brief Aplica um lote de comandos no shard dono do board
+ * @details Os IDs sao reservados no chamador; as rotas das colunas criadas
+ *          sao registradas pelo shard após a aplicaçao.
+ */
+std::future<std::vector<std::string>>
+ShardedKanbanService::applyBatchAsync(const std::string& boardId, std::vector<domain::Command> commands) {
+    std::size_t columnCount = 0;
+    std::size_t cardCount = 0;
+    BatchExecutor::countCreations(commands, columnCount, cardCount);
+    int nextColumn = nextColumnId_.fetch_add(static_cast<int>(columnCount), std::memory_order_relaxed);
+    int nextCard = nextCardId_.fetch_add(static_cast<int>(cardCount), std::memory_order_relaxed);
+
+    Shard& shard = shardFor(boardId);
+    return shard.actor.ask([this, &shard, boardId, commands = std::move(commands), nextColumn, nextCard]() mutable {
+        auto board = boardIn(shard.state, boardId);
+        BatchResult result = BatchExecutor::execute(
+            *board, commands,
+            [&nextColumn] { return "column_" + std::to_string(nextColumn++); },
+            [&nextCard] { return "card_" + std::to_string(nextCard++); });
+        for (const auto& column : result.createdColumns) {
+            columnRoutes_.insert(column->id(), boardId);
+        }
+        return std::move(result.ids);
+    });
+}
+
+/**
+ * @brief Colunas de um board (cópias montadas na thread do shard)
+ */
+std::future<std::vector<std::shared_ptr<Column>>>
+ShardedKanbanService::listColumnsAsync(const std::string& boardId) const {
+    Shard& shard = shardFor(boardId);
+    return shard.actor.ask([&shard, boardId] {
+        return snapshotOf(boardIn(shard.state, boardId)->columns());
+    });
+}
+
+/**
+ * @brief Cards de uma coluna (roteado pelo board dono da coluna; cópias)
+ */
+std::future<std::vector<std::shared_ptr<Card>>>
+ShardedKanbanService::listCardsAsync(const std::string& columnId) const {
+    std::string boardId = boardOfColumn(columnId);
+    Shard& shard = shardFor(boardId);
+    return shard.actor.ask([&shard, boardId, columnId] {
+        return snapshotOf(columnIn(*boardIn(shard.state, boardId), columnId)->cards());
+    });
+}
+
+// ============================================================================
+// IMPLEMENTAÇaO DA INTERFACE IService
+// ============================================================================
+
+/**
+ * @brief Cria dados de exemplo (mesmo conteúdo do KanbanService)
+ */
+void ShardedKanbanService::createSampleData() {
+    std::string boardId = createBoard("Projeto Kanban de Exemplo");
+
+    std::string todoId = addColumn(boardId, "To Do");
+    std::string doingId = addColumn(boardId, "Doing");
+    std::string doneId = addColumn(boardId, "Done");
+
+    addCard(boardId, todoId, "ambiente de desenvolvimento");
+    addCard(boardId, todoId, "Implementar classes de domínio");
+    addCard(boardId, doingId, "Criar KanbanService");
+    addCard(boardId, doneId, "Definir arquitetura do projeto");
+}
+
+std::string ShardedKanbanService::createBoard(const std::string& name) {
+    return createBoardAsync(name).get();
+}
+
+std::string ShardedKanbanService::addColumn(const std::string& boardId, const std::string& columnName) {
+    return addColumnAsync(boardId, columnName).get();
+}
+
+std::string ShardedKanbanService::addCard(const std::string& boardId,
+                                          const std::string& columnId,
+                                          const std::string& title) {
+    return addCardAsync(boardId, columnId, title).get();
+}
+
+void ShardedKanbanService::moveCard(const std::string& boardId, const std::string& cardId,
+                                    const std::string& fromColumnId, const std::string& toColumnId) {
+    moveCardAsync(boardId, cardId, fromColumnId, toColumnId).get();
+}
+
+std::vector<std::string> ShardedKanbanService::applyBatch(const std::string& boardId,
+                                                          const std::vector<domain::Command>& commands) {
+    return applyBatchAsync(boardId, commands).get();
+}
+
+/**
+ * @brief Junta os boards de todos os shards, ordenados por ID
+ * @details Cada shard copia os seus boards na própria thread.
+ */
+std::vector<std::shared_ptr<Board>> ShardedKanbanService::listBoards() const {
+    std::vector<std::future<std::vector<std::shared_ptr<Board>>>> parts;
+    parts.reserve(shards_.size());
+    for (const auto& shard : shards_) {
+        Shard* owner = shard.get();
+        parts.push_back(owner->actor.ask([owner] {
+            std::vector<std::shared_ptr<Board>> boards;
+            boards.reserve(owner->state.boards.size());
+            for (const auto& entry : owner->state.boards) {
+                boards.push_back(snapshotOf(*entry.second));
+            }
+            return boards;
+        }));
+    }
+
+    std::vector<std::shared_ptr<Board>> result;
+    for (auto& part : parts) {
+        auto boards = part.get();
+        result.insert(result.end(), boards.begin(), boards.end());
+    }
+    std::sort(result.begin(), result.end(), [](const auto& a, const auto& b) {
+        return a->id() < b->id();
+    });
+    return result;
+}
+
+std::optional<std::shared_ptr<Board>> ShardedKanbanService::findBoard(const std::string& boardId) const {
+    Shard& shard = shardFor(boardId);
+    return shard.actor.ask([&shard, boardId]() -> std::optional<std::shared_ptr<Board>> {
+        auto it = shard.state.boards.find(boardId);
+        if (it == shard.state.boards.end()) {
+            return std::nullopt;
+        }
+        return snapshotOf(*it->second);
+    }).get();
+}
+
+std::vector<std::shared_ptr<Column>> ShardedKanbanService::listColumns(const std::string& boardId) const {
+    return listColumnsAsync(boardId).get();
+}
+
+std::vector<std::shared_ptr<Card>> ShardedKanbanService::listCards(const std::string& columnId) const {
+    return listCardsAsync(columnId).get();
+}
+
+} // namespace application
+} // namespace kanban
@@ -0,0 +1,58 @@
+/**
+ * @file UndoHistory.cpp
+ * @brief Implementaçao do histórico de desfazer/refazer
+ */
+
+#include "application/UndoHistory.h"
+#include <algorithm>
+#include <utility>
+
+namespace kanban {
+namespace application {
+
+UndoHistory::UndoHistory(std::size_t depth) noexcept : depth_(std::max<std::size_t>(1, depth)) {}
+
+void UndoHistory::record(UndoDelta delta) {
+    redo_.clear();
+    pushUndo(std::move(delta));
+}
+
+void UndoHistory::pushUndo(UndoDelta delta) {
+    undo_.push_back(std::move(delta));
+    if (undo_.size() > depth_) {
+        undo_.pop_front();
+    }
+}
+
+void UndoHistory::pushRedo(UndoDelta delta) {
+    redo_.push_back(std::move(delta));
+    if (redo_.size() > depth_) {
+        redo_.pop_front();
+    }
+}
+
+std::optional<UndoDelta> UndoHistory::takeUndo() {
+    if (undo_.empty()) {
+        return std::nullopt;
+    }
+    UndoDelta delta = std::move(undo_.back());
+    undo_.pop_back();
+    return delta;
+}
+
+std::optional<UndoDelta> UndoHistory::takeRedo() {
+    if (redo_.empty()) {
+        return std::nullopt;
+    }
+    UndoDelta delta = std::move(redo_.back());
+    redo_.pop_back();
+    return delta;
+}
+
+void UndoHistory::clear() noexcept {
+    undo_.clear();
+    redo_.clear();
+}
+
+} // namespace application
+} // namespace kanban
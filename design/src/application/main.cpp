@@ -152,10 +152,8 @@ void demonstrateDomainDetails() {
     
     // 4. ActivityLog em acao
     std::cout << "4. ActivityLog registrando atividades:" << std::endl;
-    auto activity = kanban::domain::Activity("act1", "Card criado manualmente", 
-                                           std::chrono::system_clock::now());
-    activityLog->add(activity);
-    std::cout << "   Atividade registrada: " << activity.description() << std::endl;
+    activityLog->note("Card criado manualmente");
+    std::cout << "   Atividade registrada: " << board->describe(*activityLog->last()) << std::endl;
     std::cout << "   Total de atividades: " << activityLog->size() << std::endl;
     
     std::cout << "=========================================\n" << std::endl;
@@ -256,7 +254,7 @@ void demonstrateKanbanOperations(kanban::application::KanbanService& service,
                     auto activities = (*board)->activityLog()->activities();
                     if (!activities.empty()) {
                         view.showMessage("10. Ultima atividade registrada:");
-                        std::cout << "   " << activities.back().description() << std::endl;
+                        std::cout << "   " << (*board)->describe(activities.back()) << std::endl;
                     }
                 }
                 
@@ -0,0 +1,145 @@
+/**
+ * @file ActorThread.cpp
+ * @brief Implementaçao da thread-ator com caixa de mensagens lock-free
+ * @details Contém o laço de processamento e o protocolo de sono/despertar:
+ *          a thread só dorme depois de anunciar que vai dormir e reconferir
+ *          a caixa, e o produtor só notifica quando a thread anunciou o sono.
+ */
+
+#include "concurrency/ActorThread.h"
+#include <chrono>
+
+namespace kanban {
+namespace concurrency {
+
+namespace {
+
+/// @brief Tentativas de leitura da caixa vazia antes de dormir
+constexpr int kSpinBeforeSleep = 64;
+
+/// @brief Espera máxima da thread ociosa (rede de segurança contra wakeups perdidos)
+constexpr std::chrono::milliseconds kIdleWait{20};
+
+} // namespace
+
+// ============================================================================
+// CONSTRUTOR E DESTRUTOR
+// ============================================================================
+
+/**
+ * @brief Construtor da ActorThread
+ * @details A thread é iniciada depois que a caixa está pronta.
+ */
+ActorThread::ActorThread(std::size_t mailboxCapacity)
+    : mailbox_(mailboxCapacity) {
+    thread_ = std::thread(&ActorThread::run, this);
+}
+
+/**
+ * @brief Destrutor - processa o restante e encerra a thread
+ */
+ActorThread::~ActorThread() {
+    stop();
+}
+
+// ============================================================================
+// PRODUTORES
+// ============================================================================
+
+/**
+ * @brief Publica uma mensagem na caixa do ator
+ * @details A barreira seq_cst após o push pareia com a do ator antes de
+ *          reconferir a caixa: ou o ator vê a mensagem, ou o produtor vê
+ *          sleeping_ e o acorda.
+ */
+void ActorThread::post(std::function<void()> message) {
+    if (stopping_.load(std::memory_order_acquire)) {
+        return;
+    }
+    while (!mailbox_.tryPush(std::move(message))) {
+        std::this_thread::yield();
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        wake_.notify_one();
+    }
+}
+
+/**
+ * @brief Encerra a thread após processar as mensagens já publicadas
+ */
+void ActorThread::stop() {
+    if (stopping_.exchange(true)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        wake_.notify_one();
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+// ============================================================================
+// THREAD DO ATOR
+// ============================================================================
+
+/**
+ * @brief Laço principal: processa mensagens, gira brevemente e dorme
+ */
+void ActorThread::run() {
+    std::function<void()> message;
+    int idle = 0;
+    for (;;) {
+        if (mailbox_.tryPop(message)) {
+            idle = 0;
+            try {
+                message();
+            } catch (...) {
+                // Mensagens de post() nao têm para quem reportar; ask() usa packaged_task
+            }
+            message = nullptr;
+            processed_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        if (stopping_.load(std::memory_order_acquire)) {
+            break;
+        }
+        if (++idle < kSpinBeforeSleep) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        sleeping_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        wake_.wait_for(lock, kIdleWait, [this] {
+            return mailbox_.sizeApprox() > 0 || stopping_.load(std::memory_order_acquire);
+        });
+        sleeping_.store(false, std::memory_order_relaxed);
+        idle = 0;
+    }
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+/**
+ * @brief Verifica se o chamador está na thread do ator
+ */
+bool ActorThread::isCurrentThread() const noexcept {
+    return std::this_thread::get_id() == thread_.get_id();
+}
+
+/**
+ * @brief Número de mensagens processadas
+ */
+std::uint64_t ActorThread::processed() const noexcept {
+    return processed_.load(std::memory_order_relaxed);
+}
+
+} // namespace concurrency
+} // namespace kanban
@@ -0,0 +1,256 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementaçao do escalonador com roubo de trabalho e dos grupos de tarefas
+ */
+
+#include "concurrency/ThreadPool.h"
+#include <algorithm>
+
+namespace kanban {
+namespace concurrency {
+
+namespace {
+
+/// @brief Pool e índice da thread atual (nullptr fora de qualquer pool)
+struct CurrentWorker {
+    const ThreadPool* pool = nullptr;
+    std::size_t index = 0;
+    std::size_t depth = 0;          ///< @brief Tarefas aninhadas em execuçao (ajuda em TaskGroup::wait())
+    std::uint64_t blockedNs = 0;    ///< @brief Tempo parado em TaskGroup::wait() durante a tarefa externa
+};
+
+thread_local CurrentWorker currentWorker;
+
+} // namespace
+
+// ============================================================================
+// CONSTRUTOR E DESTRUTOR
+// ============================================================================
+
+ThreadPool::ThreadPool(std::size_t threads) : started_(Clock::now()) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    // Threads iniciadas só depois de todas as filas existirem: elas roubam umas das outras
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_[i]->thread = std::thread(&ThreadPool::run, this, i);
+    }
+}
+
+/**
+ * @brief Encerra o pool depois de esvaziar as filas
+ */
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    ready_.notify_all();
+    for (auto& worker : workers_) {
+        worker->thread.join();
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+// ============================================================================
+// FILAS E ROUBO DE TRABALHO
+// ============================================================================
+
+std::size_t ThreadPool::currentIndex() const noexcept {
+    return currentWorker.pool == this ? currentWorker.index : workers_.size();
+}
+
+void ThreadPool::enqueue(Task task) {
+    std::size_t target = currentIndex();
+    if (target == workers_.size()) {
+        target = nextQueue_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+    }
+    {
+        std::lock_guard<std::mutex> lock(workers_[target]->mutex);
+        workers_[target]->tasks.push_back(std::move(task));
+    }
+    queued_.fetch_add(1, std::memory_order_release);
+    // Sincroniza com uma thread entre o teste de queued_ e o wait: o aviso nao se perde
+    { std::lock_guard<std::mutex> lock(sleepMutex_); }
+    ready_.notify_one();
+}
+
+bool ThreadPool::take(std::size_t self, Task& task) {
+    const std::size_t count = workers_.size();
+    if (self < count) {
+        Worker& own = *workers_[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    // Roubo: a partir da fila seguinte, a mais antiga de cada vítima
+    const std::size_t first = self < count ? self + 1 : nextQueue_.load(std::memory_order_relaxed);
+    for (std::size_t k = 0; k < count; ++k) {
+        const std::size_t victim = (first + k) % count;
+        if (victim == self) {
+            continue;
+        }
+        Worker& other = *workers_[victim];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if (!other.tasks.empty()) {
+            task = std::move(other.tasks.front());
+            other.tasks.pop_front();
+            queued_.fetch_sub(1, std::memory_order_relaxed);
+            if (self < count) {
+                workers_[self]->steals.fetch_add(1, std::memory_order_relaxed);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::execute(std::size_t self, Task& task) {
+    if (self == workers_.size()) {
+        task();   // thread de fora ajudando: nao entra na instrumentaçao
+        return;
+    }
+    Worker& worker = *workers_[self];
+    // Contada antes de executar: quem recebe o resultado já a vê nos contadores
+    worker.executed.fetch_add(1, std::memory_order_relaxed);
+    if (currentWorker.depth > 0) {
+        task();   // aninhada: o tempo já conta na tarefa externa
+        return;
+    }
+    // Tempo ocupado = duraçao da tarefa externa menos o tempo parado esperando grupos
+    ++currentWorker.depth;
+    currentWorker.blockedNs = 0;
+    auto start = Clock::now();
+    try {
+        task();
+    } catch (...) {
+        --currentWorker.depth;
+        throw;
+    }
+    --currentWorker.depth;
+    auto elapsed = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    worker.busyNs.fetch_add(elapsed - std::min(elapsed, currentWorker.blockedNs), std::memory_order_relaxed);
+}
+
+bool ThreadPool::runPending() {
+    const std::size_t self = currentIndex();
+    Task task;
+    if (!take(self, task)) {
+        return false;
+    }
+    execute(self, task);
+    return true;
+}
+
+/**
+ * @brief Laço de cada thread: executa tarefas até o pool ser encerrado
+ * @details As tarefas vêm de submit() (packaged_task) ou de TaskGroup::run()
+ *          (que captura as exceções): nenhuma exceçao escapa daqui.
+ */
+void ThreadPool::run(std::size_t index) {
+    currentWorker = CurrentWorker{this, index};
+    for (;;) {
+        Task task;
+        if (take(index, task)) {
+            execute(index, task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        ready_.wait(lock, [this] { return stopping_ || queued_.load(std::memory_order_acquire) > 0; });
+        if (stopping_ && queued_.load(std::memory_order_acquire) == 0) {
+            return;   // nada mais a executar
+        }
+    }
+}
+
+std::vector<ThreadPool::WorkerStats> ThreadPool::stats() const {
+    const auto lifetime = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - started_);
+    std::vector<WorkerStats> result;
+    result.reserve(workers_.size());
+    for (const auto& worker : workers_) {
+        WorkerStats stats;
+        stats.executed = worker->executed.load(std::memory_order_relaxed);
+        stats.steals = worker->steals.load(std::memory_order_relaxed);
+        stats.busy = std::chrono::nanoseconds(worker->busyNs.load(std::memory_order_relaxed));
+        if (lifetime.count() > 0) {
+            stats.utilization = std::min(1.0, static_cast<double>(stats.busy.count()) /
+                                                  static_cast<double>(lifetime.count()));
+        }
+        result.push_back(stats);
+    }
+    return result;
+}
+
+// ============================================================================
+// GRUPOS DE TAREFAS
+// ============================================================================
+
+TaskGroup::TaskGroup(ThreadPool& pool) : pool_(pool), state_(std::make_shared<State>()) {}
+
+TaskGroup::~TaskGroup() {
+    join();
+}
+
+void TaskGroup::State::fail(std::exception_ptr e) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) {
+            error = std::move(e);
+        }
+    }
+    cancelled.store(true, std::memory_order_relaxed);
+}
+
+void TaskGroup::State::finish() {
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(mutex);
+        done.notify_all();
+    }
+}
+
+void TaskGroup::join() {
+    auto& state = *state_;
+    while (state.pending.load(std::memory_order_acquire) > 0) {
+        if (pool_.runPending()) {
+            continue;
+        }
+        // Nada para ajudar: as tarefas restantes estao em execuçao. A espera
+        // é curta porque elas podem criar novas tarefas enquanto isso.
+        auto start = std::chrono::steady_clock::now();
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.done.wait_for(lock, std::chrono::milliseconds(1),
+                                [&state] { return state.pending.load(std::memory_order_acquire) == 0; });
+        }
+        currentWorker.blockedNs += static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+    }
+}
+
+void TaskGroup::wait() {
+    join();
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        error = std::exchange(state_->error, nullptr);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace concurrency
+} // namespace kanban
@@ -7,44 +7,145 @@
  */
 
 #include "domain/ActivityLog.h"
+#include "domain/ActivityRollup.h"
+#include "domain/FlowMetrics.h"
 #include <algorithm>
+#include <iterator>
+#include <stdexcept>
 
 namespace kanban {
 namespace domain {
 
+/**
+ * @brief Nome estável do tipo de atividade
+ * @param kind Tipo a ser convertido
+ * @return String estática com o nome do tipo
+ */
+const char* toString(ActivityKind kind) noexcept {
+    switch (kind) {
+        case ActivityKind::Note:            return "note";
+        case ActivityKind::CardMoved:       return "card_moved";
+        case ActivityKind::CardReordered:   return "card_reordered";
+        case ActivityKind::CardTagsUpdated: return "card_tags_updated";
+    }
+    return "unknown";
+}
+
 // ============================================================================
 // IMPLEMENTAÇaO DA CLASSE Activity
 // ============================================================================
 
 /**
  * @brief Construtor da classe Activity
- * @param id Identificador único da atividade
- * @param description Descriçao textual da açao realizada
- * @param when Timestamp do momento em que a atividade ocorreu
- * @details Inicializa uma nova atividade com todos os atributos necessários
- *          para rastreamento completo das ações do sistema.
+ * @details Inicializa um registro tipado. O ID (sequência) permanece 0 até
+ *          que a atividade seja inserida em um ActivityLog.
+ */
+Activity::Activity(ActivityKind kind,
+                   ActivityHandle subject,
+                   ActivityHandle fromColumn,
+                   ActivityHandle toColumn,
+                   std::uint32_t index,
+                   HybridTimestamp when) noexcept
+    : when_(when),
+      subject_(subject),
+      fromColumn_(fromColumn),
+      toColumn_(toColumn),
+      index_(index),
+      kind_(kind) {}
+
+/**
+ * @brief Cria o registro de um card movido entre colunas
+ */
+Activity Activity::cardMoved(ActivityHandle card, ActivityHandle fromColumn,
+                             ActivityHandle toColumn, std::uint32_t index,
+                             HybridTimestamp when) noexcept {
+    return Activity(ActivityKind::CardMoved, card, fromColumn, toColumn, index, when);
+}
+
+/**
+ * @brief Cria o registro de um card reordenado dentro da coluna
+ */
+Activity Activity::cardReordered(ActivityHandle card, ActivityHandle column,
+                                 std::uint32_t index, HybridTimestamp when) noexcept {
+    return Activity(ActivityKind::CardReordered, card, column, column, index, when);
+}
+
+/**
+ * @brief Cria o registro de atualizaçao das tags de um card
+ */
+Activity Activity::cardTagsUpdated(ActivityHandle card, ActivityHandle column,
+                                   HybridTimestamp when) noexcept {
+    return Activity(ActivityKind::CardTagsUpdated, card, column, column, 0, when);
+}
+
+/**
+ * @brief Cria uma nota em texto livre
+ */
+Activity Activity::note(ActivityHandle text, HybridTimestamp when) noexcept {
+    return Activity(ActivityKind::Note, text, kNoActivityHandle, kNoActivityHandle, 0, when);
+}
+
+/**
+ * @brief Reconstrói uma atividade com número de sequência já conhecido
+ * @details Usado pela camada de persistência ao decodificar segmentos.
  */
-Activity::Activity(const std::string& id, const std::string& description, TimePoint when) noexcept
-    : id_(id), description_(description), when_(when) {}
+Activity Activity::restore(std::uint64_t id, ActivityKind kind,
+                           ActivityHandle subject, ActivityHandle fromColumn,
+                           ActivityHandle toColumn, std::uint32_t index,
+                           HybridTimestamp when) noexcept {
+    Activity act(kind, subject, fromColumn, toColumn, index, when);
+    act.id_ = id;
+    return act;
+}
 
 /**
  * @brief Retorna o ID único da atividade
- * @return String contendo o identificador único da atividade
- * @details Cada atividade possui um ID único que permite sua identificaçao
- *          específica no log de atividades.
+ * @return Número de sequência atribuído pelo ActivityLog
+ */
+std::uint64_t Activity::id() const noexcept {
+    return id_;
+}
+
+/**
+ * @brief Retorna o tipo da atividade
+ */
+ActivityKind Activity::kind() const noexcept {
+    return kind_;
+}
+
+/**
+ * @brief Retorna o handle do card (ou do texto livre)
+ */
+ActivityHandle Activity::subject() const noexcept {
+    return subject_;
+}
+
+/**
+ * @brief Retorna o handle da coluna de origem
+ */
+ActivityHandle Activity::fromColumn() const noexcept {
+    return fromColumn_;
+}
+
+/**
+ * @brief Retorna o handle da coluna de destino
+ */
+ActivityHandle Activity::toColumn() const noexcept {
+    return toColumn_;
+}
+
+/**
+ * @brief Retorna a posiçao resultante do card
  */
-const std::string& Activity::id() const noexcept { 
-    return id_; 
+std::uint32_t Activity::index() const noexcept {
+    return index_;
 }
 
 /**
- * @brief Retorna a descriçao da atividade
- * @return String contendo a descriçao textual da açao realizada
- * @details A descriçao explica em linguagem natural qual açao foi
- *          executada no sistema (ex: "Card movido de To Do para Doing").
+ * @brief Retorna o timestamp HLC da atividade
  */
-const std::string& Activity::description() const noexcept { 
-    return description_; 
+HybridTimestamp Activity::timestamp() const noexcept {
+    return when_;
 }
 
 /**
@@ -53,8 +154,8 @@ const std::string& Activity::description() const noexcept {
  * @details O timestamp é capturado no momento da criaçao da atividade
  *          e permite ordenaçao cronológica precisa.
  */
-TimePoint Activity::when() const noexcept { 
-    return when_; 
+TimePoint Activity::when() const noexcept {
+    return when_.toTimePoint();
 }
 
 /**
@@ -62,14 +163,17 @@ TimePoint Activity::when() const noexcept {
  * @param os Stream de saída onde a atividade será formatada
  * @param a Referência para a atividade a ser formatada
  * @return Referência para a stream de saída
- * @details Formata a atividade em um formato legível incluindo ID,
- *          descriçao e timestamp formatado como string de data/hora.
+ * @details Formata os campos brutos da atividade; para texto legível
+ *          utilize ActivityLog::describe().
  */
 std::ostream& operator<<(std::ostream& os, const Activity& a) {
-    auto time_t = std::chrono::system_clock::to_time_t(a.when());
-    os << "Activity{id=" << a.id() 
-       << ", description=\"" << a.description() << "\""
-       << ", when=" << std::ctime(&time_t) << "}";
+    os << "Activity{id=" << a.id()
+       << ", kind=" << toString(a.kind())
+       << ", subject=" << a.subject()
+       << ", from=" << a.fromColumn()
+       << ", to=" << a.toColumn()
+       << ", index=" << a.index()
+       << ", when=" << a.timestamp() << "}";
     return os;
 }
 
@@ -77,24 +181,883 @@ std::ostream& operator<<(std::ostream& os, const Activity& a) {
 // IMPLEMENTAÇaO DA CLASSE ActivityLog
 // ============================================================================
 
+/**
+ * @brief Construtor do ActivityLog
+ * @details Inicializa um log vazio com rollups e métricas de fluxo vazios.
+ */
+ActivityLog::ActivityLog()
+    : rollup_(std::make_unique<ActivityRollup>()),
+      flow_(std::make_unique<FlowMetrics>()) {}
+
+/**
+ * @brief Destrutor do ActivityLog
+ * @details As pendentes sao publicadas (e portanto entregues ao sink) e o
+ *          sink e a thread de descarga sao encerrados explicitamente
+ *          enquanto o dicionário ainda existe; a thread grava os lotes
+ *          restantes antes de sair. Erros de gravaçao nesse momento nao
+ *          podem mais ser reportados.
+ */
+ActivityLog::~ActivityLog() {
+    if (sink_) {
+        try {
+            publish();
+            sink_->close();
+        } catch (...) {
+            // Destrutores nao devem propagar exceções
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(spillMutex_);
+        spillStopping_ = true;
+    }
+    spillWake_.notify_one();
+    if (spillWriter_.joinable()) {
+        spillWriter_.join();
+    }
+}
+
 /**
  * @brief Adiciona uma nova atividade ao log
  * @param act Atividade a ser adicionada ao histórico
- * @details A atividade é movida para o vetor interno usando move semantics
- *          para melhor performance. Mantém a ordem cronológica de inserçao.
+ * @details Caminho lock-free: a atividade é apenas enfileirada. Quando a
+ *          fila acumula kPublishBatch atividades, o produtor tenta publicar
+ *          o lote (sem esperar, caso outra thread já esteja publicando). Com
+ *          a fila cheia, o produtor publica antes de tentar novamente, o que
+ *          limita a memória pendente.
  */
 void ActivityLog::add(Activity act) {
-    activities_.push_back(std::move(act));
+    // tryPush só move a atividade quando consegue uma célula
+    while (!pending_.tryPush(std::move(act))) {
+        publish();
+    }
+    if (pending_.sizeApprox() >= kPublishBatch) {
+        std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+        if (lock.owns_lock()) {
+            publishLocked();
+        }
+    }
+}
+
+/**
+ * @brief Registra um grupo contíguo de atividades
+ * @details O grupo vai direto para backlog_ depois das pendentes; como
+ *          publishLocked() só reordena o backlog quando a fila trouxe novas
+ *          atividades, a ordem do grupo é preservada.
+ */
+void ActivityLog::addGroup(std::vector<Activity> group) {
+    if (group.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    publishLocked();
+    backlog_.insert(backlog_.end(),
+                    std::make_move_iterator(group.begin()),
+                    std::make_move_iterator(group.end()));
+    std::size_t published = 0;
+    try {
+        for (; published < backlog_.size(); ++published) {
+            insertLocked(backlog_[published]);
+        }
+    } catch (...) {
+        backlog_.erase(backlog_.begin(), backlog_.begin() + static_cast<std::ptrdiff_t>(published));
+        throw;
+    }
+    backlog_.clear();
+}
+
+/**
+ * @brief Publica as atividades pendentes
+ * @return Quantidade de atividades publicadas
+ */
+std::size_t ActivityLog::publish() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return publishLocked();
+}
+
+/**
+ * @brief Drena a fila e insere as atividades no anel em ordem cronológica
+ * @details As atividades sao primeiro movidas para backlog_; se a inserçao
+ *          de alguma falhar (archive indisponível), as restantes continuam
+ *          em backlog_ e serao publicadas na próxima chamada.
+ */
+std::size_t ActivityLog::publishLocked() {
+    const std::size_t already = backlog_.size();
+    Activity act = Activity::note(kNoActivityHandle, HybridTimestamp());
+    while (pending_.tryPop(act)) {
+        backlog_.push_back(act);
+    }
+    if (backlog_.empty()) {
+        return 0;
+    }
+    if (backlog_.size() > already) {
+        std::stable_sort(backlog_.begin(), backlog_.end(),
+                         [](const Activity& a, const Activity& b) {
+                             return a.timestamp() < b.timestamp();
+                         });
+    }
+
+    std::size_t published = 0;
+    try {
+        for (; published < backlog_.size(); ++published) {
+            insertLocked(backlog_[published]);
+        }
+    } catch (...) {
+        backlog_.erase(backlog_.begin(), backlog_.begin() + static_cast<std::ptrdiff_t>(published));
+        throw;
+    }
+    backlog_.clear();
+    return published;
+}
+
+/**
+ * @brief Adquire o mutex interno e publica as pendentes
+ * @return Lock adquirido, mantido pelo chamador durante a leitura
+ * @details As atividades pendentes fazem parte do estado lógico do log,
+ *          por isso publicá-las em um método const é seguro; o const_cast
+ *          é restrito a este ponto.
+ */
+std::unique_lock<std::mutex> ActivityLog::lockForRead() const {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const_cast<ActivityLog*>(this)->publishLocked();
+    return lock;
+}
+
+/**
+ * @brief Adquire archiveMutex_ e depois o mutex interno, publicando as pendentes
+ * @details Com archiveMutex_ a thread de descarga nao move um lote de
+ *          spilling_ para o archive no meio da leitura, entao cada atividade
+ *          é vista exatamente uma vez.
+ */
+ActivityLog::ArchiveReadLock ActivityLog::lockForArchiveRead() const {
+    ArchiveReadLock lock;
+    lock.archive = std::unique_lock<std::mutex>(archiveMutex_);
+    lock.log = lockForRead();
+    return lock;
+}
+
+/**
+ * @brief Insere uma atividade no anel, atribuindo número de sequência
+ * @details Se a capacidade configurada foi atingida, o lote mais antigo é
+ *          descarregado antes da inserçao, de modo que uma falha de gravaçao
+ *          nao perde nenhuma atividade. O sink recebe a atividade só aqui,
+ *          com número de sequência e timestamp definitivos, na ordem HLC.
+ */
+void ActivityLog::insertLocked(Activity act) {
+    if (!(lastPublished_ < act.timestamp())) {
+        act.when_ = clock_.now();
+    }
+
+    const std::size_t capacity = retention_.memoryCapacity;
+    if (capacity != 0 && count_ == capacity) {
+        spillOldest(std::min(std::max<std::size_t>(retention_.spillBatch, 1), count_));
+    }
+
+    act.id_ = nextId_++;
+    lastPublished_ = act.timestamp();
+    if (act.kind() != ActivityKind::Note) {
+        cardPostings_[act.subject()].push_back(act.id_);
+    }
+    kindPostings_[static_cast<std::size_t>(act.kind())].push_back(act.id_);
+    rollup_->record(act);
+    flow_->record(act);
+    if (sink_) {
+        sink_->submit(act);
+    }
+
+    if (capacity == 0) {
+        ring_.push_back(std::move(act));
+        ++count_;
+        return;
+    }
+    if (ring_.size() < capacity) {
+        // Anel ainda em crescimento: head_ é sempre 0 nesta fase
+        ring_.push_back(std::move(act));
+    } else {
+        ring_[(head_ + count_) % capacity] = std::move(act);
+    }
+    ++count_;
+}
+
+/**
+ * @brief Retira as n atividades mais antigas do anel
+ * @param n Quantidade de atividades a remover do anel
+ * @details Com archive configurado, o lote é copiado para spilling_ e
+ *          gravado pela thread de descarga; este método nunca faz I/O. Sem
+ *          archive, as atividades sao simplesmente descartadas.
+ *          Se a gravaçao de um lote anterior falhou, nada é lançado: o novo
+ *          lote apenas pede outra tentativa à thread (ver spillError()).
+ */
+void ActivityLog::spillOldest(std::size_t n) {
+    if (n == 0) {
+        return;
+    }
+    if (retention_.archive) {
+        SpillBatch batch{retention_.archive, {}};
+        batch.activities.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            batch.activities.push_back(ringAt(i));
+        }
+        {
+            std::lock_guard<std::mutex> lock(spillMutex_);
+            spilling_.push_back(std::move(batch));
+            spillRetry_ = true;
+        }
+        if (!spillWriter_.joinable()) {
+            spillWriter_ = std::thread(&ActivityLog::runSpillWriter, this);
+        }
+        spillWake_.notify_one();
+    }
+    trimPostings(n);
+    head_ = (head_ + n) % ring_.size();
+    count_ -= n;
+}
+
+/**
+ * @brief Retira das listas de postagem os IDs das n atividades mais antigas
+ * @details As listas cobrem apenas o anel, entao a memória delas acompanha a
+ *          capacidade configurada. Só as listas dos cards presentes no lote
+ *          sao visitadas; como os IDs sao crescentes, basta cortar o início.
+ */
+void ActivityLog::trimPostings(std::size_t n) {
+    const std::uint64_t firstKept = ringAt(n - 1).id() + 1;
+    auto trim = [firstKept](std::vector<std::uint64_t>& ids) {
+        ids.erase(ids.begin(), std::lower_bound(ids.begin(), ids.end(), firstKept));
+    };
+
+    std::vector<ActivityHandle> subjects;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (ringAt(i).kind() != ActivityKind::Note) {
+            subjects.push_back(ringAt(i).subject());
+        }
+    }
+    std::sort(subjects.begin(), subjects.end());
+    subjects.erase(std::unique(subjects.begin(), subjects.end()), subjects.end());
+    for (ActivityHandle subject : subjects) {
+        auto it = cardPostings_.find(subject);
+        if (it == cardPostings_.end()) {
+            continue;
+        }
+        trim(it->second);
+        if (it->second.empty()) {
+            cardPostings_.erase(it);
+        }
+    }
+    for (auto& postings : kindPostings_) {
+        trim(postings);
+    }
+}
+
+/**
+ * @brief Laço da thread de descarga
+ * @details Grava o lote mais antigo de spilling_ sem nenhum lock: o I/O
+ *          (compressao e arquivo) nunca bloqueia os leitores. Só a
+ *          publicaçao no índice do archive e a retirada da fila acontecem
+ *          juntas sob archiveMutex_, de modo que leitores sempre encontram o
+ *          lote em exatamente um dos dois lugares. O lote da frente só é
+ *          retirado por esta thread ou por clear(); spillGeneration_ detecta
+ *          o segundo caso e a gravaçao é descartada. Após uma falha, a thread espera até
+ *          que uma nova tentativa seja pedida (spillOldest() ou
+ *          flushArchive()). No encerramento, grava o que restar, exceto após
+ *          uma falha.
+ */
+void ActivityLog::runSpillWriter() {
+    SpillBatch batch;
+    std::uint64_t generation = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(spillMutex_);
+            spillWake_.wait(lock, [this] {
+                return spillStopping_ || (!spilling_.empty() && (spillError_.empty() || spillRetry_));
+            });
+            if (spilling_.empty() || (!spillError_.empty() && !spillRetry_)) {
+                return;
+            }
+            spillRetry_ = false;
+            // Cópia: clear() pode descartar o lote durante a gravaçao
+            batch = spilling_.front();
+            generation = spillGeneration_;
+        }
+
+        std::unique_ptr<interfaces::IActivityArchive::PendingAppend> written;
+        std::string error;
+        try {
+            written = batch.archive->write(batch.activities, *this);
+        } catch (const std::exception& e) {
+            error = e.what();
+        }
+
+        std::lock_guard<std::mutex> archiveLock(archiveMutex_);
+        {
+            std::lock_guard<std::mutex> lock(spillMutex_);
+            if (generation != spillGeneration_) {
+                continue;   // clear() descartou os lotes; written remove o segmento
+            }
+            if (error.empty()) {
+                try {
+                    batch.archive->publish(std::move(written));
+                } catch (const std::exception& e) {
+                    error = e.what();
+                }
+            }
+            if (error.empty()) {
+                spilling_.pop_front();
+                spillError_.clear();
+            } else {
+                spillError_ = std::move(error);
+            }
+        }
+        spillDrained_.notify_all();
+    }
+}
+
+/**
+ * @brief Aguarda a thread de descarga gravar todos os lotes entregues
+ */
+void ActivityLog::flushArchive() {
+    publish();
+    std::unique_lock<std::mutex> lock(spillMutex_);
+    if (!spillError_.empty()) {
+        spillRetry_ = true;
+        spillWake_.notify_one();
+    }
+    spillDrained_.wait(lock, [this] {
+        return spilling_.empty() || (!spillError_.empty() && !spillRetry_);
+    });
+    if (!spilling_.empty()) {
+        throw std::runtime_error(spillError_);
+    }
+}
+
+/**
+ * @brief Erro da última gravaçao no archive, se ela falhou
+ */
+std::optional<std::string> ActivityLog::spillError() const {
+    std::lock_guard<std::mutex> lock(spillMutex_);
+    if (spillError_.empty()) {
+        return std::nullopt;
+    }
+    return spillError_;
+}
+
+/**
+ * @brief Percorre os lotes ainda em gravaçao com timestamp em [from, to]
+ * @details Chamado com os locks de lockForArchiveRead(): nenhum lote é
+ *          acrescentado ou retirado durante a leitura.
+ */
+void ActivityLog::visitSpilling(HybridTimestamp from, HybridTimestamp to, const Visitor& visit) const {
+    for (const auto& batch : spilling_) {
+        if (batch.activities.back().timestamp() < from) {
+            continue;
+        }
+        for (const auto& act : batch.activities) {
+            if (act.timestamp() > to) {
+                return;
+            }
+            if (act.timestamp() >= from) {
+                visit(act);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Retorna a i-ésima atividade em memória (0 = mais antiga)
+ */
+const Activity& ActivityLog::ringAt(std::size_t i) const noexcept {
+    return ring_[(head_ + i) % ring_.size()];
+}
+
+/**
+ * @brief Reorganiza o anel para que a atividade mais antiga fique no índice 0
+ */
+void ActivityLog::linearize() {
+    if (head_ == 0 && ring_.size() == count_) {
+        return;
+    }
+    std::vector<Activity> ordered;
+    ordered.reserve(count_);
+    for (std::size_t i = 0; i < count_; ++i) {
+        ordered.push_back(ringAt(i));
+    }
+    ring_ = std::move(ordered);
+    head_ = 0;
+}
+
+/**
+ * @brief Configura a política de retençao
+ * @param retention Nova política
+ * @details O anel é linearizado e o excedente em relaçao à nova capacidade
+ *          é descarregado imediatamente.
+ */
+void ActivityLog::setRetention(const ActivityRetention& retention) {
+    auto lock = lockForRead();
+    linearize();
+    retention_ = retention;
+    const std::size_t capacity = retention_.memoryCapacity;
+    if (capacity != 0 && count_ > capacity) {
+        spillOldest(count_ - capacity);
+        linearize();
+    }
+    if (capacity != 0) {
+        ring_.reserve(capacity);
+    }
+}
+
+/**
+ * @brief Retorna a política de retençao atual
+ */
+const ActivityRetention& ActivityLog::retention() const noexcept {
+    return retention_;
+}
+
+// ============================================================================
+// AGREGADOS (ROLLUPS)
+// ============================================================================
+
+/**
+ * @brief Série agregada de um tipo de atividade
+ * @details Uma coluna nunca vista pelo log resulta em série vazia.
+ */
+std::vector<RollupPoint> ActivityLog::rollup(ActivityKind kind,
+                                             const std::string& columnId,
+                                             RollupGranularity granularity,
+                                             TimePoint from,
+                                             TimePoint to) const {
+    ActivityHandle column = kNoActivityHandle;
+    if (!columnId.empty()) {
+        column = find(columnId);
+        if (column == kNoActivityHandle) {
+            return {};
+        }
+    }
+    auto lock = lockForRead();
+    return rollup_->series(kind, column, granularity, from, to);
+}
+
+/**
+ * @brief Grava os rollups em um stream
+ */
+void ActivityLog::saveRollups(std::ostream& os) const {
+    auto lock = lockForRead();
+    rollup_->save(os, *this);
+}
+
+/**
+ * @brief Carrega (somando) rollups de um stream
+ */
+void ActivityLog::loadRollups(std::istream& is) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rollup_->load(is, *this);
+}
+
+// ============================================================================
+// MÉTRICAS DE FLUXO
+// ============================================================================
+
+/**
+ * @brief Registra a criaçao de um card
+ * @details As pendentes sao publicadas antes, para que o registro nunca
+ *          fique à frente de uma movimentaçao já enfileirada.
+ */
+void ActivityLog::registerCard(const std::string& cardId, const std::string& columnId, TimePoint createdAt) {
+    ActivityHandle card = intern(cardId);
+    ActivityHandle column = intern(columnId);
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(createdAt.time_since_epoch()).count();
+    auto lock = lockForRead();
+    flow_->registerCard(card, column, static_cast<std::uint64_t>(std::max<std::int64_t>(ms, 0)));
+}
+
+/**
+ * @brief Distribuições de fluxo de uma coluna
+ */
+ColumnFlow ActivityLog::columnFlow(const std::string& columnId) const {
+    ActivityHandle column = find(columnId);
+    if (column == kNoActivityHandle) {
+        return ColumnFlow{};
+    }
+    auto lock = lockForRead();
+    return flow_->column(column);
+}
+
+/**
+ * @brief Histórico de fluxo de um card
+ */
+std::optional<CardFlow> ActivityLog::cardFlow(const std::string& cardId) const {
+    ActivityHandle card = find(cardId);
+    if (card == kNoActivityHandle) {
+        return std::nullopt;
+    }
+    auto lock = lockForRead();
+    return flow_->card(card, *this);
+}
+
+/**
+ * @brief Criações de cards registradas a partir de um instante
+ */
+std::vector<std::pair<std::uint64_t, ActivityHandle>> ActivityLog::creationsSince(TimePoint from) const {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(from.time_since_epoch()).count();
+    auto lock = lockForRead();
+    return flow_->creationsSince(static_cast<std::uint64_t>(std::max<std::int64_t>(ms, 0)));
+}
+
+/**
+ * @brief Configura a trilha de auditoria
+ * @param sink Destino das atividades, ou nullptr
+ */
+void ActivityLog::setSink(std::shared_ptr<interfaces::IActivitySink> sink) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sink_ = std::move(sink);
+}
+
+/**
+ * @brief Retorna a trilha de auditoria configurada
+ */
+std::shared_ptr<interfaces::IActivitySink> ActivityLog::sink() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sink_;
+}
+
+/**
+ * @brief Número de atividades atualmente em memória
+ */
+std::size_t ActivityLog::inMemorySize() const {
+    auto lock = lockForRead();
+    return count_;
+}
+
+/**
+ * @brief Registra uma nota em texto livre
+ * @param text Texto da nota
+ */
+void ActivityLog::note(const std::string& text) {
+    add(Activity::note(intern(text), now()));
 }
 
 /**
  * @brief Retorna todas as atividades do log
- * @return Referência constante para o vetor contendo todas as atividades
+ * @return Vetor com as atividades arquivadas seguidas das em memória
  * @details O vetor retornado está na ordem de inserçao (cronológica).
  *          Nao modifica o estado interno do ActivityLog.
  */
-const std::vector<Activity>& ActivityLog::activities() const noexcept {
-    return activities_;
+std::vector<Activity> ActivityLog::activities() const {
+    std::vector<Activity> result;
+    forEach([&result](const Activity& act) { result.push_back(act); });
+    return result;
+}
+
+/**
+ * @brief Percorre todas as atividades em ordem cronológica
+ * @param visit Funçao chamada para cada atividade
+ */
+void ActivityLog::forEach(const Visitor& visit) const {
+    auto lock = lockForArchiveRead();
+    const HybridTimestamp from(0);
+    const HybridTimestamp to(std::numeric_limits<std::uint64_t>::max());
+    if (retention_.archive) {
+        retention_.archive->scan(from, to, *this, visit);
+    }
+    visitSpilling(from, to, visit);
+    for (std::size_t i = 0; i < count_; ++i) {
+        visit(ringAt(i));
+    }
+}
+
+/**
+ * @brief Percorre as atividades com timestamp em [from, to]
+ * @details O anel está em ordem cronológica, entao a primeira atividade do
+ *          intervalo é localizada por busca binária.
+ */
+void ActivityLog::forEachInRange(HybridTimestamp from, HybridTimestamp to, const Visitor& visit) const {
+    if (to < from) {
+        return;
+    }
+    auto lock = lockForArchiveRead();
+    if (retention_.archive) {
+        retention_.archive->scan(from, to, *this, visit);
+    }
+    visitSpilling(from, to, visit);
+    for (std::size_t i = ringLowerBound(from); i < count_ && ringAt(i).timestamp() <= to; ++i) {
+        visit(ringAt(i));
+    }
+}
+
+/**
+ * @brief Posiçao no anel da primeira atividade com timestamp >= from
+ */
+std::size_t ActivityLog::ringLowerBound(HybridTimestamp from) const noexcept {
+    std::size_t lo = 0;
+    std::size_t hi = count_;
+    while (lo < hi) {
+        std::size_t mid = lo + (hi - lo) / 2;
+        if (ringAt(mid).timestamp() < from) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// ============================================================================
+// CONSULTAS INDEXADAS
+// ============================================================================
+
+/**
+ * @brief Materializa as atividades referenciadas por uma lista de postagem
+ * @param ids Lista de postagem (IDs crescentes)
+ * @param begin Primeira posiçao da lista a materializar
+ * @details Os IDs no anel e em cada lote em gravaçao sao contíguos, entao
+ *          cada atividade em memória é acessada em O(1) a partir do ID. IDs
+ *          anteriores sao lidos do archive em uma única chamada; sem archive,
+ *          foram descartados. Exige os locks de lockForArchiveRead().
+ */
+std::vector<Activity> ActivityLog::collect(const std::vector<std::uint64_t>& ids, std::size_t begin) const {
+    std::vector<Activity> result;
+    if (begin >= ids.size()) {
+        return result;
+    }
+    result.reserve(ids.size() - begin);
+
+    const std::uint64_t firstInMemory = count_ > 0 ? ringAt(0).id() : nextId_;
+    const std::uint64_t firstSpilling = spilling_.empty() ? firstInMemory : spilling_.front().activities.front().id();
+    const auto first = ids.begin() + static_cast<std::ptrdiff_t>(begin);
+    auto spilled = std::lower_bound(first, ids.end(), firstSpilling);
+    auto split = std::lower_bound(spilled, ids.end(), firstInMemory);
+
+    if (retention_.archive && spilled != first) {
+        std::vector<std::uint64_t> archived(first, spilled);
+        retention_.archive->fetch(archived, *this,
+                                  [&result](const Activity& act) { result.push_back(act); });
+    }
+    auto batch = spilling_.begin();
+    for (auto it = spilled; it != split; ++it) {
+        while (*it > batch->activities.back().id()) {
+            ++batch;
+        }
+        result.push_back(batch->activities[static_cast<std::size_t>(*it - batch->activities.front().id())]);
+    }
+    for (auto it = split; it != ids.end(); ++it) {
+        result.push_back(ringAt(static_cast<std::size_t>(*it - firstInMemory)));
+    }
+    return result;
+}
+
+/**
+ * @brief Histórico de um card a partir da sua lista de postagem
+ * @param cardId ID do card
+ * @param limit Quantidade máxima de atividades (0 = todas), mantendo as mais recentes
+ */
+std::vector<Activity> ActivityLog::forCard(const std::string& cardId, std::size_t limit) const {
+    static const std::vector<std::uint64_t> none;
+    ActivityHandle handle = find(cardId);
+    if (handle == kNoActivityHandle) {
+        return {};
+    }
+    auto lock = lockForArchiveRead();
+    auto it = cardPostings_.find(handle);
+    return lastMatching(
+        it == cardPostings_.end() ? none : it->second, limit,
+        [handle](const Activity& act) { return act.kind() != ActivityKind::Note && act.subject() == handle; },
+        [this, handle](std::size_t want, const Visitor& visit) {
+            retention_.archive->lastForSubject(handle, want, *this, visit);
+        });
+}
+
+/**
+ * @brief Junta o anel, os lotes em gravaçao e a camada arquivada
+ * @details Cada camada só é consultada se as mais recentes nao bastaram
+ *          para atingir limit. Exige os locks de lockForArchiveRead().
+ */
+std::vector<Activity> ActivityLog::lastMatching(const std::vector<std::uint64_t>& ids, std::size_t limit,
+                                                const std::function<bool(const Activity&)>& match,
+                                                const ArchivedQuery& archived) const {
+    std::vector<Activity> inRing = collect(ids, (limit > 0 && ids.size() > limit) ? ids.size() - limit : 0);
+    if (limit > 0 && inRing.size() == limit) {
+        return inRing;
+    }
+
+    // Lotes em gravaçao, do mais recente para o mais antigo
+    const std::size_t want = limit > 0 ? limit - inRing.size() : 0;
+    std::vector<Activity> spilled;
+    for (auto batch = spilling_.rbegin(); batch != spilling_.rend() && (want == 0 || spilled.size() < want); ++batch) {
+        for (auto act = batch->activities.rbegin(); act != batch->activities.rend(); ++act) {
+            if (match(*act)) {
+                spilled.push_back(*act);
+                if (want > 0 && spilled.size() == want) {
+                    break;
+                }
+            }
+        }
+    }
+
+    std::vector<Activity> result;
+    if (retention_.archive && (want == 0 || spilled.size() < want)) {
+        archived(want > 0 ? want - spilled.size() : 0,
+                 [&result](const Activity& act) { result.push_back(act); });
+    }
+    result.insert(result.end(), spilled.rbegin(), spilled.rend());
+    result.insert(result.end(), inRing.begin(), inRing.end());
+    return result;
+}
+
+/**
+ * @brief Atividades com timestamp HLC em [from, to]
+ */
+std::vector<Activity> ActivityLog::between(HybridTimestamp from, HybridTimestamp to) const {
+    std::vector<Activity> result;
+    if (to < from) {
+        return result;
+    }
+    auto lock = lockForArchiveRead();
+    auto append = [&result](const Activity& act) { result.push_back(act); };
+    if (retention_.archive) {
+        retention_.archive->scan(from, to, *this, append);
+    }
+    visitSpilling(from, to, append);
+    // Trecho em memória: limites por busca binária e cópia sem visitante
+    std::size_t first = ringLowerBound(from);
+    std::size_t last = to.packed() == std::numeric_limits<std::uint64_t>::max()
+                           ? count_
+                           : ringLowerBound(HybridTimestamp(to.packed() + 1));
+    result.reserve(result.size() + (last - first));
+    for (std::size_t i = first; i < last; ++i) {
+        result.push_back(ringAt(i));
+    }
+    return result;
+}
+
+/**
+ * @brief Atividades ocorridas entre dois instantes
+ * @details O limite superior inclui todos os contadores lógicos do
+ *          milissegundo de to.
+ */
+std::vector<Activity> ActivityLog::between(TimePoint from, TimePoint to) const {
+    constexpr std::uint64_t logicalMask = (std::uint64_t{1} << HybridTimestamp::kLogicalBits) - 1;
+    return between(HybridTimestamp::fromTimePoint(from),
+                   HybridTimestamp(HybridTimestamp::fromTimePoint(to).packed() | logicalMask));
+}
+
+/**
+ * @brief As n atividades mais recentes de um tipo
+ */
+std::vector<Activity> ActivityLog::lastOfKind(ActivityKind kind, std::size_t n) const {
+    if (n == 0) {
+        return {};
+    }
+    auto lock = lockForArchiveRead();
+    return lastMatching(
+        kindPostings_[static_cast<std::size_t>(kind)], n,
+        [kind](const Activity& act) { return act.kind() == kind; },
+        [this, kind](std::size_t want, const Visitor& visit) {
+            retention_.archive->lastOfKind(kind, want, *this, visit);
+        });
+}
+
+/**
+ * @brief As n atividades mais recentes do log
+ * @details Quando todas estao em memória, nenhuma leitura de disco é feita.
+ */
+std::vector<Activity> ActivityLog::recent(std::size_t n) const {
+    auto lock = lockForArchiveRead();
+    const std::uint64_t total = nextId_ - 1;
+    const std::uint64_t first = total > n ? total - n + 1 : 1;
+    std::vector<std::uint64_t> ids;
+    ids.reserve(static_cast<std::size_t>(total - first + 1));
+    for (std::uint64_t id = first; id <= total; ++id) {
+        ids.push_back(id);
+    }
+    return collect(ids, 0);
+}
+
+/**
+ * @brief Interna uma string no dicionário do log
+ * @param key String a ser internada
+ * @return Handle existente, ou um novo handle se a string ainda nao foi vista
+ * @details As strings ficam em um std::deque para que os string_view usados
+ *          como chave do índice permaneçam válidos. O caso comum (string já
+ *          internada) usa apenas o lock compartilhado.
+ */
+ActivityHandle ActivityLog::intern(const std::string& key) {
+    {
+        std::shared_lock<std::shared_mutex> lock(namesMutex_);
+        auto it = handles_.find(std::string_view(key));
+        if (it != handles_.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(namesMutex_);
+    auto it = handles_.find(std::string_view(key));
+    if (it != handles_.end()) {
+        return it->second;
+    }
+    auto handle = static_cast<ActivityHandle>(names_.size());
+    names_.push_back(key);
+    handles_.emplace(std::string_view(names_.back()), handle);
+    return handle;
+}
+
+/**
+ * @brief Resolve um handle para a string internada
+ * @param handle Handle a ser resolvido
+ * @return String internada, ou string vazia se o handle for inválido
+ */
+const std::string& ActivityLog::resolve(ActivityHandle handle) const {
+    static const std::string empty;
+    std::shared_lock<std::shared_mutex> lock(namesMutex_);
+    if (handle == kNoActivityHandle || handle >= names_.size()) {
+        return empty;
+    }
+    return names_[handle];
+}
+
+/**
+ * @brief Procura o handle de uma string sem interná-la
+ * @param key String procurada
+ * @return Handle existente, ou kNoActivityHandle
+ */
+ActivityHandle ActivityLog::find(const std::string& key) const {
+    std::shared_lock<std::shared_mutex> lock(namesMutex_);
+    auto it = handles_.find(std::string_view(key));
+    return it != handles_.end() ? it->second : kNoActivityHandle;
+}
+
+/**
+ * @brief Gera um novo timestamp HLC
+ */
+HybridTimestamp ActivityLog::now() noexcept {
+    return clock_.now();
+}
+
+/**
+ * @brief Renderiza a descriçao textual de uma atividade
+ * @details Este é o único ponto em que o texto em português é montado;
+ *          as mutações apenas registram o evento tipado.
+ */
+std::string ActivityLog::describe(const Activity& act,
+                                  const NameLookup& cardTitle,
+                                  const NameLookup& columnName) const {
+    auto card = [&]() {
+        const std::string& id = resolve(act.subject());
+        return cardTitle ? cardTitle(id) : id;
+    };
+    auto column = [&](ActivityHandle handle) {
+        const std::string& id = resolve(handle);
+        return columnName ? columnName(id) : id;
+    };
+
+    switch (act.kind()) {
+        case ActivityKind::Note:
+            return resolve(act.subject());
+        case ActivityKind::CardMoved:
+            return "Card '" + card() + "' movido de '" + column(act.fromColumn()) +
+                   "' para '" + column(act.toColumn()) + "'";
+        case ActivityKind::CardReordered:
+            return "Card '" + card() + "' reordenado na coluna '" + column(act.toColumn()) +
+                   "' para posição " + std::to_string(act.index() + 1);
+        case ActivityKind::CardTagsUpdated:
+            return "Tags do card '" + card() + "' atualizadas";
+    }
+    return std::string();
 }
 
 /**
@@ -102,8 +1065,13 @@ const std::vector<Activity>& ActivityLog::activities() const noexcept {
  * @return Número de atividades armazenadas no log
  * @details Útil para estatísticas e monitoramento do volume de atividades.
  */
-std::size_t ActivityLog::size() const noexcept {
-    return activities_.size();
+std::size_t ActivityLog::size() const {
+    auto lock = lockForArchiveRead();
+    std::size_t archived = retention_.archive ? retention_.archive->size() : 0;
+    for (const auto& batch : spilling_) {
+        archived += batch.activities.size();
+    }
+    return archived + count_;
 }
 
 /**
@@ -112,31 +1080,61 @@ std::size_t ActivityLog::size() const noexcept {
  * @details Método de conveniência para verificar a existência de atividades
  *          sem precisar verificar o tamanho.
  */
-bool ActivityLog::empty() const noexcept {
-    return activities_.empty();
+bool ActivityLog::empty() const {
+    return size() == 0;
 }
 
 /**
  * @brief Retorna a última atividade adicionada ao log
- * @return Ponteiro para a última atividade, ou nullptr se o log estiver vazio
- * @details Útil para obter a atividade mais recente sem precisar acessar
- *          todo o vetor de atividades.
+ * @return Cópia da última atividade, ou std::nullopt se o log estiver vazio
+ * @details A atividade mais recente está sempre em memória.
  */
-const Activity* ActivityLog::last() const noexcept {
-    if (activities_.empty()) {
-        return nullptr;
+std::optional<Activity> ActivityLog::last() const {
+    auto lock = lockForRead();
+    if (count_ == 0) {
+        return std::nullopt;
     }
-    return &activities_.back();
+    return ringAt(count_ - 1);
 }
 
 /**
  * @brief Limpa todas as atividades do log
- * @details Remove todas as entradas do histórico de atividades.
+ * @details Remove todas as entradas do histórico de atividades, inclusive
+ *          os segmentos arquivados, os lotes ainda nao gravados e as
+ *          atividades ainda nao publicadas.
  *          Operaçao irreversível - use com cuidado.
  */
-void ActivityLog::clear() noexcept {
-    activities_.clear();
+void ActivityLog::clear() {
+    std::lock_guard<std::mutex> archiveLock(archiveMutex_);
+    std::lock_guard<std::mutex> lock(mutex_);
+    {
+        std::lock_guard<std::mutex> spillLock(spillMutex_);
+        spilling_.clear();
+        spillError_.clear();
+        spillRetry_ = false;
+        ++spillGeneration_;
+    }
+    Activity discarded = Activity::note(kNoActivityHandle, HybridTimestamp());
+    while (pending_.tryPop(discarded)) {
+    }
+    backlog_.clear();
+    ring_.clear();
+    head_ = 0;
+    count_ = 0;
+    cardPostings_.clear();
+    for (auto& postings : kindPostings_) {
+        postings.clear();
+    }
+    rollup_->clear();
+    flow_->clear();
+    if (retention_.archive) {
+        try {
+            retention_.archive->clear();
+        } catch (...) {
+            // Falha ao remover arquivos nao deve impedir a limpeza em memória
+        }
+    }
 }
 
 } // namespace domain
-} // namespace kanban
\ No newline at end of file
+} // namespace kanban
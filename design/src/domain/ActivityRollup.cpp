@@ -0,0 +1,197 @@
+/**
+ * @file ActivityRollup.cpp
+ * @brief Implementaçao dos agregados incrementais de atividades
+ * @details Contém a atualizaçao dos buckets, a consulta por intervalo (com
+ *          agregaçao semanal sobre os buckets diários) e a serializaçao em texto.
+ */
+
+#include "domain/ActivityRollup.h"
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+constexpr std::uint64_t kHourMs = 3600ull * 1000ull;
+constexpr std::uint64_t kDayMs = 24ull * kHourMs;
+
+/// @brief 01/01/1970 foi uma quinta-feira: deslocamento para semanas iniciadas na segunda
+constexpr std::uint64_t kEpochWeekdayOffset = 3;
+
+std::uint64_t toMs(TimePoint tp) {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(tp.time_since_epoch()).count();
+    return ms > 0 ? static_cast<std::uint64_t>(ms) : 0u;
+}
+
+TimePoint fromMs(std::uint64_t ms) {
+    return TimePoint(std::chrono::duration_cast<TimePoint::duration>(
+        std::chrono::milliseconds(static_cast<std::int64_t>(ms))));
+}
+
+} // namespace
+
+// ============================================================================
+// ATUALIZAÇaO INCREMENTAL
+// ============================================================================
+
+/**
+ * @brief Contabiliza uma atividade nos buckets do board e das colunas envolvidas
+ */
+void ActivityRollup::record(const Activity& act) {
+    const std::uint64_t ms = act.timestamp().physicalMs();
+    bump(act.kind(), kNoActivityHandle, ms, false);
+    if (act.toColumn() != kNoActivityHandle) {
+        bump(act.kind(), act.toColumn(), ms, false);
+    }
+    if (act.kind() == ActivityKind::CardMoved && act.fromColumn() != kNoActivityHandle) {
+        bump(act.kind(), act.fromColumn(), ms, true);
+    }
+}
+
+/**
+ * @brief Incrementa os contadores horário e diário
+ */
+void ActivityRollup::bump(ActivityKind kind, ActivityHandle column, std::uint64_t ms, bool departure) {
+    const auto k = static_cast<std::uint8_t>(kind);
+    Counts& hour = hourly_[Key(k, column, ms / kHourMs)];
+    Counts& day = daily_[Key(k, column, ms / kDayMs)];
+    if (departure) {
+        ++hour.departures;
+        ++day.departures;
+    } else {
+        ++hour.events;
+        ++day.events;
+    }
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+/**
+ * @brief Série agregada no intervalo [from, to]
+ * @details Semanas somam os buckets diários; o primeiro e o último ponto
+ *          podem cobrir semanas parciais se o intervalo nao estiver alinhado.
+ */
+std::vector<RollupPoint> ActivityRollup::series(ActivityKind kind,
+                                                ActivityHandle column,
+                                                RollupGranularity granularity,
+                                                TimePoint from,
+                                                TimePoint to) const {
+    std::vector<RollupPoint> result;
+    const std::uint64_t beginMs = toMs(from);
+    const std::uint64_t endMs = toMs(to);
+    if (endMs < beginMs) {
+        return result;
+    }
+
+    const bool hourly = granularity == RollupGranularity::Hour;
+    const BucketMap& buckets = hourly ? hourly_ : daily_;
+    const std::uint64_t width = hourly ? kHourMs : kDayMs;
+    const auto k = static_cast<std::uint8_t>(kind);
+
+    auto it = buckets.lower_bound(Key(k, column, beginMs / width));
+    auto end = buckets.upper_bound(Key(k, column, endMs / width));
+    for (; it != end; ++it) {
+        const std::uint64_t bucket = std::get<2>(it->first);
+        std::uint64_t startMs = bucket * width;
+        if (granularity == RollupGranularity::Week) {
+            const std::uint64_t firstDay = (bucket + kEpochWeekdayOffset) / 7 * 7;
+            startMs = firstDay > kEpochWeekdayOffset ? (firstDay - kEpochWeekdayOffset) * kDayMs : 0;
+            if (!result.empty() && toMs(result.back().start) == startMs) {
+                result.back().events += it->second.events;
+                result.back().departures += it->second.departures;
+                continue;
+            }
+        }
+        RollupPoint point;
+        point.start = fromMs(startMs);
+        point.events = it->second.events;
+        point.departures = it->second.departures;
+        result.push_back(point);
+    }
+    return result;
+}
+
+/**
+ * @brief Número de buckets armazenados
+ */
+std::size_t ActivityRollup::bucketCount() const noexcept {
+    return hourly_.size() + daily_.size();
+}
+
+/**
+ * @brief Remove todos os contadores
+ */
+void ActivityRollup::clear() noexcept {
+    hourly_.clear();
+    daily_.clear();
+}
+
+// ============================================================================
+// PERSISTÊNCIA
+// ============================================================================
+
+/**
+ * @brief Grava os buckets no formato "H|D <tipo> <bucket> <eventos> <saídas> <coluna>"
+ * @details A coluna vai por último (resto da linha) e vazia representa o
+ *          agregado do board.
+ */
+void ActivityRollup::save(std::ostream& os, const ActivityLog& dictionary) const {
+    auto dump = [&](char tag, const BucketMap& buckets) {
+        for (const auto& [key, counts] : buckets) {
+            const ActivityHandle column = std::get<1>(key);
+            os << tag << ' ' << static_cast<unsigned>(std::get<0>(key))
+               << ' ' << std::get<2>(key)
+               << ' ' << counts.events
+               << ' ' << counts.departures
+               << ' ' << (column == kNoActivityHandle ? std::string() : dictionary.resolve(column))
+               << '\n';
+        }
+    };
+    os << "KROLLUP 1\n";
+    dump('H', hourly_);
+    dump('D', daily_);
+}
+
+/**
+ * @brief Soma ao rollup os buckets lidos de um stream
+ */
+void ActivityRollup::load(std::istream& is, ActivityLog& dictionary) {
+    std::string line;
+    if (!std::getline(is, line) || line != "KROLLUP 1") {
+        throw std::runtime_error("Rollup de atividades: cabeçalho inválido");
+    }
+    while (std::getline(is, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        std::istringstream fields(line);
+        char tag = 0;
+        unsigned kind = 0;
+        std::uint64_t bucket = 0;
+        Counts counts;
+        if (!(fields >> tag >> kind >> bucket >> counts.events >> counts.departures) ||
+            (tag != 'H' && tag != 'D')) {
+            throw std::runtime_error("Rollup de atividades: linha inválida: " + line);
+        }
+        std::string column;
+        if (fields.peek() == ' ') {
+            fields.get();
+        }
+        std::getline(fields, column);
+        const ActivityHandle handle = column.empty() ? kNoActivityHandle : dictionary.intern(column);
+
+        Counts& target = (tag == 'H' ? hourly_ : daily_)[Key(static_cast<std::uint8_t>(kind), handle, bucket)];
+        target.events += counts.events;
+        target.departures += counts.departures;
+    }
+}
+
+} // namespace domain
+} // namespace kanban
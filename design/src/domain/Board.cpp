@@ -11,6 +11,7 @@
 #include "domain/ActivityLog.h"
 #include "domain/Card.h"
 #include <algorithm>
+#include <limits>
 #include <stdexcept>
 
 namespace kanban {
@@ -167,6 +168,17 @@ bool Board::hasColumn(const Id& columnId) const noexcept {
 void Board::moveCard(const std::string& cardId,
                      const Id& fromColumnId,
                      const Id& toColumnId) {
+    moveCard(cardId, fromColumnId, toColumnId, std::numeric_limits<std::size_t>::max());
+}
+
+/**
+ * @brief Move um card entre duas colunas, inserindo-o em toIndex
+ * @details Um índice além do fim da coluna de destino anexa o card ao final.
+ */
+void Board::moveCard(const std::string& cardId,
+                     const Id& fromColumnId,
+                     const Id& toColumnId,
+                     std::size_t toIndex) {
     // Encontrar a coluna de origem
     auto fromColumnOpt = findColumn(fromColumnId);
     if (!fromColumnOpt) {
@@ -190,18 +202,47 @@ void Board::moveCard(const std::string& cardId,
     
     auto card = *cardOpt;
     
-    // Adicionar o card à coluna de destino
-    toColumn->addCard(card);
+    // Inserir o card na coluna de destino
+    toIndex = std::min(toIndex, toColumn->size());
+    toColumn->insertCardAt(toIndex, card);
     
-    // Registrar a atividade se o ActivityLog estiver configurado
+    // Registrar a atividade se o ActivityLog estiver configurado.
+    // Apenas o evento tipado é gravado; o texto é montado em describe().
     if (activityLog_) {
-        auto now = std::chrono::system_clock::now();
-        std::string description = "Card '" + card->title() + "' movido de '" + 
-                                 fromColumn->name() + "' para '" + toColumn->name() + "'";
-        
-        Activity activity(cardId + "_move", description, now);
-        activityLog_->add(std::move(activity));
+        auto index = static_cast<std::uint32_t>(toIndex);
+        activityLog_->add(Activity::cardMoved(activityLog_->intern(cardId),
+                                              activityLog_->intern(fromColumnId),
+                                              activityLog_->intern(toColumnId),
+                                              index,
+                                              activityLog_->now()));
+    }
+}
+
+/**
+ * @brief Gera a descriçao textual de uma atividade deste board
+ * @param activity Atividade registrada no ActivityLog do board
+ * @return Texto com títulos de cards e nomes de colunas atuais
+ * @details Resolve IDs para títulos/nomes apenas no momento da exibiçao.
+ *          Cards ou colunas que nao existem mais sao exibidos pelo ID.
+ */
+std::string Board::describe(const Activity& activity) const {
+    if (!activityLog_) {
+        return std::string();
     }
+    auto cardTitle = [this](const std::string& cardId) -> std::string {
+        for (const auto& column : columns_) {
+            auto cardOpt = column->findCard(cardId);
+            if (cardOpt) {
+                return (*cardOpt)->title();
+            }
+        }
+        return cardId;
+    };
+    auto columnName = [this](const std::string& columnId) -> std::string {
+        auto columnOpt = findColumn(columnId);
+        return columnOpt ? (*columnOpt)->name() : columnId;
+    };
+    return activityLog_->describe(activity, cardTitle, columnName);
 }
 
 // ============================================================================
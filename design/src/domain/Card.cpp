@@ -88,6 +88,76 @@ Card::Card(const std::string& id, const std::string& title)
     // tags_ é inicializado automaticamente como vector vazio
 }
 
+/**
+ * @brief Construtor de cópia
+ * @details Copia todos os atributos exceto o observador: a cópia nao está
+ *          registrada em nenhum índice, e suas alterações nao devem
+ *          sobrescrever as do card original.
+ */
+Card::Card(const Card& other)
+    : id_(other.id_),
+      title_(other.title_),
+      description_(other.description_),
+      priority_(other.priority_),
+      createdAt_(other.createdAt_),
+      updatedAt_(other.updatedAt_),
+      tags_(other.tags_) {}
+
+/**
+ * @brief Construtor de movimentaçao
+ * @details Assim como a cópia, o card construído nao herda o observador:
+ *          o índice continua apontando para o card original.
+ */
+Card::Card(Card&& other) noexcept
+    : id_(std::move(other.id_)),
+      title_(std::move(other.title_)),
+      description_(std::move(other.description_)),
+      priority_(other.priority_),
+      createdAt_(other.createdAt_),
+      updatedAt_(other.updatedAt_),
+      tags_(std::move(other.tags_)) {}
+
+/**
+ * @brief Operador de atribuiçao por cópia
+ * @details Copia todos os atributos, inclusive o ID, e mantém o observador
+ *          deste card, que é avisado do novo conteúdo (e do ID antigo, se
+ *          ele mudou).
+ */
+Card& Card::operator=(const Card& other) {
+    if (this != &other) {
+        std::string previousId = other.id_;
+        previousId.swap(id_);
+        title_ = other.title_;
+        description_ = other.description_;
+        priority_ = other.priority_;
+        createdAt_ = other.createdAt_;
+        updatedAt_ = other.updatedAt_;
+        tags_ = other.tags_;
+        notifyAssigned(previousId);
+    }
+    return *this;
+}
+
+/**
+ * @brief Operador de atribuiçao por movimentaçao
+ * @details Mesmas regras da atribuiçao por cópia; o observador de other
+ *          nao é transferido.
+ */
+Card& Card::operator=(Card&& other) noexcept {
+    if (this != &other) {
+        std::string previousId = std::move(other.id_);
+        previousId.swap(id_);
+        title_ = std::move(other.title_);
+        description_ = std::move(other.description_);
+        priority_ = other.priority_;
+        createdAt_ = other.createdAt_;
+        updatedAt_ = other.updatedAt_;
+        tags_ = std::move(other.tags_);
+        notifyAssigned(previousId);
+    }
+    return *this;
+}
+
 /**
  * @brief Retorna o ID único do card
  * @return Referência constante para o ID do card
@@ -110,11 +180,13 @@ const std::string& Card::title() const noexcept {
  * @brief Define um novo título para o card
  * @param title Novo título a ser atribuído ao card
  * @details Atualiza o título e automaticamente atualiza o timestamp
- *          de modificaçao através do método touchUpdated().
+ *          de modificaçao através do método touchUpdated(). O observador,
+ *          se houver, é avisado após a alteraçao.
  */
 void Card::setTitle(const std::string& title) {
     title_ = title;
     touchUpdated();
+    notifyTextChanged();
 }
 
 /**
@@ -130,11 +202,13 @@ const std::optional<std::string>& Card::description() const noexcept {
  * @brief Define a descriçao do card
  * @param desc Nova descriçao a ser atribuída ao card
  * @details Atualiza a descriçao e automaticamente atualiza o timestamp
- *          de modificaçao através do método touchUpdated().
+ *          de modificaçao através do método touchUpdated(). O observador,
+ *          se houver, é avisado após a alteraçao.
  */
 void Card::setDescription(const std::string& desc) {
     description_ = desc;
     touchUpdated();
+    notifyTextChanged();
 }
 
 /**
@@ -146,6 +220,7 @@ void Card::setDescription(const std::string& desc) {
 void Card::setPriority(int p) noexcept {
     priority_ = p;
     touchUpdated();
+    notifyUpdated();
 }
 
 /**
@@ -190,6 +265,7 @@ void Card::addTag(const std::shared_ptr<Tag>& tag) {
     if (!hasTag(tag->id())) {
         tags_.push_back(tag);
         touchUpdated();
+        notifyUpdated();
     }
 }
 
@@ -208,6 +284,7 @@ bool Card::removeTagById(const std::string& tagId) noexcept {
     if (it != tags_.end()) {
         tags_.erase(it);
         touchUpdated();
+        notifyUpdated();
         return true;
     }
     return false;
@@ -235,7 +312,31 @@ void Card::clearTags() noexcept {
     if (!tags_.empty()) {
         tags_.clear();
         touchUpdated();
+        notifyUpdated();
+    }
+}
+
+/**
+ * @brief Substitui todas as tags do card de uma vez
+ * @param tags Novas tags (duplicatas por ID sao descartadas)
+ * @details Preserva a ordem recebida. O observador é notificado uma única
+ *          vez, já com o conjunto final de tags.
+ */
+void Card::setTags(std::vector<std::shared_ptr<Tag>> tags) {
+    std::vector<std::shared_ptr<Tag>> unique;
+    unique.reserve(tags.size());
+    for (auto& tag : tags) {
+        const bool seen = std::any_of(unique.begin(), unique.end(),
+            [&tag](const std::shared_ptr<Tag>& kept) {
+                return kept->id() == tag->id();
+            });
+        if (!seen) {
+            unique.push_back(std::move(tag));
+        }
     }
+    tags_ = std::move(unique);
+    touchUpdated();
+    notifyUpdated();
 }
 
 /**
@@ -247,6 +348,65 @@ const std::vector<std::shared_ptr<Tag>>& Card::tags() const noexcept {
     return tags_;
 }
 
+// ============================================================================
+// OBSERVADOR
+// ============================================================================
+
+/**
+ * @brief Define o observador das alterações do card
+ * @param observer Observador (weak_ptr vazio remove o atual)
+ */
+void Card::setObserver(std::weak_ptr<interfaces::ICardObserver> observer) noexcept {
+    observer_ = std::move(observer);
+}
+
+/**
+ * @brief Avisa o observador, se ele ainda existir
+ */
+void Card::notifyTextChanged() const {
+    if (auto observer = observer_.lock()) {
+        observer->onCardTextChanged(*this);
+    }
+}
+
+/**
+ * @brief Avisa o observador de alteraçao de prioridade ou tags
+ * @details Chamado por métodos noexcept: uma falha do observador (ex.:
+ *          falta de memória ao atualizar um índice) nao interrompe a
+ *          alteraçao do card.
+ */
+void Card::notifyUpdated() const noexcept {
+    try {
+        if (auto observer = observer_.lock()) {
+            observer->onCardUpdated(*this);
+        }
+    } catch (...) {
+        // índice derivado desatualizado é preferível a std::terminate
+    }
+}
+
+/**
+ * @brief Avisa o observador de que o card recebeu o conteúdo de outro
+ * @param previousId ID antes da atribuiçao
+ * @details Com o ID trocado, só onCardIdChanged() é chamado: o observador
+ *          reindexa o card inteiro sob o novo ID. Como em notifyUpdated(),
+ *          falhas do observador sao descartadas.
+ */
+void Card::notifyAssigned(const std::string& previousId) const noexcept {
+    try {
+        if (auto observer = observer_.lock()) {
+            if (previousId != id_) {
+                observer->onCardIdChanged(*this, previousId);
+            } else {
+                observer->onCardTextChanged(*this);
+                observer->onCardUpdated(*this);
+            }
+        }
+    } catch (...) {
+        // índice derivado desatualizado é preferível a std::terminate
+    }
+}
+
 // ============================================================================
 // OPERADORES E MÉTODOS DE UTILIDADE
 // ============================================================================
@@ -0,0 +1,713 @@
+/**
+ * @file CardFilter.cpp
+ * @brief Implementaçao dos filtros de cards e do compilador de planos
+ * @details Os filtros simples e o FilterPlan compartilham as mesmas funções
+ *          de comparaçao; a diferença é que o plano recebe os dados já
+ *          normalizados e evita a recursao e as chamadas virtuais da árvore.
+ */
+
+#include "domain/CardFilter.h"
+#include "domain/CardTable.h"
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+
+namespace kanban {
+namespace domain {
+
+using interfaces::IFilter;
+
+namespace {
+
+// ============================================================================
+// COMPARAÇÕES COMPARTILHADAS
+// ============================================================================
+
+/// @brief Custos relativos estimados de cada tipo de predicado
+constexpr unsigned kCostPriority = 1;
+constexpr unsigned kCostTime = 1;
+constexpr unsigned kCostColumn = 3;
+constexpr unsigned kCostTags = 3;
+constexpr unsigned kCostText = 4;
+constexpr unsigned kCostCustom = 8;
+
+char lowerAscii(char c) noexcept {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+std::string toLower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), lowerAscii);
+    return text;
+}
+
+std::vector<std::string> toLower(std::vector<std::string> texts) {
+    for (auto& text : texts) {
+        text = toLower(std::move(text));
+    }
+    return texts;
+}
+
+/// @brief Ordena e remove repetições
+template<typename T>
+std::vector<T> sortedUnique(std::vector<T> values) {
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+}
+
+/// @brief Igualdade sem diferenciar maiúsculas; lower já está em minúsculas
+bool equalsLower(const std::string& text, const std::string& lower) noexcept {
+    if (text.size() != lower.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        if (lowerAscii(text[i]) != lower[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Busca de trecho sem diferenciar maiúsculas; needle já está em minúsculas
+bool containsLower(const std::string& text, const std::string& needle) noexcept {
+    auto it = std::search(text.begin(), text.end(), needle.begin(), needle.end(),
+                          [](char a, char b) { return lowerAscii(a) == b; });
+    return it != text.end();
+}
+
+bool hasTagNamed(const Card& card, const std::string& lowerName) noexcept {
+    for (const auto& tag : card.tags()) {
+        if (equalsLower(tag->name(), lowerName)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool matchTags(const Card& card, TagMatch mode, const std::vector<std::string>& lowerNames) noexcept {
+    switch (mode) {
+        case TagMatch::Any:
+            return std::any_of(lowerNames.begin(), lowerNames.end(),
+                               [&](const std::string& name) { return hasTagNamed(card, name); });
+        case TagMatch::All:
+            return std::all_of(lowerNames.begin(), lowerNames.end(),
+                               [&](const std::string& name) { return hasTagNamed(card, name); });
+        case TagMatch::None:
+            return std::none_of(lowerNames.begin(), lowerNames.end(),
+                                [&](const std::string& name) { return hasTagNamed(card, name); });
+        case TagMatch::AnyContaining:
+            for (const auto& tag : card.tags()) {
+                for (const auto& part : lowerNames) {
+                    if (containsLower(tag->name(), part)) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+    }
+    return false;
+}
+
+bool matchText(const Card& card, TextField field, const std::string& lowerNeedle) noexcept {
+    if (field != TextField::Description && containsLower(card.title(), lowerNeedle)) {
+        return true;
+    }
+    if (field != TextField::Title && card.description() && containsLower(*card.description(), lowerNeedle)) {
+        return true;
+    }
+    return false;
+}
+
+TimePoint timeOf(const Card& card, TimeField field) noexcept {
+    return field == TimeField::Created ? card.createdAt() : card.updatedAt();
+}
+
+} // namespace
+
+// ============================================================================
+// FILTROS SIMPLES
+// ============================================================================
+
+PrioritySetFilter::PrioritySetFilter(std::vector<int> priorities)
+    : priorities_(sortedUnique(std::move(priorities))) {}
+
+bool PrioritySetFilter::matches(const Card& card) const {
+    return std::binary_search(priorities_.begin(), priorities_.end(), card.priority());
+}
+
+std::unique_ptr<IFilter> PrioritySetFilter::clone() const {
+    return std::make_unique<PrioritySetFilter>(*this);
+}
+
+PriorityRangeFilter::PriorityRangeFilter(int min, int max) noexcept : min_(min), max_(max) {}
+
+bool PriorityRangeFilter::matches(const Card& card) const {
+    return card.priority() >= min_ && card.priority() <= max_;
+}
+
+std::unique_ptr<IFilter> PriorityRangeFilter::clone() const {
+    return std::make_unique<PriorityRangeFilter>(*this);
+}
+
+TagFilter::TagFilter(TagMatch mode, std::vector<std::string> names)
+    : mode_(mode), names_(sortedUnique(toLower(std::move(names)))) {}
+
+bool TagFilter::matches(const Card& card) const {
+    return matchTags(card, mode_, names_);
+}
+
+std::unique_ptr<IFilter> TagFilter::clone() const {
+    return std::make_unique<TagFilter>(*this);
+}
+
+TextFilter::TextFilter(TextField field, std::string needle)
+    : field_(field), needle_(toLower(std::move(needle))) {}
+
+bool TextFilter::matches(const Card& card) const {
+    return matchText(card, field_, needle_);
+}
+
+std::unique_ptr<IFilter> TextFilter::clone() const {
+    return std::make_unique<TextFilter>(*this);
+}
+
+TimeFilter::TimeFilter(TimeField field, TimePoint from, TimePoint to) noexcept
+    : field_(field), from_(from), to_(to) {}
+
+bool TimeFilter::matches(const Card& card) const {
+    TimePoint t = timeOf(card, field_);
+    return t >= from_ && t <= to_;
+}
+
+std::unique_ptr<IFilter> TimeFilter::clone() const {
+    return std::make_unique<TimeFilter>(*this);
+}
+
+ColumnFilter::ColumnFilter(std::vector<std::string> columnIds)
+    : columnIds_(sortedUnique(std::move(columnIds))) {}
+
+bool ColumnFilter::matches(const Card&) const {
+    return false;
+}
+
+bool ColumnFilter::matchesInColumn(const Card&, const std::string& columnId) const {
+    return containsColumn(columnId);
+}
+
+bool ColumnFilter::containsColumn(const std::string& columnId) const noexcept {
+    return std::binary_search(columnIds_.begin(), columnIds_.end(), columnId);
+}
+
+std::unique_ptr<IFilter> ColumnFilter::clone() const {
+    return std::make_unique<ColumnFilter>(*this);
+}
+
+// ============================================================================
+// COMBINADORES
+// ============================================================================
+
+CompositeFilter::CompositeFilter(const CompositeFilter& other) {
+    children_.reserve(other.children_.size());
+    for (const auto& child : other.children_) {
+        children_.push_back(child->clone());
+    }
+}
+
+CompositeFilter& CompositeFilter::operator=(const CompositeFilter& other) {
+    if (this != &other) {
+        std::vector<std::unique_ptr<IFilter>> children;
+        children.reserve(other.children_.size());
+        for (const auto& child : other.children_) {
+            children.push_back(child->clone());
+        }
+        children_ = std::move(children);
+    }
+    return *this;
+}
+
+CompositeFilter& CompositeFilter::add(std::unique_ptr<IFilter> filter) {
+    if (filter) {
+        children_.push_back(std::move(filter));
+    }
+    return *this;
+}
+
+bool AndFilter::matches(const Card& card) const {
+    return std::all_of(children_.begin(), children_.end(),
+                       [&](const auto& child) { return child->matches(card); });
+}
+
+bool AndFilter::matchesInColumn(const Card& card, const std::string& columnId) const {
+    return std::all_of(children_.begin(), children_.end(),
+                       [&](const auto& child) { return child->matchesInColumn(card, columnId); });
+}
+
+std::unique_ptr<IFilter> AndFilter::clone() const {
+    return std::make_unique<AndFilter>(*this);
+}
+
+bool OrFilter::matches(const Card& card) const {
+    return std::any_of(children_.begin(), children_.end(),
+                       [&](const auto& child) { return child->matches(card); });
+}
+
+bool OrFilter::matchesInColumn(const Card& card, const std::string& columnId) const {
+    return std::any_of(children_.begin(), children_.end(),
+                       [&](const auto& child) { return child->matchesInColumn(card, columnId); });
+}
+
+std::unique_ptr<IFilter> OrFilter::clone() const {
+    return std::make_unique<OrFilter>(*this);
+}
+
+NotFilter::NotFilter(std::unique_ptr<IFilter> inner) : inner_(std::move(inner)) {
+    if (!inner_) {
+        inner_ = std::make_unique<AndFilter>();   // Not(vazio) = Not(aceita tudo)
+    }
+}
+
+bool NotFilter::matches(const Card& card) const {
+    return !inner_->matches(card);
+}
+
+bool NotFilter::matchesInColumn(const Card& card, const std::string& columnId) const {
+    return !inner_->matchesInColumn(card, columnId);
+}
+
+std::unique_ptr<IFilter> NotFilter::clone() const {
+    return std::make_unique<NotFilter>(inner_->clone());
+}
+
+// ============================================================================
+// COMPILAÇaO
+// ============================================================================
+
+/**
+ * @brief Compilador árvore -> instruções
+ * @details Primeiro monta uma árvore intermediária normalizada (And/Or
+ *          achatados, constantes propagadas, filhos ordenados por custo) e
+ *          depois a emite como testes com destinos de curto-circuito.
+ */
+class FilterPlan::Compiler {
+public:
+    struct Node {
+        enum class Kind { Leaf, Constant, And, Or, Not };
+        Kind kind = Kind::Constant;
+        bool value = true;              ///< @brief Constant
+        Predicate predicate;            ///< @brief Leaf
+        std::vector<Node> children;     ///< @brief And/Or/Not
+        unsigned cost = 0;
+    };
+
+    explicit Compiler(FilterPlan& plan) : plan_(plan) {}
+
+    void run(const IFilter& filter) {
+        Node root = build(filter);
+        root = extractColumnScope(std::move(root));
+        plan_.entry_ = emit(root, kAccept, kReject);
+
+        // Emitido de trás para frente; inverte para que a execuçao avance no vetor
+        auto& code = plan_.code_;
+        const auto last = static_cast<std::uint32_t>(code.size() - 1);
+        auto remap = [last](std::uint32_t target) { return target <= last ? last - target : target; };
+        std::reverse(code.begin(), code.end());
+        for (auto& in : code) {
+            in.onTrue = remap(in.onTrue);
+            in.onFalse = remap(in.onFalse);
+        }
+        plan_.entry_ = code.empty() ? plan_.entry_ : remap(plan_.entry_);
+    }
+
+private:
+    static Node constant(bool value) {
+        Node node;
+        node.kind = Node::Kind::Constant;
+        node.value = value;
+        return node;
+    }
+
+    static Node leaf(Predicate predicate) {
+        Node node;
+        node.kind = Node::Kind::Leaf;
+        node.cost = predicate.cost;
+        node.predicate = std::move(predicate);
+        return node;
+    }
+
+    static Predicate predicate(Predicate::Kind kind, unsigned cost) {
+        Predicate p;
+        p.kind = kind;
+        p.cost = cost;
+        return p;
+    }
+
+    /**
+     * @brief Converte um filtro em nó normalizado
+     */
+    Node build(const IFilter& filter) {
+        if (auto f = dynamic_cast<const AndFilter*>(&filter)) {
+            return combine(Node::Kind::And, f->children());
+        }
+        if (auto f = dynamic_cast<const OrFilter*>(&filter)) {
+            return combine(Node::Kind::Or, f->children());
+        }
+        if (auto f = dynamic_cast<const NotFilter*>(&filter)) {
+            Node inner = build(f->inner());
+            if (inner.kind == Node::Kind::Constant) {
+                return constant(!inner.value);
+            }
+            if (inner.kind == Node::Kind::Not) {
+                return std::move(inner.children.front());
+            }
+            Node node;
+            node.kind = Node::Kind::Not;
+            node.cost = inner.cost;
+            node.children.push_back(std::move(inner));
+            return node;
+        }
+        if (auto f = dynamic_cast<const PrioritySetFilter*>(&filter)) {
+            if (f->priorities().empty()) {
+                return constant(false);
+            }
+            Predicate p = predicate(Predicate::Kind::PrioritySet, kCostPriority);
+            p.priorities = f->priorities();
+            return leaf(std::move(p));
+        }
+        if (auto f = dynamic_cast<const PriorityRangeFilter*>(&filter)) {
+            if (f->min() > f->max()) {
+                return constant(false);
+            }
+            Predicate p = predicate(Predicate::Kind::PriorityRange, kCostPriority);
+            p.min = f->min();
+            p.max = f->max();
+            return leaf(std::move(p));
+        }
+        if (auto f = dynamic_cast<const TagFilter*>(&filter)) {
+            if (f->names().empty()) {
+                return constant(f->mode() == TagMatch::All || f->mode() == TagMatch::None);
+            }
+            Predicate p = predicate(Predicate::Kind::Tags, kCostTags);
+            p.tagMatch = f->mode();
+            p.strings = f->names();
+            return leaf(std::move(p));
+        }
+        if (auto f = dynamic_cast<const TextFilter*>(&filter)) {
+            if (f->needle().empty()) {
+                return constant(true);
+            }
+            Predicate p = predicate(Predicate::Kind::Text,
+                                    f->field() == TextField::Any ? kCostText * 2 : kCostText);
+            p.textField = f->field();
+            p.needle = f->needle();
+            return leaf(std::move(p));
+        }
+        if (auto f = dynamic_cast<const TimeFilter*>(&filter)) {
+            if (f->from() > f->to()) {
+                return constant(false);
+            }
+            Predicate p = predicate(Predicate::Kind::Time, kCostTime);
+            p.timeField = f->field();
+            p.from = f->from();
+            p.to = f->to();
+            return leaf(std::move(p));
+        }
+        if (auto f = dynamic_cast<const ColumnFilter*>(&filter)) {
+            if (f->columnIds().empty()) {
+                return constant(false);
+            }
+            Predicate p = predicate(Predicate::Kind::Column, kCostColumn);
+            p.strings = f->columnIds();
+            return leaf(std::move(p));
+        }
+
+        // Implementaçao desconhecida de IFilter: avaliada por chamada virtual
+        Predicate p = predicate(Predicate::Kind::Custom, kCostCustom);
+        p.custom = std::shared_ptr<const IFilter>(filter.clone());
+        return leaf(std::move(p));
+    }
+
+    /**
+     * @brief Monta um And/Or achatado, sem constantes neutras e ordenado por custo
+     */
+    Node combine(Node::Kind kind, const std::vector<std::unique_ptr<IFilter>>& children) {
+        const bool neutral = (kind == Node::Kind::And);   // And: true; Or: false
+        Node node;
+        node.kind = kind;
+        for (const auto& child : children) {
+            Node built = build(*child);
+            if (built.kind == Node::Kind::Constant) {
+                if (built.value != neutral) {
+                    return constant(!neutral);            // absorvente: And(false), Or(true)
+                }
+                continue;
+            }
+            if (built.kind == kind) {
+                for (auto& grandchild : built.children) {
+                    node.children.push_back(std::move(grandchild));
+                }
+            } else {
+                node.children.push_back(std::move(built));
+            }
+        }
+        return finish(std::move(node));
+    }
+
+    /**
+     * @brief Ordena os filhos pelo custo e reduz listas vazias ou unitárias
+     */
+    static Node finish(Node node) {
+        if (node.children.empty()) {
+            return constant(node.kind == Node::Kind::And);
+        }
+        if (node.children.size() == 1) {
+            return std::move(node.children.front());
+        }
+        std::stable_sort(node.children.begin(), node.children.end(),
+                         [](const Node& a, const Node& b) { return a.cost < b.cost; });
+        node.cost = 0;
+        for (const auto& child : node.children) {
+            node.cost += child.cost;
+        }
+        return node;
+    }
+
+    /**
+     * @brief Move os testes de coluna do nível superior para o escopo do plano
+     */
+    Node extractColumnScope(Node root) {
+        auto isColumn = [](const Node& node) {
+            return node.kind == Node::Kind::Leaf && node.predicate.kind == Predicate::Kind::Column;
+        };
+        auto narrow = [this](const std::vector<std::string>& columns) {
+            if (!plan_.columnScope_) {
+                plan_.columnScope_ = columns;
+                return;
+            }
+            std::vector<std::string> both;
+            std::set_intersection(plan_.columnScope_->begin(), plan_.columnScope_->end(),
+                                  columns.begin(), columns.end(), std::back_inserter(both));
+            plan_.columnScope_ = std::move(both);
+        };
+
+        if (isColumn(root)) {
+            narrow(root.predicate.strings);
+            return constant(true);
+        }
+        if (root.kind != Node::Kind::And) {
+            return root;
+        }
+        Node rest;
+        rest.kind = Node::Kind::And;
+        for (auto& child : root.children) {
+            if (isColumn(child)) {
+                narrow(child.predicate.strings);
+            } else {
+                rest.children.push_back(std::move(child));
+            }
+        }
+        return finish(std::move(rest));
+    }
+
+    /**
+     * @brief Emite o nó com os destinos de sucesso e de falha já conhecidos
+     * @return Ponto de entrada do nó (instruçao ou destino terminal)
+     * @details And encadeia os filhos pelo destino de sucesso e Or pelo de
+     *          falha; Not apenas troca os destinos. Os filhos sao emitidos do
+     *          último para o primeiro, pois cada um precisa da entrada do seguinte.
+     */
+    std::uint32_t emit(Node& node, std::uint32_t onTrue, std::uint32_t onFalse) {
+        switch (node.kind) {
+            case Node::Kind::Constant:
+                return node.value ? onTrue : onFalse;
+            case Node::Kind::Leaf: {
+                auto predicate = static_cast<std::uint32_t>(plan_.predicates_.size());
+                plan_.predicates_.push_back(std::move(node.predicate));
+                plan_.code_.push_back(Instruction{predicate, onTrue, onFalse});
+                return static_cast<std::uint32_t>(plan_.code_.size() - 1);
+            }
+            case Node::Kind::Not:
+                return emit(node.children.front(), onFalse, onTrue);
+            case Node::Kind::And: {
+                std::uint32_t next = onTrue;
+                for (auto it = node.children.rbegin(); it != node.children.rend(); ++it) {
+                    next = emit(*it, next, onFalse);
+                }
+                return next;
+            }
+            case Node::Kind::Or: {
+                std::uint32_t next = onFalse;
+                for (auto it = node.children.rbegin(); it != node.children.rend(); ++it) {
+                    next = emit(*it, onTrue, next);
+                }
+                return next;
+            }
+        }
+        return onFalse;
+    }
+
+    FilterPlan& plan_;
+};
+
+FilterPlan FilterPlan::compile(const IFilter& filter) {
+    FilterPlan plan;
+    Compiler(plan).run(filter);
+    return plan;
+}
+
+// ============================================================================
+// AVALIAÇaO
+// ============================================================================
+
+// Inline: chamado apenas pelo laço de matches(), onde fica o custo do interpretador
+inline bool FilterPlan::test(const Predicate& p, const Card& card, const std::string& columnId) {
+    switch (p.kind) {
+        case Predicate::Kind::PrioritySet:
+            return std::binary_search(p.priorities.begin(), p.priorities.end(), card.priority());
+        case Predicate::Kind::PriorityRange:
+            return card.priority() >= p.min && card.priority() <= p.max;
+        case Predicate::Kind::Tags:
+            return matchTags(card, p.tagMatch, p.strings);
+        case Predicate::Kind::Text:
+            return matchText(card, p.textField, p.needle);
+        case Predicate::Kind::Time: {
+            TimePoint t = timeOf(card, p.timeField);
+            return t >= p.from && t <= p.to;
+        }
+        case Predicate::Kind::Column:
+            if (p.strings.size() == 1) {
+                return p.strings.front() == columnId;
+            }
+            return std::binary_search(p.strings.begin(), p.strings.end(), columnId);
+        case Predicate::Kind::Custom:
+            return p.custom->matchesInColumn(card, columnId);
+    }
+    return false;
+}
+
+bool FilterPlan::matches(const Card& card, const std::string& columnId) const {
+    if (columnScope_ && !std::binary_search(columnScope_->begin(), columnScope_->end(), columnId)) {
+        return false;
+    }
+    std::uint32_t pc = entry_;
+    while (pc < kReject) {
+        const Instruction& in = code_[pc];
+        pc = test(predicates_[in.predicate], card, columnId) ? in.onTrue : in.onFalse;
+    }
+    return pc == kAccept;
+}
+
+bool FilterPlan::rejectsAll() const noexcept {
+    return entry_ == kReject || (columnScope_ && columnScope_->empty());
+}
+
+bool FilterPlan::vectorizable() const noexcept {
+    return std::none_of(predicates_.begin(), predicates_.end(), [](const Predicate& p) {
+        return p.kind == Predicate::Kind::Text || p.kind == Predicate::Kind::Custom;
+    });
+}
+
+std::optional<simd::Bitmap> FilterPlan::select(const CardTable& table) const {
+    if (!vectorizable()) {
+        return std::nullopt;
+    }
+    const std::size_t rows = table.size();
+    auto columns = [&table, rows](const std::vector<std::string>& ids) {
+        simd::Bitmap selected(rows);
+        for (const auto& id : ids) {
+            selected |= table.whereColumn(id);
+        }
+        return selected;
+    };
+
+    // Uma seleçao por predicado
+    std::vector<simd::Bitmap> selections;
+    selections.reserve(predicates_.size());
+    for (const Predicate& p : predicates_) {
+        switch (p.kind) {
+            case Predicate::Kind::PrioritySet: {
+                simd::Bitmap selected(rows);
+                for (int priority : p.priorities) {
+                    selected |= table.wherePriority(simd::Compare::Equal, priority);
+                }
+                selections.push_back(std::move(selected));
+                break;
+            }
+            case Predicate::Kind::PriorityRange: {
+                simd::Bitmap selected = table.wherePriority(simd::Compare::GreaterEqual, p.min);
+                selected &= table.wherePriority(simd::Compare::LessEqual, p.max);
+                selections.push_back(std::move(selected));
+                break;
+            }
+            case Predicate::Kind::Tags: {
+                auto selected = table.whereTags(p.tagMatch, p.strings);
+                if (!selected) {
+                    return std::nullopt;
+                }
+                selections.push_back(std::move(*selected));
+                break;
+            }
+            case Predicate::Kind::Time:
+                selections.push_back(table.whereTime(p.timeField, p.from, p.to));
+                break;
+            case Predicate::Kind::Column:
+                selections.push_back(columns(p.strings));
+                break;
+            case Predicate::Kind::Text:
+            case Predicate::Kind::Custom:
+                return std::nullopt;
+        }
+    }
+
+    // Os saltos só avançam no vetor: resolve do fim para o início
+    const simd::Bitmap none(rows);
+    const simd::Bitmap all(rows, true);
+    std::vector<simd::Bitmap> accepted(code_.size());
+    auto target = [&](std::uint32_t pc) -> const simd::Bitmap& {
+        if (pc == kAccept) return all;
+        if (pc == kReject) return none;
+        return accepted[pc];
+    };
+    for (std::size_t pc = code_.size(); pc-- > 0;) {
+        const Instruction& in = code_[pc];
+        const simd::Bitmap& predicate = selections[in.predicate];
+        simd::Bitmap whenTrue = predicate;
+        whenTrue &= target(in.onTrue);
+        simd::Bitmap whenFalse = target(in.onFalse);
+        whenFalse.andNot(predicate);
+        whenTrue |= whenFalse;
+        accepted[pc] = std::move(whenTrue);
+    }
+
+    simd::Bitmap result = target(entry_);
+    if (columnScope_) {
+        result &= columns(*columnScope_);
+    }
+    return result;
+}
+
+std::string FilterPlan::explain() const {
+    static const char* const kKindNames[] = {
+        "prioridade", "faixa de prioridade", "tags", "texto", "data", "coluna", "filtro externo"
+    };
+    auto target = [](std::uint32_t pc) {
+        if (pc == kAccept) return std::string("aceita");
+        if (pc == kReject) return std::string("rejeita");
+        return std::to_string(pc);
+    };
+    std::ostringstream out;
+    if (columnScope_) {
+        out << "escopo: " << columnScope_->size() << " coluna(s)\n";
+    }
+    if (code_.empty()) {
+        out << target(entry_) << "\n";
+    }
+    for (std::size_t pc = 0; pc < code_.size(); ++pc) {
+        const Instruction& in = code_[pc];
+        out << pc << ": testa " << kKindNames[static_cast<int>(predicates_[in.predicate].kind)]
+            << "; verdadeiro -> " << target(in.onTrue) << ", falso -> " << target(in.onFalse) << "\n";
+    }
+    return out.str();
+}
+
+} // namespace domain
+} // namespace kanban
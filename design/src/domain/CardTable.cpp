@@ -0,0 +1,157 @@
+/**
+ * @file CardTable.cpp
+ * @brief Implementaçao da tabela colunar de atributos dos cards
+ */
+
+#include "domain/CardTable.h"
+#include "domain/Board.h"
+#include "domain/Column.h"
+#include <algorithm>
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+std::string toLower(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), [](char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    });
+    return text;
+}
+
+} // namespace
+
+// ============================================================================
+// CONSTRUÇaO
+// ============================================================================
+
+CardTable CardTable::fromBoard(const Board& board) {
+    CardTable table;
+    std::size_t total = 0;
+    for (const auto& column : board.columns()) {
+        total += column->cards().size();
+    }
+    table.cards_.reserve(total);
+    table.priorities_.reserve(total);
+    table.created_.reserve(total);
+    table.updated_.reserve(total);
+    table.tagMasks_.reserve(total);
+    table.columnIndexes_.reserve(total);
+
+    for (const auto& column : board.columns()) {
+        auto columnIndex = static_cast<std::int32_t>(table.columnIds_.size());
+        table.columnIds_.push_back(column->id());
+
+        for (const auto& card : column->cards()) {
+            std::uint64_t mask = 0;
+            for (const auto& tag : card->tags()) {
+                std::string name = toLower(tag->name());
+                auto it = table.tagBits_.find(name);
+                if (it == table.tagBits_.end()) {
+                    if (table.tagBits_.size() == kMaxIndexedTags) {
+                        table.tagsComplete_ = false;
+                        continue;
+                    }
+                    it = table.tagBits_.emplace(name, std::uint64_t{1} << table.tagBits_.size()).first;
+                }
+                mask |= it->second;
+            }
+
+            table.cards_.push_back(card);
+            table.priorities_.push_back(card->priority());
+            table.created_.push_back(toTicks(card->createdAt()));
+            table.updated_.push_back(toTicks(card->updatedAt()));
+            table.tagMasks_.push_back(mask);
+            table.columnIndexes_.push_back(columnIndex);
+        }
+    }
+    return table;
+}
+
+std::int64_t CardTable::toTicks(TimePoint time) noexcept {
+    return static_cast<std::int64_t>(time.time_since_epoch().count());
+}
+
+std::optional<std::uint64_t> CardTable::tagBit(const std::string& name) const {
+    auto it = tagBits_.find(toLower(name));
+    if (it == tagBits_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+// ============================================================================
+// SELEÇÕES
+// ============================================================================
+
+simd::Bitmap CardTable::wherePriority(simd::Compare op, int value) const {
+    simd::Bitmap rows;
+    simd::compareInt32(priorities_.data(), size(), op, static_cast<std::int32_t>(value), rows);
+    return rows;
+}
+
+simd::Bitmap CardTable::whereTime(TimeField field, TimePoint from, TimePoint to) const {
+    const auto& ticks = field == TimeField::Updated ? updated_ : created_;
+    simd::Bitmap rows;
+    simd::rangeInt64(ticks.data(), size(), toTicks(from), toTicks(to), rows);
+    return rows;
+}
+
+std::optional<simd::Bitmap> CardTable::whereTags(TagMatch mode, const std::vector<std::string>& names) const {
+    if (mode == TagMatch::AnyContaining) {
+        return std::nullopt;
+    }
+
+    // Nomes sem bit: ausentes de todos os cards se o dicionário está
+    // completo; caso contrário, a resposta nao pode ser dada pela máscara
+    std::uint64_t mask = 0;
+    bool missing = false;
+    for (const auto& name : names) {
+        if (auto bit = tagBit(name)) {
+            mask |= *bit;
+        } else if (!tagsComplete_) {
+            return std::nullopt;
+        } else {
+            missing = true;
+        }
+    }
+
+    simd::Bitmap rows;
+    switch (mode) {
+        case TagMatch::All:
+            if (missing) {
+                rows.assign(size(), false);
+                return rows;
+            }
+            simd::matchMask(tagMasks_.data(), size(), mask, simd::MaskMatch::All, rows);
+            return rows;
+        case TagMatch::None:
+            simd::matchMask(tagMasks_.data(), size(), mask, simd::MaskMatch::None, rows);
+            return rows;
+        default:
+            simd::matchMask(tagMasks_.data(), size(), mask, simd::MaskMatch::Any, rows);
+            return rows;
+    }
+}
+
+simd::Bitmap CardTable::whereColumn(const std::string& columnId) const {
+    auto it = std::find(columnIds_.begin(), columnIds_.end(), columnId);
+    if (it == columnIds_.end()) {
+        return simd::Bitmap(size(), false);
+    }
+    simd::Bitmap rows;
+    simd::compareInt32(columnIndexes_.data(), size(), simd::Compare::Equal,
+                       static_cast<std::int32_t>(it - columnIds_.begin()), rows);
+    return rows;
+}
+
+std::vector<std::shared_ptr<Card>> CardTable::cardsIn(const simd::Bitmap& rows) const {
+    std::vector<std::shared_ptr<Card>> result;
+    result.reserve(rows.count());
+    rows.forEachSet([&](std::size_t row) { result.push_back(cards_[row]); });
+    return result;
+}
+
+} // namespace domain
+} // namespace kanban
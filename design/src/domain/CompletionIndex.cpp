@@ -0,0 +1,123 @@
+/**
+ * @file CompletionIndex.cpp
+ * @brief Implementaçao do índice de completamento de títulos e tags
+ */
+
+#include "domain/CompletionIndex.h"
+#include "domain/Card.h"
+#include "domain/TextTokenizer.h"
+#include <algorithm>
+#include <mutex>
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+std::int64_t ticks(TimePoint time) noexcept {
+    return static_cast<std::int64_t>(time.time_since_epoch().count());
+}
+
+} // namespace
+
+// ============================================================================
+// ATUALIZAÇaO
+// ============================================================================
+
+void CompletionIndex::addCard(const Card& card) {
+    // Nomes normalizados das tags atuais, sem repetiçao (calculados fora do lock)
+    std::vector<std::pair<std::string, std::string>> current;   // chave, grafia
+    for (const auto& tag : card.tags()) {
+        std::string key = foldText(tag->name());
+        bool seen = std::any_of(current.begin(), current.end(),
+                                [&key](const auto& entry) { return entry.first == key; });
+        if (!seen && !key.empty()) {
+            current.emplace_back(std::move(key), tag->name());
+        }
+    }
+    const std::int64_t updated = ticks(card.updatedAt());
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    titles_.insert(card.id(), card.title(), CompletionRank{card.priority(), updated});
+
+    auto& previous = cardTags_[card.id()];
+    for (const auto& key : previous) {
+        bool kept = std::any_of(current.begin(), current.end(),
+                                [&key](const auto& entry) { return entry.first == key; });
+        if (!kept) {
+            releaseTagLocked(key);
+        }
+    }
+    for (const auto& entry : current) {
+        TagUse& use = tagUses_[entry.first];
+        if (std::find(previous.begin(), previous.end(), entry.first) == previous.end()) {
+            ++use.cards;
+        }
+        if (use.name.empty()) {
+            use.name = entry.second;
+        }
+        use.lastUsed = std::max(use.lastUsed, updated);
+        tags_.insert(entry.first, use.name, CompletionRank{static_cast<std::int64_t>(use.cards), use.lastUsed});
+    }
+
+    previous.clear();
+    for (auto& entry : current) {
+        previous.push_back(std::move(entry.first));
+    }
+}
+
+void CompletionIndex::removeCard(const std::string& cardId) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    titles_.erase(cardId);
+    auto it = cardTags_.find(cardId);
+    if (it == cardTags_.end()) {
+        return;
+    }
+    for (const auto& key : it->second) {
+        releaseTagLocked(key);
+    }
+    cardTags_.erase(it);
+}
+
+/**
+ * @brief Um card deixou de usar a tag: rebaixa ou remove a sugestao
+ */
+void CompletionIndex::releaseTagLocked(const std::string& key) {
+    auto it = tagUses_.find(key);
+    if (it == tagUses_.end()) {
+        return;
+    }
+    if (--it->second.cards == 0) {
+        tags_.erase(key);
+        tagUses_.erase(it);
+        return;
+    }
+    tags_.insert(key, it->second.name,
+                 CompletionRank{static_cast<std::int64_t>(it->second.cards), it->second.lastUsed});
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+std::vector<Completion> CompletionIndex::completeTitles(const std::string& prefix, std::size_t limit) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return titles_.complete(prefix, limit);
+}
+
+std::vector<Completion> CompletionIndex::completeTags(const std::string& prefix, std::size_t limit) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return tags_.complete(prefix, limit);
+}
+
+std::vector<std::string> CompletionIndex::tagNames() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::string> names;
+    for (auto& entry : tags_.entries()) {
+        names.push_back(std::move(entry.text));
+    }
+    return names;
+}
+
+} // namespace domain
+} // namespace kanban
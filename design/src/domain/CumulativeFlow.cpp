@@ -0,0 +1,169 @@
+/**
+ * @file CumulativeFlow.cpp
+ * @brief Implementaçao do cálculo paralelo do diagrama de fluxo cumulativo
+ */
+
+#include "domain/CumulativeFlow.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+/// @brief Menor partiçao que compensa uma tarefa no pool
+constexpr std::size_t kMinPartition = 1 << 16;
+
+/// @brief Limite do bucket de excedentes (depois do fim da janela): nunca cruzado
+constexpr std::uint64_t kNoBoundary = std::numeric_limits<std::uint64_t>::max();
+
+std::uint64_t toMs(TimePoint tp) {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(tp.time_since_epoch()).count();
+    return static_cast<std::uint64_t>(std::max<std::int64_t>(ms, 0));
+}
+
+/**
+ * @brief Saldo por (bucket, coluna) de um trecho das atividades
+ * @details deltas[(b - first) * colunas + c], para os buckets que o trecho cobre.
+ */
+struct Partial {
+    std::size_t first = 0;
+    std::vector<std::int64_t> deltas;
+};
+
+} // namespace
+
+CumulativeFlow cumulativeFlow(const CumulativeFlowInput& input,
+                              TimePoint from,
+                              TimePoint to,
+                              std::chrono::milliseconds bucket,
+                              concurrency::ThreadPool* pool) {
+    if (bucket.count() <= 0) {
+        throw std::invalid_argument("Largura do bucket deve ser positiva");
+    }
+    if (to < from) {
+        throw std::invalid_argument("Fim da janela anterior ao início");
+    }
+
+    const auto width = static_cast<std::uint64_t>(bucket.count());
+    const std::uint64_t fromMs = toMs(from);
+    const std::uint64_t span = toMs(to) - fromMs;
+    const std::size_t buckets = static_cast<std::size_t>(std::max<std::uint64_t>(1, (span + width - 1) / width));
+    if (buckets > kMaxCumulativeFlowBuckets) {
+        throw std::invalid_argument("Janela com buckets demais: " + std::to_string(buckets));
+    }
+    const std::size_t columns = input.columns.size();
+
+    // Bucket de um instante; o índice buckets acumula o que passou do fim da janela
+    auto bucketOf = [&](std::uint64_t ms) -> std::size_t {
+        if (ms < fromMs) {
+            return 0;
+        }
+        return static_cast<std::size_t>(std::min<std::uint64_t>((ms - fromMs) / width, buckets));
+    };
+    // Poucas colunas: busca linear é mais rápida que um hash
+    auto columnOf = [&](ActivityHandle handle) -> std::ptrdiff_t {
+        for (std::size_t c = 0; c < columns; ++c) {
+            if (input.columns[c].first == handle) {
+                return static_cast<std::ptrdiff_t>(c);
+            }
+        }
+        return -1;
+    };
+
+    const auto& events = input.events;
+    auto fold = [&](std::size_t begin, std::size_t end) {
+        Partial partial;
+        if (begin == end) {
+            return partial;
+        }
+        // Atividades em ordem cronológica: o trecho cobre buckets contíguos
+        partial.first = bucketOf(events[begin].timestamp().physicalMs());
+        std::size_t last = bucketOf(events[end - 1].timestamp().physicalMs());
+        partial.deltas.assign((last - partial.first + 1) * columns, 0);
+        // O bucket só avança: a divisao é refeita apenas ao cruzar o limite
+        std::size_t current = partial.first;
+        std::uint64_t boundary = current < buckets ? fromMs + (current + 1) * width : kNoBoundary;
+        for (std::size_t i = begin; i < end; ++i) {
+            const Activity& act = events[i];
+            if (act.kind() != ActivityKind::CardMoved) {
+                continue;
+            }
+            const std::uint64_t ms = act.timestamp().physicalMs();
+            if (ms >= boundary) {
+                current = bucketOf(ms);
+                boundary = current < buckets ? fromMs + (current + 1) * width : kNoBoundary;
+            }
+            std::size_t row = (current - partial.first) * columns;
+            std::ptrdiff_t source = columnOf(act.fromColumn());
+            std::ptrdiff_t target = columnOf(act.toColumn());
+            if (source >= 0) {
+                --partial.deltas[row + static_cast<std::size_t>(source)];
+            }
+            if (target >= 0) {
+                ++partial.deltas[row + static_cast<std::size_t>(target)];
+            }
+        }
+        return partial;
+    };
+
+    // Partições contíguas: a primeira fica com o chamador, as demais vao ao pool
+    std::size_t partitions = 1;
+    if (pool != nullptr && events.size() >= 2 * kMinPartition) {
+        partitions = std::min(pool->size() + 1, events.size() / kMinPartition);
+    }
+    const std::size_t step = (events.size() + partitions - 1) / partitions;
+    std::vector<Partial> partials(partitions);
+    if (partitions > 1) {
+        concurrency::TaskGroup group(*pool);
+        for (std::size_t p = 1; p < partitions; ++p) {
+            std::size_t begin = std::min(p * step, events.size());
+            std::size_t end = std::min(begin + step, events.size());
+            group.run([&fold, &partials, p, begin, end] { partials[p] = fold(begin, end); });
+        }
+        partials[0] = fold(0, std::min(step, events.size()));
+        group.wait();
+    } else {
+        partials[0] = fold(0, events.size());
+    }
+
+    // Saldo total por bucket (linha buckets = depois do fim da janela)
+    std::vector<std::int64_t> deltas((buckets + 1) * columns, 0);
+    for (const auto& partial : partials) {
+        std::size_t offset = partial.first * columns;
+        for (std::size_t i = 0; i < partial.deltas.size(); ++i) {
+            deltas[offset + i] += partial.deltas[i];
+        }
+    }
+    for (const auto& [ms, column] : input.creations) {
+        std::ptrdiff_t target = columnOf(column);
+        if (target >= 0 && ms >= fromMs) {
+            ++deltas[bucketOf(ms) * columns + static_cast<std::size_t>(target)];
+        }
+    }
+
+    // Soma de trás para frente a partir do estado atual
+    CumulativeFlow flow;
+    flow.from = from;
+    flow.bucket = bucket;
+    flow.events = events.size();
+    flow.columns.reserve(columns);
+    for (const auto& column : input.columns) {
+        flow.columns.push_back(column.second);
+    }
+    flow.counts.assign(buckets, std::vector<std::int64_t>(columns, 0));
+    std::vector<std::int64_t> running(input.current);
+    running.resize(columns, 0);
+    for (std::size_t b = buckets + 1; b-- > 1;) {
+        for (std::size_t c = 0; c < columns; ++c) {
+            running[c] -= deltas[b * columns + c];
+        }
+        flow.counts[b - 1] = running;
+    }
+    return flow;
+}
+
+} // namespace domain
+} // namespace kanban
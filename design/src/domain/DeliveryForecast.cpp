@@ -0,0 +1,202 @@
+/**
+ * @file DeliveryForecast.cpp
+ * @brief Implementaçao da previsao de entrega por Monte Carlo
+ */
+
+#include "domain/DeliveryForecast.h"
+#include "domain/ActivityRollup.h"
+#include "domain/RandomStream.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+/// @brief Tentativas por bloco: cada bloco tem o seu fluxo aleatório
+constexpr std::size_t kTrialsPerStream = 1 << 15;
+
+constexpr std::uint64_t kDayMs = 24ull * 3600ull * 1000ull;
+constexpr std::uint64_t kWeekMs = 7 * kDayMs;
+
+/// @brief 01/01/1970 foi uma quinta-feira: deslocamento para semanas iniciadas na segunda
+constexpr std::uint64_t kEpochWeekdayOffset = 3;
+
+std::uint64_t toMs(TimePoint tp) {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(tp.time_since_epoch()).count();
+    return ms > 0 ? static_cast<std::uint64_t>(ms) : 0u;
+}
+
+TimePoint fromMs(std::uint64_t ms) {
+    return TimePoint(std::chrono::duration_cast<TimePoint::duration>(
+        std::chrono::milliseconds(static_cast<std::int64_t>(ms))));
+}
+
+/// @brief Histograma de um trecho de blocos (posiçao kMaxForecastWeeks + 1 = além do horizonte)
+using Histogram = std::vector<std::uint64_t>;
+
+} // namespace
+
+// ============================================================================
+// PERCENTIS
+// ============================================================================
+
+std::optional<std::size_t> DeliveryForecast::weeksAt(double percentile) const {
+    if (!(percentile > 0.0 && percentile <= 1.0)) {
+        throw std::invalid_argument("Percentil deve estar em (0, 1]");
+    }
+    const auto target = static_cast<std::uint64_t>(std::ceil(percentile * static_cast<double>(trials)));
+    std::uint64_t seen = 0;
+    for (std::size_t w = 0; w < weeks.size(); ++w) {
+        seen += weeks[w];
+        if (seen >= target && seen > 0) {
+            return w;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<TimePoint> DeliveryForecast::dateAt(double percentile) const {
+    auto w = weeksAt(percentile);
+    if (!w) {
+        return std::nullopt;
+    }
+    return start + std::chrono::hours(24 * 7) * static_cast<std::int64_t>(*w);
+}
+
+// ============================================================================
+// SIMULAÇaO
+// ============================================================================
+
+DeliveryForecast forecastDelivery(const std::vector<std::uint32_t>& weeklyThroughput,
+                                  std::size_t remaining,
+                                  TimePoint start,
+                                  std::size_t trials,
+                                  concurrency::ThreadPool* pool,
+                                  std::uint64_t seed) {
+    if (weeklyThroughput.empty()) {
+        throw std::invalid_argument("Sem histórico de throughput para a previsao");
+    }
+    if (trials == 0) {
+        throw std::invalid_argument("Número de tentativas deve ser positivo");
+    }
+
+    DeliveryForecast forecast;
+    forecast.start = start;
+    forecast.remaining = remaining;
+    forecast.trials = trials;
+    forecast.throughput = weeklyThroughput;
+    forecast.weeks.assign(kMaxForecastWeeks + 1, 0);
+
+    // Casos resolvidos sem sortear: nada a entregar, ou impossível no horizonte
+    const std::uint64_t best = *std::max_element(weeklyThroughput.begin(), weeklyThroughput.end());
+    if (remaining == 0) {
+        forecast.weeks[0] = trials;
+        return forecast;
+    }
+    if (best * kMaxForecastWeeks < remaining) {
+        forecast.beyondHorizon = trials;
+        return forecast;
+    }
+
+    const auto& samples = weeklyThroughput;
+    const auto sampleCount = static_cast<std::uint32_t>(samples.size());
+    const std::size_t blocks = (trials + kTrialsPerStream - 1) / kTrialsPerStream;
+    const std::vector<RandomStream> streams = RandomStream::streams(seed, blocks);
+
+    // Blocos [first, last): cada um consome apenas o seu fluxo
+    auto simulate = [&](std::size_t first, std::size_t last) {
+        Histogram histogram(kMaxForecastWeeks + 2, 0);
+        for (std::size_t block = first; block < last; ++block) {
+            RandomStream rng = streams[block];
+            const std::size_t count = std::min(kTrialsPerStream, trials - block * kTrialsPerStream);
+            for (std::size_t t = 0; t < count; ++t) {
+                std::uint64_t delivered = 0;
+                std::size_t w = 0;
+                while (delivered < remaining && w < kMaxForecastWeeks) {
+                    delivered += samples[rng.below(sampleCount)];
+                    ++w;
+                }
+                ++histogram[delivered >= remaining ? w : kMaxForecastWeeks + 1];
+            }
+        }
+        return histogram;
+    };
+
+    // Trechos contíguos de blocos: o primeiro fica com o chamador, os demais vao ao pool
+    std::size_t partitions = 1;
+    if (pool != nullptr) {
+        partitions = std::min(pool->size() + 1, blocks);
+    }
+    const std::size_t step = (blocks + partitions - 1) / partitions;
+    std::vector<Histogram> partials(partitions);
+    if (partitions > 1) {
+        concurrency::TaskGroup group(*pool);
+        for (std::size_t p = 1; p < partitions; ++p) {
+            std::size_t first = std::min(p * step, blocks);
+            std::size_t last = std::min(first + step, blocks);
+            group.run([&simulate, &partials, p, first, last] { partials[p] = simulate(first, last); });
+        }
+        partials[0] = simulate(0, std::min(step, blocks));
+        group.wait();
+    } else {
+        partials[0] = simulate(0, blocks);
+    }
+
+    Histogram total(kMaxForecastWeeks + 2, 0);
+    for (const auto& partial : partials) {
+        for (std::size_t i = 0; i < partial.size(); ++i) {
+            total[i] += partial[i];
+        }
+    }
+
+    std::copy(total.begin(), total.begin() + kMaxForecastWeeks + 1, forecast.weeks.begin());
+    forecast.beyondHorizon = total[kMaxForecastWeeks + 1];
+    return forecast;
+}
+
+// ============================================================================
+// HISTÓRICO DE THROUGHPUT
+// ============================================================================
+
+std::vector<std::uint32_t> weeklyThroughput(const ActivityLog& log,
+                                            const std::string& columnId,
+                                            TimePoint now,
+                                            std::size_t weeks) {
+    // Semanas completas: [início da semana corrente - weeks, início da semana corrente)
+    const std::uint64_t today = toMs(now) / kDayMs;
+    const std::uint64_t mondayIndex = (today + kEpochWeekdayOffset) / 7 * 7;
+    if (mondayIndex < kEpochWeekdayOffset) {
+        return {};
+    }
+    const std::uint64_t endMs = (mondayIndex - kEpochWeekdayOffset) * kDayMs;
+    const std::uint64_t span = std::min<std::uint64_t>(weeks, endMs / kWeekMs);
+    if (span == 0) {
+        return {};
+    }
+    std::uint64_t fromMsValue = endMs - span * kWeekMs;
+    const TimePoint to = fromMs(endMs - 1);
+
+    // O histórico começa na primeira semana com alguma movimentaçao no board
+    auto activity = log.rollup(ActivityKind::CardMoved, "", RollupGranularity::Week, fromMs(fromMsValue), to);
+    if (activity.empty()) {
+        return {};
+    }
+    fromMsValue = std::max(fromMsValue, toMs(activity.front().start));
+
+    std::vector<std::uint32_t> samples(static_cast<std::size_t>((endMs - fromMsValue) / kWeekMs), 0);
+    for (const auto& point : log.rollup(ActivityKind::CardMoved, columnId, RollupGranularity::Week,
+                                        fromMs(fromMsValue), to)) {
+        const std::uint64_t startMs = toMs(point.start);
+        if (startMs >= fromMsValue && startMs < endMs) {
+            samples[static_cast<std::size_t>((startMs - fromMsValue) / kWeekMs)] =
+                static_cast<std::uint32_t>(point.events);
+        }
+    }
+    return samples;
+}
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,695 @@
+/**
+ * @file EventStore.cpp
+ * @brief Implementaçao do log de eventos, da dobra de estado e dos snapshots
+ */
+
+#include "domain/EventStore.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+constexpr char kMagic[4] = {'K', 'E', 'V', 'T'};
+constexpr std::uint8_t kVersion = 2;   // 2: descriçao no CardEntry dos snapshots
+
+// ============================================================================
+// LEITURA E ESCRITA BINÁRIA
+// ============================================================================
+
+template<typename T>
+void put(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+void putBlock(std::ostream& os, const std::vector<T>& values) {
+    put(os, static_cast<std::uint64_t>(values.size()));
+    if (!values.empty()) {
+        os.write(reinterpret_cast<const char*>(values.data()),
+                 static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+}
+
+[[noreturn]] void malformed(const char* what) {
+    throw std::runtime_error(std::string("Log de eventos malformado: ") + what);
+}
+
+template<typename T>
+T get(std::istream& is) {
+    T value{};
+    if (!is.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+        malformed("conteúdo truncado");
+    }
+    return value;
+}
+
+template<typename T>
+std::vector<T> getBlock(std::istream& is) {
+    auto count = get<std::uint64_t>(is);
+    std::vector<T> values;
+    // Cresce à medida que lê: um tamanho corrompido nao reserva memória à toa
+    constexpr std::uint64_t kChunk = 1 << 16;
+    while (values.size() < count) {
+        const std::size_t offset = values.size();
+        const std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(kChunk, count - offset));
+        values.resize(offset + n);
+        if (!is.read(reinterpret_cast<char*>(values.data() + offset), static_cast<std::streamsize>(n * sizeof(T)))) {
+            malformed("conteúdo truncado");
+        }
+    }
+    return values;
+}
+
+/// @brief Posiçao de value em list, conferindo primeiro a dica
+std::size_t locate(const std::vector<std::uint32_t>& list, std::uint32_t value, std::uint32_t hint) noexcept {
+    if (hint < list.size() && list[hint] == value) {
+        return hint;
+    }
+    return static_cast<std::size_t>(std::find(list.begin(), list.end(), value) - list.begin());
+}
+
+/// @brief Move o elemento de from para min(to, último) sem realocar
+void reposition(std::vector<std::uint32_t>& list, std::size_t from, std::size_t to) noexcept {
+    to = std::min(to, list.size() - 1);
+    if (from < to) {
+        std::rotate(list.begin() + from, list.begin() + from + 1, list.begin() + to + 1);
+    } else if (to < from) {
+        std::rotate(list.begin() + to, list.begin() + from, list.begin() + from + 1);
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// EVENTOS
+// ============================================================================
+
+const char* toString(EventKind kind) noexcept {
+    switch (kind) {
+        case EventKind::BoardCreated:       return "BoardCreated";
+        case EventKind::ColumnAdded:        return "ColumnAdded";
+        case EventKind::CardAdded:          return "CardAdded";
+        case EventKind::CardMoved:          return "CardMoved";
+        case EventKind::ColumnMoved:        return "ColumnMoved";
+        case EventKind::CardReordered:      return "CardReordered";
+        case EventKind::CardTagsUpdated:    return "CardTagsUpdated";
+        case EventKind::CardPrioritySet:    return "CardPrioritySet";
+        case EventKind::CardTitleSet:       return "CardTitleSet";
+        case EventKind::CardDescriptionSet: return "CardDescriptionSet";
+    }
+    return "Unknown";
+}
+
+Event Event::boardCreated(EventHandle board, EventHandle name) noexcept {
+    Event e;
+    e.kind = EventKind::BoardCreated;
+    e.subject = board;
+    e.text = name;
+    return e;
+}
+
+Event Event::columnAdded(EventHandle column, EventHandle board, EventHandle name) noexcept {
+    Event e;
+    e.kind = EventKind::ColumnAdded;
+    e.subject = column;
+    e.target = board;
+    e.text = name;
+    return e;
+}
+
+Event Event::cardAdded(EventHandle card, EventHandle column, EventHandle title) noexcept {
+    Event e;
+    e.kind = EventKind::CardAdded;
+    e.subject = card;
+    e.target = column;
+    e.text = title;
+    return e;
+}
+
+Event Event::cardMoved(EventHandle card, EventHandle fromColumn, EventHandle toColumn,
+                       std::uint32_t fromPosition, std::uint32_t toPosition) noexcept {
+    Event e;
+    e.kind = EventKind::CardMoved;
+    e.subject = card;
+    e.source = fromColumn;
+    e.target = toColumn;
+    e.text = toPosition;
+    e.index = fromPosition;
+    return e;
+}
+
+Event Event::columnMoved(EventHandle column, EventHandle board,
+                         std::uint32_t fromIndex, std::uint32_t toIndex) noexcept {
+    Event e;
+    e.kind = EventKind::ColumnMoved;
+    e.subject = column;
+    e.target = board;
+    e.source = fromIndex;
+    e.index = toIndex;
+    return e;
+}
+
+Event Event::cardReordered(EventHandle card, EventHandle column,
+                           std::uint32_t fromPosition, std::uint32_t toPosition) noexcept {
+    Event e;
+    e.kind = EventKind::CardReordered;
+    e.subject = card;
+    e.target = column;
+    e.source = fromPosition;
+    e.index = toPosition;
+    return e;
+}
+
+Event Event::cardTagsUpdated(EventHandle card, std::uint32_t firstTag, std::uint32_t tagCount) noexcept {
+    Event e;
+    e.kind = EventKind::CardTagsUpdated;
+    e.subject = card;
+    e.text = firstTag;
+    e.index = tagCount;
+    return e;
+}
+
+Event Event::cardPrioritySet(EventHandle card, int priority) noexcept {
+    Event e;
+    e.kind = EventKind::CardPrioritySet;
+    e.subject = card;
+    e.index = static_cast<std::uint32_t>(static_cast<std::int32_t>(priority));
+    return e;
+}
+
+Event Event::cardTitleSet(EventHandle card, EventHandle title) noexcept {
+    Event e;
+    e.kind = EventKind::CardTitleSet;
+    e.subject = card;
+    e.text = title;
+    return e;
+}
+
+Event Event::cardDescriptionSet(EventHandle card, EventHandle description) noexcept {
+    Event e;
+    e.kind = EventKind::CardDescriptionSet;
+    e.subject = card;
+    e.text = description;
+    return e;
+}
+
+// ============================================================================
+// DOBRA DO ESTADO
+// ============================================================================
+
+EventState::Slot& EventState::slot(EventHandle id) {
+    if (id >= slots_.size()) {
+        slots_.resize(std::max<std::size_t>(static_cast<std::size_t>(id) + 1, slots_.size() * 2));
+    }
+    return slots_[id];
+}
+
+const EventState::Slot* EventState::findSlot(EventHandle id) const noexcept {
+    return id < slots_.size() ? &slots_[id] : nullptr;
+}
+
+void EventState::reserveHandles(std::size_t count) {
+    if (count > slots_.size()) {
+        slots_.resize(count);
+    }
+}
+
+const EventState::BoardEntry* EventState::findBoard(EventHandle id) const noexcept {
+    const Slot* s = findSlot(id);
+    return s && s->board != kNone ? &boards_[s->board] : nullptr;
+}
+
+const EventState::ColumnEntry* EventState::findColumn(EventHandle id) const noexcept {
+    const Slot* s = findSlot(id);
+    return s && s->column != kNone ? &columns_[s->column] : nullptr;
+}
+
+const EventState::CardEntry* EventState::findCard(EventHandle id) const noexcept {
+    const Slot* s = findSlot(id);
+    return s && s->card != kNone ? &cards_[s->card] : nullptr;
+}
+
+/**
+ * @brief Aplica um evento conferindo as referências antes de alterar o estado
+ * @details Toda checagem acontece antes da primeira escrita: um evento
+ *          rejeitado nao deixa alteraçao parcial.
+ */
+bool EventState::apply(const Event& event) {
+    ++sequence_;
+    auto reject = [this] {
+        ++rejected_;
+        return false;
+    };
+    if (event.subject == kNoEventHandle) {
+        return reject();
+    }
+    const Slot* subject = findSlot(event.subject);
+    const Slot* target = findSlot(event.target);
+
+    switch (event.kind) {
+        case EventKind::BoardCreated: {
+            if (subject && subject->board != kNone) {
+                return reject();
+            }
+            const auto index = static_cast<std::uint32_t>(boards_.size());
+            boards_.push_back(BoardEntry{event.subject, event.text, {}});
+            slot(event.subject).board = index;
+            return true;
+        }
+        case EventKind::ColumnAdded: {
+            if ((subject && subject->column != kNone) || !target || target->board == kNone) {
+                return reject();
+            }
+            const std::uint32_t board = target->board;
+            const auto index = static_cast<std::uint32_t>(columns_.size());
+            columns_.push_back(ColumnEntry{event.subject, event.text, board, {}});
+            boards_[board].columns.push_back(index);
+            slot(event.subject).column = index;
+            return true;
+        }
+        case EventKind::CardAdded: {
+            if ((subject && subject->card != kNone) || !target || target->column == kNone) {
+                return reject();
+            }
+            const std::uint32_t column = target->column;
+            const auto index = static_cast<std::uint32_t>(cards_.size());
+            cards_.push_back(CardEntry{event.subject, event.text, kNoEventHandle, column, 0, 0, 0});
+            columns_[column].cards.push_back(index);
+            slot(event.subject).card = index;
+            return true;
+        }
+        case EventKind::CardMoved: {
+            const Slot* source = findSlot(event.source);
+            if (!subject || subject->card == kNone || !source || source->column == kNone ||
+                !target || target->column == kNone) {
+                return reject();
+            }
+            CardEntry& card = cards_[subject->card];
+            ColumnEntry& from = columns_[source->column];
+            ColumnEntry& to = columns_[target->column];
+            if (card.column != source->column || from.board != to.board) {
+                return reject();
+            }
+            const std::size_t position = locate(from.cards, subject->card, event.index);
+            if (position == from.cards.size()) {
+                return reject();
+            }
+            from.cards.erase(from.cards.begin() + static_cast<std::ptrdiff_t>(position));
+            // Posiçao de destino ausente ou além do fim: o card vai para o fim
+            const std::size_t insertAt = std::min<std::size_t>(event.text, to.cards.size());
+            to.cards.insert(to.cards.begin() + static_cast<std::ptrdiff_t>(insertAt), subject->card);
+            card.column = target->column;
+            return true;
+        }
+        case EventKind::ColumnMoved: {
+            if (!subject || subject->column == kNone || !target || target->board == kNone ||
+                columns_[subject->column].board != target->board) {
+                return reject();
+            }
+            auto& list = boards_[target->board].columns;
+            const std::size_t position = locate(list, subject->column, event.source);
+            if (position == list.size()) {
+                return reject();
+            }
+            reposition(list, position, event.index);
+            return true;
+        }
+        case EventKind::CardReordered: {
+            if (!subject || subject->card == kNone || !target || target->column == kNone ||
+                cards_[subject->card].column != target->column) {
+                return reject();
+            }
+            auto& list = columns_[target->column].cards;
+            const std::size_t position = locate(list, subject->card, event.source);
+            if (position == list.size()) {
+                return reject();
+            }
+            reposition(list, position, event.index);
+            return true;
+        }
+        case EventKind::CardTagsUpdated: {
+            if (!subject || subject->card == kNone) {
+                return reject();
+            }
+            CardEntry& card = cards_[subject->card];
+            card.firstTag = event.text;
+            card.tagCount = event.index;
+            return true;
+        }
+        case EventKind::CardPrioritySet: {
+            if (!subject || subject->card == kNone) {
+                return reject();
+            }
+            cards_[subject->card].priority = event.priority();
+            return true;
+        }
+        case EventKind::CardTitleSet: {
+            if (!subject || subject->card == kNone) {
+                return reject();
+            }
+            cards_[subject->card].title = event.text;
+            return true;
+        }
+        case EventKind::CardDescriptionSet: {
+            if (!subject || subject->card == kNone) {
+                return reject();
+            }
+            cards_[subject->card].description = event.text;
+            return true;
+        }
+    }
+    return reject();
+}
+
+/**
+ * @brief Dobra uma faixa de eventos antecipando os acessos aleatórios
+ * @details O log é lido em sequência, mas cada evento toca o slot e a
+ *          entidade do seu subject em posições arbitrárias. Os slots sao
+ *          pré-carregados kPrefetchDistance eventos à frente e as entidades
+ *          na metade dessa distância, quando o slot já deve estar no cache.
+ */
+void EventState::apply(const Event* first, const Event* last) {
+    constexpr std::ptrdiff_t kPrefetchDistance = 16;
+    for (; first != last; ++first) {
+#if defined(__GNUC__) || defined(__clang__)
+        if (last - first > kPrefetchDistance) {
+            const EventHandle ahead = first[kPrefetchDistance].subject;
+            if (ahead < slots_.size()) {
+                __builtin_prefetch(&slots_[ahead]);
+            }
+            const EventHandle near = first[kPrefetchDistance / 2].subject;
+            if (near < slots_.size() && slots_[near].card < cards_.size()) {
+                __builtin_prefetch(&cards_[slots_[near].card], 1);
+            }
+        }
+#endif
+        apply(*first);
+    }
+}
+
+// ============================================================================
+// PERSISTÊNCIA DO ESTADO
+// ============================================================================
+
+void EventState::save(std::ostream& os) const {
+    put(os, sequence_);
+    put(os, rejected_);
+    put(os, static_cast<std::uint64_t>(boards_.size()));
+    for (const auto& board : boards_) {
+        put(os, board.id);
+        put(os, board.name);
+        putBlock(os, board.columns);
+    }
+    put(os, static_cast<std::uint64_t>(columns_.size()));
+    for (const auto& column : columns_) {
+        put(os, column.id);
+        put(os, column.name);
+        put(os, column.board);
+        putBlock(os, column.cards);
+    }
+    putBlock(os, cards_);
+}
+
+/**
+ * @brief Lê o estado e refaz o índice por handle, conferindo as referências
+ */
+EventState EventState::load(std::istream& is) {
+    EventState state;
+    state.sequence_ = get<std::uint64_t>(is);
+    state.rejected_ = get<std::uint64_t>(is);
+
+    auto boardCount = get<std::uint64_t>(is);
+    for (std::uint64_t i = 0; i < boardCount; ++i) {
+        BoardEntry board;
+        board.id = get<EventHandle>(is);
+        board.name = get<EventHandle>(is);
+        board.columns = getBlock<std::uint32_t>(is);
+        state.boards_.push_back(std::move(board));
+    }
+    auto columnCount = get<std::uint64_t>(is);
+    for (std::uint64_t i = 0; i < columnCount; ++i) {
+        ColumnEntry column;
+        column.id = get<EventHandle>(is);
+        column.name = get<EventHandle>(is);
+        column.board = get<std::uint32_t>(is);
+        column.cards = getBlock<std::uint32_t>(is);
+        state.columns_.push_back(std::move(column));
+    }
+    state.cards_ = getBlock<CardEntry>(is);
+
+    auto index = [&state](EventHandle id) -> Slot& {
+        if (id == kNoEventHandle) {
+            malformed("entidade sem ID");
+        }
+        return state.slot(id);
+    };
+    for (std::uint32_t b = 0; b < state.boards_.size(); ++b) {
+        index(state.boards_[b].id).board = b;
+        for (std::uint32_t c : state.boards_[b].columns) {
+            if (c >= state.columns_.size() || state.columns_[c].board != b) {
+                malformed("coluna fora do board");
+            }
+        }
+    }
+    for (std::uint32_t c = 0; c < state.columns_.size(); ++c) {
+        index(state.columns_[c].id).column = c;
+        for (std::uint32_t k : state.columns_[c].cards) {
+            if (k >= state.cards_.size() || state.cards_[k].column != c) {
+                malformed("card fora da coluna");
+            }
+        }
+    }
+    for (std::uint32_t k = 0; k < state.cards_.size(); ++k) {
+        index(state.cards_[k].id).card = k;
+    }
+    return state;
+}
+
+// ============================================================================
+// EventStore - DICIONÁRIO
+// ============================================================================
+
+EventStore::EventStore(std::size_t snapshotInterval) : snapshotInterval_(snapshotInterval) {}
+
+/**
+ * @brief Interna uma string (ver ActivityLog::intern())
+ */
+EventHandle EventStore::intern(std::string_view key) {
+    {
+        std::shared_lock<std::shared_mutex> lock(namesMutex_);
+        auto it = handles_.find(key);
+        if (it != handles_.end()) {
+            return it->second;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(namesMutex_);
+    auto it = handles_.find(key);
+    if (it != handles_.end()) {
+        return it->second;
+    }
+    auto handle = static_cast<EventHandle>(names_.size());
+    names_.emplace_back(key);
+    handles_.emplace(std::string_view(names_.back()), handle);
+    return handle;
+}
+
+const std::string& EventStore::resolve(EventHandle handle) const {
+    static const std::string empty;
+    std::shared_lock<std::shared_mutex> lock(namesMutex_);
+    return handle < names_.size() ? names_[handle] : empty;
+}
+
+std::size_t EventStore::handleCount() const {
+    std::shared_lock<std::shared_mutex> lock(namesMutex_);
+    return names_.size();
+}
+
+std::uint32_t EventStore::appendTags(const std::vector<std::string>& tags) {
+    std::vector<EventHandle> handles;
+    handles.reserve(tags.size());
+    for (const auto& tag : tags) {
+        handles.push_back(intern(tag));
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto first = static_cast<std::uint32_t>(tagPool_.size());
+    tagPool_.insert(tagPool_.end(), handles.begin(), handles.end());
+    return first;
+}
+
+std::vector<std::string> EventStore::tags(std::uint32_t firstTag, std::uint32_t tagCount) const {
+    std::vector<std::string> result;
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (firstTag > tagPool_.size() || tagCount > tagPool_.size() - firstTag) {
+        return result;
+    }
+    result.reserve(tagCount);
+    for (std::uint32_t i = 0; i < tagCount; ++i) {
+        result.push_back(resolve(tagPool_[firstTag + i]));
+    }
+    return result;
+}
+
+// ============================================================================
+// EventStore - LOG
+// ============================================================================
+
+void EventStore::appendLocked(Event event) {
+    event.when = clock_.now();
+    events_.push_back(event);
+    current_.apply(event);
+    if (snapshotInterval_ > 0 && events_.size() % snapshotInterval_ == 0) {
+        snapshots_.push_back(current_);
+        if (snapshots_.size() > kMaxSnapshots) {
+            snapshots_.pop_front();
+        }
+    }
+}
+
+std::uint64_t EventStore::append(Event event) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    appendLocked(event);
+    return events_.size();
+}
+
+std::uint64_t EventStore::appendGroup(std::vector<Event> group) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (const auto& event : group) {
+        appendLocked(event);
+    }
+    return events_.size();
+}
+
+std::uint64_t EventStore::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return events_.size();
+}
+
+Event EventStore::at(std::uint64_t sequence) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (sequence == 0 || sequence > events_.size()) {
+        throw std::out_of_range("Evento inexistente: " + std::to_string(sequence));
+    }
+    return events_[sequence - 1];
+}
+
+void EventStore::forEach(std::uint64_t from,
+                         const std::function<void(std::uint64_t, const Event&)>& visit) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (std::uint64_t sequence = std::max<std::uint64_t>(from, 1); sequence <= events_.size(); ++sequence) {
+        visit(sequence, events_[sequence - 1]);
+    }
+}
+
+// ============================================================================
+// EventStore - ESTADO E SNAPSHOTS
+// ============================================================================
+
+EventState EventStore::state() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return current_;
+}
+
+/**
+ * @brief Snapshot mais recente até upTo e reproduçao da cauda
+ */
+EventState EventStore::replay(std::uint64_t upTo) const {
+    const std::size_t handles = handleCount();
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    upTo = std::min<std::uint64_t>(upTo, events_.size());
+
+    EventState state;
+    for (auto it = snapshots_.rbegin(); it != snapshots_.rend(); ++it) {
+        if (it->sequence() <= upTo) {
+            state = *it;
+            break;
+        }
+    }
+    state.reserveHandles(handles);
+    state.apply(events_.data() + state.sequence(), events_.data() + upTo);
+    return state;
+}
+
+std::size_t EventStore::snapshotCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return snapshots_.size();
+}
+
+// ============================================================================
+// EventStore - PERSISTÊNCIA
+// ============================================================================
+
+void EventStore::save(std::ostream& os) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::shared_lock<std::shared_mutex> namesLock(namesMutex_);
+    os.write(kMagic, sizeof(kMagic));
+    put(os, kVersion);
+    put(os, static_cast<std::uint64_t>(names_.size()));
+    for (const auto& name : names_) {
+        put(os, static_cast<std::uint32_t>(name.size()));
+        os.write(name.data(), static_cast<std::streamsize>(name.size()));
+    }
+    putBlock(os, tagPool_);
+    putBlock(os, events_);
+    current_.save(os);
+    if (!os) {
+        throw std::runtime_error("Falha ao gravar o log de eventos");
+    }
+}
+
+/**
+ * @brief Lê o log e recupera o estado a partir do snapshot gravado
+ */
+void EventStore::load(std::istream& is) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    std::unique_lock<std::shared_mutex> namesLock(namesMutex_);
+    if (!events_.empty() || !names_.empty()) {
+        throw std::runtime_error("EventStore::load requer um store vazio");
+    }
+
+    char magic[sizeof(kMagic)] = {};
+    if (!is.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), kMagic) ||
+        get<std::uint8_t>(is) != kVersion) {
+        malformed("cabeçalho inválido");
+    }
+    std::deque<std::string> names;
+    std::unordered_map<std::string_view, EventHandle> handles;
+    auto nameCount = get<std::uint64_t>(is);
+    for (std::uint64_t i = 0; i < nameCount; ++i) {
+        std::string name(get<std::uint32_t>(is), '\0');
+        if (!is.read(name.data(), static_cast<std::streamsize>(name.size()))) {
+            malformed("conteúdo truncado");
+        }
+        names.push_back(std::move(name));
+        handles.emplace(std::string_view(names.back()), static_cast<EventHandle>(i));
+    }
+    auto tagPool = getBlock<EventHandle>(is);
+    auto events = getBlock<Event>(is);
+    EventState snapshot = EventState::load(is);
+    if (snapshot.sequence() > events.size()) {
+        malformed("snapshot posterior ao log");
+    }
+
+    // Recuperaçao: snapshot gravado + eventos posteriores a ele
+    EventState current = snapshot;
+    current.reserveHandles(names.size());
+    current.apply(events.data() + current.sequence(), events.data() + events.size());
+
+    names_ = std::move(names);
+    handles_ = std::move(handles);
+    tagPool_ = std::move(tagPool);
+    events_ = std::move(events);
+    current_ = std::move(current);
+    snapshots_.clear();
+    if (snapshotInterval_ > 0) {
+        snapshots_.push_back(std::move(snapshot));
+    }
+    if (!events_.empty()) {
+        clock_.observe(events_.back().when);
+    }
+}
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,143 @@
+/**
+ * @file FlowMetrics.cpp
+ * @brief Implementaçao das métricas de fluxo (lead time, cycle time e permanência)
+ */
+
+#include "domain/FlowMetrics.h"
+#include <algorithm>
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+/// @brief Duraçao de from até to (0 se o relógio recuou)
+std::uint64_t elapsed(std::uint64_t from, std::uint64_t to) noexcept {
+    return to > from ? to - from : 0;
+}
+
+TimePoint toTimePoint(std::uint64_t ms) {
+    return TimePoint(std::chrono::milliseconds(ms));
+}
+
+} // namespace
+
+// ============================================================================
+// ATUALIZAÇaO
+// ============================================================================
+
+void FlowMetrics::registerCard(ActivityHandle card, ActivityHandle column, std::uint64_t ms) {
+    auto [it, inserted] = cards_.try_emplace(card);
+    CardState& state = it->second;
+    if (state.createdMs == kUnknown) {
+        state.createdMs = ms;
+        state.createdIn = column;
+    }
+    if (inserted) {
+        state.arrivals.emplace_back(column, ms);
+        enter(state, column, ms);
+    }
+}
+
+void FlowMetrics::record(const Activity& act) {
+    switch (act.kind()) {
+        case ActivityKind::CardMoved: {
+            const std::uint64_t ms = act.timestamp().physicalMs();
+            CardState& state = cards_[act.subject()];
+
+            // Fim da permanência na coluna onde o card estava
+            if (state.column != kNoActivityHandle) {
+                ColumnFlow& from = columns_[state.column];
+                --from.wip;
+                if (state.enteredMs != kUnknown) {
+                    from.dwell.add(elapsed(state.enteredMs, ms));
+                }
+            }
+            if (state.startedMs == kUnknown) {
+                state.startedMs = ms;
+            }
+
+            // Primeira chegada ao destino: amostras de lead e cycle time
+            const ActivityHandle to = act.toColumn();
+            auto seen = std::find_if(state.arrivals.begin(), state.arrivals.end(),
+                                     [to](const auto& arrival) { return arrival.first == to; });
+            if (seen == state.arrivals.end()) {
+                state.arrivals.emplace_back(to, ms);
+                ColumnFlow& flow = columns_[to];
+                if (state.createdMs != kUnknown) {
+                    flow.leadTime.add(elapsed(state.createdMs, ms));
+                }
+                flow.cycleTime.add(elapsed(state.startedMs, ms));
+            }
+            enter(state, to, ms);
+            break;
+        }
+        case ActivityKind::CardReordered: {
+            // A posiçao nao muda o fluxo; só localiza cards ainda desconhecidos
+            auto [it, inserted] = cards_.try_emplace(act.subject());
+            if (inserted) {
+                enter(it->second, act.toColumn(), kUnknown);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void FlowMetrics::enter(CardState& state, ActivityHandle column, std::uint64_t ms) {
+    state.column = column;
+    state.enteredMs = ms;
+    ++columns_[column].wip;
+}
+
+void FlowMetrics::clear() noexcept {
+    cards_.clear();
+    columns_.clear();
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+ColumnFlow FlowMetrics::column(ActivityHandle column) const {
+    auto it = columns_.find(column);
+    return it == columns_.end() ? ColumnFlow{} : it->second;
+}
+
+std::vector<std::pair<std::uint64_t, ActivityHandle>> FlowMetrics::creationsSince(std::uint64_t ms) const {
+    std::vector<std::pair<std::uint64_t, ActivityHandle>> creations;
+    for (const auto& [card, state] : cards_) {
+        if (state.createdMs != kUnknown && state.createdMs >= ms) {
+            creations.emplace_back(state.createdMs, state.createdIn);
+        }
+    }
+    return creations;
+}
+
+std::optional<CardFlow> FlowMetrics::card(ActivityHandle card, const ActivityLog& dictionary) const {
+    auto it = cards_.find(card);
+    if (it == cards_.end()) {
+        return std::nullopt;
+    }
+    const CardState& state = it->second;
+    CardFlow flow;
+    if (state.createdMs != kUnknown) {
+        flow.createdAt = toTimePoint(state.createdMs);
+    }
+    if (state.startedMs != kUnknown) {
+        flow.startedAt = toTimePoint(state.startedMs);
+    }
+    if (state.enteredMs != kUnknown) {
+        flow.enteredAt = toTimePoint(state.enteredMs);
+    }
+    flow.column = dictionary.resolve(state.column);
+    flow.arrivals.reserve(state.arrivals.size());
+    for (const auto& [column, ms] : state.arrivals) {
+        flow.arrivals.emplace_back(dictionary.resolve(column), toTimePoint(ms));
+    }
+    return flow;
+}
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,352 @@
+/**
+ * @file FuzzyIndex.cpp
+ * @brief Implementaçao do índice de trigramas para busca aproximada nos títulos
+ */
+
+#include "domain/FuzzyIndex.h"
+#include "domain/Card.h"
+#include "domain/TextTokenizer.h"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <mutex>
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+/// @brief Postings obsoletos tolerados antes da primeira compactaçao
+constexpr std::size_t kMinStaleForCompaction = 4096;
+
+/// @brief Marcador de início de palavra nos trigramas
+constexpr unsigned char kWordStart = 0x01;
+
+std::uint32_t packGram(unsigned char a, unsigned char b, unsigned char c) noexcept {
+    return (static_cast<std::uint32_t>(a) << 16) | (static_cast<std::uint32_t>(b) << 8) | c;
+}
+
+/// @brief Geraçao de documentos livres (nenhum posting a tem)
+constexpr std::uint32_t kDeadGeneration = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * @brief Trigramas distintos da palavra, com dois marcadores de início
+ * @details "tela" gera "\x01\x01t", "\x01te", "tel" e "ela". O primeiro
+ *          trigrama sobrevive a qualquer erro que nao esteja na primeira
+ *          letra, de modo que palavras curtas com um erro no meio ainda
+ *          encontram candidatas.
+ */
+std::vector<std::uint32_t> gramsOf(const std::string& word) {
+    std::vector<std::uint32_t> grams;
+    if (word.empty()) {
+        return grams;
+    }
+    auto byte = [&word](std::size_t i) { return static_cast<unsigned char>(word[i]); };
+    grams.push_back(packGram(kWordStart, kWordStart, byte(0)));
+    if (word.size() >= 2) {
+        grams.push_back(packGram(kWordStart, byte(0), byte(1)));
+    }
+    for (std::size_t i = 0; i + 2 < word.size(); ++i) {
+        grams.push_back(packGram(byte(i), byte(i + 1), byte(i + 2)));
+    }
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+} // namespace
+
+// ============================================================================
+// DISTÂNCIA DE EDIÇaO
+// ============================================================================
+
+int FuzzyIndex::maxEdits(std::size_t wordLength) noexcept {
+    if (wordLength <= 2) return 0;
+    if (wordLength <= 5) return 1;
+    return 2;
+}
+
+/**
+ * @details Distância "optimal string alignment" (cada trecho editado uma vez)
+ *          entre word e text[0, j), mínima sobre j. Só as colunas até
+ *          |word| + bound podem ficar dentro do limite; a linha é abandonada
+ *          assim que todo valor dela passa de bound. Palavras sao limitadas a
+ *          kMaxTokenBytes, como as produzidas por tokenize().
+ */
+int FuzzyIndex::prefixDistance(const std::string& word, const std::string& text, int bound) {
+    const std::size_t m = std::min(word.size(), kMaxTokenBytes);
+    const std::size_t n = std::min({text.size(), kMaxTokenBytes, m + static_cast<std::size_t>(bound)});
+    if (m == 0) {
+        return 0;
+    }
+
+    std::array<int, kMaxTokenBytes + 1> rows[3];
+    int* before = rows[0].data();     // linha i - 2
+    int* previous = rows[1].data();   // linha i - 1
+    int* current = rows[2].data();
+    for (std::size_t j = 0; j <= n; ++j) {
+        previous[j] = static_cast<int>(j);
+    }
+
+    for (std::size_t i = 1; i <= m; ++i) {
+        current[0] = static_cast<int>(i);
+        int rowMin = current[0];
+        for (std::size_t j = 1; j <= n; ++j) {
+            int cost = word[i - 1] == text[j - 1] ? 0 : 1;
+            int value = std::min({previous[j] + 1, current[j - 1] + 1, previous[j - 1] + cost});
+            if (i > 1 && j > 1 && word[i - 1] == text[j - 2] && word[i - 2] == text[j - 1]) {
+                value = std::min(value, before[j - 2] + 1);
+            }
+            current[j] = value;
+            rowMin = std::min(rowMin, value);
+        }
+        if (rowMin > bound) {
+            return bound + 1;
+        }
+        std::swap(before, previous);
+        std::swap(previous, current);
+    }
+
+    int best = *std::min_element(previous, previous + n + 1);
+    return std::min(best, bound + 1);
+}
+
+// ============================================================================
+// ATUALIZAÇaO
+// ============================================================================
+
+void FuzzyIndex::add(const std::string& boardId, const Card& card) {
+    std::vector<std::string> tokens = tokenize(card.title());
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    std::uint32_t index = 0;
+    auto it = byCard_.find(card.id());
+    if (it != byCard_.end()) {
+        index = it->second;
+        unindexLocked(documents_[index]);
+    } else if (!freeDocuments_.empty()) {
+        index = freeDocuments_.back();
+        freeDocuments_.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(documents_.size());
+        documents_.emplace_back();
+        generations_.push_back(kDeadGeneration);
+    }
+
+    Document& document = documents_[index];
+    document.cardId = card.id();
+    document.boardId = boardId;
+    document.alive = true;
+    byCard_[card.id()] = index;
+    indexLocked(index, tokens);
+    compactLocked();
+}
+
+void FuzzyIndex::remove(const std::string& cardId) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = byCard_.find(cardId);
+    if (it == byCard_.end()) {
+        return;
+    }
+    Document& document = documents_[it->second];
+    unindexLocked(document);
+    document.alive = false;
+    document.cardId.clear();
+    document.boardId.clear();
+    generations_[it->second] = kDeadGeneration;
+    freeDocuments_.push_back(it->second);
+    byCard_.erase(it);
+    compactLocked();
+}
+
+void FuzzyIndex::onCardTextChanged(const Card& card) {
+    std::vector<std::string> tokens = tokenize(card.title());
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = byCard_.find(card.id());
+    if (it == byCard_.end() || documents_[it->second].tokens == tokens) {
+        return;   // nao indexado, ou só a descriçao mudou
+    }
+    unindexLocked(documents_[it->second]);
+    indexLocked(it->second, tokens);
+    compactLocked();
+}
+
+/**
+ * @brief ID da palavra no vocabulário, incluindo-a (e seus trigramas) se nova
+ */
+std::uint32_t FuzzyIndex::wordIdLocked(const std::string& text) {
+    auto it = wordIds_.find(text);
+    if (it != wordIds_.end()) {
+        return it->second;
+    }
+    auto id = static_cast<std::uint32_t>(words_.size());
+    words_.push_back(Word{text, {}, 0});
+    wordIds_.emplace(text, id);
+    for (std::uint32_t gram : gramsOf(text)) {
+        grams_[gram].push_back(id);
+    }
+    return id;
+}
+
+/**
+ * @brief Acrescenta os postings da geraçao atual do documento
+ */
+void FuzzyIndex::indexLocked(std::uint32_t index, std::vector<std::string>& tokens) {
+    Document& document = documents_[index];
+    for (const auto& token : tokens) {
+        document.words.push_back(wordIdLocked(token));
+    }
+    std::sort(document.words.begin(), document.words.end());
+    document.words.erase(std::unique(document.words.begin(), document.words.end()), document.words.end());
+    for (std::uint32_t id : document.words) {
+        words_[id].postings.push_back(Posting{index, document.generation});
+        ++words_[id].documents;
+    }
+    document.tokens = std::move(tokens);
+    generations_[index] = document.generation;
+    livePostings_ += document.words.size();
+}
+
+/**
+ * @brief Invalida os postings da versao atual do documento
+ */
+void FuzzyIndex::unindexLocked(Document& document) {
+    for (std::uint32_t id : document.words) {
+        --words_[id].documents;
+    }
+    livePostings_ -= document.words.size();
+    stalePostings_ += document.words.size();
+    document.words.clear();
+    document.tokens.clear();
+    ++document.generation;
+}
+
+/**
+ * @brief Remove os postings obsoletos quando eles passam dos válidos
+ * @details Palavras que deixaram de aparecer ficam no vocabulário, sem
+ *          postings, e sao ignoradas na consulta.
+ */
+void FuzzyIndex::compactLocked() {
+    if (stalePostings_ < kMinStaleForCompaction || stalePostings_ <= livePostings_) {
+        return;
+    }
+    for (auto& word : words_) {
+        word.postings.erase(std::remove_if(word.postings.begin(), word.postings.end(),
+                                           [this](const Posting& p) {
+                                               return generations_[p.document] != p.generation;
+                                           }),
+                            word.postings.end());
+    }
+    stalePostings_ = 0;
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+std::vector<SearchHit> FuzzyIndex::search(const std::string& query, std::size_t limit) const {
+    std::vector<std::string> tokens = tokenize(query);
+    std::sort(tokens.begin(), tokens.end());
+    tokens.erase(std::unique(tokens.begin(), tokens.end()), tokens.end());
+    if (tokens.size() > kMaxQueryWords) {
+        tokens.resize(kMaxQueryWords);
+    }
+    std::size_t queryBytes = 0;
+    for (const auto& token : tokens) {
+        queryBytes += token.size();
+    }
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<SearchHit> hits;
+    if (tokens.empty() || limit == 0 || byCard_.empty()) {
+        return hits;
+    }
+
+    // Fase 1: palavras do vocabulário aprovadas para cada palavra da consulta,
+    // da mais próxima para a mais distante
+    std::vector<std::vector<std::pair<int, std::uint32_t>>> matches(tokens.size());
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        const std::string& token = tokens[i];
+        const int bound = maxEdits(token.size());
+        std::vector<std::uint32_t> candidates;
+        for (std::uint32_t gram : gramsOf(token)) {
+            auto it = grams_.find(gram);
+            if (it != grams_.end()) {
+                candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        for (std::uint32_t id : candidates) {
+            if (words_[id].documents == 0) {
+                continue;
+            }
+            int distance = prefixDistance(token, words_[id].text, bound);
+            if (distance <= bound) {
+                matches[i].emplace_back(distance, id);
+            }
+        }
+        if (matches[i].empty()) {
+            return hits;
+        }
+        std::sort(matches[i].begin(), matches[i].end());
+    }
+
+    // Fase 2: cards com alguma palavra aprovada para cada palavra da consulta.
+    // A palavra i só avança cards que já casaram as anteriores; como as
+    // aprovadas vêm em ordem de distância, a primeira que avança o card é a
+    // mais próxima.
+    std::vector<std::uint8_t> matched(documents_.size(), 0);
+    std::vector<std::uint16_t> edits(documents_.size(), 0);
+    std::vector<std::uint32_t> found;
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        const bool last = i + 1 == tokens.size();
+        std::size_t advanced = 0;
+        for (const auto& match : matches[i]) {
+            for (const Posting& posting : words_[match.second].postings) {
+                if (generations_[posting.document] != posting.generation || matched[posting.document] != i) {
+                    continue;   // posting obsoleto, ou card que nao casou as palavras anteriores
+                }
+                matched[posting.document] = static_cast<std::uint8_t>(i + 1);
+                edits[posting.document] = static_cast<std::uint16_t>(edits[posting.document] + match.first);
+                ++advanced;
+                if (last) {
+                    found.push_back(posting.document);
+                }
+            }
+        }
+        if (advanced == 0) {
+            return hits;
+        }
+    }
+
+    auto better = [&](std::uint32_t a, std::uint32_t b) {
+        if (edits[a] != edits[b]) return edits[a] < edits[b];
+        return documents_[a].cardId < documents_[b].cardId;
+    };
+    std::size_t top = std::min(limit, found.size());
+    std::partial_sort(found.begin(), found.begin() + static_cast<std::ptrdiff_t>(top), found.end(), better);
+
+    hits.reserve(top);
+    for (std::size_t i = 0; i < top; ++i) {
+        const Document& document = documents_[found[i]];
+        double score = 1.0 - static_cast<double>(edits[found[i]]) / static_cast<double>(queryBytes);
+        hits.push_back(SearchHit{document.cardId, document.boardId, score});
+    }
+    return hits;
+}
+
+std::size_t FuzzyIndex::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return byCard_.size();
+}
+
+std::size_t FuzzyIndex::wordCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return static_cast<std::size_t>(std::count_if(words_.begin(), words_.end(),
+                                                   [](const Word& word) { return word.documents > 0; }));
+}
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,109 @@
+/**
+ * @file HybridClock.cpp
+ * @brief Implementaçao do relógio lógico híbrido (HLC)
+ * @details Contém a conversao entre HybridTimestamp e TimePoint e o laço de
+ *          compare-and-swap que garante monotonicidade do HybridClock.
+ */
+
+#include "domain/HybridClock.h"
+#include <algorithm>
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+/**
+ * @brief Lê o tempo físico atual em milissegundos desde a época Unix
+ */
+std::uint64_t physicalNowMs() noexcept {
+    auto since = std::chrono::system_clock::now().time_since_epoch();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(since).count();
+    return ms > 0 ? static_cast<std::uint64_t>(ms) : 0u;
+}
+
+} // namespace
+
+// ============================================================================
+// IMPLEMENTAÇaO DA CLASSE HybridTimestamp
+// ============================================================================
+
+/**
+ * @brief Converte um TimePoint em HybridTimestamp com contador lógico zero
+ * @param tp Momento físico a ser convertido
+ * @return Timestamp equivalente (precisao de milissegundos)
+ */
+HybridTimestamp HybridTimestamp::fromTimePoint(std::chrono::system_clock::time_point tp) noexcept {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(tp.time_since_epoch()).count();
+    std::uint64_t physical = ms > 0 ? static_cast<std::uint64_t>(ms) : 0u;
+    return HybridTimestamp(physical << kLogicalBits);
+}
+
+/**
+ * @brief Converte o timestamp para TimePoint da system_clock
+ * @return Momento físico, descartando o contador lógico
+ */
+std::chrono::system_clock::time_point HybridTimestamp::toTimePoint() const noexcept {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::milliseconds(static_cast<std::int64_t>(physicalMs()))));
+}
+
+/**
+ * @brief Formata o timestamp como "<ms>.<lógico>"
+ */
+std::ostream& operator<<(std::ostream& os, HybridTimestamp ts) {
+    os << ts.physicalMs() << '.' << ts.logical();
+    return os;
+}
+
+// ============================================================================
+// IMPLEMENTAÇaO DA CLASSE HybridClock
+// ============================================================================
+
+/**
+ * @brief Gera um novo timestamp estritamente crescente
+ * @details Se o tempo físico avançou, o contador lógico é zerado; caso
+ *          contrário (mesmo milissegundo ou relógio retrocedendo), o valor
+ *          anterior é incrementado em uma unidade lógica.
+ */
+HybridTimestamp HybridClock::now() noexcept {
+    const std::uint64_t physical = physicalNowMs() << HybridTimestamp::kLogicalBits;
+    std::uint64_t previous = last_.load(std::memory_order_relaxed);
+    std::uint64_t next;
+    do {
+        next = physical > previous ? physical : previous + 1;
+    } while (!last_.compare_exchange_weak(previous, next,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed));
+    return HybridTimestamp(next);
+}
+
+/**
+ * @brief Avança o relógio para além de um timestamp observado
+ * @param observed Timestamp vindo de outra origem
+ * @return Timestamp local maior que observed, que o último emitido e
+ *         nao inferior ao tempo físico atual
+ */
+HybridTimestamp HybridClock::observe(HybridTimestamp observed) noexcept {
+    const std::uint64_t physical = physicalNowMs() << HybridTimestamp::kLogicalBits;
+    std::uint64_t previous = last_.load(std::memory_order_relaxed);
+    std::uint64_t next;
+    do {
+        std::uint64_t floor = std::max(previous, observed.packed());
+        next = physical > floor ? physical : floor + 1;
+    } while (!last_.compare_exchange_weak(previous, next,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_relaxed));
+    return HybridTimestamp(next);
+}
+
+/**
+ * @brief Retorna o último timestamp emitido
+ */
+HybridTimestamp HybridClock::last() const noexcept {
+    return HybridTimestamp(last_.load(std::memory_order_acquire));
+}
+
+} // namespace domain
+} // namespace kanban
@@ -0,0 +1,323 @@
+/**
+ * @file PrefixTrie.cpp
+ * @brief Implementaçao da trie radix com top-K por nó
+ */
+
+#include "domain/PrefixTrie.h"
+#include "domain/TextTokenizer.h"
+#include <algorithm>
+
+namespace kanban {
+namespace domain {
+
+/**
+ * @brief Nó da trie: rótulo da aresta que chega a ele, filhos ordenados
+ *        pelo primeiro byte do rótulo e as melhores entradas da subárvore
+ */
+struct PrefixTrie::Node {
+    std::string label;
+    std::vector<std::unique_ptr<Node>> children;
+    std::vector<std::uint32_t> entries;   ///< @brief Entradas cuja chave termina aqui
+    std::vector<std::uint32_t> top;       ///< @brief Até kCachedTop, da melhor para a pior
+
+    /// @brief Posiçao do filho cujo rótulo começa com c (ou onde inseri-lo)
+    std::size_t childSlot(char c) const noexcept {
+        auto it = std::lower_bound(children.begin(), children.end(), c,
+                                   [](const std::unique_ptr<Node>& child, char value) {
+                                       return static_cast<unsigned char>(child->label[0]) <
+                                              static_cast<unsigned char>(value);
+                                   });
+        return static_cast<std::size_t>(it - children.begin());
+    }
+
+    /// @brief Filho cujo rótulo começa com c, ou nullptr
+    Node* child(char c) const noexcept {
+        std::size_t slot = childSlot(c);
+        return (slot < children.size() && children[slot]->label[0] == c) ? children[slot].get() : nullptr;
+    }
+};
+
+namespace {
+
+bool contains(const std::vector<std::uint32_t>& list, std::uint32_t value) {
+    return std::find(list.begin(), list.end(), value) != list.end();
+}
+
+} // namespace
+
+PrefixTrie::PrefixTrie() : root_(std::make_unique<Node>()) {}
+PrefixTrie::~PrefixTrie() = default;
+PrefixTrie::PrefixTrie(PrefixTrie&&) noexcept = default;
+PrefixTrie& PrefixTrie::operator=(PrefixTrie&&) noexcept = default;
+
+// ============================================================================
+// ATUALIZAÇaO
+// ============================================================================
+
+void PrefixTrie::insert(const std::string& id, const std::string& text, CompletionRank rank) {
+    std::string key = foldText(text);
+
+    auto existing = byId_.find(id);
+    if (existing != byId_.end()) {
+        std::uint32_t slot = existing->second;
+        Entry& entry = entries_[slot];
+        if (entry.key == key) {
+            // Mesma posiçao na trie: só o rank (e a grafia) mudam
+            bool raised = !(rank < entry.rank);
+            entry.text = text;
+            entry.rank = rank;
+            auto path = pathTo(key);
+            if (raised) {
+                promote(path, slot);
+            } else {
+                for (auto it = path.rbegin(); it != path.rend(); ++it) {
+                    if (contains((*it)->top, slot)) {
+                        recompute(**it);
+                    }
+                }
+            }
+            return;
+        }
+        remove(slot);
+    }
+
+    std::uint32_t slot = 0;
+    if (!freeEntries_.empty()) {
+        slot = freeEntries_.back();
+        freeEntries_.pop_back();
+    } else {
+        slot = static_cast<std::uint32_t>(entries_.size());
+        entries_.emplace_back();
+    }
+    entries_[slot] = Entry{id, text, key, rank};
+    byId_[id] = slot;
+
+    // Desce pela chave, criando ou dividindo arestas
+    std::vector<Node*> path{root_.get()};
+    Node* node = root_.get();
+    std::size_t i = 0;
+    while (i < key.size()) {
+        std::size_t position = node->childSlot(key[i]);
+        if (position == node->children.size() || node->children[position]->label[0] != key[i]) {
+            auto leaf = std::make_unique<Node>();
+            leaf->label = key.substr(i);
+            node = node->children.insert(node->children.begin() + static_cast<std::ptrdiff_t>(position),
+                                         std::move(leaf))->get();
+            path.push_back(node);
+            break;
+        }
+
+        std::unique_ptr<Node>& child = node->children[position];
+        std::size_t common = 0;
+        while (common < child->label.size() && i + common < key.size() &&
+               child->label[common] == key[i + common]) {
+            ++common;
+        }
+        if (common < child->label.size()) {
+            auto middle = std::make_unique<Node>();
+            middle->label = child->label.substr(0, common);
+            middle->top = child->top;
+            child->label.erase(0, common);
+            middle->children.push_back(std::move(child));
+            child = std::move(middle);
+        }
+        node = child.get();
+        path.push_back(node);
+        i += common;
+    }
+
+    node->entries.push_back(slot);
+    promote(path, slot);
+}
+
+bool PrefixTrie::erase(const std::string& id) {
+    auto it = byId_.find(id);
+    if (it == byId_.end()) {
+        return false;
+    }
+    remove(it->second);
+    return true;
+}
+
+/**
+ * @brief Remove a entrada, poda nós vazios, funde cadeias e refaz os top-K
+ */
+void PrefixTrie::remove(std::uint32_t slot) {
+    Entry& entry = entries_[slot];
+    auto path = pathTo(entry.key);
+    Node* target = path.back();
+    target->entries.erase(std::find(target->entries.begin(), target->entries.end(), slot));
+
+    for (std::size_t k = path.size() - 1; k >= 1; --k) {
+        Node* node = path[k];
+        Node* parent = path[k - 1];
+        if (node->entries.empty() && node->children.empty()) {
+            parent->children.erase(parent->children.begin() +
+                                   static_cast<std::ptrdiff_t>(parent->childSlot(node->label[0])));
+            continue;
+        }
+        if (node->entries.empty() && node->children.size() == 1) {
+            // Nó sem entradas com um único filho: funde as arestas
+            std::unique_ptr<Node> only = std::move(node->children[0]);
+            node->label += only->label;
+            node->children = std::move(only->children);
+            node->entries = std::move(only->entries);
+            node->top = std::move(only->top);
+            continue;
+        }
+        if (contains(node->top, slot)) {
+            recompute(*node);
+        }
+    }
+    if (contains(root_->top, slot)) {
+        recompute(*root_);
+    }
+
+    byId_.erase(entry.id);
+    entry = Entry{};
+    freeEntries_.push_back(slot);
+}
+
+/**
+ * @brief Insere (ou reposiciona) a entrada no top-K de cada nó do caminho
+ * @details Válido quando o rank da entrada só aumentou: nenhuma outra
+ *          entrada pode ter passado à frente dela.
+ */
+void PrefixTrie::promote(const std::vector<Node*>& path, std::uint32_t slot) {
+    for (Node* node : path) {
+        auto& top = node->top;
+        auto present = std::find(top.begin(), top.end(), slot);
+        if (present != top.end()) {
+            top.erase(present);
+        }
+        auto position = std::lower_bound(top.begin(), top.end(), slot,
+                                         [this](std::uint32_t a, std::uint32_t b) { return better(a, b); });
+        if (top.size() < kCachedTop || position != top.end()) {
+            top.insert(position, slot);
+            if (top.size() > kCachedTop) {
+                top.pop_back();
+            }
+        }
+    }
+}
+
+/**
+ * @brief Refaz o top-K do nó a partir das suas entradas e dos filhos
+ */
+void PrefixTrie::recompute(Node& node) {
+    std::vector<std::uint32_t> candidates(node.entries);
+    for (const auto& child : node.children) {
+        candidates.insert(candidates.end(), child->top.begin(), child->top.end());
+    }
+    auto order = [this](std::uint32_t a, std::uint32_t b) { return better(a, b); };
+    if (candidates.size() > kCachedTop) {
+        std::partial_sort(candidates.begin(), candidates.begin() + kCachedTop, candidates.end(), order);
+        candidates.resize(kCachedTop);
+    } else {
+        std::sort(candidates.begin(), candidates.end(), order);
+    }
+    node.top = std::move(candidates);
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+std::vector<Completion> PrefixTrie::complete(const std::string& prefix, std::size_t limit) const {
+    std::vector<Completion> result;
+    std::string key = foldText(prefix);
+
+    // Desce pelo prefixo; ele pode terminar no meio de uma aresta
+    const Node* node = root_.get();
+    std::size_t i = 0;
+    while (i < key.size()) {
+        const Node* child = node->child(key[i]);
+        if (child == nullptr) {
+            return result;
+        }
+        std::size_t n = std::min(child->label.size(), key.size() - i);
+        if (child->label.compare(0, n, key, i, n) != 0) {
+            return result;
+        }
+        i += n;
+        node = child;
+    }
+
+    std::vector<std::uint32_t> slots;
+    if (limit <= kCachedTop || node->top.size() < kCachedTop) {
+        slots.assign(node->top.begin(), node->top.begin() + static_cast<std::ptrdiff_t>(std::min(limit, node->top.size())));
+    } else {
+        collect(*node, slots);
+        auto order = [this](std::uint32_t a, std::uint32_t b) { return better(a, b); };
+        std::size_t top = std::min(limit, slots.size());
+        std::partial_sort(slots.begin(), slots.begin() + static_cast<std::ptrdiff_t>(top), slots.end(), order);
+        slots.resize(top);
+    }
+
+    result.reserve(slots.size());
+    for (std::uint32_t slot : slots) {
+        result.push_back(Completion{entries_[slot].id, entries_[slot].text});
+    }
+    return result;
+}
+
+std::vector<Completion> PrefixTrie::entries() const {
+    std::vector<std::uint32_t> slots;
+    collect(*root_, slots);
+    std::vector<Completion> result;
+    result.reserve(slots.size());
+    for (std::uint32_t slot : slots) {
+        result.push_back(Completion{entries_[slot].id, entries_[slot].text});
+    }
+    return result;
+}
+
+/**
+ * @brief Entradas da subárvore em ordem alfabética da chave (DFS)
+ */
+void PrefixTrie::collect(const Node& node, std::vector<std::uint32_t>& out) const {
+    std::size_t first = out.size();
+    out.insert(out.end(), node.entries.begin(), node.entries.end());
+    std::sort(out.begin() + static_cast<std::ptrdiff_t>(first), out.end(),
+              [this](std::uint32_t a, std::uint32_t b) { return entries_[a].id < entries_[b].id; });
+    for (const auto& child : node.children) {
+        collect(*child, out);
+    }
+}
+
+// ============================================================================
+// AUXILIARES
+// ============================================================================
+
+/**
+ * @brief Ordem do top-K: rank decrescente, depois ID crescente
+ */
+bool PrefixTrie::better(std::uint32_t a, std::uint32_t b) const noexcept {
+    const Entry& x = entries_[a];
+    const Entry& y = entries_[b];
+    if (y.rank < x.rank) return true;
+    if (x.rank < y.rank) return false;
+    return x.id < y.id;
+}
+
+/**
+ * @brief Nós da raiz até o nó cuja chave é exatamente key
+ */
+std::vector<PrefixTrie::Node*> PrefixTrie::pathTo(const std::string& key) const {
+    std::vector<Node*> path{root_.get()};
+    Node* node = root_.get();
+    std::size_t i = 0;
+    while (i < key.size()) {
+        Node* child = node->child(key[i]);
+        if (child == nullptr || key.compare(i, child->label.size(), child->label) != 0) {
+            return {};
+        }
+        i += child->label.size();
+        node = child;
+        path.push_back(node);
+    }
+    return path;
+}
+
+} // namespace domain
+} // namespace kanban
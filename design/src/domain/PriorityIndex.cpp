@@ -0,0 +1,92 @@
+/**
+ * @file PriorityIndex.cpp
+ * @brief Implementaçao do índice ordenado de cards por urgência
+ */
+
+#include "domain/PriorityIndex.h"
+#include <algorithm>
+#include <mutex>
+
+namespace kanban {
+namespace domain {
+
+/**
+ * @brief Mesma ordem de Card::operator<, com o ID como desempate final
+ */
+bool PriorityIndex::Key::operator<(const Key& other) const noexcept {
+    if (priority != other.priority) {
+        return priority > other.priority;
+    }
+    if (createdAt != other.createdAt) {
+        return createdAt < other.createdAt;
+    }
+    return cardId < other.cardId;
+}
+
+PriorityIndex::Key PriorityIndex::keyOf(const std::shared_ptr<Card>& card) {
+    return Key{card->priority(), card->createdAt(), card->id(), card};
+}
+
+// ============================================================================
+// ATUALIZAÇaO
+// ============================================================================
+
+void PriorityIndex::add(const std::shared_ptr<Card>& card) {
+    Key key = keyOf(card);
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = positions_.find(card->id());
+    if (it != positions_.end()) {
+        order_.erase(it->second);
+        it->second = order_.insert(std::move(key)).first;
+    } else {
+        positions_.emplace(card->id(), order_.insert(std::move(key)).first);
+    }
+}
+
+void PriorityIndex::update(const Card& card) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = positions_.find(card.id());
+    if (it == positions_.end()) {
+        return;
+    }
+    const Key& current = *it->second;
+    if (current.priority == card.priority() && current.createdAt == card.createdAt()) {
+        return;   // nenhuma mudança de ordem (ex.: só as tags mudaram)
+    }
+    Key key = keyOf(current.card);
+    order_.erase(it->second);
+    it->second = order_.insert(std::move(key)).first;
+}
+
+void PriorityIndex::remove(const std::string& cardId) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = positions_.find(cardId);
+    if (it == positions_.end()) {
+        return;
+    }
+    order_.erase(it->second);
+    positions_.erase(it);
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+std::vector<std::shared_ptr<Card>> PriorityIndex::top(std::size_t k) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::shared_ptr<Card>> cards;
+    cards.reserve(std::min(k, order_.size()));
+    for (auto it = order_.begin(); it != order_.end() && cards.size() < k; ++it) {
+        cards.push_back(it->card);
+    }
+    return cards;
+}
+
+std::size_t PriorityIndex::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return positions_.size();
+}
+
+} // namespace domain
+} // namespace kanban
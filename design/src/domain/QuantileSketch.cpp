@@ -0,0 +1,116 @@
+/**
+ * @file QuantileSketch.cpp
+ * @brief Implementaçao do sketch de quantis com erro relativo limitado
+ */
+
+#include "domain/QuantileSketch.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace kanban {
+namespace domain {
+
+QuantileSketch::QuantileSketch(double relativeAccuracy) {
+    if (!(relativeAccuracy > 0.0 && relativeAccuracy < 1.0)) {
+        throw std::invalid_argument("Precisao relativa deve estar em (0, 1)");
+    }
+    gamma_ = (1.0 + relativeAccuracy) / (1.0 - relativeAccuracy);
+    logGamma_ = std::log(gamma_);
+}
+
+// ============================================================================
+// ATUALIZAÇaO
+// ============================================================================
+
+void QuantileSketch::add(std::uint64_t ms) {
+    if (ms == 0) {
+        ++zeros_;
+    } else {
+        std::size_t bucket = bucketOf(ms);
+        if (bucket >= buckets_.size()) {
+            buckets_.resize(bucket + 1, 0);
+        }
+        ++buckets_[bucket];
+    }
+    min_ = count_ == 0 ? ms : std::min(min_, ms);
+    max_ = std::max(max_, ms);
+    sum_ += ms;
+    ++count_;
+}
+
+void QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.count_ == 0) {
+        return;
+    }
+    if (other.buckets_.size() > buckets_.size()) {
+        buckets_.resize(other.buckets_.size(), 0);
+    }
+    for (std::size_t i = 0; i < other.buckets_.size(); ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+    zeros_ += other.zeros_;
+    min_ = count_ == 0 ? other.min_ : std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    sum_ += other.sum_;
+    count_ += other.count_;
+}
+
+void QuantileSketch::clear() noexcept {
+    buckets_.clear();
+    zeros_ = 0;
+    count_ = 0;
+    min_ = 0;
+    max_ = 0;
+    sum_ = 0;
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+std::uint64_t QuantileSketch::quantile(double q) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    if (q <= 0.0) {
+        return min_;
+    }
+    if (q >= 1.0) {
+        return max_;
+    }
+
+    // Posiçao (base 0) da amostra procurada na sequência ordenada
+    auto rank = static_cast<std::uint64_t>(q * static_cast<double>(count_ - 1));
+    if (rank < zeros_) {
+        return 0;
+    }
+    std::uint64_t seen = zeros_;
+    for (std::size_t i = 0; i < buckets_.size(); ++i) {
+        seen += buckets_[i];
+        if (seen > rank) {
+            return std::clamp(valueOf(i), min_, max_);
+        }
+    }
+    return max_;
+}
+
+double QuantileSketch::mean() const noexcept {
+    return count_ == 0 ? 0.0 : static_cast<double>(sum_ / count_);
+}
+
+std::size_t QuantileSketch::bucketOf(std::uint64_t ms) const {
+    return static_cast<std::size_t>(std::ceil(std::log(static_cast<double>(ms)) / logGamma_));
+}
+
+/**
+ * @brief Representante do bucket: ponto que minimiza o erro relativo
+ *        em (gamma^(i-1), gamma^i]
+ */
+std::uint64_t QuantileSketch::valueOf(std::size_t bucket) const {
+    double upper = std::exp(static_cast<double>(bucket) * logGamma_);
+    return static_cast<std::uint64_t>(std::llround(2.0 * upper / (gamma_ + 1.0)));
+}
+
+} // namespace domain
+} // namespace kanban
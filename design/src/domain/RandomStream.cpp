@@ -0,0 +1,61 @@
+/**
+ * @file RandomStream.cpp
+ * @brief Implementaçao do gerador xoshiro256**
+ */
+
+#include "domain/RandomStream.h"
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+/// @brief Um passo do splitmix64 (expansao da semente)
+std::uint64_t splitMix64(std::uint64_t& x) noexcept {
+    std::uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/// @brief Polinômio de salto de 2^128 posições
+constexpr std::uint64_t kJump[] = {
+    0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+};
+
+} // namespace
+
+RandomStream::RandomStream(std::uint64_t seed) noexcept {
+    for (auto& word : state_) {
+        word = splitMix64(seed);
+    }
+}
+
+void RandomStream::jump() noexcept {
+    std::array<std::uint64_t, 4> jumped{};
+    for (std::uint64_t word : kJump) {
+        for (int bit = 0; bit < 64; ++bit) {
+            if (word & (std::uint64_t{1} << bit)) {
+                for (std::size_t i = 0; i < jumped.size(); ++i) {
+                    jumped[i] ^= state_[i];
+                }
+            }
+            next();
+        }
+    }
+    state_ = jumped;
+}
+
+std::vector<RandomStream> RandomStream::streams(std::uint64_t seed, std::size_t count) {
+    std::vector<RandomStream> result;
+    result.reserve(count);
+    RandomStream current(seed);
+    for (std::size_t i = 0; i < count; ++i) {
+        result.push_back(current);
+        current.jump();
+    }
+    return result;
+}
+
+} // namespace domain
+} // namespace kanban
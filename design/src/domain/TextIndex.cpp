@@ -0,0 +1,226 @@
+/**
+ * @file TextIndex.cpp
+ * @brief Implementaçao do índice invertido de texto completo dos cards
+ */
+
+#include "domain/TextIndex.h"
+#include "domain/Card.h"
+#include "domain/TextTokenizer.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <utility>
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+/// @brief Parâmetros do BM25
+constexpr double kK1 = 1.2;
+constexpr double kB = 0.75;
+
+/// @brief Postings obsoletos tolerados antes da primeira compactaçao
+constexpr std::size_t kMinStaleForCompaction = 4096;
+
+} // namespace
+
+// ============================================================================
+// ATUALIZAÇaO
+// ============================================================================
+
+/**
+ * @brief Termos distintos do card com suas ocorrências ponderadas
+ * @details Calculado fora do lock do índice.
+ */
+TextIndex::WeightedTerms TextIndex::weighTerms(const Card& card) {
+    std::unordered_map<std::string, float> weights;
+    for (auto& token : tokenize(card.title())) {
+        weights[std::move(token)] += kTitleWeight;
+    }
+    if (card.description()) {
+        for (auto& token : tokenize(*card.description())) {
+            weights[std::move(token)] += 1.0f;
+        }
+    }
+    return WeightedTerms(std::make_move_iterator(weights.begin()), std::make_move_iterator(weights.end()));
+}
+
+void TextIndex::add(const std::string& boardId, const Card& card) {
+    WeightedTerms weighted = weighTerms(card);
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    std::uint32_t index = 0;
+    auto it = byCard_.find(card.id());
+    if (it != byCard_.end()) {
+        index = it->second;
+        unindexLocked(documents_[index]);
+    } else if (!freeDocuments_.empty()) {
+        index = freeDocuments_.back();
+        freeDocuments_.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(documents_.size());
+        documents_.emplace_back();
+    }
+
+    Document& document = documents_[index];
+    document.cardId = card.id();
+    document.boardId = boardId;
+    document.alive = true;
+    byCard_[card.id()] = index;
+    indexLocked(index, weighted);
+    compactLocked();
+}
+
+void TextIndex::remove(const std::string& cardId) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = byCard_.find(cardId);
+    if (it == byCard_.end()) {
+        return;
+    }
+    Document& document = documents_[it->second];
+    unindexLocked(document);
+    document.alive = false;
+    document.cardId.clear();
+    document.boardId.clear();
+    freeDocuments_.push_back(it->second);
+    byCard_.erase(it);
+    compactLocked();
+}
+
+void TextIndex::onCardTextChanged(const Card& card) {
+    WeightedTerms weighted = weighTerms(card);
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = byCard_.find(card.id());
+    if (it == byCard_.end()) {
+        return;
+    }
+    unindexLocked(documents_[it->second]);
+    indexLocked(it->second, weighted);
+    compactLocked();
+}
+
+/**
+ * @brief Acrescenta os postings da geraçao atual do documento
+ */
+void TextIndex::indexLocked(std::uint32_t index, WeightedTerms& weighted) {
+    Document& document = documents_[index];
+    for (auto& entry : weighted) {
+        Term& term = terms_[std::move(entry.first)];
+        term.postings.push_back(Posting{index, document.generation, entry.second});
+        ++term.documents;
+        document.terms.push_back(&term);
+        document.length += entry.second;
+    }
+    livePostings_ += weighted.size();
+    totalLength_ += document.length;
+}
+
+/**
+ * @brief Invalida os postings da versao atual do documento
+ * @details Os postings ficam nas listas até a próxima compactaçao; a nova
+ *          geraçao faz com que a consulta os ignore.
+ */
+void TextIndex::unindexLocked(Document& document) {
+    for (Term* term : document.terms) {
+        --term->documents;
+    }
+    livePostings_ -= document.terms.size();
+    stalePostings_ += document.terms.size();
+    totalLength_ -= document.length;
+    document.terms.clear();
+    document.length = 0;
+    ++document.generation;
+}
+
+/**
+ * @brief Remove os postings obsoletos quando eles passam dos válidos
+ */
+void TextIndex::compactLocked() {
+    if (stalePostings_ < kMinStaleForCompaction || stalePostings_ <= livePostings_) {
+        return;
+    }
+    for (auto it = terms_.begin(); it != terms_.end();) {
+        auto& postings = it->second.postings;
+        postings.erase(std::remove_if(postings.begin(), postings.end(), [this](const Posting& p) {
+                           const Document& d = documents_[p.document];
+                           return !d.alive || d.generation != p.generation;
+                       }),
+                       postings.end());
+        if (it->second.documents == 0) {
+            it = terms_.erase(it);   // nenhum Document válido aponta para ele
+        } else {
+            ++it;
+        }
+    }
+    stalePostings_ = 0;
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+std::vector<SearchHit> TextIndex::search(const std::string& query, std::size_t limit) const {
+    std::vector<std::string> tokens = tokenize(query);
+    std::sort(tokens.begin(), tokens.end());
+    tokens.erase(std::unique(tokens.begin(), tokens.end()), tokens.end());
+
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<SearchHit> hits;
+    const double count = static_cast<double>(byCard_.size());
+    if (tokens.empty() || limit == 0 || byCard_.empty()) {
+        return hits;
+    }
+    const double averageLength = std::max(totalLength_ / count, 1.0);
+
+    std::unordered_map<std::uint32_t, double> scores;
+    for (const auto& token : tokens) {
+        auto it = terms_.find(token);
+        if (it == terms_.end() || it->second.documents == 0) {
+            continue;
+        }
+        const double df = it->second.documents;
+        const double idf = std::log(1.0 + (count - df + 0.5) / (df + 0.5));
+        for (const Posting& posting : it->second.postings) {
+            const Document& document = documents_[posting.document];
+            if (!document.alive || document.generation != posting.generation) {
+                continue;   // posting obsoleto
+            }
+            const double tf = posting.frequency;
+            const double norm = kK1 * (1.0 - kB + kB * document.length / averageLength);
+            scores[posting.document] += idf * tf * (kK1 + 1.0) / (tf + norm);
+        }
+    }
+
+    std::vector<std::pair<std::uint32_t, double>> ranked(scores.begin(), scores.end());
+    auto better = [this](const std::pair<std::uint32_t, double>& a, const std::pair<std::uint32_t, double>& b) {
+        if (a.second != b.second) {
+            return a.second > b.second;
+        }
+        return documents_[a.first].cardId < documents_[b.first].cardId;
+    };
+    std::size_t top = std::min(limit, ranked.size());
+    std::partial_sort(ranked.begin(), ranked.begin() + static_cast<std::ptrdiff_t>(top), ranked.end(), better);
+
+    hits.reserve(top);
+    for (std::size_t i = 0; i < top; ++i) {
+        const Document& document = documents_[ranked[i].first];
+        hits.push_back(SearchHit{document.cardId, document.boardId, ranked[i].second});
+    }
+    return hits;
+}
+
+std::size_t TextIndex::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return byCard_.size();
+}
+
+std::size_t TextIndex::termCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return static_cast<std::size_t>(std::count_if(terms_.begin(), terms_.end(),
+                                                   [](const auto& entry) { return entry.second.documents > 0; }));
+}
+
+} // namespace domain
+} // namespace kanban
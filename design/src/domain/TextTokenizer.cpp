@@ -0,0 +1,167 @@
+/**
+ * @file TextTokenizer.cpp
+ * @brief Implementaçao da normalizaçao e tokenizaçao de texto para busca
+ */
+
+#include "domain/TextTokenizer.h"
+
+namespace kanban {
+namespace domain {
+
+namespace {
+
+/// @brief Papel de um caractere na tokenizaçao
+enum class Kind {
+    Text,       ///< @brief Parte de um token (com a forma normalizada)
+    Mark,       ///< @brief Marca combinante: descartada sem separar
+    Separator   ///< @brief Separa tokens
+};
+
+/**
+ * @brief Forma normalizada de U+00C0-U+00FF (nullptr = separador)
+ */
+const char* const kLatin1[64] = {
+    "a", "a", "a", "a", "a", "a", "ae", "c",      // À Á Â Ã Ä Å Æ Ç
+    "e", "e", "e", "e", "i", "i", "i", "i",       // È É Ê Ë Ì Í Î Ï
+    "d", "n", "o", "o", "o", "o", "o", nullptr,   // Ð Ñ Ò Ó Ô Õ Ö ×
+    "o", "u", "u", "u", "u", "y", "th", "ss",     // Ø Ù Ú Û Ü Ý Þ ß
+    "a", "a", "a", "a", "a", "a", "ae", "c",      // à á â ã ä å æ ç
+    "e", "e", "e", "e", "i", "i", "i", "i",       // è é ê ë ì í î ï
+    "d", "n", "o", "o", "o", "o", "o", nullptr,   // ð ñ ò ó ô õ ö ÷
+    "o", "u", "u", "u", "u", "y", "th", "y"       // ø ù ú û ü ý þ ÿ
+};
+
+/**
+ * @brief Decodifica um caractere UTF-8 a partir de text[i]
+ * @param length Recebe o número de bytes consumidos (1 se inválido)
+ * @return Code point, ou -1 se a sequência for inválida
+ */
+long decode(const std::string& text, std::size_t i, std::size_t& length) noexcept {
+    auto byte = [&](std::size_t k) { return static_cast<unsigned char>(text[k]); };
+    unsigned char lead = byte(i);
+    length = 1;
+    if (lead < 0x80) {
+        return lead;
+    }
+
+    std::size_t extra = 0;
+    long cp = 0;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        extra = 1;
+        cp = lead & 0x1F;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        extra = 2;
+        cp = lead & 0x0F;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        extra = 3;
+        cp = lead & 0x07;
+    } else {
+        return -1;
+    }
+    if (i + extra >= text.size()) {
+        return -1;
+    }
+    for (std::size_t k = 1; k <= extra; ++k) {
+        unsigned char next = byte(i + k);
+        if ((next & 0xC0) != 0x80) {
+            return -1;
+        }
+        cp = (cp << 6) | (next & 0x3F);
+    }
+    length = extra + 1;
+    return cp;
+}
+
+/**
+ * @brief Classifica o caractere em text[i] e devolve sua forma normalizada
+ * @param length Recebe o número de bytes consumidos
+ * @param folded Recebe a forma normalizada (apenas para Kind::Text)
+ * @param foldedLength Tamanho de folded
+ */
+Kind classify(const std::string& text, std::size_t i, std::size_t& length,
+              const char*& folded, std::size_t& foldedLength) noexcept {
+    long cp = decode(text, i, length);
+    if (cp < 0) {
+        return Kind::Separator;
+    }
+    if (cp < 0x80) {
+        char c = text[i];
+        if (c >= 'A' && c <= 'Z') {
+            static const char kLower[] = "abcdefghijklmnopqrstuvwxyz";
+            folded = kLower + (c - 'A');
+            foldedLength = 1;
+            return Kind::Text;
+        }
+        if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) {
+            folded = text.data() + i;
+            foldedLength = 1;
+            return Kind::Text;
+        }
+        return Kind::Separator;
+    }
+    if (cp >= 0x300 && cp <= 0x36F) {
+        return Kind::Mark;
+    }
+    if (cp < 0xC0 || (cp >= 0x2000 && cp <= 0x206F)) {
+        return Kind::Separator;   // controles C1, pontuaçao Latin-1 e pontuaçao geral
+    }
+    if (cp <= 0xFF) {
+        folded = kLatin1[cp - 0xC0];
+        if (folded == nullptr) {
+            return Kind::Separator;
+        }
+        foldedLength = folded[1] == '\0' ? 1 : 2;
+        return Kind::Text;
+    }
+    folded = text.data() + i;
+    foldedLength = length;
+    return Kind::Text;
+}
+
+} // namespace
+
+std::string foldText(const std::string& text) {
+    std::string result;
+    result.reserve(text.size());
+    std::size_t i = 0;
+    while (i < text.size()) {
+        std::size_t length = 1;
+        const char* folded = nullptr;
+        std::size_t foldedLength = 0;
+        switch (classify(text, i, length, folded, foldedLength)) {
+            case Kind::Text:      result.append(folded, foldedLength); break;
+            case Kind::Mark:      break;
+            case Kind::Separator: result.append(text, i, length); break;
+        }
+        i += length;
+    }
+    return result;
+}
+
+std::vector<std::string> tokenize(const std::string& text) {
+    std::vector<std::string> tokens;
+    std::string current;
+    std::size_t i = 0;
+    while (i < text.size()) {
+        std::size_t length = 1;
+        const char* folded = nullptr;
+        std::size_t foldedLength = 0;
+        Kind kind = classify(text, i, length, folded, foldedLength);
+        if (kind == Kind::Text) {
+            if (current.size() + foldedLength <= kMaxTokenBytes) {
+                current.append(folded, foldedLength);
+            }
+        } else if (kind == Kind::Separator && !current.empty()) {
+            tokens.push_back(std::move(current));
+            current.clear();
+        }
+        i += length;
+    }
+    if (!current.empty()) {
+        tokens.push_back(std::move(current));
+    }
+    return tokens;
+}
+
+} // namespace domain
+} // namespace kanban
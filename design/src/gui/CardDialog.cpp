@@ -1,29 +1,32 @@
 #include "gui/CardDialog.h"
+#include <QCompleter>
 
 namespace kanban {
 namespace gui {
 
-CardDialog::CardDialog(std::shared_ptr<domain::Card> card, QWidget *parent)
-    : QDialog(parent), card_(card) {
+CardDialog::TagCompletionProvider CardDialog::tagCompletionProvider_;
+
+void CardDialog::setTagCompletionProvider(TagCompletionProvider provider) {
+    tagCompletionProvider_ = std::move(provider);
+}
+
+CardDialog::CardDialog(const std::optional<CardView>& card, QWidget *parent)
+    : QDialog(parent) {
     
     setupUI();
     
     // Preencher dados se estiver editando um card existente
     if (card) {
-        titleEdit_->setText(QString::fromStdString(card->title()));
-        if (card->description().has_value()) {
-            descriptionEdit_->setPlainText(QString::fromStdString(card->description().value()));
-        }
+        titleEdit_->setText(card->title);
+        descriptionEdit_->setPlainText(card->description);
         // CORREÇÃO: Garantir que a prioridade esteja dentro dos limites
-        int priority = card->priority();
+        int priority = card->priority;
         if (priority < 0) priority = 0;
         if (priority > 2) priority = 2;
         priorityCombo_->setCurrentIndex(priority);
         
         // Preencher tags existentes
-        for (const auto& tag : card->tags()) {
-            tagsListWidget_->addItem(QString::fromStdString(tag->name()));
-        }
+        tagsListWidget_->addItems(card->tags);
     }
 }
 
@@ -67,8 +70,26 @@ void CardDialog::setupUI() {
     tagsComboBox_->setEditable(true);
     tagsComboBox_->setPlaceholderText("Digite uma nova etiqueta...");
     
-    // Popular com tags comuns
-    tagsComboBox_->addItems({"urgente", "bug", "feature", "design", "teste", "documentação"});
+    // Popular com as tags mais usadas no board e, depois, com tags comuns
+    QStringList suggestions;
+    if (tagCompletionProvider_) {
+        suggestions = tagCompletionProvider_(QString());
+    }
+    const QStringList commonTags{"urgente", "bug", "feature", "design", "teste", "documentação"};
+    for (const QString& common : commonTags) {
+        if (!suggestions.contains(common, Qt::CaseInsensitive)) {
+            suggestions << common;
+        }
+    }
+    tagsComboBox_->addItems(suggestions);
+    
+    // Completar pelo prefixo digitado, consultando o índice do board
+    tagCompletionModel_ = new QStringListModel(this);
+    if (tagCompletionProvider_) {
+        QCompleter *completer = new QCompleter(tagCompletionModel_, this);
+        completer->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+        tagsComboBox_->setCompleter(completer);
+    }
     
     addTagButton_ = new QPushButton("➕ Adicionar");
     removeTagButton_ = new QPushButton("➖ Remover");
@@ -89,6 +110,7 @@ void CardDialog::setupUI() {
     // CORREÇÃO: Usar o lineEdit interno do ComboBox
     if (tagsComboBox_->lineEdit()) {
         connect(tagsComboBox_->lineEdit(), &QLineEdit::returnPressed, this, &CardDialog::addTag);
+        connect(tagsComboBox_->lineEdit(), &QLineEdit::textEdited, this, &CardDialog::updateTagCompletions);
     }
     
     // Botões
@@ -123,6 +145,12 @@ void CardDialog::addTag() {
     tagsComboBox_->setCurrentText("");
 }
 
+void CardDialog::updateTagCompletions(const QString& prefix) {
+    if (!tagCompletionProvider_) return;
+    tagCompletionModel_->setStringList(prefix.trimmed().isEmpty() ? QStringList()
+                                                                  : tagCompletionProvider_(prefix));
+}
+
 void CardDialog::removeTag() {
     QList<QListWidgetItem*> selected = tagsListWidget_->selectedItems();
     for (QListWidgetItem* item : selected) {
@@ -7,8 +7,8 @@
 namespace kanban {
 namespace gui {
 
-CardWidget::CardWidget(std::shared_ptr<domain::Card> card, QWidget *parent)
-    : QWidget(parent), card_(card)
+CardWidget::CardWidget(CardView card, QWidget *parent)
+    : QWidget(parent), card_(std::move(card))
 {
     // Permite que o stylesheet pinte o background
     setAttribute(Qt::WA_StyledBackground, true);
@@ -39,7 +39,7 @@ void CardWidget::setupUI() {
     layout->setSpacing(6);
 
     // Título do card
-    titleLabel_ = new QLabel(QString::fromStdString(card_->title()));
+    titleLabel_ = new QLabel(card_.title);
     titleLabel_->setStyleSheet(
         "QLabel {"
         "   font-weight: bold;"
@@ -53,8 +53,8 @@ void CardWidget::setupUI() {
     layout->addWidget(titleLabel_);
 
     // Descrição (se existir)
-    if (card_->description().has_value() && !card_->description()->empty()) {
-        QString description = QString::fromStdString(card_->description().value());
+    if (!card_.description.isEmpty()) {
+        QString description = card_.description;
         
         // Limitar descrição se for muito longa
         QFontMetrics metrics(font());
@@ -94,11 +94,11 @@ void CardWidget::setupUI() {
     QString priorityText;
     QColor priorityColor;
     
-    switch (card_->priority()) {
+    switch (card_.priority) {
         case 0: priorityText = "⚪ Baixa"; priorityColor = QColor("#28a745"); break;
         case 1: priorityText = "🟡 Média"; priorityColor = QColor("#ffc107"); break;
         case 2: priorityText = "🔴 Alta"; priorityColor = QColor("#dc3545"); break;
-        default: priorityText = QString("⚡ %1").arg(card_->priority()); priorityColor = QColor("#6c757d");
+        default: priorityText = QString("⚡ %1").arg(card_.priority); priorityColor = QColor("#6c757d");
     }
     
     priorityLabel_ = new QLabel(priorityText);
@@ -120,7 +120,7 @@ void CardWidget::setupUI() {
     moveUpButton_->setToolTip("Mover para cima");
     moveUpButton_->setStyleSheet("QPushButton { border: none; background: transparent; }");
     connect(moveUpButton_, &QPushButton::clicked, this, [this]() {
-        emit moveUpRequested(QString::fromStdString(card_->id()));
+        emit moveUpRequested(QString::fromStdString(card_.id));
     });
     footerLayout->addWidget(moveUpButton_);
 
@@ -129,12 +129,12 @@ void CardWidget::setupUI() {
     moveDownButton_->setToolTip("Mover para baixo");
     moveDownButton_->setStyleSheet("QPushButton { border: none; background: transparent; }");
     connect(moveDownButton_, &QPushButton::clicked, this, [this]() {
-        emit moveDownRequested(QString::fromStdString(card_->id()));
+        emit moveDownRequested(QString::fromStdString(card_.id));
     });
     footerLayout->addWidget(moveDownButton_);
     
     // ID do card (pequeno)
-    QLabel *idLabel = new QLabel(QString("#%1").arg(QString::fromStdString(card_->id()).mid(0, 6)));
+    QLabel *idLabel = new QLabel(QString("#%1").arg(QString::fromStdString(card_.id).mid(0, 6)));
     idLabel->setStyleSheet(
         "QLabel {"
         "   font-size: 9px;"
@@ -156,23 +156,20 @@ void CardWidget::updateTagsDisplay() {
     }
 
     // Adicionar tags atuais
-    if (card_) {
-        auto tags = card_->tags();
-        for (const auto& tag : tags) {
-            QLabel *tagLabel = new QLabel(QString::fromStdString(tag->name()));
-            tagLabel->setStyleSheet(
-                "QLabel {"
-                "   background-color: #e3f2fd;"
-                "   color: #1976d2;"
-                "   padding: 2px 6px;"
-                "   border-radius: 8px;"
-                "   font-size: 9px;"
-                "   border: 1px solid #90caf9;"
-                "}"
-            );
-            tagLabel->setMaximumHeight(16);
-            tagsLayout_->addWidget(tagLabel);
-        }
+    for (const auto& tag : card_.tags) {
+        QLabel *tagLabel = new QLabel(tag);
+        tagLabel->setStyleSheet(
+            "QLabel {"
+            "   background-color: #e3f2fd;"
+            "   color: #1976d2;"
+            "   padding: 2px 6px;"
+            "   border-radius: 8px;"
+            "   font-size: 9px;"
+            "   border: 1px solid #90caf9;"
+            "}"
+        );
+        tagLabel->setMaximumHeight(16);
+        tagsLayout_->addWidget(tagLabel);
     }
     
     // Spacer para empurrar para esquerda
@@ -180,18 +177,14 @@ void CardWidget::updateTagsDisplay() {
 }
 
 void CardWidget::updateUI() {
-    if (!card_) {
-        return;
-    }
-    
     // Atualizar título
-    titleLabel_->setText(QString::fromStdString(card_->title()));
+    titleLabel_->setText(card_.title);
     
     // Gerenciar descrição
-    bool hasDescription = card_->description().has_value() && !card_->description()->empty();
+    bool hasDescription = !card_.description.isEmpty();
     
     if (hasDescription) {
-        QString description = QString::fromStdString(card_->description().value());
+        QString description = card_.description;
         QFontMetrics metrics(font());
         QString elidedText = metrics.elidedText(description, Qt::ElideRight, 220);
         
@@ -227,11 +220,11 @@ void CardWidget::updateUI() {
     // Atualizar prioridade
     QString priorityText;
     QColor priorityColor;
-    switch (card_->priority()) {
+    switch (card_.priority) {
         case 0: priorityText = "⚪ Baixa"; priorityColor = QColor("#28a745"); break;
         case 1: priorityText = "🟡 Média"; priorityColor = QColor("#ffc107"); break;
         case 2: priorityText = "🔴 Alta"; priorityColor = QColor("#dc3545"); break;
-        default: priorityText = QString("⚡ %1").arg(card_->priority()); priorityColor = QColor("#6c757d");
+        default: priorityText = QString("⚡ %1").arg(card_.priority); priorityColor = QColor("#6c757d");
     }
     priorityLabel_->setText(priorityText);
     priorityLabel_->setStyleSheet(
@@ -268,10 +261,10 @@ void CardWidget::mouseMoveEvent(QMouseEvent *event) {
     QMimeData *mimeData = new QMimeData;
     
     // Incluir informações completas do card
-    QString cardData = QString::fromStdString(card_->id());
+    QString cardData = QString::fromStdString(card_.id);
     mimeData->setText(cardData);
-    mimeData->setData("application/x-card-id", QByteArray::fromStdString(card_->id()));
-    mimeData->setData("application/x-card-title", QByteArray::fromStdString(card_->title()));
+    mimeData->setData("application/x-card-id", QByteArray::fromStdString(card_.id));
+    mimeData->setData("application/x-card-title", card_.title.toUtf8());
     
     // Tentar obter a coluna pai
     QWidget* parent = parentWidget();
@@ -301,27 +294,12 @@ void CardWidget::mouseMoveEvent(QMouseEvent *event) {
 void CardWidget::mouseDoubleClickEvent(QMouseEvent *event) {
     Q_UNUSED(event)
     
-    if (!card_) {
-        return;
-    }
-    
     CardDialog dialog(card_);
     if (dialog.exec() == QDialog::Accepted) {
-        // Atualizar card com novos dados
-        card_->setTitle(dialog.getTitle().toStdString());
-        card_->setDescription(dialog.getDescription().toStdString());
-        card_->setPriority(dialog.getPriority());
-        
-        // Atualizar tags a partir do dialog
-        card_->clearTags();
-        QStringList tags = dialog.getTags();
-        for (const QString& t : tags) {
-            auto tag = std::make_shared<domain::Tag>(t.toStdString(), t.toStdString());
-            card_->addTag(tag);
-        }
-
-        // Atualizar UI de forma segura
-        updateUI();
+        // O card é alterado pelo executor do serviço; a coluna é redesenhada
+        // quando a alteração terminar
+        emit editRequested(QString::fromStdString(card_.id), dialog.getTitle(),
+                           dialog.getDescription(), dialog.getPriority(), dialog.getTags());
     }
 }
 
@@ -9,11 +9,17 @@
 namespace kanban {
 namespace gui {
 
-ColumnWidget::ColumnWidget(std::shared_ptr<domain::Column> column, QWidget *parent)
-    : QFrame(parent), column_(column) {
+ColumnWidget::ColumnWidget(ColumnView column, QWidget *parent)
+    : QFrame(parent), column_(std::move(column)) {
     
     setupUI();
-    refreshCards(nullptr);
+    refreshCards();
+}
+
+void ColumnWidget::setColumn(ColumnView column) {
+    column_ = std::move(column);
+    countLabel_->setText(QString("%1 cards").arg(column_.cards.size()));
+    refreshCards();
 }
 
 void ColumnWidget::setupUI() {
@@ -41,7 +47,7 @@ void ColumnWidget::setupUI() {
     mainLayout_->setSpacing(8);
 
     // Cabeçalho da coluna
-    QLabel *titleLabel = new QLabel(QString::fromStdString(column_->name()));
+    QLabel *titleLabel = new QLabel(column_.name);
     titleLabel->setStyleSheet(
         "QLabel {"
         "   font-weight: bold;"
@@ -56,16 +62,16 @@ void ColumnWidget::setupUI() {
     mainLayout_->addWidget(titleLabel);
 
     // Contador de cards
-    QLabel *countLabel = new QLabel(QString("%1 cards").arg(column_->size()));
-    countLabel->setStyleSheet(
+    countLabel_ = new QLabel(QString("%1 cards").arg(column_.cards.size()));
+    countLabel_->setStyleSheet(
         "QLabel {"
         "   font-size: 12px;"
         "   color: #050505ff;"
         "   padding: 4px;"
         "}"
     );
-    countLabel->setAlignment(Qt::AlignCenter);
-    mainLayout_->addWidget(countLabel);
+    countLabel_->setAlignment(Qt::AlignCenter);
+    mainLayout_->addWidget(countLabel_);
 
     // Área rolável para cards
     scrollArea_ = new QScrollArea;
@@ -116,7 +122,7 @@ void ColumnWidget::setupUI() {
     mainLayout_->addWidget(addCardButton_);
 }
 
-void ColumnWidget::refreshCards(std::function<bool(std::shared_ptr<kanban::domain::Card>)> predicate) {
+void ColumnWidget::refreshCards() {
     // Limpar cards existentes
     QLayoutItem *item;
     while ((item = cardsLayout_->takeAt(0)) != nullptr) {
@@ -124,41 +130,30 @@ void ColumnWidget::refreshCards(std::function<bool(std::shared_ptr<kanban::domai
         delete item;
     }
 
-    // Adicionar cards atuais
-    auto cards = column_->cards();
-    for (const auto& card : cards) {
-        // Se existir predicado, usar para filtrar
-        if (predicate) {
-            try {
-                if (!predicate(card)) continue;
-            } catch (...) {
-                // Em caso de erro no predicado, mostrar o card por seguranca
-            }
-        }
+    // Adicionar os cards da cópia que passaram pelos filtros
+    for (const auto& card : column_.cards) {
+        if (!card.visible) continue;
 
         CardWidget *cardWidget = new CardWidget(card);
         // Conectar sinais de mover para cima/baixo
         connect(cardWidget, &CardWidget::moveUpRequested, this, [this](const QString& cardId){
             // encontrar índice atual do card
-            int currentIndex = -1;
-            auto cards = column_->cards();
-            for (int i = 0; i < static_cast<int>(cards.size()); ++i) {
-                if (QString::fromStdString(cards[i]->id()) == cardId) { currentIndex = i; break; }
-            }
+            int currentIndex = column_.indexOf(cardId);
             if (currentIndex == -1) return;
             int newIndex = std::max(0, currentIndex - 1);
-            emit cardReordered(QString::fromStdString(column_->id()), cardId, newIndex);
+            emit cardReordered(QString::fromStdString(column_.id), cardId, newIndex);
         });
         connect(cardWidget, &CardWidget::moveDownRequested, this, [this](const QString& cardId){
-            int currentIndex = -1;
-            auto cards = column_->cards();
-            for (int i = 0; i < static_cast<int>(cards.size()); ++i) {
-                if (QString::fromStdString(cards[i]->id()) == cardId) { currentIndex = i; break; }
-            }
+            int currentIndex = column_.indexOf(cardId);
             if (currentIndex == -1) return;
-            int maxIndex = static_cast<int>(column_->size()) - 1;
+            int maxIndex = static_cast<int>(column_.cards.size()) - 1;
             int newIndex = std::min(maxIndex, currentIndex + 1);
-            emit cardReordered(QString::fromStdString(column_->id()), cardId, newIndex);
+            emit cardReordered(QString::fromStdString(column_.id), cardId, newIndex);
+        });
+        connect(cardWidget, &CardWidget::editRequested, this,
+                [this](const QString& cardId, const QString& title, const QString& description,
+                       int priority, const QStringList& tags) {
+            emit cardEdited(QString::fromStdString(column_.id), cardId, title, description, priority, tags);
         });
 
         cardsLayout_->addWidget(cardWidget);
@@ -175,7 +170,7 @@ void ColumnWidget::addNewCard() {
                                          &ok);
     
     if (ok && !title.isEmpty()) {
-        emit cardAdded(QString::fromStdString(column_->id()), title);
+        emit cardAdded(QString::fromStdString(column_.id), title);
     }
 }
 
@@ -208,7 +203,7 @@ void ColumnWidget::dropEvent(QDropEvent *event) {
         // Movimento de coluna (já existe)
         QByteArray itemData = event->mimeData()->data("application/x-column");
         QString fromColumnId = QString::fromUtf8(itemData);
-        QString toColumnId = QString::fromStdString(column_->id());
+        QString toColumnId = QString::fromStdString(column_.id);
         
         emit columnMoved(fromColumnId, toColumnId);
         event->acceptProposedAction();
@@ -225,7 +220,7 @@ void ColumnWidget::dropEvent(QDropEvent *event) {
         }
 
         // DIFERENCIAR: Reordenação vs Movimento entre colunas
-        if (fromColumnId == QString::fromStdString(column_->id())) {
+        if (fromColumnId == QString::fromStdString(column_.id)) {
             // REORDENAÇÃO: Card está sendo movido dentro da mesma coluna
             int newIndex = calculateDropIndex(event->position().toPoint());
             if (newIndex != -1) {
@@ -233,7 +228,7 @@ void ColumnWidget::dropEvent(QDropEvent *event) {
             }
         } else {
             // MOVIMENTO ENTRE COLUNAS: Card está sendo movido para outra coluna
-            emit cardMoved(cardId, fromColumnId, QString::fromStdString(column_->id()));
+            emit cardMoved(cardId, fromColumnId, QString::fromStdString(column_.id));
         }
         
         event->acceptProposedAction();
@@ -306,7 +301,7 @@ int ColumnWidget::calculateDropIndex(const QPoint& pos) {
     int index = (relativeY - headerHeight) / cardHeight;
     
     // Limitar ao número máximo de cards
-    int maxIndex = static_cast<int>(column_->size());
+    int maxIndex = static_cast<int>(column_.cards.size());
     if (index > maxIndex) {
         index = maxIndex;
     }
@@ -327,7 +322,7 @@ void ColumnWidget::mouseMoveEvent(QMouseEvent *event) {
 
     QDrag *drag = new QDrag(this);
     QMimeData *mimeData = new QMimeData;
-    mimeData->setData("application/x-column", QByteArray::fromStdString(column_->id()));
+    mimeData->setData("application/x-column", QByteArray::fromStdString(column_.id));
     drag->setMimeData(mimeData);
     drag->exec(Qt::MoveAction);
 }
@@ -0,0 +1,150 @@
+#include "gui/CumulativeFlowWidget.h"
+#include <QPainter>
+#include <QPolygonF>
+#include <QFontMetrics>
+#include <algorithm>
+
+namespace kanban {
+namespace gui {
+
+namespace {
+
+// Uma cor por coluna (repete a partir da oitava)
+const QColor kBandColors[] = {
+    QColor("#90caf9"), QColor("#ffcc80"), QColor("#ce93d8"), QColor("#a5d6a7"),
+    QColor("#ef9a9a"), QColor("#80deea"), QColor("#fff59d"), QColor("#bcaaa4")
+};
+constexpr int kBandColorCount = sizeof(kBandColors) / sizeof(kBandColors[0]);
+
+} // namespace
+
+CumulativeFlowWidget::CumulativeFlowWidget(QWidget *parent)
+    : QWidget(parent)
+{
+    setMinimumHeight(160);
+    setSizePolicy(QSizePolicy::Preferred, QSizePolicy::Fixed);
+}
+
+void CumulativeFlowWidget::setFlow(const domain::CumulativeFlow& flow, const QStringList& columnNames) {
+    flow_ = flow;
+    columnNames_ = columnNames;
+    update();
+}
+
+void CumulativeFlowWidget::clear() {
+    flow_ = domain::CumulativeFlow{};
+    columnNames_.clear();
+    update();
+}
+
+QSize CumulativeFlowWidget::sizeHint() const {
+    return QSize(250, 180);
+}
+
+void CumulativeFlowWidget::paintEvent(QPaintEvent *event) {
+    Q_UNUSED(event);
+
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.fillRect(rect(), QColor("#f8f9fa"));
+
+    QFont small = font();
+    small.setPixelSize(10);
+    painter.setFont(small);
+    QFontMetrics metrics(small);
+
+    const std::size_t columns = flow_.columns.size();
+    if (flow_.counts.empty() || columns == 0) {
+        painter.setPen(QColor("#666666"));
+        painter.drawText(rect(), Qt::AlignCenter, "Sem dados de fluxo");
+        return;
+    }
+
+    // Legenda abaixo do gráfico: quadrado colorido + nome, quebrando linhas
+    const int lineHeight = metrics.height() + 2;
+    int legendRows = 1;
+    int x = 4;
+    for (std::size_t c = 0; c < columns; ++c) {
+        int itemWidth = 14 + metrics.horizontalAdvance(columnNames_.value(static_cast<int>(c))) + 8;
+        if (x + itemWidth > width() - 4 && x > 4) {
+            ++legendRows;
+            x = 4;
+        }
+        x += itemWidth;
+    }
+    QRectF plot(4, 4, width() - 8, height() - 8 - legendRows * lineHeight);
+    if (plot.height() < 10) {
+        return;
+    }
+
+    // Escala vertical: maior total de cards em um bucket
+    std::int64_t maxTotal = 1;
+    for (const auto& row : flow_.counts) {
+        std::int64_t total = 0;
+        for (std::int64_t count : row) {
+            total += std::max<std::int64_t>(count, 0);
+        }
+        maxTotal = std::max(maxTotal, total);
+    }
+
+    const std::size_t buckets = flow_.counts.size();
+    auto xOf = [&](std::size_t b) {
+        return buckets == 1 ? (b == 0 ? plot.left() : plot.right())
+                            : plot.left() + plot.width() * static_cast<double>(b) / static_cast<double>(buckets - 1);
+    };
+    auto yOf = [&](std::int64_t value) {
+        return plot.bottom() - plot.height() * static_cast<double>(value) / static_cast<double>(maxTotal);
+    };
+    // Com um único bucket, a faixa é desenhada como um retângulo
+    const std::size_t points = std::max<std::size_t>(buckets, 2);
+    auto rowAt = [&](std::size_t p) -> const std::vector<std::int64_t>& {
+        return flow_.counts[std::min(p, buckets - 1)];
+    };
+
+    // Faixas empilhadas: a última coluna do board fica na base
+    std::vector<std::int64_t> lower(points, 0);
+    for (std::size_t k = columns; k-- > 0;) {
+        std::vector<std::int64_t> upper(points);
+        QPolygonF band;
+        for (std::size_t p = 0; p < points; ++p) {
+            upper[p] = lower[p] + std::max<std::int64_t>(rowAt(p)[k], 0);
+            band << QPointF(xOf(p), yOf(upper[p]));
+        }
+        for (std::size_t p = points; p-- > 0;) {
+            band << QPointF(xOf(p), yOf(lower[p]));
+        }
+        QColor color = kBandColors[k % kBandColorCount];
+        painter.setPen(color.darker(130));
+        painter.setBrush(color);
+        painter.drawPolygon(band);
+        lower = std::move(upper);
+    }
+
+    painter.setPen(QColor("#dee2e6"));
+    painter.setBrush(Qt::NoBrush);
+    painter.drawRect(plot);
+    painter.setPen(QColor("#666666"));
+    painter.drawText(plot.adjusted(3, 2, -3, -2), Qt::AlignTop | Qt::AlignLeft, QString::number(maxTotal));
+
+    // Legenda
+    x = 4;
+    int y = static_cast<int>(plot.bottom()) + 4;
+    for (std::size_t c = 0; c < columns; ++c) {
+        QString name = columnNames_.value(static_cast<int>(c));
+        int itemWidth = 14 + metrics.horizontalAdvance(name) + 8;
+        if (x + itemWidth > width() - 4 && x > 4) {
+            x = 4;
+            y += lineHeight;
+        }
+        QColor color = kBandColors[c % kBandColorCount];
+        painter.setPen(color.darker(130));
+        painter.setBrush(color);
+        painter.drawRect(x, y + 2, 10, 10);
+        painter.setPen(QColor("#212529"));
+        painter.drawText(x + 14, y + metrics.ascent(), name);
+        x += itemWidth;
+    }
+}
+
+} // namespace gui
+} // namespace kanban
@@ -1,6 +1,8 @@
 #include "gui/MainWindow.h"
 #include "gui/ColumnWidget.h"
 #include "gui/CardWidget.h"
+#include "gui/CardDialog.h"
+#include "gui/GuiDispatcher.h"
 #include <QMenuBar>
 #include <QStatusBar>
 #include <QToolBar>
@@ -9,14 +11,82 @@
 #include <QHBoxLayout>
 #include <QInputDialog>
 #include <QDateTime>
+#include <QCompleter>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
 
 namespace kanban {
 namespace gui {
 
+namespace {
+/// @brief Máximo de atividades exibidas no painel de histórico
+constexpr std::size_t kActivityLogDisplayLimit = 500;
+
+/// @brief Histórico já formatado no executor: uma mensagem ou as linhas a exibir
+struct ActivityView {
+    QString message;
+    QStringList entries;
+};
+
+/// @brief Item da lista de boards, copiado no executor
+struct BoardEntry {
+    std::string id;
+    QString name;
+    int columns = 0;
+};
+
+/// @brief Copia o board (ou só as colunas em onlyColumns) sob o lock de leitura,
+///        marcando os cards aceitos pelos filtros. Roda no executor.
+BoardView snapshotBoard(const application::KanbanService& service, const std::string& boardId,
+                        const std::optional<domain::FilterPlan>& plan,
+                        const std::optional<std::unordered_set<std::string>>& textMatches,
+                        const std::vector<std::string>& onlyColumns) {
+    return service.readBoard(boardId, [&](const domain::Board& board) {
+        BoardView view;
+        view.id = board.id();
+        view.name = QString::fromStdString(board.name());
+        for (const auto& column : board.columns()) {
+            if (!onlyColumns.empty() &&
+                std::find(onlyColumns.begin(), onlyColumns.end(), column->id()) == onlyColumns.end()) {
+                continue;
+            }
+            ColumnView columnView;
+            columnView.id = column->id();
+            columnView.name = QString::fromStdString(column->name());
+            columnView.cards.reserve(column->size());
+            for (const auto& card : column->cards()) {
+                CardView cardView = CardView::of(*card);
+                // Sem filtros ativos, mostrar tudo
+                cardView.visible = !plan || ((!textMatches || textMatches->count(card->id()) > 0) &&
+                                             plan->matches(*card));
+                columnView.cards.push_back(std::move(cardView));
+            }
+            view.columns.push_back(std::move(columnView));
+        }
+        return view;
+    });
+}
+}
+
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent), 
-      service_(std::make_unique<application::KanbanService>()) {
+      service_(std::make_unique<application::AsyncKanbanService>(
+          std::make_shared<application::KanbanService>(), guiDispatcher(this))),
+      readModel_(std::make_shared<application::ReadModel>()) {
     
+    // Projeções publicadas pela thread do ReadModel: a interface só relê
+    // o board atual, sem percorrê-lo
+    readModel_->setListener([this, dispatch = guiDispatcher(this)](const std::string& boardId, std::uint64_t) {
+        dispatch([this, boardId] {
+            if (boardId == currentBoardId_) {
+                renderStatistics();
+                refreshFilterTags();
+            }
+        });
+    });
+    service_->service().useReadModel(readModel_);
+
     setupUI();
     setupConnections();
     setupMenuBar();
@@ -27,6 +97,10 @@ MainWindow::MainWindow(QWidget *parent)
 }
 
 MainWindow::~MainWindow() {
+    // Primeiro o executor: ele ainda entrega conclusões a esta janela
+    service_.reset();
+    readModel_.reset();   // o projetor ainda pode enfileirar avisos para esta janela
+    CardDialog::setTagCompletionProvider(nullptr);
     clearBoardTab();
 }
 
@@ -141,6 +215,18 @@ void MainWindow::setupUI() {
     statsLabel_ = new QLabel("Selecione um board para ver estatísticas...");
     statsLabel_->setStyleSheet("font-size: 11px; color: #666; margin: 5px;");
     statsLabel_->setWordWrap(true);
+
+    // Fluxo cumulativo do board atual (cards por coluna ao longo do tempo)
+    QLabel *cfdTitle = new QLabel("📈 Fluxo Cumulativo");
+    cfdTitle->setStyleSheet("font-size: 14px; font-weight: bold; margin-top: 15px; margin-bottom: 5px;");
+
+    cfdWindowCombo_ = new QComboBox;
+    cfdWindowCombo_->addItem("Última hora", 60);               // valor: janela em minutos
+    cfdWindowCombo_->addItem("Últimas 24 horas", 24 * 60);
+    cfdWindowCombo_->addItem("Últimos 30 dias", 30 * 24 * 60);
+    cfdWindowCombo_->addItem("Último ano", 365 * 24 * 60);
+
+    cfdWidget_ = new CumulativeFlowWidget;
     
     // Adicionar ao layout direito
     rightLayout->addWidget(activityTitle);
@@ -148,6 +234,9 @@ void MainWindow::setupUI() {
     rightLayout->addWidget(activityLogTextEdit_);
     rightLayout->addWidget(statsTitle);
     rightLayout->addWidget(statsLabel_);
+    rightLayout->addWidget(cfdTitle);
+    rightLayout->addWidget(cfdWindowCombo_);
+    rightLayout->addWidget(cfdWidget_);
     rightLayout->addStretch();
 
     // ===== ADICIONAR TODOS OS PAINÉIS AO LAYOUT PRINCIPAL =====
@@ -177,6 +266,29 @@ void MainWindow::setupFilterPanel() {
     tagFilterCombo_->setPlaceholderText("Selecione ou digite uma tag...");
     tagFilterCombo_->addItem("Todas as tags", "");
     
+    // Busca no título e na descrição (índice de texto do serviço)
+    QLabel *textSearchLabel = new QLabel("Buscar texto:");
+    textSearchEdit_ = new QLineEdit;
+    textSearchEdit_->setPlaceholderText("Palavras do título ou descrição...");
+    textSearchEdit_->setClearButtonEnabled(true);
+    
+    // Completar títulos do board atual a cada tecla (trie do serviço)
+    titleCompletionModel_ = new QStringListModel(this);
+    QCompleter *titleCompleter = new QCompleter(titleCompletionModel_, this);
+    titleCompleter->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
+    textSearchEdit_->setCompleter(titleCompleter);
+    
+    // Sugestões de tags no diálogo de edição de cards
+    CardDialog::setTagCompletionProvider([this](const QString& prefix) {
+        QStringList names;
+        if (currentBoardId_.empty()) return names;
+        // Leitura do índice de tags: barata e segura entre threads, feita na hora
+        for (const auto& completion : service_->service().completeTagNames(currentBoardId_, prefix.toStdString())) {
+            names << QString::fromStdString(completion.text);
+        }
+        return names;
+    });
+    
     // Filtro por Prioridade
     QLabel *priorityFilterLabel = new QLabel("Filtrar por Prioridade:");
     highPriorityFilter_ = new QCheckBox("🔴 Alta Prioridade");
@@ -218,6 +330,8 @@ void MainWindow::setupFilterPanel() {
     // Layout
     filterLayout->addWidget(tagFilterLabel);
     filterLayout->addWidget(tagFilterCombo_);
+    filterLayout->addWidget(textSearchLabel);
+    filterLayout->addWidget(textSearchEdit_);
     filterLayout->addWidget(priorityFilterLabel);
     filterLayout->addWidget(highPriorityFilter_);
     filterLayout->addWidget(mediumPriorityFilter_);
@@ -230,6 +344,8 @@ void MainWindow::setupFilterPanel() {
     // Conexões
     connect(applyFilterButton_, &QPushButton::clicked, this, &MainWindow::applyFilters);
     connect(clearFilterButton_, &QPushButton::clicked, this, &MainWindow::clearFilters);
+    connect(textSearchEdit_, &QLineEdit::returnPressed, this, &MainWindow::applyFilters);
+    connect(textSearchEdit_, &QLineEdit::textEdited, this, &MainWindow::updateTitleCompletions);
 }
 
 // NOVO MÉTODO: Aplicar filtros
@@ -251,8 +367,8 @@ void MainWindow::applyFilters() {
         currentPriorityFilters_ = {0, 1, 2};
     }
     
-    // Aplicar filtros
-    refreshCurrentBoard(false);
+    // Aplicar filtros (o board é redesenhado quando a busca de texto terminar)
+    rebuildFilterPlan();
     
     statusLabel_->setText("✅ Filtros aplicados");
 }
@@ -261,8 +377,12 @@ void MainWindow::applyFilters() {
 void MainWindow::clearFilters() {
     currentTagFilter_.clear();
     currentPriorityFilters_ = {0, 1, 2};
+    filterPlan_.reset();
+    textMatches_.reset();
+    ++searchRequest_;   // descarta uma busca ainda em andamento
     
     tagFilterCombo_->setCurrentIndex(0);
+    textSearchEdit_->clear();
     highPriorityFilter_->setChecked(false);
     mediumPriorityFilter_->setChecked(false);
     lowPriorityFilter_->setChecked(false);
@@ -271,76 +391,103 @@ void MainWindow::clearFilters() {
     statusLabel_->setText("🧹 Filtros limpos");
 }
 
-// NOVO MÉTODO: Verificar se card corresponde aos filtros
-bool MainWindow::cardMatchesFilter(std::shared_ptr<domain::Card> card) {
-    if (!card) return true; // Se não há card, não filtrar
-    
-    // Se não há filtros ativos, mostrar tudo
-    if (currentTagFilter_.isEmpty() && currentPriorityFilters_.empty()) {
-        return true;
-    }
-    
-    // Verificar filtro de prioridade
+// Compilar os filtros da interface em um FilterPlan, avaliado por card
+void MainWindow::rebuildFilterPlan() {
+    domain::AndFilter filter;
     if (!currentPriorityFilters_.empty()) {
-        if (currentPriorityFilters_.find(card->priority()) == currentPriorityFilters_.end()) {
-            return false;
-        }
+        filter.add(domain::PrioritySetFilter(std::vector<int>(currentPriorityFilters_.begin(),
+                                                              currentPriorityFilters_.end())));
     }
-    
-    // Verificar filtro de tag
     if (!currentTagFilter_.isEmpty()) {
-        bool hasMatchingTag = false;
-        for (const auto& tag : card->tags()) {
-            if (QString::fromStdString(tag->name()).contains(currentTagFilter_, Qt::CaseInsensitive)) {
-                hasMatchingTag = true;
-                break;
-            }
+        filter.add(domain::TagFilter(domain::TagMatch::AnyContaining, {currentTagFilter_.toStdString()}));
+    }
+    filterPlan_ = domain::FilterPlan::compile(filter);
+    
+    // A busca de texto é resolvida uma vez pelo índice, não card a card, no executor
+    const auto request = ++searchRequest_;
+    QString text = textSearchEdit_->text().trimmed();
+    if (text.isEmpty()) {
+        textMatches_.reset();
+        refreshCurrentBoard(false);
+        return;
+    }
+    service_->call([query = text.toStdString()](application::KanbanService& service) {
+        auto hits = service.searchCards(query, std::numeric_limits<std::size_t>::max());
+        if (hits.empty()) {
+            // Nenhuma palavra exata: tolerar erros de digitação nos títulos
+            hits = service.fuzzySearchCards(query, std::numeric_limits<std::size_t>::max());
         }
-        if (!hasMatchingTag) {
-            return false;
+        std::unordered_set<std::string> matches;
+        for (const auto& hit : hits) {
+            matches.insert(hit.cardId);   // IDs de card são únicos entre boards
         }
+        return matches;
+    }, [this, request](std::unordered_set<std::string> matches) {
+        if (request != searchRequest_) return;   // filtros mudaram nesse meio tempo
+        textMatches_ = std::move(matches);
+        refreshCurrentBoard(false);
+    }, [this](const std::exception& e) {
+        statusLabel_->setText("❌ Erro na busca de texto: " + QString(e.what()));
+    });
+}
+
+// Sugerir os títulos do board atual que começam com o texto digitado
+void MainWindow::updateTitleCompletions(const QString& prefix) {
+    // Só a resposta da última tecla é exibida
+    const auto request = ++completionRequest_;
+    if (currentBoardId_.empty() || prefix.trimmed().isEmpty()) {
+        titleCompletionModel_->setStringList(QStringList());
+        return;
     }
-    
-    return true;
+    service_->call([boardId = currentBoardId_, text = prefix.toStdString()](application::KanbanService& service) {
+        QStringList titles;
+        for (const auto& completion : service.completeCardTitles(boardId, text)) {
+            titles << QString::fromStdString(completion.text);
+        }
+        return titles;
+    }, [this, request](QStringList titles) {
+        if (request == completionRequest_) {
+            titleCompletionModel_->setStringList(titles);
+        }
+    }, [](const std::exception& e) {
+        qDebug() << "Erro ao completar títulos:" << e.what();
+    });
 }
 
 // NOVO MÉTODO: Atualizar lista de tags para filtro
 void MainWindow::refreshFilterTags() {
     if (currentBoardId_.empty()) return;
     
+    // Tags em uso no board, lidas da projeçao (ainda nao publicada: o
+    // aviso do ReadModel chama esta funçao de novo)
+    auto projection = readModel_->board(currentBoardId_);
+    if (!projection) return;
+
+    QStringList tags;
+    for (const auto& [name, cards] : projection->cardsByTag) {
+        tags << QString::fromStdString(name);
+    }
+
+    // Mesmas tags: nada a fazer (evita fechar o combo aberto pelo usuário)
+    if (tagFilterCombo_->count() == tags.size() + 1) {
+        bool same = true;
+        for (int i = 0; same && i < tags.size(); ++i) {
+            same = tagFilterCombo_->itemText(i + 1) == tags[i];
+        }
+        if (same) return;
+    }
+
     QString currentText = tagFilterCombo_->currentText();
     tagFilterCombo_->clear();
     tagFilterCombo_->addItem("Todas as tags", "");
+    for (const auto& tag : tags) {
+        tagFilterCombo_->addItem(tag, tag);
+    }
     
-    try {
-        auto boardOpt = service_->findBoard(currentBoardId_);
-        if (!boardOpt) return;
-        
-        std::set<QString> uniqueTags;
-        auto board = *boardOpt;
-        
-        // Coletar todas as tags únicas do board
-        for (const auto& column : board->columns()) {
-            for (const auto& card : column->cards()) {
-                for (const auto& tag : card->tags()) {
-                    uniqueTags.insert(QString::fromStdString(tag->name()));
-                }
-            }
-        }
-        
-        // Adicionar tags ao combobox
-        for (const auto& tag : uniqueTags) {
-            tagFilterCombo_->addItem(tag, tag);
-        }
-        
-        // Restaurar seleção anterior se possível
-        int index = tagFilterCombo_->findText(currentText);
-        if (index >= 0) {
-            tagFilterCombo_->setCurrentIndex(index);
-        }
-        
-    } catch (const std::exception& e) {
-        qDebug() << "Erro ao atualizar tags de filtro:" << e.what();
+    // Restaurar seleção anterior se possível
+    int index = tagFilterCombo_->findText(currentText);
+    if (index >= 0) {
+        tagFilterCombo_->setCurrentIndex(index);
     }
 }
 
@@ -367,6 +514,19 @@ void MainWindow::setupMenuBar() {
     connect(quitAction, &QAction::triggered, this, &QWidget::close);
     fileMenu->addAction(quitAction);
 
+    // Menu Editar
+    QMenu *editMenu = menuBar->addMenu("&Editar");
+
+    QAction *undoAction = new QAction("&Desfazer", this);
+    undoAction->setShortcut(QKeySequence::Undo);
+    connect(undoAction, &QAction::triggered, this, &MainWindow::undoLastChange);
+    editMenu->addAction(undoAction);
+
+    QAction *redoAction = new QAction("&Refazer", this);
+    redoAction->setShortcut(QKeySequence::Redo);
+    connect(redoAction, &QAction::triggered, this, &MainWindow::redoLastChange);
+    editMenu->addAction(redoAction);
+
     // Menu Ajuda
     QMenu *helpMenu = menuBar->addMenu("&Ajuda");
     QAction *aboutAction = new QAction("&Sobre", this);
@@ -380,15 +540,32 @@ void MainWindow::setupConnections() {
     connect(boardsListWidget_, &QListWidget::currentRowChanged, this, &MainWindow::onBoardSelected);
     connect(boardNameLineEdit_, &QLineEdit::returnPressed, this, &MainWindow::createNewBoard);
     connect(refreshActivityLogButton_, &QPushButton::clicked, this, &MainWindow::refreshActivityLog);
+    connect(cfdWindowCombo_, &QComboBox::currentIndexChanged, this, &MainWindow::updateCumulativeFlow);
+}
+
+// ============================================================================
+// CHAMADAS AO SERVIÇO
+// ============================================================================
+
+// Envia uma alteração ao executor. Os redesenhos nunca leem o domínio na
+// thread da interface: copiam o board em outra chamada (snapshotBoard), que
+// o executor roda depois desta, na ordem de envio.
+template<typename Fn, typename Done>
+void MainWindow::mutate(Fn&& fn, Done&& onDone, const QString& errorText) {
+    service_->call(std::forward<Fn>(fn),
+        [onDone = std::forward<Done>(onDone)](auto&&... result) mutable {
+            onDone(std::forward<decltype(result)>(result)...);
+        },
+        [this, errorText](const std::exception& e) {
+            QMessageBox::critical(this, "Erro", errorText + ": " + e.what());
+            statusLabel_->setText("❌ " + errorText + ": " + QString(e.what()));
+        });
 }
 
 void MainWindow::loadSampleData() {
-    try {
-        service_->createSampleData();
-        statusLabel_->setText("📊 Dados de exemplo carregados");
-    } catch (const std::exception& e) {
-        statusLabel_->setText("❌ Erro ao carregar dados: " + QString(e.what()));
-    }
+    mutate([](application::KanbanService& service) { service.createSampleData(); },
+           [this] { statusLabel_->setText("📊 Dados de exemplo carregados"); },
+           "Erro ao carregar dados");
 }
 
 void MainWindow::createNewBoard() {
@@ -398,36 +575,17 @@ void MainWindow::createNewBoard() {
         return;
     }
 
-    try {
-        std::string boardId = service_->createBoard(boardName.toStdString());
-        boardNameLineEdit_->clear();
-        refreshBoards();
-        
-        // CORREÇÃO: Encontra o índice do novo board e seleciona
-        auto boards = service_->listBoards();
-        int newIndex = -1;
-        for (int i = 0; i < static_cast<int>(boards.size()); ++i) {
-            if (boards[i]->id() == boardId) {
-                newIndex = i;
-                break;
-            }
-        }
-        
-        if (newIndex != -1) {
-            // CORREÇÃO: Seleciona o novo board na lista
-            boardsListWidget_->setCurrentRow(newIndex);
-            
-            // CORREÇÃO: Força a atualização imediata do board selecionado
-            currentBoardId_ = boardId;
-            refreshCurrentBoard(true);
-            
-            statusLabel_->setText("✅ Board criado: " + boardName);
-        }
-        
-    } catch (const std::exception& e) {
-        QMessageBox::critical(this, "Erro", QString("Erro ao criar board: ") + e.what());
-        statusLabel_->setText("❌ Erro ao criar board");
-    }
+    mutate([name = boardName.toStdString()](application::KanbanService& service) {
+               return service.createBoard(name);
+           },
+           [this, boardName](std::string boardId) {
+               boardNameLineEdit_->clear();
+               // O novo board é selecionado quando a lista atualizada chegar
+               selectAfterRefresh_ = boardId;
+               refreshBoards();
+               statusLabel_->setText("✅ Board criado: " + boardName);
+           },
+           "Erro ao criar board");
 }
 
 void MainWindow::createNewColumn() {
@@ -445,242 +603,258 @@ void MainWindow::createNewColumn() {
                                               &ok);
     
     if (ok && !columnName.isEmpty()) {
-        try {
-            std::string columnId = service_->addColumn(currentBoardId_, columnName.toStdString());
-            
-            // CORREÇÃO: Força recriação completa da visualização
-            refreshCurrentBoard(true);
-            
-            statusLabel_->setText("✅ Coluna criada: " + columnName);
-        } catch (const std::exception& e) {
-            QMessageBox::critical(this, "Erro", QString("Erro ao criar coluna: ") + e.what());
-            statusLabel_->setText("❌ Erro ao criar coluna");
-        }
+        mutate([boardId = currentBoardId_, name = columnName.toStdString()](application::KanbanService& service) {
+                   return service.addColumn(boardId, name);
+               },
+               [this, columnName](std::string) {
+                   // CORREÇÃO: Força recriação completa da visualização
+                   refreshCurrentBoard(true);
+                   statusLabel_->setText("✅ Coluna criada: " + columnName);
+               },
+               "Erro ao criar coluna");
     }
 }
 
 void MainWindow::refreshBoards() {
-    boardsListWidget_->clear();
-    auto boards = service_->listBoards();
-    
-    for (const auto& board : boards) {
-        QString boardText = QString("📋 %1\n   🗂️ %2 colunas")
-                           .arg(QString::fromStdString(board->name()))
-                           .arg(board->columnCount());
-        boardsListWidget_->addItem(boardText);
-    }
+    // Nomes e contagens copiados no executor: a lista não lê o domínio aqui
+    service_->call([](application::KanbanService& service) {
+        std::vector<BoardEntry> entries;
+        for (const auto& board : service.listBoards()) {
+            entries.push_back({board->id(), QString::fromStdString(board->name()),
+                               static_cast<int>(board->columnCount())});
+        }
+        return entries;
+    }, [this](std::vector<BoardEntry> entries) {
+        boardList_.clear();
+        boardsListWidget_->clear();
+        for (const auto& entry : entries) {
+            QString boardText = QString("📋 %1\n   🗂️ %2 colunas")
+                               .arg(entry.name)
+                               .arg(entry.columns);
+            boardList_.emplace_back(entry.id, entry.name);   // antes do item: addItem pode selecioná-lo
+            boardsListWidget_->addItem(boardText);
+        }
+        
+        if (!selectAfterRefresh_.empty()) {
+            for (int i = 0; i < static_cast<int>(boardList_.size()); ++i) {
+                if (boardList_[i].first == selectAfterRefresh_) {
+                    boardsListWidget_->setCurrentRow(i);
+                    break;
+                }
+            }
+            selectAfterRefresh_.clear();
+        }
+    }, [this](const std::exception& e) {
+        statusLabel_->setText("❌ Erro ao listar boards: " + QString(e.what()));
+    });
 }
 
 void MainWindow::onBoardSelected(int index) {
-    if (index < 0) {
+    if (index < 0 || index >= static_cast<int>(boardList_.size())) {
         return;
     }
 
-    try {
-        auto boards = service_->listBoards();
-        if (index < static_cast<int>(boards.size())) {
-            auto board = boards[index];
-            std::string newBoardId = board->id();
-            
-            // CORREÇÃO: Só atualiza se for um board diferente
-            if (currentBoardId_ != newBoardId) {
-                currentBoardId_ = newBoardId;
-                refreshCurrentBoard(true);
-            }
-            
-            // ADICIONE ESTA PARTE: Conectar os sinais columnMoved dos ColumnWidgets existentes
-            if (columnWidgetsByBoard_.find(currentBoardId_) != columnWidgetsByBoard_.end()) {
-                auto& currentColumnWidgets = columnWidgetsByBoard_[currentBoardId_];
-                for (auto& pair : currentColumnWidgets) {
-                    ColumnWidget* columnWidget = pair.second;
-                    // Conectar o sinal columnMoved se ainda não estiver conectado
-                    connect(columnWidget, &ColumnWidget::columnMoved,
-                            this, &MainWindow::onColumnMoved, Qt::UniqueConnection);
-                    connect(columnWidget, &ColumnWidget::cardReordered, this, &MainWindow::onCardReordered);
-                }
-            }
-            
-            QString boardName = QString::fromStdString(board->name());
-            statusLabel_->setText("📊 Visualizando board: " + boardName);
-            
-            // Atualizar estatísticas
-            updateStatistics();
+    const std::string newBoardId = boardList_[index].first;
+    
+    // CORREÇÃO: Só atualiza se for um board diferente
+    if (currentBoardId_ != newBoardId) {
+        currentBoardId_ = newBoardId;
+        refreshCurrentBoard(true);
+    }
+    
+    // ADICIONE ESTA PARTE: Conectar os sinais columnMoved dos ColumnWidgets existentes
+    if (columnWidgetsByBoard_.find(currentBoardId_) != columnWidgetsByBoard_.end()) {
+        auto& currentColumnWidgets = columnWidgetsByBoard_[currentBoardId_];
+        for (auto& pair : currentColumnWidgets) {
+            ColumnWidget* columnWidget = pair.second;
+            // Conectar o sinal columnMoved se ainda não estiver conectado
+            connect(columnWidget, &ColumnWidget::columnMoved,
+                    this, &MainWindow::onColumnMoved, Qt::UniqueConnection);
+            connect(columnWidget, &ColumnWidget::cardReordered, this, &MainWindow::onCardReordered);
         }
-    } catch (const std::exception& e) {
-        statusLabel_->setText("❌ Erro ao carregar board: " + QString(e.what()));
     }
+    
+    statusLabel_->setText("📊 Visualizando board: " + boardList_[index].second);
+    
+    // Atualizar estatísticas
+    updateStatistics();
 }
 
 void MainWindow::onCardReordered(const QString& columnId, const QString& cardId, int newIndex) {
-    try {
-        service_->moveCardWithinColumn(currentBoardId_, 
-                                      columnId.toStdString(), 
-                                      cardId.toStdString(), 
-                                      static_cast<std::size_t>(newIndex));
-        
-        // Atualizar apenas a coluna específica (performance)
-        if (columnWidgetsByBoard_.find(currentBoardId_) != columnWidgetsByBoard_.end()) {
-            auto& currentColumnWidgets = columnWidgetsByBoard_[currentBoardId_];
-            auto it = currentColumnWidgets.find(columnId.toStdString());
-                if (it != currentColumnWidgets.end()) {
-                    it->second->refreshCards([this](std::shared_ptr<kanban::domain::Card> c){ return this->cardMatchesFilter(c); });
-                }
-        }
-        
-        statusLabel_->setText("🔄 Card reordenado na coluna");
-        
-        // Atualizar estatísticas
-        updateStatistics();
-        
-    } catch (const std::exception& e) {
-        statusLabel_->setText("❌ Erro ao reordenar card: " + QString(e.what()));
-        QMessageBox::warning(this, "Erro de Reordenação", 
-                            "Não foi possível reordenar o card: " + QString(e.what()));
+    const std::string column = columnId.toStdString();
+    mutate([boardId = currentBoardId_, column, card = cardId.toStdString(), newIndex](application::KanbanService& service) {
+               service.moveCardWithinColumn(boardId, column, card, static_cast<std::size_t>(newIndex));
+           },
+           [this, column] {
+               // Atualizar apenas a coluna específica (performance)
+               refreshSpecificColumns(column, column);
+               statusLabel_->setText("🔄 Card reordenado na coluna");
+           },
+           "Não foi possível reordenar o card");
+}
+
+void MainWindow::onCardEdited(const QString& columnId, const QString& cardId, const QString& title,
+                              const QString& description, int priority, const QStringList& tags) {
+    const std::string column = columnId.toStdString();
+    std::vector<std::string> tagNames;
+    for (const QString& tag : tags) {
+        tagNames.push_back(tag.toStdString());
     }
+    mutate([boardId = currentBoardId_, card = cardId.toStdString(), text = title.toStdString(),
+            details = description.toStdString(), priority, tagNames = std::move(tagNames)](
+               application::KanbanService& service) {
+               service.updateCard(boardId, card, text, details, priority, tagNames);
+           },
+           [this, column, title] {
+               refreshSpecificColumns(column, column);
+               statusLabel_->setText("✏️ Card atualizado: " + title);
+           },
+           "Não foi possível atualizar o card");
 }
 
 void MainWindow::onColumnMoved(const QString& fromColumnId, const QString& toColumnId) {
     if (fromColumnId == toColumnId) return;
     
-    try {
-        // Lógica para reordenar colunas no serviço
-        // Você precisará adicionar um método no KanbanService para isso
-        service_->moveColumn(currentBoardId_, fromColumnId.toStdString(), toColumnId.toStdString());
-        refreshCurrentBoard(true);
-    } catch (const std::exception& e) {
-        statusLabel_->setText("❌ Erro ao mover coluna: " + QString(e.what()));
-    }
+    mutate([boardId = currentBoardId_, from = fromColumnId.toStdString(), to = toColumnId.toStdString()](
+               application::KanbanService& service) { service.moveColumn(boardId, from, to); },
+           [this] { refreshCurrentBoard(true); },
+           "Erro ao mover coluna");
+}
+
+void MainWindow::undoLastChange() {
+    if (currentBoardId_.empty()) return;
+
+    mutate([boardId = currentBoardId_](application::KanbanService& service) { return service.undo(boardId); },
+           [this](bool done) {
+               if (!done) {
+                   statusLabel_->setText("ℹ️ Nada para desfazer");
+                   return;
+               }
+               refreshCurrentBoard(true);
+               statusLabel_->setText("↩️ Alteração desfeita");
+           },
+           "Não foi possível desfazer");
+}
+
+void MainWindow::redoLastChange() {
+    if (currentBoardId_.empty()) return;
+
+    mutate([boardId = currentBoardId_](application::KanbanService& service) { return service.redo(boardId); },
+           [this](bool done) {
+               if (!done) {
+                   statusLabel_->setText("ℹ️ Nada para refazer");
+                   return;
+               }
+               refreshCurrentBoard(true);
+               statusLabel_->setText("↪️ Alteração refeita");
+           },
+           "Não foi possível refazer");
 }
 
 void MainWindow::onCardMoved(const QString& cardId, const QString& fromColumnId, const QString& toColumnId) {
-    try {
-        if (currentBoardId_.empty() || toColumnId.isEmpty()) {
-            statusLabel_->setText("❌ Selecione um board e uma coluna de destino");
-            return;
-        }
-        
-        std::string fromColumn = fromColumnId.toStdString();
-        
-        // CORREÇÃO: Se a coluna de origem não foi fornecida, encontrar automaticamente
-        if (fromColumn.empty()) {
-            auto columns = service_->listColumns(currentBoardId_);
-            for (const auto& column : columns) {
-                auto cardOpt = column->findCard(cardId.toStdString());
-                if (cardOpt.has_value()) {
-                    fromColumn = column->id();
-                    break;
-                }
-            }
-        }
-        
-        // CORREÇÃO: Verificar se o card já está na coluna de destino
-        if (!fromColumn.empty()) {
-            auto toColumnOpt = service_->findBoard(currentBoardId_);
-            if (toColumnOpt.has_value()) {
-                auto board = *toColumnOpt;
-                auto toColumn = board->findColumn(toColumnId.toStdString());
-                if (toColumn.has_value()) {
-                    auto existingCard = (*toColumn)->findCard(cardId.toStdString());
-                    if (existingCard.has_value()) {
-                        // Card já está na coluna de destino
-                        statusLabel_->setText("ℹ️ Card já está na coluna de destino");
-                        return;
-                    }
-                }
-            }
-        }
-        
-        if (!fromColumn.empty() && !toColumnId.isEmpty()) {
-            service_->moveCard(currentBoardId_, 
-                              cardId.toStdString(), 
-                              fromColumn, 
-                              toColumnId.toStdString());
-            
-            // CORREÇÃO: Atualizar apenas as colunas envolvidas
-            refreshSpecificColumns(fromColumn, toColumnId.toStdString());
-            
-            statusLabel_->setText("✅ Card movido com sucesso");
-            
-        } else {
-            statusLabel_->setText("❌ Não foi possível determinar as colunas para mover o card");
-        }
-    } catch (const std::exception& e) {
-        QMessageBox::critical(this, "Erro", QString("Erro ao mover card: ") + e.what());
-        statusLabel_->setText("❌ Erro ao mover card: " + QString(e.what()));
+    if (currentBoardId_.empty() || toColumnId.isEmpty()) {
+        statusLabel_->setText("❌ Selecione um board e uma coluna de destino");
+        return;
     }
+    
+    // A coluna de origem vem do índice de localizaçao do serviço, consultado
+    // no executor imediatamente antes do movimento
+    const std::string to = toColumnId.toStdString();
+    mutate([boardId = currentBoardId_, card = cardId.toStdString(), hint = fromColumnId.toStdString(), to](
+               application::KanbanService& service) -> std::optional<std::string> {
+               std::string from = hint;
+               if (auto location = service.locateCard(card)) {
+                   from = location->columnId;
+               }
+               if (from == to) {
+                   return std::nullopt;   // card já está na coluna de destino
+               }
+               if (from.empty()) {
+                   throw std::runtime_error("Não foi possível determinar as colunas para mover o card");
+               }
+               service.moveCard(boardId, card, from, to);
+               return from;
+           },
+           [this, to](std::optional<std::string> from) {
+               if (!from) {
+                   statusLabel_->setText("ℹ️ Card já está na coluna de destino");
+                   return;
+               }
+               // CORREÇÃO: Atualizar apenas as colunas envolvidas
+               refreshSpecificColumns(*from, to);
+               statusLabel_->setText("✅ Card movido com sucesso");
+           },
+           "Erro ao mover card");
 }
 
 void MainWindow::refreshSpecificColumns(const std::string& fromColumnId, const std::string& toColumnId) {
     if (currentBoardId_.empty()) return;
     
-    try {
-        // CORREÇÃO: Atualizar apenas as colunas envolvidas no movimento
-        if (columnWidgetsByBoard_.find(currentBoardId_) != columnWidgetsByBoard_.end()) {
-            auto& currentColumnWidgets = columnWidgetsByBoard_[currentBoardId_];
-            
-            // Atualizar coluna de origem
-            auto fromIt = currentColumnWidgets.find(fromColumnId);
-            if (fromIt != currentColumnWidgets.end()) {
-                fromIt->second->refreshCards([this](std::shared_ptr<kanban::domain::Card> c){ return this->cardMatchesFilter(c); });
-            }
-            
-            // Atualizar coluna de destino
-            auto toIt = currentColumnWidgets.find(toColumnId);
-            if (toIt != currentColumnWidgets.end()) {
-                toIt->second->refreshCards([this](std::shared_ptr<kanban::domain::Card> c){ return this->cardMatchesFilter(c); });
+    // CORREÇÃO: Copiar apenas as colunas envolvidas no movimento
+    std::vector<std::string> columnIds{fromColumnId};
+    if (toColumnId != fromColumnId) columnIds.push_back(toColumnId);
+    service_->call([boardId = currentBoardId_, plan = filterPlan_, matches = textMatches_,
+                    columnIds = std::move(columnIds)](application::KanbanService& service) {
+        return snapshotBoard(service, boardId, plan, matches, columnIds);
+    }, [this](BoardView view) {
+        if (view.id != currentBoardId_) return;   // outro board foi selecionado
+        auto widgets = columnWidgetsByBoard_.find(currentBoardId_);
+        if (widgets != columnWidgetsByBoard_.end()) {
+            for (auto& column : view.columns) {
+                auto it = widgets->second.find(column.id);
+                if (it != widgets->second.end()) {
+                    it->second->setColumn(std::move(column));
+                }
             }
         }
         
         // Atualizar estatísticas
         updateStatistics();
-        
-    } catch (const std::exception& e) {
+    }, [this](const std::exception& e) {
         statusLabel_->setText("❌ Erro ao atualizar colunas: " + QString(e.what()));
-    }
+    });
 }
 
 void MainWindow::onCardAdded(const QString& columnId, const QString& title) {
-    try {
-        std::string newCardId = service_->addCard(currentBoardId_, 
-                                                 columnId.toStdString(), 
-                                                 title.toStdString());
-        
-        // CORREÇÃO: Atualiza apenas a coluna específica
-        if (columnWidgetsByBoard_.find(currentBoardId_) != columnWidgetsByBoard_.end()) {
-            auto& currentColumnWidgets = columnWidgetsByBoard_[currentBoardId_];
-            auto it = currentColumnWidgets.find(columnId.toStdString());
-            if (it != currentColumnWidgets.end()) {
-                it->second->refreshCards([this](std::shared_ptr<kanban::domain::Card> c){ return this->cardMatchesFilter(c); });
-            }
-        }
-        
-        statusLabel_->setText("✅ Novo card criado: " + title);
-        
-        // Atualizar estatísticas
-        updateStatistics();
-        
-    } catch (const std::exception& e) {
-        QMessageBox::critical(this, "Erro", QString("Erro ao criar card: ") + e.what());
-        statusLabel_->setText("❌ Erro ao criar card");
-    }
+    const std::string column = columnId.toStdString();
+    mutate([boardId = currentBoardId_, column, text = title.toStdString()](application::KanbanService& service) {
+               return service.addCard(boardId, column, text);
+           },
+           [this, column, title](std::string) {
+               // CORREÇÃO: Atualiza apenas a coluna específica
+               refreshSpecificColumns(column, column);
+               statusLabel_->setText("✅ Novo card criado: " + title);
+           },
+           "Erro ao criar card");
 }
 
 void MainWindow::refreshCurrentBoard(bool forceRebuild) {
     if (currentBoardId_.empty()) return;
     
+    // Colunas, cards e resultado dos filtros copiados no executor, depois das
+    // alterações já enviadas; aqui só a cópia é desenhada
+    const auto request = ++boardRequest_;
+    rebuildPending_ = rebuildPending_ || forceRebuild;
+    service_->call([boardId = currentBoardId_, plan = filterPlan_, matches = textMatches_](
+                       application::KanbanService& service) {
+        return snapshotBoard(service, boardId, plan, matches, {});
+    }, [this, request](BoardView view) {
+        if (request != boardRequest_ || view.id != currentBoardId_) return;   // há um redesenho mais novo
+        const bool rebuild = rebuildPending_;
+        rebuildPending_ = false;
+        renderBoard(view, rebuild);
+    }, [this](const std::exception& e) {
+        statusLabel_->setText("❌ Erro ao atualizar board: " + QString(e.what()));
+    });
+}
+
+void MainWindow::renderBoard(const BoardView& view, bool forceRebuild) {
+    const auto& columns = view.columns;
+    
     try {
-        // CORREÇÃO: Verifica se o board ainda existe
-        auto boardOpt = service_->findBoard(currentBoardId_);
-        if (!boardOpt.has_value()) {
-            statusLabel_->setText("❌ Board não encontrado");
-            return;
-        }
-        
-        auto columns = service_->listColumns(currentBoardId_);
-        
         // CORREÇÃO: Verifica se o tab atual existe, se não, cria
         //int currentTabIndex = boardsTabWidget_->currentIndex();
-        QString currentBoardName = QString::fromStdString((*boardOpt)->name());
+        QString currentBoardName = view.name;
         
         bool tabExists = false;
         for (int i = 0; i < boardsTabWidget_->count(); ++i) {
@@ -737,9 +911,11 @@ void MainWindow::refreshCurrentBoard(bool forceRebuild) {
                 this, &MainWindow::onColumnMoved);
         connect(columnWidget, &ColumnWidget::cardReordered, this,
              &MainWindow::onCardReordered);
+        connect(columnWidget, &ColumnWidget::cardEdited, this,
+             &MainWindow::onCardEdited);
         
         columnsLayout->addWidget(columnWidget);
-        columnWidgetsByBoard_[currentBoardId_][column->id()] = columnWidget;
+        columnWidgetsByBoard_[currentBoardId_][column.id] = columnWidget;
     }
     
     columnsLayout->addStretch();
@@ -802,9 +978,11 @@ void MainWindow::refreshCurrentBoard(bool forceRebuild) {
                                 this, &MainWindow::onColumnMoved);
                         connect(columnWidget, &ColumnWidget::cardReordered, this, 
                             &MainWindow::onCardReordered);
+                        connect(columnWidget, &ColumnWidget::cardEdited, this,
+                            &MainWindow::onCardEdited);
                         
                         columnsLayout->addWidget(columnWidget);
-                        columnWidgetsByBoard_[currentBoardId_][column->id()] = columnWidget;
+                        columnWidgetsByBoard_[currentBoardId_][column.id] = columnWidget;
                     }
                     
                     columnsLayout->addStretch();
@@ -816,9 +994,9 @@ void MainWindow::refreshCurrentBoard(bool forceRebuild) {
             // Apenas atualiza as colunas existentes
             auto& currentColumnWidgets = columnWidgetsByBoard_[currentBoardId_];
             for (const auto& column : columns) {
-                auto it = currentColumnWidgets.find(column->id());
+                auto it = currentColumnWidgets.find(column.id);
                 if (it != currentColumnWidgets.end()) {
-                        it->second->refreshCards([this](std::shared_ptr<kanban::domain::Card> c){ return this->cardMatchesFilter(c); });
+                        it->second->setColumn(column);
                     } else {
                     // Se encontrou uma coluna nova, adiciona ao layout
                     ColumnWidget* columnWidget = new ColumnWidget(column);
@@ -829,6 +1007,8 @@ void MainWindow::refreshCurrentBoard(bool forceRebuild) {
                             this, &MainWindow::onCardAdded);
                     connect(columnWidget, &ColumnWidget::cardReordered, 
                         this, &MainWindow::onCardReordered);
+                    connect(columnWidget, &ColumnWidget::cardEdited,
+                        this, &MainWindow::onCardEdited);
                     
                     // Encontra o container de colunas e adiciona
                     QWidget* currentTab = boardsTabWidget_->currentWidget();
@@ -846,7 +1026,7 @@ void MainWindow::refreshCurrentBoard(bool forceRebuild) {
                                         columnsLayout->addItem(stretch);
                                     }
                                     
-                                    currentColumnWidgets[column->id()] = columnWidget;
+                                    currentColumnWidgets[column.id] = columnWidget;
                                 }
                             }
                         }
@@ -858,20 +1038,8 @@ void MainWindow::refreshCurrentBoard(bool forceRebuild) {
         // Atualizar histórico de atividades
         refreshActivityLog();
         
-        // Atualizar estatísticas
+        // Atualizar estatísticas (os cards já vieram filtrados na cópia)
         updateStatistics();
-        // APÓS recriar os CardWidgets, aplicar filtros
-        if (!currentTagFilter_.isEmpty() || !currentPriorityFilters_.empty()) {
-        // Aplicar filtros de forma mais simples - recriando toda a UI
-        // Isso é menos eficiente, mas funciona por enquanto
-        if (columnWidgetsByBoard_.find(currentBoardId_) != columnWidgetsByBoard_.end()) {
-            auto& currentColumnWidgets = columnWidgetsByBoard_[currentBoardId_];
-            for (auto& pair : currentColumnWidgets) {
-                ColumnWidget* columnWidget = pair.second;
-                columnWidget->refreshCards([this](std::shared_ptr<kanban::domain::Card> c){ return this->cardMatchesFilter(c); }); // Isso vai recriar os cards com filtro
-            }
-        }
-    }
         
         // Atualizar lista de tags para filtro
         refreshFilterTags();
@@ -893,109 +1061,155 @@ void MainWindow::clearBoardTab() {
 }
 
 void MainWindow::refreshActivityLog() {
-    try {
-        // Primeiro, limpar completamente o documento do QTextEdit
-        // Isso remove texto e quaisquer imagens ou recursos embutidos
-        if (activityLogTextEdit_) {
-            // limpar conteúdo e resource cache do documento
-            activityLogTextEdit_->clear();
-            if (activityLogTextEdit_->document()) {
-                activityLogTextEdit_->document()->clear();
-                activityLogTextEdit_->setHtml(QString());
-            }
-        }
-
-        if (currentBoardId_.empty()) {
-            activityLogTextEdit_->setPlainText("Selecione um board para ver o histórico.");
-            return;
-        }
-        
-        auto board = service_->findBoard(currentBoardId_);
+    if (currentBoardId_.empty()) {
+        activityLogTextEdit_->clear();
+        activityLogTextEdit_->setPlainText("Selecione um board para ver o histórico.");
+        return;
+    }
+    
+    // As descrições são montadas no executor; aqui só o texto pronto é exibido
+    const auto request = ++activityRequest_;
+    service_->call([boardId = currentBoardId_](application::KanbanService& service) {
+        ActivityView view;
+        auto board = service.findBoard(boardId);
         if (!board.has_value()) {
-            activityLogTextEdit_->setPlainText("Board não encontrado.");
-            return;
+            view.message = "Board não encontrado.";
+            return view;
         }
         
         auto activityLog = (*board)->activityLog();
         if (!activityLog) {
-            activityLogTextEdit_->setPlainText("Nenhum histórico disponível.");
-            return;
+            view.message = "Nenhum histórico disponível.";
+            return view;
         }
         
-        activityLogTextEdit_->clear();
-        
-        auto activities = activityLog->activities();
+        // Apenas as atividades mais recentes, já em ordem cronológica no log
+        auto activities = activityLog->recent(kActivityLogDisplayLimit);
         
         if (activities.empty()) {
-            activityLogTextEdit_->setPlainText("Nenhuma atividade registrada ainda.\n\n"
-                                             "As atividades aparecerão aqui quando você:\n"
-                                             "• Mover cards entre colunas\n"
-                                             "• Criar novos cards\n"
-                                             "• Fizer outras alterações");
-            return;
+            view.message = "Nenhuma atividade registrada ainda.\n\n"
+                           "As atividades aparecerão aqui quando você:\n"
+                           "• Mover cards entre colunas\n"
+                           "• Criar novos cards\n"
+                           "• Fizer outras alterações";
+            return view;
         }
         
-        // Ordenar por timestamp (mais recente primeiro)
-        std::vector<domain::Activity> sortedActivities(activities.begin(), activities.end());
-        std::sort(sortedActivities.begin(), sortedActivities.end(),
-                 [](const domain::Activity& a, const domain::Activity& b) {
-                     return a.when() > b.when();
-                 });
-        
-        for (const auto& activity : sortedActivities) {
+        // Exibir da mais recente para a mais antiga (sem reordenar)
+        for (auto it = activities.rbegin(); it != activities.rend(); ++it) {
+            const auto& activity = *it;
             auto time_t = std::chrono::system_clock::to_time_t(activity.when());
             QString timeStr = QDateTime::fromSecsSinceEpoch(time_t).toString("dd/MM/yyyy hh:mm:ss");
             
-            QString activityText = QString("🕒 %1\n   %2\n")
+            view.entries << QString("🕒 %1\n   %2\n")
                 .arg(timeStr)
-                .arg(QString::fromStdString(activity.description()));
-            
-            activityLogTextEdit_->append(activityText);
+                .arg(QString::fromStdString((*board)->describe(activity)));
         }
+        return view;
+    }, [this, request](ActivityView view) {
+        if (request != activityRequest_) return;   // já existe uma atualização mais nova
         
-    } catch (const std::exception& e) {
-        activityLogTextEdit_->setPlainText("❌ Erro ao carregar atividades: " + QString(e.what()));
-    }
-}
-
-void MainWindow::updateStatistics() {
-    try {
-        if (currentBoardId_.empty()) {
-            statsLabel_->setText("Selecione um board para ver estatísticas...");
-            return;
+        // Primeiro, limpar completamente o documento do QTextEdit
+        // Isso remove texto e quaisquer imagens ou recursos embutidos
+        activityLogTextEdit_->clear();
+        if (activityLogTextEdit_->document()) {
+            activityLogTextEdit_->document()->clear();
+            activityLogTextEdit_->setHtml(QString());
         }
         
-        auto board = service_->findBoard(currentBoardId_);
-        if (!board.has_value()) {
-            statsLabel_->setText("Board não encontrado.");
+        if (!view.message.isEmpty()) {
+            activityLogTextEdit_->setPlainText(view.message);
             return;
         }
-        
-        auto columns = service_->listColumns(currentBoardId_);
-        int totalCards = 0;
-        int totalColumns = columns.size();
-        QString columnStats;
-        
-        for (const auto& column : columns) {
-            int columnCardCount = column->size();
-            totalCards += columnCardCount;
-            columnStats += QString("• %1: %2 cards\n")
-                          .arg(QString::fromStdString(column->name()))
-                          .arg(columnCardCount);
+        for (const auto& activityText : view.entries) {
+            activityLogTextEdit_->append(activityText);
         }
-        
-        QString statsText = QString(
-            "📊 Estatísticas do Board:\n\n"
-            "🏷️ Total de Colunas: %1\n"
-            "🎴 Total de Cards: %2\n\n"
-            "📋 Distribuição:\n%3"
-        ).arg(totalColumns).arg(totalCards).arg(columnStats);
-        
-        statsLabel_->setText(statsText);
-        
-    } catch (const std::exception& e) {
-        statsLabel_->setText("❌ Erro ao carregar estatísticas: " + QString(e.what()));
+    }, [this, request](const std::exception& e) {
+        if (request == activityRequest_) {
+            activityLogTextEdit_->setPlainText("❌ Erro ao carregar atividades: " + QString(e.what()));
+        }
+    });
+}
+
+void MainWindow::updateStatistics() {
+    renderStatistics();
+    updateCumulativeFlow();
+}
+
+void MainWindow::renderStatistics() {
+    if (currentBoardId_.empty()) {
+        statsLabel_->setText("Selecione um board para ver estatísticas...");
+        return;
+    }
+    
+    // Contagens mantidas pelo ReadModel: nenhuma chamada ao serviço nem
+    // percurso do board. O aviso da próxima projeçao atualiza o texto.
+    auto projection = readModel_->board(currentBoardId_);
+    if (!projection) {
+        statsLabel_->setText("Calculando estatísticas...");
+        return;
+    }
+    
+    QString columnStats;
+    for (const auto& column : projection->columns) {
+        columnStats += QString("• %1: %2 cards\n")
+                      .arg(QString::fromStdString(column.name))
+                      .arg(column.cards);
+    }
+    
+    QString priorityStats;
+    for (const auto& [priority, cards] : projection->cardsByPriority) {
+        priorityStats += QString("• Prioridade %1: %2 cards\n").arg(priority).arg(cards->size());
+    }
+    
+    const std::uint64_t latest = readModel_->latestVersion(currentBoardId_);
+    const std::uint64_t behind = latest > projection->version ? latest - projection->version : 0;
+    statsLabel_->setText(QString(
+        "📊 Estatísticas do Board:\n\n"
+        "🏷️ Total de Colunas: %1\n"
+        "🎴 Total de Cards: %2\n\n"
+        "📋 Distribuição:\n%3\n"
+        "⭐ Por prioridade:\n%4\n"
+        "🕒 Versão %5%6"
+    ).arg(projection->columns.size())
+     .arg(projection->totalCards)
+     .arg(columnStats)
+     .arg(priorityStats)
+     .arg(projection->version)
+     .arg(behind > 0 ? QString(" (%1 alterações pendentes)").arg(behind) : QString()));
+}
+
+void MainWindow::updateCumulativeFlow() {
+    if (currentBoardId_.empty()) {
+        cfdWidget_->clear();
+        return;
     }
+
+    // Janela escolhida dividida em 24 pontos, terminando agora
+    const std::chrono::milliseconds window = std::chrono::minutes(cfdWindowCombo_->currentData().toInt());
+    const auto request = ++flowRequest_;
+    service_->call([boardId = currentBoardId_, window](application::KanbanService& service) {
+        const auto now = std::chrono::system_clock::now();
+        auto flow = service.cumulativeFlow(boardId, now - window, now, window / 24);
+
+        std::map<std::string, QString> names;
+        for (const auto& column : service.listColumns(boardId)) {
+            names[column->id()] = QString::fromStdString(column->name());
+        }
+        QStringList columnNames;
+        for (const auto& columnId : flow.columns) {
+            columnNames << names[columnId];
+        }
+        return std::make_pair(std::move(flow), columnNames);
+    }, [this, request](std::pair<domain::CumulativeFlow, QStringList> result) {
+        if (request == flowRequest_) {
+            cfdWidget_->setFlow(result.first, result.second);
+        }
+    }, [this, request](const std::exception& e) {
+        if (request != flowRequest_) return;
+        cfdWidget_->clear();
+        statusLabel_->setText("❌ Erro ao calcular fluxo cumulativo: " + QString(e.what()));
+    });
 }
 
 void MainWindow::showAbout() {
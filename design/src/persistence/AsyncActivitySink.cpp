@@ -0,0 +1,382 @@
+/**
+ * @file AsyncActivitySink.cpp
+ * @brief Implementaçao do destino de auditoria assíncrono com group commit
+ * @details Contém a thread de gravaçao, a formataçao das linhas de auditoria
+ *          e o pequeno encapsulamento de I/O de baixo nível (open/write/fsync)
+ *          necessário para controlar a sincronizaçao com o disco.
+ */
+
+#include "persistence/AsyncActivitySink.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace kanban {
+namespace persistence {
+
+using domain::Activity;
+
+namespace {
+
+/// @brief Espera máxima da thread ociosa (limita o atraso de um wakeup perdido)
+constexpr std::chrono::milliseconds kIdleWait{20};
+
+/// @brief Capacidade da fila lock-free de entrada
+constexpr std::size_t kQueueCapacity = 8192;
+
+// ============================================================================
+// I/O DE BAIXO NÍVEL
+// ============================================================================
+
+int openAppend(const std::string& path) {
+#ifdef _WIN32
+    return ::_open(path.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    return ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+#endif
+}
+
+bool writeAll(int fd, const char* data, std::size_t size) {
+    while (size > 0) {
+#ifdef _WIN32
+        int n = ::_write(fd, data, static_cast<unsigned>(size));
+#else
+        ssize_t n = ::write(fd, data, size);
+#endif
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+bool syncFile(int fd) {
+#ifdef _WIN32
+    return ::_commit(fd) == 0;
+#else
+    return ::fsync(fd) == 0;
+#endif
+}
+
+void closeFile(int fd) {
+#ifdef _WIN32
+    ::_close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+/**
+ * @brief Anexa um campo escapando TAB, quebras de linha e barra invertida
+ */
+void appendField(std::string& out, const std::string& value) {
+    for (char c : value) {
+        switch (c) {
+            case '\\': out += "\\\\"; break;
+            case '\t': out += "\\t"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            default:   out.push_back(c);
+        }
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// CONSTRUTOR E DESTRUTOR
+// ============================================================================
+
+/**
+ * @brief Construtor do AsyncActivitySink
+ * @details Abre o arquivo em modo append e inicia a thread de gravaçao.
+ */
+AsyncActivitySink::AsyncActivitySink(const std::string& path,
+                                     const domain::ActivityLog& dictionary,
+                                     FsyncOptions options)
+    : path_(path),
+      dictionary_(dictionary),
+      options_(options),
+      queue_(kQueueCapacity) {
+    if (options_.maxGroup == 0) {
+        options_.maxGroup = 1;
+    }
+    fd_ = openAppend(path_);
+    if (fd_ < 0) {
+        throw ActivitySinkException("Nao foi possível abrir o arquivo de auditoria '" +
+                                    path_ + "': " + std::strerror(errno));
+    }
+    lastSync_ = std::chrono::steady_clock::now();
+    writer_ = std::thread(&AsyncActivitySink::run, this);
+}
+
+/**
+ * @brief Destrutor - grava o restante e encerra a thread
+ */
+AsyncActivitySink::~AsyncActivitySink() {
+    close();
+}
+
+// ============================================================================
+// CAMINHO DOS PRODUTORES
+// ============================================================================
+
+/**
+ * @brief Enfileira uma atividade
+ * @details Nunca realiza I/O: se a fila lock-free estiver cheia, a atividade
+ *          é guardada na lista de transbordo (apenas um mutex curto). Enquanto
+ *          o transbordo nao esvaziar, as seguintes também vao para ele, de
+ *          modo que o arquivo preserve a ordem de submissao.
+ */
+void AsyncActivitySink::submit(const Activity& activity) {
+    if (stopping_.load(std::memory_order_acquire)) {
+        return;
+    }
+    if (overflowPending_.load(std::memory_order_acquire) > 0 || !queue_.tryPush(activity)) {
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        overflow_.push_back(activity);
+        overflowPending_.store(overflow_.size(), std::memory_order_release);
+        overflowed_.fetch_add(1, std::memory_order_relaxed);
+    }
+    submitted_.fetch_add(1, std::memory_order_release);
+    if (sleeping_.load(std::memory_order_acquire)) {
+        wake_.notify_one();
+    }
+}
+
+/**
+ * @brief Aguarda até que todas as atividades submetidas estejam em disco
+ * @details Sinaliza a thread de gravaçao para sincronizar imediatamente,
+ *          independentemente da política configurada.
+ */
+void AsyncActivitySink::flush() {
+    const std::uint64_t target = submitted_.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(stateMutex_);
+    while (durable_.load(std::memory_order_acquire) < target &&
+           !closed_.load(std::memory_order_acquire)) {
+        flushRequested_.store(true, std::memory_order_release);
+        wake_.notify_one();
+        durableChanged_.wait_for(lock, kIdleWait);
+    }
+    if (!error_.empty()) {
+        throw ActivitySinkException(error_);
+    }
+}
+
+/**
+ * @brief Encerra a thread de gravaçao após esvaziar a fila
+ * @details Idempotente; chamadas seguintes nao têm efeito.
+ */
+void AsyncActivitySink::close() {
+    if (stopping_.exchange(true)) {
+        return;
+    }
+    wake_.notify_one();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
+    if (fd_ >= 0) {
+        closeFile(fd_);
+        fd_ = -1;
+    }
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        closed_.store(true, std::memory_order_release);
+    }
+    durableChanged_.notify_all();
+}
+
+// ============================================================================
+// THREAD DE GRAVAÇaO
+// ============================================================================
+
+/**
+ * @brief Laço principal: coleta, grava em grupo e sincroniza conforme a política
+ */
+void AsyncActivitySink::run() {
+    std::vector<Activity> group;
+    group.reserve(options_.maxGroup);
+
+    for (;;) {
+        group.clear();
+        collect(group);
+        if (!group.empty()) {
+            writeGroup(group);
+        }
+
+        const bool forced = flushRequested_.exchange(false, std::memory_order_acq_rel);
+        const bool stopping = stopping_.load(std::memory_order_acquire);
+        bool due = false;
+        switch (options_.policy) {
+            case FsyncPolicy::EveryCommit:
+                due = unsyncedEvents_ > 0;
+                break;
+            case FsyncPolicy::Interval:
+                due = unsyncedEvents_ > 0 &&
+                      std::chrono::steady_clock::now() - lastSync_ >= options_.interval;
+                break;
+            case FsyncPolicy::BatchSize:
+                due = unsyncedEvents_ >= options_.batchSize;
+                break;
+            case FsyncPolicy::Never:
+                break;
+        }
+        if (due || ((forced || stopping) && written_ > durable_.load(std::memory_order_relaxed))) {
+            sync();
+        } else if (forced) {
+            durableChanged_.notify_all();
+        }
+
+        if (!group.empty()) {
+            continue;
+        }
+        if (stopping) {
+            // Uma última coleta garante que nada submetido antes do close() fique para trás
+            collect(group);
+            if (group.empty()) {
+                break;
+            }
+            writeGroup(group);
+            sync();
+            continue;
+        }
+
+        auto wait = kIdleWait;
+        if (options_.policy == FsyncPolicy::Interval && unsyncedEvents_ > 0) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - lastSync_);
+            wait = std::max(std::chrono::milliseconds(1),
+                            std::min(kIdleWait, options_.interval - elapsed));
+        }
+        std::unique_lock<std::mutex> lock(stateMutex_);
+        sleeping_.store(true, std::memory_order_release);
+        wake_.wait_for(lock, wait, [this] {
+            return queue_.sizeApprox() > 0 ||
+                   stopping_.load(std::memory_order_acquire) ||
+                   flushRequested_.load(std::memory_order_acquire);
+        });
+        sleeping_.store(false, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Retira da fila (e do transbordo) até options_.maxGroup atividades
+ * @return Quantidade coletada
+ */
+std::size_t AsyncActivitySink::collect(std::vector<Activity>& group) {
+    Activity act = Activity::note(domain::kNoActivityHandle, domain::HybridTimestamp());
+    while (group.size() < options_.maxGroup && queue_.tryPop(act)) {
+        group.push_back(act);
+    }
+    if (group.size() < options_.maxGroup) {
+        std::lock_guard<std::mutex> lock(overflowMutex_);
+        std::size_t take = std::min(options_.maxGroup - group.size(), overflow_.size());
+        group.insert(group.end(), overflow_.begin(), overflow_.begin() + static_cast<std::ptrdiff_t>(take));
+        overflow_.erase(overflow_.begin(), overflow_.begin() + static_cast<std::ptrdiff_t>(take));
+        overflowPending_.store(overflow_.size(), std::memory_order_release);
+    }
+    return group.size();
+}
+
+/**
+ * @brief Formata o grupo e o grava com uma única chamada de escrita
+ * @details Em caso de erro de I/O o grupo é contabilizado como processado
+ *          (para nao bloquear flush() indefinidamente) e o erro é reportado
+ *          na próxima chamada a flush().
+ */
+void AsyncActivitySink::writeGroup(const std::vector<Activity>& group) {
+    std::string buffer;
+    buffer.reserve(group.size() * 64);
+    for (const auto& act : group) {
+        buffer += std::to_string(act.id());
+        buffer.push_back('\t');
+        buffer += std::to_string(act.timestamp().physicalMs());
+        buffer.push_back('.');
+        buffer += std::to_string(act.timestamp().logical());
+        buffer.push_back('\t');
+        buffer += domain::toString(act.kind());
+        buffer.push_back('\t');
+        appendField(buffer, dictionary_.resolve(act.subject()));
+        buffer.push_back('\t');
+        appendField(buffer, dictionary_.resolve(act.fromColumn()));
+        buffer.push_back('\t');
+        appendField(buffer, dictionary_.resolve(act.toColumn()));
+        buffer.push_back('\t');
+        buffer += std::to_string(act.index());
+        buffer.push_back('\n');
+    }
+
+    if (!writeAll(fd_, buffer.data(), buffer.size())) {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        error_ = "Falha ao gravar a auditoria em '" + path_ + "': " + std::strerror(errno);
+    }
+    written_ += group.size();
+    unsyncedEvents_ += group.size();
+}
+
+/**
+ * @brief Sincroniza o arquivo com o disco e publica o novo contador durável
+ */
+void AsyncActivitySink::sync() {
+    if (!syncFile(fd_)) {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        error_ = "Falha ao sincronizar a auditoria em '" + path_ + "': " + std::strerror(errno);
+    }
+    syncs_.fetch_add(1, std::memory_order_relaxed);
+    unsyncedEvents_ = 0;
+    lastSync_ = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(stateMutex_);
+        durable_.store(written_, std::memory_order_release);
+    }
+    durableChanged_.notify_all();
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+/**
+ * @brief Número de atividades já sincronizadas em disco
+ */
+std::uint64_t AsyncActivitySink::durableCount() const {
+    return durable_.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Caminho do arquivo de auditoria
+ */
+const std::string& AsyncActivitySink::path() const noexcept {
+    return path_;
+}
+
+/**
+ * @brief Quantidade de atividades que passaram pela lista de transbordo
+ */
+std::uint64_t AsyncActivitySink::overflowCount() const noexcept {
+    return overflowed_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Quantidade de chamadas a fsync realizadas
+ */
+std::uint64_t AsyncActivitySink::syncCount() const noexcept {
+    return syncs_.load(std::memory_order_relaxed);
+}
+
+} // namespace persistence
+} // namespace kanban
@@ -0,0 +1,459 @@
+/**
+ * @file SegmentedActivityArchive.cpp
+ * @brief Implementaçao do archive de atividades em segmentos comprimidos
+ * @details Contém a codificaçao binária dos segmentos (varints, deltas e
+ *          dicionário local) e a leitura seletiva por intervalo de tempo.
+ */
+
+#include "persistence/SegmentedActivityArchive.h"
+#include "domain/ActivityLog.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+namespace kanban {
+namespace persistence {
+
+namespace fs = std::filesystem;
+using domain::Activity;
+using domain::ActivityHandle;
+using domain::ActivityKind;
+using domain::ActivityLog;
+using domain::HybridTimestamp;
+
+namespace {
+
+constexpr char kMagic[4] = {'K', 'S', 'E', 'G'};
+constexpr std::uint8_t kVersion = 1;
+
+/// @brief Índice local reservado para handles ausentes (kNoActivityHandle)
+constexpr std::uint64_t kNoLocalIndex = 0;
+
+// ============================================================================
+// CODIFICAÇaO VARINT (LEB128 sem sinal)
+// ============================================================================
+
+void putVarint(std::string& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+/**
+ * @brief Cursor de leitura sobre o conteúdo de um segmento
+ * @details Qualquer leitura além do fim lança ActivityArchiveException.
+ */
+class Reader {
+public:
+    Reader(const std::string& data, const std::string& path)
+        : data_(data), path_(path) {}
+
+    std::uint64_t varint() {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            std::uint8_t byte = this->byte();
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        throw ActivityArchiveException("Varint inválido no segmento: " + path_);
+    }
+
+    std::uint8_t byte() {
+        if (pos_ >= data_.size()) {
+            throw ActivityArchiveException("Segmento truncado: " + path_);
+        }
+        return static_cast<std::uint8_t>(data_[pos_++]);
+    }
+
+    std::string string(std::size_t length) {
+        if (data_.size() - pos_ < length) {
+            throw ActivityArchiveException("Segmento truncado: " + path_);
+        }
+        std::string s = data_.substr(pos_, length);
+        pos_ += length;
+        return s;
+    }
+
+private:
+    const std::string& data_;
+    const std::string& path_;
+    std::size_t pos_ = 0;
+};
+
+} // namespace
+
+// ============================================================================
+// IMPLEMENTAÇaO DA CLASSE SegmentedActivityArchive
+// ============================================================================
+
+/**
+ * @brief Construtor do SegmentedActivityArchive
+ * @param directory Diretório dos segmentos
+ */
+SegmentedActivityArchive::SegmentedActivityArchive(const std::string& directory)
+    : directory_(directory) {}
+
+/**
+ * @brief Remove o arquivo de um segmento gravado e nunca publicado
+ */
+SegmentedActivityArchive::PendingSegment::~PendingSegment() {
+    if (!published && !info.path.empty()) {
+        std::error_code ec;
+        fs::remove(info.path, ec);
+    }
+}
+
+/**
+ * @brief Grava um lote como um novo segmento
+ * @details Handles do log sao traduzidos para índices em um dicionário local
+ *          ao segmento (índice 0 reservado para "ausente"), de modo que o
+ *          arquivo seja autocontido e legível por outro processo. Nenhum
+ *          membro é alterado: o índice só muda em publish().
+ */
+std::unique_ptr<interfaces::IActivityArchive::PendingAppend>
+SegmentedActivityArchive::write(const std::vector<Activity>& batch,
+                                const ActivityLog& dictionary) {
+    auto pending = std::make_unique<PendingSegment>();
+    if (batch.empty()) {
+        return pending;
+    }
+
+    // Dicionário local: handle do log -> índice no segmento (1-based)
+    std::unordered_map<ActivityHandle, std::uint64_t> local;
+    std::vector<ActivityHandle> order;
+    auto localIndex = [&](ActivityHandle h) -> std::uint64_t {
+        if (h == domain::kNoActivityHandle) {
+            return kNoLocalIndex;
+        }
+        auto [it, inserted] = local.emplace(h, order.size() + 1);
+        if (inserted) {
+            order.push_back(h);
+        }
+        return it->second;
+    };
+
+    std::string records;
+    records.reserve(batch.size() * 8);
+    std::uint64_t prevId = batch.front().id();
+    std::uint64_t prevTs = batch.front().timestamp().packed();
+    for (const auto& act : batch) {
+        records.push_back(static_cast<char>(act.kind()));
+        putVarint(records, act.id() - prevId);
+        putVarint(records, act.timestamp().packed() - prevTs);
+        putVarint(records, localIndex(act.subject()));
+        putVarint(records, localIndex(act.fromColumn()));
+        putVarint(records, localIndex(act.toColumn()));
+        putVarint(records, act.index());
+        prevId = act.id();
+        prevTs = act.timestamp().packed();
+    }
+
+    std::string data(kMagic, sizeof(kMagic));
+    data.push_back(static_cast<char>(kVersion));
+    putVarint(data, batch.size());
+    putVarint(data, batch.front().id());
+    putVarint(data, batch.front().timestamp().packed());
+    putVarint(data, order.size());
+    for (ActivityHandle h : order) {
+        const std::string& s = dictionary.resolve(h);
+        putVarint(data, s.size());
+        data += s;
+    }
+    data += records;
+
+    std::error_code ec;
+    fs::create_directories(directory_, ec);
+    if (ec) {
+        throw ActivityArchiveException("Nao foi possível criar o diretório '" +
+                                       directory_ + "': " + ec.message());
+    }
+
+    const std::string name = "segment-" + std::to_string(batch.front().id()) + ".kseg";
+    const fs::path finalPath = fs::path(directory_) / name;
+    const fs::path tmpPath = fs::path(directory_) / (name + ".tmp");
+    {
+        std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw ActivityArchiveException("Nao foi possível criar o segmento: " + tmpPath.string());
+        }
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        if (!out) {
+            throw ActivityArchiveException("Falha ao gravar o segmento: " + tmpPath.string());
+        }
+    }
+    fs::rename(tmpPath, finalPath, ec);
+    if (ec) {
+        throw ActivityArchiveException("Falha ao publicar o segmento '" +
+                                       finalPath.string() + "': " + ec.message());
+    }
+
+    SegmentInfo& info = pending->info;
+    info.path = finalPath.string();
+    info.firstId = batch.front().id();
+    info.lastId = batch.back().id();
+    info.firstTs = batch.front().timestamp().packed();
+    info.lastTs = batch.back().timestamp().packed();
+    info.count = batch.size();
+    info.bytes = data.size();
+    for (const auto& act : batch) {
+        if (act.kind() != ActivityKind::Note) {
+            info.subjects.push_back(act.subject());
+        }
+        ++info.kinds[static_cast<std::size_t>(act.kind())];
+    }
+    std::sort(info.subjects.begin(), info.subjects.end());
+    info.subjects.erase(std::unique(info.subjects.begin(), info.subjects.end()), info.subjects.end());
+    info.subjects.shrink_to_fit();
+    return pending;
+}
+
+/**
+ * @brief Acrescenta ao índice o segmento gravado por write()
+ * @details Um lote vazio nao produz segmento e é ignorado.
+ */
+void SegmentedActivityArchive::publish(std::unique_ptr<PendingAppend> pending) {
+    auto& segment = static_cast<PendingSegment&>(*pending);
+    if (segment.info.count == 0) {
+        return;
+    }
+    segments_.push_back(segment.info);
+    total_ += segment.info.count;
+    segment.published = true;
+}
+
+/**
+ * @brief Percorre as atividades arquivadas no intervalo [from, to]
+ * @details Os segmentos estao em ordem cronológica: o primeiro segmento que
+ *          pode conter o intervalo é localizado por busca binária sobre o
+ *          último timestamp, e a varredura termina no primeiro segmento que
+ *          começa depois de to.
+ */
+void SegmentedActivityArchive::scan(HybridTimestamp from,
+                                    HybridTimestamp to,
+                                    const ActivityLog& dictionary,
+                                    const Visitor& visit) const {
+    auto it = std::lower_bound(segments_.begin(), segments_.end(), from.packed(),
+                               [](const SegmentInfo& info, std::uint64_t ts) {
+                                   return info.lastTs < ts;
+                               });
+    for (; it != segments_.end() && it->firstTs <= to.packed(); ++it) {
+        for (const auto& act : readSegment(*it, dictionary)) {
+            if (act.timestamp() > to) {
+                return;
+            }
+            if (act.timestamp() >= from) {
+                visit(act);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Lê atividades arquivadas pelos seus números de sequência
+ * @details Para cada ID, o segmento é localizado por busca binária sobre o
+ *          primeiro ID; IDs consecutivos no mesmo segmento reaproveitam a
+ *          mesma decodificaçao.
+ */
+void SegmentedActivityArchive::fetch(const std::vector<std::uint64_t>& ids,
+                                     const ActivityLog& dictionary,
+                                     const Visitor& visit) const {
+    const SegmentInfo* current = nullptr;
+    std::vector<Activity> decoded;
+    for (std::uint64_t id : ids) {
+        if (!current || id < current->firstId || id > current->lastId) {
+            auto it = std::upper_bound(segments_.begin(), segments_.end(), id,
+                                       [](std::uint64_t value, const SegmentInfo& info) {
+                                           return value < info.firstId;
+                                       });
+            if (it == segments_.begin() || id > std::prev(it)->lastId) {
+                continue;
+            }
+            current = &*std::prev(it);
+            decoded = readSegment(*current, dictionary);
+        }
+        // IDs sao contíguos dentro de um segmento
+        const Activity& act = decoded[static_cast<std::size_t>(id - current->firstId)];
+        visit(act);
+    }
+}
+
+/**
+ * @brief As atividades arquivadas mais recentes de um card
+ */
+void SegmentedActivityArchive::lastForSubject(ActivityHandle subject,
+                                              std::size_t limit,
+                                              const ActivityLog& dictionary,
+                                              const Visitor& visit) const {
+    lastMatching(
+        [subject](const SegmentInfo& info) {
+            return std::binary_search(info.subjects.begin(), info.subjects.end(), subject);
+        },
+        [subject](const Activity& act) {
+            return act.kind() != ActivityKind::Note && act.subject() == subject;
+        },
+        limit, dictionary, visit);
+}
+
+/**
+ * @brief As n atividades arquivadas mais recentes de um tipo
+ */
+void SegmentedActivityArchive::lastOfKind(ActivityKind kind,
+                                          std::size_t n,
+                                          const ActivityLog& dictionary,
+                                          const Visitor& visit) const {
+    if (n == 0) {
+        return;
+    }
+    const auto k = static_cast<std::size_t>(kind);
+    lastMatching([k](const SegmentInfo& info) { return info.kinds[k] > 0; },
+                 [kind](const Activity& act) { return act.kind() == kind; },
+                 n, dictionary, visit);
+}
+
+/**
+ * @brief Percorre os segmentos do mais recente para o mais antigo
+ * @details Cada segmento candidato é decodificado uma única vez; a busca
+ *          termina assim que limit atividades forem reunidas. O resultado é
+ *          entregue em ordem cronológica.
+ */
+void SegmentedActivityArchive::lastMatching(const std::function<bool(const SegmentInfo&)>& candidate,
+                                            const std::function<bool(const Activity&)>& match,
+                                            std::size_t limit,
+                                            const ActivityLog& dictionary,
+                                            const Visitor& visit) const {
+    std::vector<std::vector<Activity>> chunks;   // do segmento mais recente para o mais antigo
+    std::size_t found = 0;
+    for (auto it = segments_.rbegin(); it != segments_.rend() && (limit == 0 || found < limit); ++it) {
+        if (!candidate(*it)) {
+            continue;
+        }
+        std::vector<Activity> chunk;
+        for (const auto& act : readSegment(*it, dictionary)) {
+            if (match(act)) {
+                chunk.push_back(act);
+            }
+        }
+        if (limit != 0 && found + chunk.size() > limit) {
+            chunk.erase(chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(found + chunk.size() - limit));
+        }
+        found += chunk.size();
+        chunks.push_back(std::move(chunk));
+    }
+    for (auto chunk = chunks.rbegin(); chunk != chunks.rend(); ++chunk) {
+        for (const auto& act : *chunk) {
+            visit(act);
+        }
+    }
+}
+
+/**
+ * @brief Decodifica todas as atividades de um segmento
+ * @details Strings do dicionário local sao traduzidas de volta para handles
+ *          com ActivityLog::find(); strings desconhecidas pelo log resultam
+ *          em kNoActivityHandle.
+ */
+std::vector<Activity> SegmentedActivityArchive::readSegment(const SegmentInfo& info,
+                                                            const ActivityLog& dictionary) const {
+    std::ifstream in(info.path, std::ios::binary);
+    if (!in) {
+        throw ActivityArchiveException("Nao foi possível abrir o segmento: " + info.path);
+    }
+    const std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    Reader reader(data, info.path);
+    if (reader.string(sizeof(kMagic)) != std::string(kMagic, sizeof(kMagic)) ||
+        reader.byte() != kVersion) {
+        throw ActivityArchiveException("Formato de segmento desconhecido: " + info.path);
+    }
+
+    const std::uint64_t count = reader.varint();
+    std::uint64_t id = reader.varint();
+    std::uint64_t ts = reader.varint();
+    if (count != info.count || id != info.firstId) {
+        throw ActivityArchiveException("Cabeçalho inconsistente no segmento: " + info.path);
+    }
+
+    std::vector<ActivityHandle> handles(1, domain::kNoActivityHandle);
+    const std::uint64_t entries = reader.varint();
+    handles.reserve(entries + 1);
+    for (std::uint64_t i = 0; i < entries; ++i) {
+        handles.push_back(dictionary.find(reader.string(reader.varint())));
+    }
+    auto handleAt = [&](std::uint64_t local) {
+        if (local >= handles.size()) {
+            throw ActivityArchiveException("Índice de dicionário inválido no segmento: " + info.path);
+        }
+        return handles[local];
+    };
+
+    std::vector<Activity> result;
+    result.reserve(info.count);
+    for (std::uint64_t i = 0; i < count; ++i) {
+        const auto kind = static_cast<ActivityKind>(reader.byte());
+        id += reader.varint();
+        ts += reader.varint();
+        const ActivityHandle subject = handleAt(reader.varint());
+        const ActivityHandle fromColumn = handleAt(reader.varint());
+        const ActivityHandle toColumn = handleAt(reader.varint());
+        const auto index = static_cast<std::uint32_t>(reader.varint());
+        result.push_back(Activity::restore(id, kind, subject, fromColumn, toColumn, index,
+                                           HybridTimestamp(ts)));
+    }
+    return result;
+}
+
+/**
+ * @brief Número total de atividades arquivadas
+ */
+std::size_t SegmentedActivityArchive::size() const {
+    return total_;
+}
+
+/**
+ * @brief Remove todos os arquivos de segmento conhecidos
+ * @details Falhas individuais de remoçao sao ignoradas; o índice em
+ *          memória é sempre esvaziado.
+ */
+void SegmentedActivityArchive::clear() {
+    for (const auto& info : segments_) {
+        std::error_code ec;
+        fs::remove(info.path, ec);
+    }
+    segments_.clear();
+    total_ = 0;
+}
+
+/**
+ * @brief Metadados dos segmentos em ordem cronológica
+ */
+const std::vector<SegmentedActivityArchive::SegmentInfo>&
+SegmentedActivityArchive::segments() const noexcept {
+    return segments_;
+}
+
+/**
+ * @brief Diretório dos segmentos
+ */
+const std::string& SegmentedActivityArchive::directory() const noexcept {
+    return directory_;
+}
+
+/**
+ * @brief Total de bytes ocupados pelos segmentos em disco
+ */
+std::size_t SegmentedActivityArchive::bytesOnDisk() const noexcept {
+    std::size_t total = 0;
+    for (const auto& info : segments_) {
+        total += info.bytes;
+    }
+    return total;
+}
+
+} // namespace persistence
+} // namespace kanban
@@ -0,0 +1,373 @@
+/**
+ * @file PredicateKernels.cpp
+ * @brief Implementaçao dos kernels escalares, SSE2 e AVX2
+ * @details Todos os kernels produzem uma palavra de 64 bits por bloco de 64
+ *          linhas. Cada operador é reduzido a uma comparaçao básica (igual,
+ *          menor, maior, zero) mais uma inversao opcional da palavra, de modo
+ *          que cada conjunto de instruções implementa só as comparações
+ *          básicas. As linhas do último bloco incompleto sao avaliadas pelo
+ *          caminho escalar.
+ *
+ *          As funções AVX2 sao compiladas com o atributo target("avx2") (GCC
+ *          e Clang) e só sao chamadas quando a CPU o suporta; o restante do
+ *          projeto continua compilado para a arquitetura base.
+ */
+
+#include "simd/PredicateKernels.h"
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define KANBAN_SIMD_X86 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define KANBAN_TARGET_AVX2
+#else
+#define KANBAN_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace kanban {
+namespace simd {
+
+namespace {
+
+// ============================================================================
+// SELEÇaO DO CONJUNTO DE INSTRUÇÕES
+// ============================================================================
+
+Isa detect() noexcept {
+#if defined(KANBAN_SIMD_X86)
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        if (osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(info, 7, 0);
+            if (info[1] & (1 << 5)) {
+                return Isa::Avx2;
+            }
+        }
+    }
+    return Isa::Sse2;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? Isa::Avx2 : Isa::Sse2;
+#endif
+#else
+    return Isa::Scalar;
+#endif
+}
+
+std::atomic<Isa>& activeSlot() noexcept {
+    static std::atomic<Isa> active{detectedIsa()};
+    return active;
+}
+
+// ============================================================================
+// COMPARAÇÕES BÁSICAS
+// ============================================================================
+
+/// @brief Comparaçao básica; os demais operadores sao o seu complemento
+enum class Basic { Equal, Less, Greater, Zero, EqualMask };
+
+/**
+ * @brief Decompõe um operador em comparaçao básica + inversao
+ */
+void decompose(Compare op, Basic& basic, bool& invert) noexcept {
+    switch (op) {
+        case Compare::Equal:        basic = Basic::Equal;   invert = false; return;
+        case Compare::NotEqual:     basic = Basic::Equal;   invert = true;  return;
+        case Compare::Less:         basic = Basic::Less;    invert = false; return;
+        case Compare::GreaterEqual: basic = Basic::Less;    invert = true;  return;
+        case Compare::Greater:      basic = Basic::Greater; invert = false; return;
+        case Compare::LessEqual:    basic = Basic::Greater; invert = true;  return;
+    }
+}
+
+/**
+ * @brief Máscara dos n bits menos significativos (n <= 64)
+ */
+inline std::uint64_t lowBits(std::size_t n) noexcept {
+    return n >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1;
+}
+
+// ----------------------------------------------------------------------------
+// Escalar
+// ----------------------------------------------------------------------------
+
+template<Basic B>
+std::uint64_t scalarInt32(const std::int32_t* v, std::size_t n, std::int32_t k) noexcept {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        bool hit = (B == Basic::Equal) ? v[i] == k : (B == Basic::Less) ? v[i] < k : v[i] > k;
+        word |= std::uint64_t{hit} << i;
+    }
+    return word;
+}
+
+/// @brief Bits das linhas FORA de [min, max]
+std::uint64_t scalarOutside(const std::int64_t* v, std::size_t n, std::int64_t min, std::int64_t max) noexcept {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        word |= std::uint64_t{v[i] < min || v[i] > max} << i;
+    }
+    return word;
+}
+
+template<Basic B>
+std::uint64_t scalarMask(const std::uint64_t* v, std::size_t n, std::uint64_t mask) noexcept {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        bool hit = (B == Basic::Zero) ? (v[i] & mask) == 0 : (v[i] & mask) == mask;
+        word |= std::uint64_t{hit} << i;
+    }
+    return word;
+}
+
+#if defined(KANBAN_SIMD_X86)
+
+// ----------------------------------------------------------------------------
+// SSE2
+// ----------------------------------------------------------------------------
+
+template<Basic B>
+std::uint64_t sse2Int32(const std::int32_t* v, std::int32_t k) noexcept {
+    const __m128i key = _mm_set1_epi32(k);
+    std::uint64_t word = 0;
+    for (unsigned j = 0; j < 64; j += 4) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + j));
+        __m128i hit = (B == Basic::Equal) ? _mm_cmpeq_epi32(x, key)
+                    : (B == Basic::Less)  ? _mm_cmpgt_epi32(key, x)
+                                          : _mm_cmpgt_epi32(x, key);
+        word |= static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(hit))) << j;
+    }
+    return word;
+}
+
+/**
+ * @brief a > b em inteiros de 64 bits com sinal, usando apenas SSE2
+ * @details Parte alta comparada com sinal; em caso de empate, decide a parte
+ *          baixa comparada sem sinal (via deslocamento de 0x80000000).
+ */
+inline __m128i sse2Gt64(__m128i a, __m128i b) noexcept {
+    const __m128i bias = _mm_set_epi32(0, static_cast<int>(0x80000000u), 0, static_cast<int>(0x80000000u));
+    __m128i gt = _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+    __m128i eq = _mm_cmpeq_epi32(a, b);
+    __m128i gtHigh = _mm_shuffle_epi32(gt, _MM_SHUFFLE(3, 3, 1, 1));
+    __m128i eqHigh = _mm_shuffle_epi32(eq, _MM_SHUFFLE(3, 3, 1, 1));
+    __m128i gtLow = _mm_shuffle_epi32(gt, _MM_SHUFFLE(2, 2, 0, 0));
+    return _mm_or_si128(gtHigh, _mm_and_si128(eqHigh, gtLow));
+}
+
+/**
+ * @brief Igualdade de inteiros de 64 bits usando apenas SSE2
+ */
+inline __m128i sse2Eq64(__m128i a, __m128i b) noexcept {
+    __m128i eq = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+std::uint64_t sse2Outside(const std::int64_t* v, std::int64_t min, std::int64_t max) noexcept {
+    const __m128i lo = _mm_set1_epi64x(min);
+    const __m128i hi = _mm_set1_epi64x(max);
+    std::uint64_t word = 0;
+    for (unsigned j = 0; j < 64; j += 2) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v + j));
+        __m128i out = _mm_or_si128(sse2Gt64(lo, x), sse2Gt64(x, hi));
+        word |= static_cast<std::uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(out))) << j;
+    }
+    return word;
+}
+
+template<Basic B>
+std::uint64_t sse2Mask(const std::uint64_t* v, std::uint64_t mask) noexcept {
+    const __m128i m = _mm_set1_epi64x(static_cast<long long>(mask));
+    const __m128i target = (B == Basic::Zero) ? _mm_setzero_si128() : m;
+    std::uint64_t word = 0;
+    for (unsigned j = 0; j < 64; j += 2) {
+        __m128i x = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v + j)), m);
+        __m128i hit = sse2Eq64(x, target);
+        word |= static_cast<std::uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(hit))) << j;
+    }
+    return word;
+}
+
+// ----------------------------------------------------------------------------
+// AVX2
+// ----------------------------------------------------------------------------
+
+template<Basic B>
+KANBAN_TARGET_AVX2 std::uint64_t avx2Int32(const std::int32_t* v, std::int32_t k) noexcept {
+    const __m256i key = _mm256_set1_epi32(k);
+    std::uint64_t word = 0;
+    for (unsigned j = 0; j < 64; j += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(v + j));
+        __m256i hit = (B == Basic::Equal) ? _mm256_cmpeq_epi32(x, key)
+                    : (B == Basic::Less)  ? _mm256_cmpgt_epi32(key, x)
+                                          : _mm256_cmpgt_epi32(x, key);
+        word |= static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(hit))) << j;
+    }
+    return word;
+}
+
+KANBAN_TARGET_AVX2 std::uint64_t avx2Outside(const std::int64_t* v, std::int64_t min, std::int64_t max) noexcept {
+    const __m256i lo = _mm256_set1_epi64x(min);
+    const __m256i hi = _mm256_set1_epi64x(max);
+    std::uint64_t word = 0;
+    for (unsigned j = 0; j < 64; j += 4) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(v + j));
+        __m256i out = _mm256_or_si256(_mm256_cmpgt_epi64(lo, x), _mm256_cmpgt_epi64(x, hi));
+        word |= static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(out))) << j;
+    }
+    return word;
+}
+
+template<Basic B>
+KANBAN_TARGET_AVX2 std::uint64_t avx2Mask(const std::uint64_t* v, std::uint64_t mask) noexcept {
+    const __m256i m = _mm256_set1_epi64x(static_cast<long long>(mask));
+    const __m256i target = (B == Basic::Zero) ? _mm256_setzero_si256() : m;
+    std::uint64_t word = 0;
+    for (unsigned j = 0; j < 64; j += 4) {
+        __m256i x = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(v + j)), m);
+        __m256i hit = _mm256_cmpeq_epi64(x, target);
+        word |= static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(hit))) << j;
+    }
+    return word;
+}
+
+#endif // KANBAN_SIMD_X86
+
+// ============================================================================
+// LAÇOS POR BLOCO
+// ============================================================================
+
+/**
+ * @brief Preenche out bloco a bloco: block(i) para blocos completos e
+ *        tail(i, n) para o último, invertendo as palavras se pedido
+ */
+template<typename Block, typename Tail>
+void fill(std::size_t count, bool invert, Bitmap& out, Block block, Tail tail) {
+    out.assign(count, false);
+    std::uint64_t* words = out.words();
+    const std::uint64_t flip = invert ? ~std::uint64_t{0} : 0;
+    const std::size_t full = count / 64;
+    for (std::size_t w = 0; w < full; ++w) {
+        words[w] = block(w * 64) ^ flip;
+    }
+    if (count % 64 != 0) {
+        std::size_t n = count % 64;
+        words[full] = (tail(full * 64, n) ^ flip) & lowBits(n);
+    }
+}
+
+template<Basic B>
+void compareInt32With(const std::int32_t* values, std::size_t count, std::int32_t k, bool invert, Bitmap& out) {
+    auto tail = [&](std::size_t i, std::size_t n) { return scalarInt32<B>(values + i, n, k); };
+    switch (activeIsa()) {
+#if defined(KANBAN_SIMD_X86)
+        case Isa::Avx2:
+            fill(count, invert, out, [&](std::size_t i) { return avx2Int32<B>(values + i, k); }, tail);
+            return;
+        case Isa::Sse2:
+            fill(count, invert, out, [&](std::size_t i) { return sse2Int32<B>(values + i, k); }, tail);
+            return;
+#endif
+        default:
+            fill(count, invert, out, [&](std::size_t i) { return scalarInt32<B>(values + i, 64, k); }, tail);
+            return;
+    }
+}
+
+template<Basic B>
+void matchMaskWith(const std::uint64_t* masks, std::size_t count, std::uint64_t mask, bool invert, Bitmap& out) {
+    auto tail = [&](std::size_t i, std::size_t n) { return scalarMask<B>(masks + i, n, mask); };
+    switch (activeIsa()) {
+#if defined(KANBAN_SIMD_X86)
+        case Isa::Avx2:
+            fill(count, invert, out, [&](std::size_t i) { return avx2Mask<B>(masks + i, mask); }, tail);
+            return;
+        case Isa::Sse2:
+            fill(count, invert, out, [&](std::size_t i) { return sse2Mask<B>(masks + i, mask); }, tail);
+            return;
+#endif
+        default:
+            fill(count, invert, out, [&](std::size_t i) { return scalarMask<B>(masks + i, 64, mask); }, tail);
+            return;
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// API PÚBLICA
+// ============================================================================
+
+Isa detectedIsa() noexcept {
+    static const Isa detected = detect();
+    return detected;
+}
+
+Isa activeIsa() noexcept {
+    return activeSlot().load(std::memory_order_relaxed);
+}
+
+Isa setActiveIsa(Isa isa) noexcept {
+    Isa limit = detectedIsa();
+    Isa chosen = static_cast<int>(isa) <= static_cast<int>(limit) ? isa : limit;
+    activeSlot().store(chosen, std::memory_order_relaxed);
+    return chosen;
+}
+
+const char* isaName(Isa isa) noexcept {
+    switch (isa) {
+        case Isa::Scalar: return "escalar";
+        case Isa::Sse2:   return "SSE2";
+        case Isa::Avx2:   return "AVX2";
+    }
+    return "?";
+}
+
+void compareInt32(const std::int32_t* values, std::size_t count, Compare op, std::int32_t operand, Bitmap& out) {
+    Basic basic = Basic::Equal;
+    bool invert = false;
+    decompose(op, basic, invert);
+    switch (basic) {
+        case Basic::Less:    compareInt32With<Basic::Less>(values, count, operand, invert, out); return;
+        case Basic::Greater: compareInt32With<Basic::Greater>(values, count, operand, invert, out); return;
+        default:             compareInt32With<Basic::Equal>(values, count, operand, invert, out); return;
+    }
+}
+
+void rangeInt64(const std::int64_t* values, std::size_t count, std::int64_t min, std::int64_t max, Bitmap& out) {
+    // Calcula as linhas fora do intervalo e inverte
+    auto tail = [&](std::size_t i, std::size_t n) { return scalarOutside(values + i, n, min, max); };
+    switch (activeIsa()) {
+#if defined(KANBAN_SIMD_X86)
+        case Isa::Avx2:
+            fill(count, true, out, [&](std::size_t i) { return avx2Outside(values + i, min, max); }, tail);
+            return;
+        case Isa::Sse2:
+            fill(count, true, out, [&](std::size_t i) { return sse2Outside(values + i, min, max); }, tail);
+            return;
+#endif
+        default:
+            fill(count, true, out, [&](std::size_t i) { return scalarOutside(values + i, 64, min, max); }, tail);
+            return;
+    }
+}
+
+void matchMask(const std::uint64_t* masks, std::size_t count, std::uint64_t mask, MaskMatch mode, Bitmap& out) {
+    switch (mode) {
+        case MaskMatch::Any:  matchMaskWith<Basic::Zero>(masks, count, mask, true, out); return;
+        case MaskMatch::None: matchMaskWith<Basic::Zero>(masks, count, mask, false, out); return;
+        case MaskMatch::All:  matchMaskWith<Basic::EqualMask>(masks, count, mask, false, out); return;
+    }
+}
+
+} // namespace simd
+} // namespace kanban
@@ -1,5 +1,6 @@
 // Este arquivo inclui apenas os headers para garantir que os .h compilam.
 #include "../include/domain/ActivityLog.h"
+#include "../include/domain/ActivityRollup.h"
 #include "../include/domain/Board.h"
 #include "../include/domain/Card.h"
 #include "../include/domain/Column.h"
@@ -10,6 +11,11 @@
 #include "../include/interfaces/IView.h"
 #include "../include/persistence/FileRepository.h"
 #include "persistence/MemoryRepository.h"
+#include "persistence/SegmentedActivityArchive.h"
+#include "persistence/AsyncActivitySink.h"
+#include <fstream>
+#include <sstream>
+#include <filesystem>
 #include <iostream>
 
 // Define TEST_CARD para ativar o teste
@@ -69,27 +75,188 @@ void testActivityLog() {
     
     ActivityLog log;
     
-    auto now = Clock::now();
-    Activity act1("act1", "Card '1' movido de 'To Do' para 'Doing'", now);
-    Activity act2("act2", "Card '2' criado em 'To Do'", now + std::chrono::seconds(10));
+    Activity act1 = Activity::cardMoved(log.intern("1"), log.intern("todo"),
+                                        log.intern("doing"), 0, log.now());
     
     log.add(act1);
-    log.add(std::move(act2));
+    log.note("Card '2' criado em 'To Do'");
     
     std::cout << "ActivityLog tem " << log.size() << " atividades\n";
     
-    const Activity* last = log.last();
+    auto last = log.last();
     if (last) {
         std::cout << "Última atividade: " << *last << std::endl;
     }
     
-    // Listar todas as atividades
+    // Listar todas as atividades (renderizadas sob demanda)
     for (const auto& activity : log.activities()) {
-        std::cout << " - " << activity << std::endl;
+        std::cout << " - " << activity << " -> " << log.describe(activity) << std::endl;
     }
 }
 #endif
 
+#define TEST_ACTIVITY_RETENTION
+
+#ifdef TEST_ACTIVITY_RETENTION
+void testActivityRetention() {
+    using namespace kanban::domain;
+
+    auto dir = std::filesystem::temp_directory_path() / "kanban_activity_test";
+    std::filesystem::remove_all(dir);
+    auto archive = std::make_shared<kanban::persistence::SegmentedActivityArchive>(dir.string());
+
+    ActivityLog log;
+    ActivityRetention retention;
+    retention.memoryCapacity = 100;
+    retention.spillBatch = 25;
+    retention.archive = archive;
+    log.setRetention(retention);
+
+    HybridTimestamp middle;
+    for (int i = 0; i < 1000; ++i) {
+        log.add(Activity::cardMoved(log.intern("card_" + std::to_string(i % 10)),
+                                    log.intern("todo"), log.intern("doing"),
+                                    static_cast<std::uint32_t>(i), log.now()));
+        if (i == 500) {
+            middle = log.last()->timestamp();
+        }
+    }
+
+    std::size_t visited = 0;
+    std::uint64_t expectedId = 1;
+    bool ordered = true;
+    log.forEach([&](const Activity& a) {
+        ordered = ordered && a.id() == expectedId++;
+        ++visited;
+    });
+
+    std::size_t inRange = 0;
+    log.forEachInRange(middle, log.last()->timestamp(), [&](const Activity&) { ++inRange; });
+
+    log.flushArchive();   // os segmentos sao gravados pela thread de descarga
+    std::cout << "Retençao: " << log.inMemorySize() << " em memória, "
+              << archive->size() << " arquivadas em " << archive->segments().size()
+              << " segmentos (" << archive->bytesOnDisk() << " bytes)\n";
+    std::cout << "Leitura completa: " << visited << (ordered ? " em ordem" : " FORA DE ORDEM")
+              << ", intervalo: " << inRange << " (esperado 500)\n";
+
+    auto history = log.forCard("card_3");
+    auto lastFive = log.forCard("card_3", 5);
+    log.add(Activity::cardTagsUpdated(log.intern("card_3"), log.intern("doing"), log.now()));
+    auto tagged = log.lastOfKind(ActivityKind::CardTagsUpdated, 10);
+    auto moved = log.lastOfKind(ActivityKind::CardMoved, 150);
+    std::cout << "Histórico do card_3: " << history.size() << " (esperado 100), primeiro id "
+              << (history.empty() ? 0 : history.front().id()) << ", últimos 5 a partir do id "
+              << (lastFive.empty() ? 0 : lastFive.front().id()) << "\n";
+    std::cout << "Tags atualizadas: " << tagged.size() << ", recentes: " << log.recent(3).size()
+              << ", movimentos: " << moved.size() << " (esperado 150) a partir do id "
+              << (moved.empty() ? 0 : moved.front().id()) << " (esperado 851)\n";
+
+    log.clear();
+    std::filesystem::remove_all(dir);
+
+    // Archive inutilizável: add() nunca lança, o erro fica em spillError()
+    std::ofstream(dir.string()) << "nao é um diretório";
+    ActivityLog broken;
+    broken.setRetention(retention);
+    for (int i = 0; i < 300; ++i) {
+        broken.add(Activity::note(broken.intern("nota"), broken.now()));
+    }
+    bool flushFailed = false;
+    try {
+        broken.flushArchive();
+    } catch (const std::runtime_error&) {
+        flushFailed = true;
+    }
+    std::cout << "Archive com falha: " << broken.size() << " atividades (esperado 300), erro "
+              << (broken.spillError() ? "reportado" : "AUSENTE") << ", flushArchive "
+              << (flushFailed ? "lançou" : "NAO lançou") << "\n";
+    broken.setRetention(ActivityRetention{});
+    std::filesystem::remove_all(dir);
+}
+#endif
+
+#define TEST_ACTIVITY_ROLLUP
+
+#ifdef TEST_ACTIVITY_ROLLUP
+void testActivityRollup() {
+    using namespace kanban::domain;
+
+    ActivityLog log;
+    const auto start = std::chrono::system_clock::now() - std::chrono::hours(24 * 21);
+    for (int day = 0; day < 21; ++day) {
+        auto when = HybridTimestamp::fromTimePoint(start + std::chrono::hours(24 * day));
+        for (int i = 0; i <= day % 3; ++i) {
+            log.add(Activity::cardMoved(log.intern("card_" + std::to_string(i)),
+                                        log.intern("doing"), log.intern("done"), 0,
+                                        HybridTimestamp(when.packed() + static_cast<std::uint64_t>(i))));
+        }
+    }
+
+    auto weekly = log.rollup(ActivityKind::CardMoved, "done", RollupGranularity::Week,
+                             start, std::chrono::system_clock::now());
+    std::uint64_t total = 0;
+    for (const auto& point : weekly) {
+        total += point.events;
+    }
+    auto leaving = log.rollup(ActivityKind::CardMoved, "doing", RollupGranularity::Day,
+                              start, std::chrono::system_clock::now());
+    std::cout << "Rollup: " << weekly.size() << " semanas, " << total
+              << " entradas em 'done' (esperado 42), " << leaving.size() << " dias com saídas de 'doing'\n";
+
+    std::stringstream saved;
+    log.saveRollups(saved);
+    ActivityLog restored;
+    restored.loadRollups(saved);
+    auto again = restored.rollup(ActivityKind::CardMoved, "", RollupGranularity::Day,
+                                 start, std::chrono::system_clock::now());
+    std::cout << "Rollup restaurado: " << again.size() << " dias (esperado 21)\n";
+}
+#endif
+
+#define TEST_ACTIVITY_SINK
+
+#ifdef TEST_ACTIVITY_SINK
+void testActivitySink() {
+    using namespace kanban::domain;
+    using namespace kanban::persistence;
+
+    auto path = std::filesystem::temp_directory_path() / "kanban_activity_audit.log";
+    std::filesystem::remove(path);
+
+    ActivityLog log;
+    FsyncOptions options;
+    options.policy = FsyncPolicy::BatchSize;
+    options.batchSize = 64;
+    auto sink = std::make_shared<AsyncActivitySink>(path.string(), log, options);
+    log.setSink(sink);
+
+    for (int i = 0; i < 500; ++i) {
+        log.add(Activity::cardMoved(log.intern("card_" + std::to_string(i % 7)),
+                                    log.intern("todo"), log.intern("done"),
+                                    static_cast<std::uint32_t>(i), log.now()));
+    }
+    log.note("linha com\ttab");
+    log.publish();   // o sink recebe as atividades na publicaçao
+    sink->flush();
+
+    std::ifstream in(path);
+    std::size_t lines = 0;
+    bool sequenced = true;
+    for (std::string line; std::getline(in, line);) {
+        ++lines;
+        sequenced = sequenced && line.compare(0, line.find('\t'), std::to_string(lines)) == 0;
+    }
+    std::cout << "Auditoria: " << lines << " linhas (esperado 501)"
+              << (sequenced ? " em sequência" : " FORA DE SEQUÊNCIA") << ", duráveis: "
+              << sink->durableCount() << ", fsyncs: " << sink->syncCount() << "\n";
+
+    log.setSink(nullptr);
+    sink->close();
+    std::filesystem::remove(path);
+}
+#endif
+
 // No compile_test.cpp, adicione após o TEST_ACTIVITY_LOG
 #define TEST_BOARD
 
@@ -141,7 +308,7 @@ void testBoard() {
     std::cout << "\n=== ATIVIDADES REGISTRADAS ===" << std::endl;
     std::cout << "Total de atividades: " << activityLog->size() << std::endl;
     for (const auto& activity : activityLog->activities()) {
-        std::cout << " - " << activity.description() << std::endl;
+        std::cout << " - " << board->describe(activity) << std::endl;
     }
 }
 #endif
@@ -269,6 +436,1202 @@ void testKanbanService() {
 }
 #endif
 
+#define TEST_CONCURRENT_SERVICE
+
+#ifdef TEST_CONCURRENT_SERVICE
+#include <thread>
+
+void testConcurrentService() {
+    using namespace kanban::application;
+
+    std::cout << "\n=== TESTE KANBAN SERVICE CONCORRENTE ===" << std::endl;
+
+    KanbanService service;
+    std::string shared = service.createBoard("Compartilhado");
+    std::string sharedTodo = service.addColumn(shared, "To Do");
+    std::string sharedDone = service.addColumn(shared, "Done");
+
+    const int threads = 4;
+    const int cardsPerThread = 200;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::string own = service.createBoard("Board " + std::to_string(t));
+            std::string todo = service.addColumn(own, "To Do");
+            std::string done = service.addColumn(own, "Done");
+            for (int i = 0; i < cardsPerThread; ++i) {
+                std::string card = service.addCard(own, todo, "card");
+                service.moveCard(own, card, todo, done);
+                std::string sharedCard = service.addCard(shared, sharedTodo, "shared");
+                if (i % 2 == 0) {
+                    service.moveCard(shared, sharedCard, sharedTodo, sharedDone);
+                }
+                service.listBoards();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    std::size_t ownDone = 0;
+    for (const auto& board : service.listBoards()) {
+        if (board->id() == shared) {
+            continue;
+        }
+        ownDone += service.readBoard(board->id(), [](const kanban::domain::Board& b) {
+            return b.columns()[1]->size();
+        });
+    }
+    std::cout << "Boards: " << service.listBoards().size() << " (esperado " << threads + 1 << ")\n";
+    std::cout << "Cards concluídos nos boards próprios: " << ownDone
+              << " (esperado " << threads * cardsPerThread << ")\n";
+    std::cout << "Compartilhado: " << service.listCards(sharedTodo).size() << " / "
+              << service.listCards(sharedDone).size() << " (esperado "
+              << threads * cardsPerThread / 2 << " / " << threads * cardsPerThread / 2 << ")\n";
+
+    std::string other = service.createBoard("Outro");
+    std::string otherColumn = service.addColumn(other, "To Do");
+    try {
+        service.addCard(shared, otherColumn, "coluna de outro board");
+        std::cout << "ERRO: coluna de outro board aceita\n";
+    } catch (const std::exception& e) {
+        std::cout << "Rejeitado como esperado: " << e.what() << "\n";
+    }
+}
+#endif
+
+#include "application/ShardedKanbanService.h"
+
+#define TEST_SHARDED_SERVICE
+
+#ifdef TEST_SHARDED_SERVICE
+void testShardedService() {
+    using namespace kanban::application;
+
+    std::cout << "\n=== TESTE KANBAN SERVICE PARTICIONADO ===" << std::endl;
+
+    ShardedKanbanService service(4);
+    service.createSampleData();
+    std::vector<std::future<std::string>> created;
+    for (int i = 0; i < 8; ++i) {
+        created.push_back(service.createBoardAsync("Board " + std::to_string(i)));
+    }
+    for (auto& f : created) {
+        f.get();
+    }
+
+    auto boards = service.listBoards();
+    std::cout << "Boards: " << boards.size() << " (esperado 9) em " << service.shardCount() << " shards\n";
+
+    auto sample = boards[0]->id();
+    auto columns = service.listColumns(sample);
+    auto todo = service.listCards(columns[0]->id());
+    service.moveCardAsync(sample, todo[0]->id(), columns[0]->id(), columns[2]->id()).get();
+    auto done = service.withBoard(sample, [](kanban::domain::Board& board) {
+        return board.columns()[2]->size();
+    }).get();
+    std::cout << "Cards em Done: " << done << " (esperado 2), cópia lida antes: "
+              << columns[2]->size() << " (esperado 1)\n";
+
+    try {
+        service.addColumn("board_inexistente", "X");
+        std::cout << "ERRO: board inexistente aceito\n";
+    } catch (const std::exception& e) {
+        std::cout << "Rejeitado como esperado: " << e.what() << "\n";
+    }
+}
+#endif
+
+#include "application/BatchExecutor.h"
+
+#define TEST_BATCH
+
+#ifdef TEST_BATCH
+void testBatch() {
+    using namespace kanban::application;
+    using kanban::domain::Command;
+
+    std::cout << "\n=== TESTE LOTE DE COMANDOS ===" << std::endl;
+
+    KanbanService service;
+    std::size_t notifications = 0;
+    service.setChangeListener([&](const BoardChange&) { ++notifications; });
+    std::string boardId = service.createBoard("Importaçao");
+
+    std::vector<Command> batch = {Command::createColumn("To Do"), Command::createColumn("Done")};
+    for (int i = 0; i < 1000; ++i) {
+        batch.push_back(Command::addCard("$0", "Card " + std::to_string(i)));
+    }
+    batch.push_back(Command::moveCard("$2", "$0", "$1"));
+    batch.push_back(Command::retagCard("$2", {"bug", "urgente"}));
+    batch.push_back(Command::setPriority("$3", 5));
+    batch.push_back(Command::reorderCard("$0", "$4", 0));
+    auto ids = service.applyBatch(boardId, batch);
+
+    auto columns = service.listColumns(boardId);
+    std::cout << "Colunas: " << columns.size() << ", To Do: " << columns[0]->size()
+              << ", Done: " << columns[1]->size() << " (esperado 2, 999, 1)\n";
+    std::cout << "Primeiro da To Do: " << columns[0]->cards()[0]->id() << " (esperado " << ids[4] << ")\n";
+    std::cout << "Notificações: " << notifications << " (esperado 1)\n";
+
+    auto log = (*service.findBoard(boardId))->activityLog();
+    std::size_t before = log->size();
+    try {
+        service.applyBatch(boardId, {Command::addCard(columns[0]->id(), "nunca aplicado"),
+                                     Command::moveCard(ids[2], columns[0]->id(), columns[1]->id())});
+        std::cout << "ERRO: lote inválido aplicado\n";
+    } catch (const BatchException& e) {
+        std::cout << "Lote rejeitado (índice " << e.commandIndex() << ") - " << e.what() << "\n";
+    }
+    std::cout << "Após rejeiçao - To Do: " << columns[0]->size() << " (esperado 999), atividades novas: "
+              << log->size() - before << " (esperado 0)\n";
+}
+#endif
+
+#define TEST_CARD_LOCATION
+
+#ifdef TEST_CARD_LOCATION
+void testCardLocation() {
+    using namespace kanban::application;
+    using kanban::domain::Command;
+
+    std::cout << "\n=== TESTE LOCALIZAÇaO DE CARDS ===" << std::endl;
+
+    KanbanService service;
+    std::string boardId = service.createBoard("Localizaçao");
+    std::string todo = service.addColumn(boardId, "To Do");
+    std::string done = service.addColumn(boardId, "Done");
+    std::string a = service.addCard(boardId, todo, "A");
+    std::string b = service.addCard(boardId, todo, "B");
+    std::string c = service.addCard(boardId, todo, "C");
+
+    // Apenas o ID do card: a origem vem do índice
+    service.moveCard(a, done);
+    service.moveCardWithinColumn(c, 0);
+    service.updateCardTags(b, {"bug"});
+
+    auto locA = service.locateCard(a);
+    auto locB = service.locateCard(b);
+    auto locC = service.locateCard(c);
+    std::cout << "A: " << locA->columnId << "[" << locA->position << "] (esperado " << done << "[0])\n";
+    std::cout << "B: " << locB->columnId << "[" << locB->position << "] (esperado " << todo << "[1])\n";
+    std::cout << "C: " << locC->columnId << "[" << locC->position << "] (esperado " << todo << "[0])\n";
+
+    auto ids = service.applyBatch(boardId, {Command::addCard(done, "D"), Command::moveCard(b, todo, done)});
+    auto locD = service.locateCard(ids[0]);
+    std::cout << "D: " << locD->columnId << "[" << locD->position << "], B: "
+              << service.locateCard(b)->columnId << " (esperado " << done << "[1], " << done << ")\n";
+    std::cout << "Card inexistente localizado: " << std::boolalpha
+              << service.locateCard("card_999").has_value() << " (esperado false)\n";
+}
+#endif
+
+#define TEST_CARD_FILTER
+
+#ifdef TEST_CARD_FILTER
+void testCardFilter() {
+    using namespace kanban::application;
+    using namespace kanban::domain;
+
+    std::cout << "\n=== TESTE FILTROS COMPILADOS ===" << std::endl;
+
+    KanbanService service;
+    std::string boardId = service.createBoard("Filtros");
+    auto ids = service.applyBatch(boardId, {
+        Command::createColumn("To Do"),                 // $0
+        Command::createColumn("Done"),                  // $1
+        Command::addCard("$0", "Corrigir login"),       // $2
+        Command::addCard("$0", "Tela de relatórios"),   // $3
+        Command::addCard("$1", "Login com SSO"),        // $4
+        Command::addCard("$1", "Documentar API"),       // $5
+        Command::retagCard("$2", {"Bug", "urgente"}),
+        Command::retagCard("$4", {"feature"}),
+        Command::retagCard("$5", {"bug"}),
+        Command::setPriority("$2", 2),
+        Command::setPriority("$4", 1),
+        Command::setPriority("$5", 2),
+    });
+    auto print = [](const std::vector<std::shared_ptr<Card>>& cards) {
+        std::string out;
+        for (const auto& card : cards) out += card->id() + " ";
+        return out;
+    };
+
+    // (texto "login" OU tag bug) E prioridade >= 1 E NAO tag feature
+    AndFilter filter;
+    filter.add(OrFilter().add(TextFilter(TextField::Title, "LOGIN")).add(TagFilter(TagMatch::Any, {"BUG"})))
+          .add(PriorityRangeFilter(1, 3))
+          .add(NotFilter(TagFilter(TagMatch::Any, {"feature"})));
+    std::cout << "Consulta: " << print(service.query(boardId, filter))
+              << "(esperado " << ids[2] << " " << ids[5] << " )\n";
+
+    auto plan = FilterPlan::compile(filter);
+    std::cout << "Plano (prioridade primeiro):\n" << plan.explain();
+
+    // Coluna no nível superior vira escopo: a coluna To Do nem é percorrida
+    AndFilter scoped;
+    scoped.add(ColumnFilter({ids[1]})).add(TagFilter(TagMatch::All, {"bug"}));
+    auto scopedPlan = FilterPlan::compile(scoped);
+    std::cout << "Escopo: " << scopedPlan.columnScope()->size() << " coluna(s), resultado: "
+              << print(service.query(boardId, scopedPlan)) << "(esperado 1, " << ids[5] << " )\n";
+
+    bool sameAsTree = true;
+    for (const auto& column : service.listColumns(boardId)) {
+        for (const auto& card : column->cards()) {
+            sameAsTree = sameAsTree && (plan.matches(*card, column->id()) == filter.matches(*card));
+        }
+    }
+    std::cout << "Plano equivale à árvore: " << std::boolalpha << sameAsTree << " (esperado true)\n";
+    std::cout << "Prioridade vazia rejeita tudo: "
+              << FilterPlan::compile(AndFilter().add(PrioritySetFilter({})).add(filter)).rejectsAll()
+              << " (esperado true)\n";
+
+    // Sem texto, o plano é resolvido sobre a CardTable (caminho dos boards grandes)
+    OrFilter numeric;
+    numeric.add(AndFilter().add(TagFilter(TagMatch::Any, {"BUG"})).add(NotFilter(ColumnFilter({ids[0]}))))
+           .add(PrioritySetFilter({1}));
+    auto numericPlan = FilterPlan::compile(numeric);
+    auto table = service.cardTable(boardId);
+    auto rows = numericPlan.select(table);
+    bool sameAsScan = rows.has_value();
+    for (std::size_t row = 0; rows && row < table.size(); ++row) {
+        const auto column = table.columnIds()[static_cast<std::size_t>(table.columnIndexes()[row])];
+        sameAsScan = sameAsScan && rows->test(row) == numericPlan.matches(*table.cards()[row], column);
+    }
+    std::cout << "Seleçao na CardTable: " << (rows ? print(table.cardsIn(*rows)) : std::string("- "))
+              << "(esperado " << ids[4] << " " << ids[5] << " ), igual à varredura: " << sameAsScan
+              << ", com texto: " << plan.select(table).has_value() << " (esperado true, false)\n";
+}
+#endif
+
+#define TEST_FILTER_EXPR
+
+#ifdef TEST_FILTER_EXPR
+void testFilterExpr() {
+    using namespace kanban::application;
+    using kanban::domain::Command;
+    using kanban::domain::AndFilter;
+    using kanban::domain::PriorityRangeFilter;
+
+    std::cout << "\n=== TESTE EXPRESSION TEMPLATES ===" << std::endl;
+
+    KanbanService service;
+    std::string boardId = service.createBoard("Expressões");
+    auto ids = service.applyBatch(boardId, {
+        Command::createColumn("To Do"),            // $0
+        Command::createColumn("Done"),             // $1
+        Command::addCard("$0", "Bug no login"),    // $2
+        Command::addCard("$1", "Bug corrigido"),   // $3
+        Command::addCard("$0", "Nova tela"),       // $4
+        Command::retagCard("$2", {"bug"}),
+        Command::retagCard("$3", {"BUG"}),
+        Command::setPriority("$2", 2),
+        Command::setPriority("$3", 2),
+    });
+    const std::string done = ids[1];
+
+    using namespace kanban::domain::expr;
+    auto urgent = priority >= 2 && hasTag("bug") && !inColumn(done);
+    auto result = service.query(boardId, urgent);
+    std::cout << "Expressao: " << result.size() << " card(s), " << (result.empty() ? "-" : result[0]->id())
+              << " (esperado 1, " << ids[2] << ")\n";
+
+    // Convertida em IFilter e combinada com filtros de tempo de execuçao
+    AndFilter mixed;
+    mixed.add(toFilter(urgent)).add(PriorityRangeFilter(0, 5));
+    std::cout << "Via IFilter: " << service.query(boardId, mixed).size() << " card(s) (esperado 1)\n";
+    std::cout << "Título: " << service.query(boardId, titleContains("TELA") || inColumn(done)).size()
+              << " card(s) (esperado 2)\n";
+}
+#endif
+
+#define TEST_SIMD_KERNELS
+
+#ifdef TEST_SIMD_KERNELS
+#include "simd/PredicateKernels.h"
+
+void testSimdKernels() {
+    using namespace kanban::application;
+    using kanban::domain::Command;
+    using kanban::domain::TagMatch;
+    namespace simd = kanban::simd;
+
+    std::cout << "\n=== TESTE KERNELS VETORIZADOS ===" << std::endl;
+
+    // 203 cards: prioridade i % 4, tag "bug" nos múltiplos de 3
+    KanbanService service;
+    std::string boardId = service.createBoard("Kernels");
+    std::vector<Command> commands{Command::createColumn("To Do"), Command::createColumn("Done")};
+    for (int i = 0; i < 203; ++i) {
+        std::string ref = "$" + std::to_string(commands.size());
+        commands.push_back(Command::addCard(i % 2 ? "$1" : "$0", "Card " + std::to_string(i)));
+        commands.push_back(Command::setPriority(ref, i % 4));
+        if (i % 3 == 0) {
+            commands.push_back(Command::retagCard(ref, {"Bug"}));
+        }
+    }
+    auto ids = service.applyBatch(boardId, commands);
+
+    auto table = service.cardTable(boardId);
+    std::cout << "Linhas: " << table.size() << " (esperado 203), CPU: "
+              << simd::isaName(simd::detectedIsa()) << std::endl;
+
+    // Cada conjunto de instruções deve selecionar exatamente as mesmas linhas
+    bool agree = true;
+    std::size_t urgentBugs = 0;
+    for (simd::Isa isa : {simd::Isa::Scalar, simd::Isa::Sse2, simd::Isa::Avx2}) {
+        simd::setActiveIsa(isa);
+        auto rows = table.wherePriority(simd::Compare::GreaterEqual, 2);
+        rows &= *table.whereTags(TagMatch::Any, {"bug"});
+        rows.andNot(table.whereColumn(ids[1]));
+        if (isa == simd::Isa::Scalar) {
+            urgentBugs = rows.count();
+        }
+        agree = agree && rows.count() == urgentBugs;
+    }
+    simd::setActiveIsa(simd::detectedIsa());
+
+    // i par (To Do), i % 4 >= 2 e i % 3 == 0  =>  i % 12 == 6
+    std::cout << "Prioridade >= 2, bug, fora de Done: " << urgentBugs << " (esperado 17), ISAs concordam: "
+              << std::boolalpha << agree << std::endl;
+    std::cout << "Tag inexistente (All): " << table.whereTags(TagMatch::All, {"bug", "ui"})->count()
+              << " (esperado 0)" << std::endl;
+}
+#endif
+
+#define TEST_TEXT_INDEX
+
+#ifdef TEST_TEXT_INDEX
+void testTextIndex() {
+    using namespace kanban::application;
+
+    std::cout << "\n=== TESTE ÍNDICE DE TEXTO ===" << std::endl;
+
+    KanbanService service;
+    std::string boardId = service.createBoard("Busca");
+    std::string columnId = service.addColumn(boardId, "To Do");
+    std::string a = service.addCard(boardId, columnId, "Migração do banco");
+    std::string b = service.addCard(boardId, columnId, "Revisar relatório");
+    std::string c = service.addCard(boardId, columnId, "Ajustar tela de login");
+
+    auto cards = service.listCards(columnId);   // na ordem: a, b, c
+    auto top = [&](const std::string& query) {
+        auto hits = service.searchCards(query);
+        return hits.empty() ? std::string("-") : hits[0].cardId + " (" + std::to_string(hits.size()) + ")";
+    };
+
+    std::cout << "Sem acento/maiúsculas: " << top("MIGRACAO") << " (esperado " << a << " (1))" << std::endl;
+
+    // Alterações diretas no Card chegam ao índice pelo observador
+    cards[1]->setDescription("Incluir a migração de usuários");
+    std::cout << "Após setDescription: " << top("migração") << " (esperado " << a << " (2), título pesa mais)" << std::endl;
+
+    cards[1]->setTitle("Revisar migração");
+    std::cout << "Após setTitle: " << top("revisar migracao") << " (esperado " << b << " (2))" << std::endl;
+    std::cout << "Título antigo: " << top("relatorio") << " (esperado - )" << std::endl;
+
+    // Cópias nao notificam o índice
+    kanban::domain::Card copy = *cards[2];
+    copy.setTitle("Outro título");
+    std::cout << "Cópia alterada: " << top("login") << " (esperado " << c << " (1))" << std::endl;
+
+    // Atribuir de volta (mesmo ID) avisa o observador do card original
+    *cards[2] = copy;
+    std::cout << "Cópia atribuída: " << top("outro titulo") << " (esperado " << c << " (1))" << std::endl;
+
+    // Atribuiçao é membro a membro (ID incluído): um swap troca os cards de lugar e os índices acompanham
+    static_assert(std::is_nothrow_move_assignable<kanban::domain::Card>::value, "move de Card deve ser noexcept");
+    std::swap(*cards[1], *cards[2]);
+    std::cout << "Após swap: " << top("outro titulo") << " na posiçao " << service.locateCard(c)->position
+              << ", " << top("revisar") << " na posiçao " << service.locateCard(b)->position
+              << " (esperado " << c << " (1) na posiçao 1, " << b << " (1) na posiçao 2)" << std::endl;
+    std::swap(*cards[1], *cards[2]);
+
+    // Ediçao completa pelo serviço (caminho do diálogo da GUI)
+    service.updateCard(boardId, a, "Backup do banco", "Antes da janela", 2, {"infra", "urgente"});
+    std::cout << "Após updateCard: " << top("backup") << " (esperado " << a << " (1)), prioridade "
+              << cards[0]->priority() << ", tags " << cards[0]->tags().size() << " (esperado 2, 2)" << std::endl;
+    service.undo(boardId);
+    std::cout << "Desfazer updateCard: tags " << cards[0]->tags().size() << ", prioridade " << cards[0]->priority()
+              << ", " << top("banco") << " (esperado 0, 0, " << a << " (1))" << std::endl;
+}
+#endif
+
+#define TEST_PREFIX_TRIE
+
+#ifdef TEST_PREFIX_TRIE
+void testPrefixTrie() {
+    using namespace kanban::application;
+
+    std::cout << "\n=== TESTE COMPLETAMENTO POR PREFIXO ===" << std::endl;
+
+    KanbanService service;
+    std::string boardId = service.createBoard("Completar");
+    std::string columnId = service.addColumn(boardId, "To Do");
+    std::string a = service.addCard(boardId, columnId, "Ajustar tela de login");
+    std::string b = service.addCard(boardId, columnId, "Ajuda online");
+    std::string c = service.addCard(boardId, columnId, "Atualizar dependências");
+    auto cards = service.listCards(columnId);   // na ordem: a, b, c
+
+    auto ids = [](const std::vector<kanban::domain::Completion>& completions) {
+        std::string text;
+        for (const auto& completion : completions) text += completion.id + " ";
+        return text.empty() ? std::string("- ") : text;
+    };
+
+    std::cout << "Prefixo 'aju': " << ids(service.completeCardTitles(boardId, "aju"))
+              << "(esperado os dois 'Aju...')" << std::endl;
+
+    // Prioridade e título alterados diretamente no Card chegam pelo observador
+    cards[1]->setPriority(2);
+    std::cout << "Após setPriority: " << ids(service.completeCardTitles(boardId, "AJU", 1))
+              << "(esperado " << b << ")" << std::endl;
+    cards[2]->setTitle("Ajustar build");
+    std::cout << "Após setTitle: " << ids(service.completeCardTitles(boardId, "ajus"))
+              << "(esperado " << a << " e " << c << ")" << std::endl;
+    std::cout << "Título antigo: " << ids(service.completeCardTitles(boardId, "atu"))
+              << "(esperado - )" << std::endl;
+
+    // Tags: ordenadas pelo número de cards, sem diferenciar acentos
+    service.updateCardTags(boardId, a, {"Documentação", "bug"});
+    service.updateCardTags(boardId, b, {"bug"});
+    auto tags = service.completeTagNames(boardId, "");
+    std::cout << "Tags: " << (tags.empty() ? std::string("-") : tags[0].text) << " primeiro, "
+              << tags.size() << " no total (esperado bug primeiro, 2 no total)" << std::endl;
+    auto doc = service.completeTagNames(boardId, "docu");
+    std::cout << "Prefixo 'docu': " << (doc.empty() ? std::string("-") : doc[0].text)
+              << " (esperado Documentação)" << std::endl;
+
+    service.updateCardTags(boardId, a, {});
+    std::cout << "Tags após remover de " << a << ": " << service.tagNames(boardId).size()
+              << " (esperado 1)" << std::endl;
+}
+#endif
+
+#define TEST_FUZZY_SEARCH
+
+#ifdef TEST_FUZZY_SEARCH
+void testFuzzySearch() {
+    using namespace kanban::application;
+    using kanban::domain::FuzzyIndex;
+
+    std::cout << "\n=== TESTE BUSCA APROXIMADA ===" << std::endl;
+
+    std::cout << "Distância 'implemnt'/'implementar': " << FuzzyIndex::prefixDistance("implemnt", "implementar", 2)
+              << " (esperado 1)" << std::endl;
+    std::cout << "Distância 'lcasses'/'classes': " << FuzzyIndex::prefixDistance("lcasses", "classes", 2)
+              << " (esperado 1, transposiçao)" << std::endl;
+    std::cout << "Distância 'xyz'/'classes' (limite 1): " << FuzzyIndex::prefixDistance("xyz", "classes", 1)
+              << " (esperado 2)" << std::endl;
+
+    KanbanService service;
+    std::string boardId = service.createBoard("Aproximada");
+    std::string columnId = service.addColumn(boardId, "To Do");
+    std::string a = service.addCard(boardId, columnId, "Implementar classes de domínio");
+    std::string b = service.addCard(boardId, columnId, "Implantar servidor");
+    service.addCard(boardId, columnId, "Classificar tickets");
+
+    auto top = [&](const std::string& query) {
+        auto hits = service.fuzzySearchCards(query);
+        return hits.empty() ? std::string("-") : hits[0].cardId + " (" + std::to_string(hits.size()) + ")";
+    };
+
+    std::cout << "Busca exata 'implemnt clases': " << service.searchCards("implemnt clases").size()
+              << " resultados (esperado 0)" << std::endl;
+    std::cout << "Busca aproximada 'implemnt clases': " << top("implemnt clases")
+              << " (esperado " << a << " (1))" << std::endl;
+    std::cout << "Busca aproximada 'DOMINO': " << top("DOMINO") << " (esperado " << a << " (1))" << std::endl;
+
+    // Título alterado diretamente no Card chega ao índice pelo observador
+    auto cards = service.listCards(columnId);   // na ordem: a, b, ...
+    cards[1]->setTitle("Implementar cache");
+    std::cout << "Após setTitle 'implmentar cahce': " << top("implmentar cahce")
+              << " (esperado " << b << " (1))" << std::endl;
+    std::cout << "Título antigo 'servidro': " << top("servidro") << " (esperado - )" << std::endl;
+}
+#endif
+
+#define TEST_TOP_CARDS
+
+#ifdef TEST_TOP_CARDS
+void testTopCards() {
+    using namespace kanban::application;
+    using kanban::domain::Command;
+
+    std::cout << "\n=== TESTE CARDS MAIS URGENTES ===" << std::endl;
+
+    KanbanService service;
+    std::string boardId = service.createBoard("Urgentes");
+    std::string todo = service.addColumn(boardId, "To Do");
+    std::string doing = service.addColumn(boardId, "Doing");
+    std::string a = service.addCard(boardId, todo, "Antigo");
+    std::string b = service.addCard(boardId, todo, "Médio");
+    std::string c = service.addCard(boardId, doing, "Novo");
+
+    auto ids = [&](std::size_t k) {
+        std::string text;
+        for (const auto& card : service.topCards(boardId, k)) text += card->id() + " ";
+        return text;
+    };
+
+    std::cout << "Mesma prioridade: " << ids(3) << "(esperado " << a << " " << b << " " << c << ", mais antigo primeiro)" << std::endl;
+
+    // setPriority direto no Card chega ao índice pelo observador
+    service.listCards(doing)[0]->setPriority(2);
+    std::cout << "Após setPriority(2) em " << c << ": " << ids(2) << "(esperado " << c << " " << a << ")" << std::endl;
+
+    // Comandos em lote e movimentações
+    service.applyBatch(boardId, {Command::setPriority(b, 3), Command::moveCard(a, todo, doing)});
+    std::cout << "Após lote: " << ids(3) << "(esperado " << b << " " << c << " " << a << ")" << std::endl;
+    std::cout << "k maior que o board: " << service.topCards(boardId, 10).size() << " (esperado 3)" << std::endl;
+}
+#endif
+
+#define TEST_FLOW_METRICS
+
+#ifdef TEST_FLOW_METRICS
+#include "domain/FlowMetrics.h"
+
+void testFlowMetrics() {
+    using namespace kanban::domain;
+    using std::chrono::hours;
+    using std::chrono::milliseconds;
+
+    std::cout << "\n=== TESTE MÉTRICAS DE FLUXO ===" << std::endl;
+
+    QuantileSketch sketch;
+    for (std::uint64_t ms = 1; ms <= 1000; ++ms) sketch.add(ms);
+    std::cout << "Sketch 1..1000: p50=" << sketch.quantile(0.5) << " p90=" << sketch.quantile(0.9)
+              << " max=" << sketch.quantile(1.0) << " (esperado ~500, ~900 com erro <= 1%, 1000)" << std::endl;
+
+    // Horários fixos: card criado em t0, começa após 1h, chega a "done" após 5h
+    ActivityLog log;
+    const TimePoint t0{milliseconds(1700000000000LL)};
+    auto at = [&](int h) { return HybridTimestamp::fromTimePoint(t0 + hours(h)); };
+    auto move = [&](const char* card, const char* from, const char* to, int h) {
+        log.add(Activity::cardMoved(log.intern(card), log.intern(from), log.intern(to), 0, at(h)));
+    };
+    log.registerCard("c1", "todo", t0);
+    log.registerCard("c2", "todo", t0);
+    move("c1", "todo", "doing", 1);
+    move("c2", "todo", "doing", 2);
+    move("c1", "doing", "done", 5);
+    move("c2", "doing", "done", 10);
+
+    auto hoursOf = [](std::uint64_t ms) { return static_cast<double>(ms) / 3600000.0; };
+    ColumnFlow done = log.columnFlow("done");
+    ColumnFlow doing = log.columnFlow("doing");
+    std::cout << "Lead time até done: " << done.leadTime.count() << " amostras, min " << hoursOf(done.leadTime.min())
+              << "h, max " << hoursOf(done.leadTime.max()) << "h (esperado 2, 5h, 10h)" << std::endl;
+    std::cout << "Cycle time até done: min " << hoursOf(done.cycleTime.min()) << "h, max "
+              << hoursOf(done.cycleTime.max()) << "h (esperado 4h, 8h)" << std::endl;
+    std::cout << "Permanência em doing: média " << hoursOf(static_cast<std::uint64_t>(doing.dwell.mean()))
+              << "h (esperado 6h); WIP doing/done: " << doing.wip << "/" << done.wip << " (esperado 0/2)" << std::endl;
+
+    auto flow = log.cardFlow("c1");
+    std::cout << "c1: coluna " << (flow ? flow->column : "?") << ", chegadas " << (flow ? flow->arrivals.size() : 0)
+              << " (esperado done, 3); card desconhecido: " << (log.cardFlow("c9") ? "sim" : "nao")
+              << " (esperado nao)" << std::endl;
+
+    // Pelo serviço: lead time por card até a última coluna
+    kanban::application::KanbanService service;
+    std::string boardId = service.createBoard("Fluxo");
+    std::string todo = service.addColumn(boardId, "To Do");
+    std::string doneColumn = service.addColumn(boardId, "Done");
+    std::string card = service.addCard(boardId, todo, "Entregar");
+    std::cout << "Lead time antes de Done: " << (service.leadTime(boardId, card) ? "sim" : "nao")
+              << " (esperado nao)" << std::endl;
+    service.moveCard(boardId, card, todo, doneColumn);
+    std::cout << "Lead time após Done: " << (service.leadTime(boardId, card) ? "sim" : "nao")
+              << "; WIP Done: " << service.columnFlow(boardId, doneColumn).wip << " (esperado sim; 1)" << std::endl;
+}
+#endif
+
+#define TEST_CUMULATIVE_FLOW
+
+#ifdef TEST_CUMULATIVE_FLOW
+#include "domain/CumulativeFlow.h"
+
+void testCumulativeFlow() {
+    using namespace kanban::domain;
+    using std::chrono::hours;
+    using std::chrono::minutes;
+    using std::chrono::milliseconds;
+
+    std::cout << "\n=== TESTE FLUXO CUMULATIVO ===" << std::endl;
+
+    // Dois cards em todo antes da janela; c3 criado nela; c1 e c2 concluídos
+    // dentro da janela e c3 depois dela
+    ActivityLog log;
+    const TimePoint t0{milliseconds(1700000000000LL)};
+    ActivityHandle todo = log.intern("todo");
+    ActivityHandle done = log.intern("done");
+    auto moved = [&](const char* card, minutes at) {
+        return Activity::cardMoved(log.intern(card), todo, done, 0, HybridTimestamp::fromTimePoint(t0 + at));
+    };
+    CumulativeFlowInput input;
+    input.columns = {{todo, "todo"}, {done, "done"}};
+    input.current = {0, 3};
+    input.events = {moved("c1", minutes(90)), moved("c2", minutes(150)), moved("c3", minutes(300))};
+    input.creations = {{static_cast<std::uint64_t>((t0 + minutes(30)).time_since_epoch() / milliseconds(1)), todo}};
+
+    CumulativeFlow flow = cumulativeFlow(input, t0, t0 + hours(4), hours(1));
+    std::cout << "Buckets (todo/done):";
+    for (const auto& row : flow.counts) std::cout << " " << row[0] << "/" << row[1];
+    std::cout << " (esperado 3/0 2/1 1/2 1/2)" << std::endl;
+
+    // Partições paralelas produzem a mesma série que o cálculo sequencial
+    std::mt19937 rng(3);
+    CumulativeFlowInput big;
+    big.columns = {{todo, "todo"}, {log.intern("doing"), "doing"}, {done, "done"}};
+    big.current = {1000, 1000, 1000};
+    for (int i = 0; i < 400000; ++i) {
+        ActivityHandle from = big.columns[rng() % 3].first;
+        ActivityHandle to = big.columns[rng() % 3].first;
+        big.events.push_back(Activity::cardMoved(1, from, to, 0,
+                                                 HybridTimestamp::fromTimePoint(t0 + milliseconds(i * 50))));
+    }
+    kanban::concurrency::ThreadPool pool(3);
+    CumulativeFlow sequential = cumulativeFlow(big, t0, t0 + hours(4), minutes(10));
+    CumulativeFlow parallel = cumulativeFlow(big, t0, t0 + hours(4), minutes(10), &pool);
+    std::cout << "Paralelo == sequencial: " << (parallel.counts == sequential.counts ? "sim" : "nao")
+              << " (" << parallel.counts.size() << " buckets, esperado sim, 24)" << std::endl;
+
+    // Pelo serviço: o último bucket é o estado atual do board
+    kanban::application::KanbanService service;
+    std::string boardId = service.createBoard("CFD");
+    std::string a = service.addColumn(boardId, "To Do");
+    std::string b = service.addColumn(boardId, "Done");
+    std::string card = service.addCard(boardId, a, "Um");
+    service.addCard(boardId, a, "Dois");
+    service.moveCard(boardId, card, a, b);
+    auto now = std::chrono::system_clock::now();
+    CumulativeFlow live = service.cumulativeFlow(boardId, now - hours(1), now + minutes(1), minutes(5));
+    std::cout << "Serviço, último bucket: " << live.counts.back()[0] << "/" << live.counts.back()[1]
+              << ", primeiro: " << live.counts.front()[0] << "/" << live.counts.front()[1]
+              << " (esperado 1/1, 0/0)" << std::endl;
+}
+#endif
+
+#define TEST_DELIVERY_FORECAST
+
+#ifdef TEST_DELIVERY_FORECAST
+#include "domain/DeliveryForecast.h"
+
+void testDeliveryForecast() {
+    using namespace kanban::domain;
+    using std::chrono::hours;
+    using std::chrono::milliseconds;
+
+    std::cout << "\n=== TESTE PREVISaO DE ENTREGA ===" << std::endl;
+
+    // Throughput constante: toda tentativa termina no mesmo número de semanas
+    const TimePoint now{milliseconds(1700000000000LL)};   // terça, 14/11/2023 (UTC)
+    DeliveryForecast fixed = forecastDelivery({5}, 12, now, 1000);
+    std::cout << "Constante 5/semana, 12 restantes: p50 = " << fixed.weeksAt(0.5).value_or(0)
+              << ", p100 = " << fixed.weeksAt(1.0).value_or(0)
+              << ", data p50 = +" << (*fixed.dateAt(0.5) - now) / hours(24) << " dias"
+              << " (esperado 3, 3, +21 dias)" << std::endl;
+
+    DeliveryForecast stalled = forecastDelivery({0, 0}, 4, now, 1000);
+    std::cout << "Sem entregas: alem do horizonte = " << stalled.beyondHorizon
+              << ", p50 = " << (stalled.dateAt(0.5) ? "data" : "nenhuma") << " (esperado 1000, nenhuma)" << std::endl;
+
+    // O resultado nao depende do número de threads
+    std::vector<std::uint32_t> history = {3, 0, 7, 5, 2, 9, 4, 0, 6, 5};
+    kanban::concurrency::ThreadPool pool(3);
+    DeliveryForecast sequential = forecastDelivery(history, 60, now, 200000);
+    DeliveryForecast parallel = forecastDelivery(history, 60, now, 200000, &pool);
+    std::cout << "Paralelo == sequencial: " << (parallel.weeks == sequential.weeks ? "sim" : "nao")
+              << ", p50 <= p85 <= p95: "
+              << (sequential.weeksAt(0.5) <= sequential.weeksAt(0.85) &&
+                  sequential.weeksAt(0.85) <= sequential.weeksAt(0.95) ? "sim" : "nao")
+              << " (esperado sim, sim)" << std::endl;
+
+    // Throughput semanal lido dos rollups: semanas completas desde a primeira
+    // movimentaçao do board; a semana corrente fica de fora
+    ActivityLog log;
+    const TimePoint monday{milliseconds(1699833600000LL)};   // segunda, 13/11/2023
+    const auto week = hours(24 * 7);
+    ActivityHandle todo = log.intern("todo");
+    ActivityHandle doing = log.intern("doing");
+    ActivityHandle done = log.intern("done");
+    auto move = [&](const char* card, ActivityHandle from, ActivityHandle to, TimePoint at) {
+        log.add(Activity::cardMoved(log.intern(card), from, to, 0, HybridTimestamp::fromTimePoint(at)));
+    };
+    move("c1", todo, doing, monday - 4 * week + hours(24));
+    move("c1", doing, done, monday - 3 * week + hours(48));
+    move("c2", doing, done, monday - week + hours(1));
+    move("c3", doing, done, monday - week + hours(72));
+    move("c4", doing, done, monday + hours(2));
+    log.publish();
+    std::cout << "Throughput semanal:";
+    for (std::uint32_t count : weeklyThroughput(log, "done", now, 12)) std::cout << " " << count;
+    std::cout << " (esperado 0 1 0 2)" << std::endl;
+
+    // Pelo serviço, com histórico de entregas nas semanas anteriores
+    kanban::application::KanbanService service;
+    std::string boardId = service.createBoard("Previsao");
+    std::string a = service.addColumn(boardId, "To Do");
+    std::string b = service.addColumn(boardId, "Done");
+    service.addCard(boardId, a, "Urgente");
+    service.addCard(boardId, a, "Dois");
+    service.addCard(boardId, a, "Tres");
+    auto boardLog = (*service.findBoard(boardId))->activityLog();
+    auto today = std::chrono::system_clock::now();
+    for (int days : {22, 15, 14, 8}) {
+        boardLog->add(Activity::cardMoved(boardLog->intern("antigo_" + std::to_string(days)), boardLog->intern(a),
+                                          boardLog->intern(b), 0,
+                                          HybridTimestamp::fromTimePoint(today - hours(24 * days))));
+    }
+    boardLog->publish();
+    DeliveryForecast board = service.forecastDelivery(boardId, 12, 50000);
+    DeliveryForecast subset = service.forecastDelivery(boardId, FilterPlan::compile(TextFilter(TextField::Title, "urgente")), 12, 50000);
+    std::cout << "Serviço: restantes " << board.remaining << ", subconjunto " << subset.remaining
+              << ", p95 do subconjunto <= do board: "
+              << (subset.weeksAt(0.95) && board.weeksAt(0.95) && *subset.weeksAt(0.95) <= *board.weeksAt(0.95) ? "sim" : "nao")
+              << " (esperado 3, 1, sim)" << std::endl;
+}
+#endif
+
+#define TEST_WORK_STEALING
+
+#ifdef TEST_WORK_STEALING
+#include "concurrency/ThreadPool.h"
+
+// Soma de [begin, end) dividindo recursivamente em subgrupos
+long long parallelSum(kanban::concurrency::ThreadPool& pool, long long begin, long long end) {
+    if (end - begin <= 1000) {
+        long long sum = 0;
+        for (long long i = begin; i < end; ++i) sum += i;
+        return sum;
+    }
+    long long mid = begin + (end - begin) / 2;
+    long long left = 0;
+    kanban::concurrency::TaskGroup group(pool);
+    group.run([&] { left = parallelSum(pool, begin, mid); });
+    long long right = parallelSum(pool, mid, end);
+    group.wait();
+    return left + right;
+}
+
+void testWorkStealing() {
+    using namespace kanban::concurrency;
+
+    std::cout << "\n=== TESTE ESCALONADOR COM ROUBO DE TRABALHO ===" << std::endl;
+
+    // Grupos aninhados: quem espera executa tarefas pendentes, sem travar o pool
+    ThreadPool pool(4);
+    std::cout << "Soma paralela aninhada: " << parallelSum(pool, 0, 1000000)
+              << " (esperado 499999500000)" << std::endl;
+
+    // Cancelamento: as tarefas enfileiradas atrás de uma tarefa bloqueada nao executam
+    ThreadPool single(1);
+    std::promise<void> gate;
+    std::shared_future<void> opened = gate.get_future().share();
+    std::future<void> blocker = single.submit([opened] { opened.wait(); });
+    std::atomic<int> ran{0};
+    TaskGroup cancelled(single);
+    for (int i = 0; i < 100; ++i) cancelled.run([&ran] { ++ran; });
+    cancelled.cancel();
+    gate.set_value();
+    cancelled.wait();
+    blocker.get();
+    std::cout << "Tarefas executadas apos cancel(): " << ran.load() << " (esperado 0)" << std::endl;
+
+    // Exceçao: relançada por wait()
+    TaskGroup failing(pool);
+    failing.run([] { throw std::runtime_error("falha na tarefa"); });
+    try {
+        failing.wait();
+        std::cout << "ERRO: exceçao nao propagada" << std::endl;
+    } catch (const std::runtime_error& e) {
+        std::cout << "Exceçao propagada: " << e.what() << " (esperado falha na tarefa)" << std::endl;
+    }
+
+    // Instrumentaçao: toda tarefa enviada de fora é contada em alguma thread
+    ThreadPool counted(3);
+    std::vector<std::future<int>> futures;
+    for (int i = 0; i < 500; ++i) futures.push_back(counted.submit([i] { return i; }));
+    for (auto& future : futures) future.get();
+    std::uint64_t executed = 0;
+    bool utilizationValid = true;
+    for (const auto& worker : counted.stats()) {
+        executed += worker.executed;
+        utilizationValid = utilizationValid && worker.utilization >= 0.0 && worker.utilization <= 1.0;
+    }
+    std::cout << "Tarefas contadas: " << executed << ", utilizaçao em [0, 1]: "
+              << (utilizationValid ? "sim" : "nao") << " (esperado 500, sim)" << std::endl;
+
+    // Consulta em board grande: avaliada em paralelo, na mesma ordem da sequencial
+    kanban::application::KanbanService service;
+    std::string boardId = service.createBoard("Grande");
+    std::vector<kanban::domain::Command> commands = {kanban::domain::Command::createColumn("To Do"),
+                                                     kanban::domain::Command::createColumn("Done")};
+    for (int i = 0; i < 40000; ++i) {
+        commands.push_back(kanban::domain::Command::addCard(i % 2 ? "$0" : "$1",
+                                                            (i % 3 ? "Tarefa " : "Bug ") + std::to_string(i)));
+    }
+    service.applyBatch(boardId, commands);
+    auto plan = kanban::domain::FilterPlan::compile(kanban::domain::TextFilter(kanban::domain::TextField::Title, "bug"));
+    std::vector<std::shared_ptr<kanban::domain::Card>> expected;
+    for (const auto& column : service.listColumns(boardId)) {
+        for (const auto& card : column->cards()) {
+            if (plan.matches(*card, column->id())) expected.push_back(card);
+        }
+    }
+    auto found = service.query(boardId, plan);
+    std::cout << "Consulta paralela: " << found.size() << " cards, mesma ordem: "
+              << (found == expected ? "sim" : "nao") << " (esperado 13334, sim)" << std::endl;
+
+    // CardTable em cache: invalidada por ediçao direta do card e por mutaçao do serviço
+    const std::string doneId = service.listColumns(boardId).back()->id();
+    auto urgent = kanban::domain::FilterPlan::compile(kanban::domain::PriorityRangeFilter(3, 1 << 30));
+    auto inDone = kanban::domain::FilterPlan::compile(kanban::domain::ColumnFilter({doneId}));
+    std::size_t urgentBefore = service.query(boardId, urgent).size();
+    std::size_t doneBefore = service.query(boardId, inDone).size();
+    expected.front()->setPriority(3);
+    std::size_t urgentAfter = service.query(boardId, urgent).size();
+    service.addCard(boardId, doneId, "Mais um");
+    std::size_t doneAfter = service.query(boardId, inDone).size();
+    std::cout << "Cache da CardTable: urgentes " << urgentBefore << " -> " << urgentAfter
+              << " (esperado 0 -> 1), em Done " << doneBefore << " -> " << doneAfter
+              << " (esperado 20000 -> 20001)" << std::endl;
+}
+#endif
+
+#define TEST_ASYNC_SERVICE
+
+#ifdef TEST_ASYNC_SERVICE
+#include "application/AsyncKanbanService.h"
+#include <deque>
+
+void testAsyncService() {
+    using kanban::application::AsyncKanbanService;
+    using kanban::application::KanbanService;
+
+    std::cout << "\n=== TESTE SERVIÇO ASSÍNCRONO ===" << std::endl;
+
+    // Futures: as chamadas executam em ordem, fora da thread do teste
+    AsyncKanbanService direct;
+    auto boardFuture = direct.createBoard("Assíncrono");
+    std::string boardId = boardFuture.get();
+    std::string todo = direct.addColumn(boardId, "To Do").get();
+    std::string done = direct.addColumn(boardId, "Done").get();
+    std::string cardId = direct.addCard(boardId, todo, "Tarefa").get();
+    direct.moveCard(boardId, cardId, todo, done).get();
+    std::cout << "Cards em Done: " << direct.listCards(done).get().size() << " (esperado 1)" << std::endl;
+    bool offThread = direct.call([](KanbanService&) { return std::this_thread::get_id(); }).get()
+                     != std::this_thread::get_id();
+    std::cout << "Executado em outra thread: " << (offThread ? "sim" : "nao") << " (esperado sim)" << std::endl;
+
+    // Callbacks: entregues pelo dispatcher (aqui, uma fila esvaziada pela thread do teste)
+    std::mutex queueMutex;
+    std::deque<std::function<void()>> queue;
+    AsyncKanbanService dispatched(std::make_shared<KanbanService>(), [&](std::function<void()> callback) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.push_back(std::move(callback));
+    });
+    const auto testThread = std::this_thread::get_id();
+    std::vector<std::string> order;
+    bool onTestThread = true;
+    auto record = [&](std::string label) {
+        return [&, label](auto&&...) {
+            onTestThread = onTestThread && std::this_thread::get_id() == testThread;
+            order.push_back(label);
+        };
+    };
+    dispatched.call([](KanbanService& s) { s.createSampleData(); }, record("amostra"));
+    dispatched.call([](KanbanService& s) { return s.listBoards().size(); }, record("boards"));
+    std::string error;
+    dispatched.call([](KanbanService& s) { return s.addColumn("board_inexistente", "X"); },
+                    record("coluna"), [&](const std::exception& e) { error = e.what(); });
+    dispatched.drain();
+    std::cout << "Callbacks antes de esvaziar a fila: " << order.size() << " (esperado 0)" << std::endl;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        while (!queue.empty()) {
+            queue.front()();
+            queue.pop_front();
+        }
+    }
+    std::cout << "Ordem: ";
+    for (const auto& label : order) std::cout << label << " ";
+    std::cout << "(esperado amostra boards), na thread do teste: " << (onTestThread ? "sim" : "nao")
+              << ", erro entregue: " << (error.empty() ? "nao" : "sim") << std::endl;
+
+    // Erros também chegam pelo future
+    try {
+        dispatched.moveCard("board_inexistente", "card", "a", "b").get();
+        std::cout << "ERRO: exceçao nao propagada" << std::endl;
+    } catch (const std::runtime_error&) {
+        std::cout << "Exceçao propagada pelo future: sim" << std::endl;
+    }
+    std::cout << "Chamadas pendentes: " << dispatched.pending() << " (esperado 0)" << std::endl;
+}
+#endif
+
+#define TEST_EVENT_SOURCING
+
+#ifdef TEST_EVENT_SOURCING
+#include "domain/EventStore.h"
+
+/// @brief Estrutura do board em texto: colunas, cards, tags e prioridades em ordem
+std::string describeStructure(kanban::application::KanbanService& service, const std::string& boardId) {
+    std::ostringstream out;
+    for (const auto& column : service.listColumns(boardId)) {
+        out << column->name() << "[";
+        for (const auto& card : column->cards()) {
+            out << card->id() << ":" << card->title() << ":" << card->priority();
+            for (const auto& tag : card->tags()) out << "#" << tag->name();
+            out << " ";
+        }
+        out << "] ";
+    }
+    return out.str();
+}
+
+void testEventSourcing() {
+    using kanban::application::KanbanService;
+    using kanban::domain::Command;
+    using kanban::domain::EventStore;
+
+    std::cout << "\n=== TESTE EVENT SOURCING ===" << std::endl;
+
+    auto store = std::make_shared<EventStore>(4);
+    KanbanService original;
+    original.useEventStore(store);
+    std::string boardId = original.createBoard("Eventos");
+    std::string todo = original.addColumn(boardId, "To Do");
+    std::string doing = original.addColumn(boardId, "Doing");
+    std::string done = original.addColumn(boardId, "Done");
+    std::string a = original.addCard(boardId, todo, "A");
+    std::string b = original.addCard(boardId, todo, "Contrato");
+    std::string c = original.addCard(boardId, todo, "C");
+    original.moveCard(boardId, a, todo, doing);
+    original.moveCardWithinColumn(boardId, todo, c, 0);
+    original.moveColumn(boardId, done, todo);
+    original.updateCardTags(boardId, b, {"urgente", "backend"});
+    original.applyBatch(boardId, {Command::addCard(doing, "D"), Command::setPriority("$0", 7),
+                                  Command::moveCard(c, todo, done), Command::retagCard(a, {"revisao"}),
+                                  Command::reorderCard(doing, "$0", 0)});
+    original.updateCard(boardId, b, "Contrato revisado", "Cláusulas novas", 4, {"urgente", "backend"});
+    // Falhas de validaçao nao gravam nada
+    auto before = store->size();
+    try { original.moveCard(boardId, a, todo, done); } catch (const std::runtime_error&) {}
+    std::cout << "Eventos: " << store->size() << ", após mutaçao inválida: " << (store->size() - before)
+              << " (esperado 0 novos), rejeitados: " << store->state().rejected() << " (esperado 0)" << std::endl;
+
+    // Persistência e recuperaçao em outro serviço
+    std::stringstream file;
+    store->save(file);
+    auto loaded = std::make_shared<EventStore>(4);
+    loaded->load(file);
+    KanbanService restored;
+    restored.useEventStore(loaded);
+    const std::string expected = describeStructure(original, boardId);
+    std::cout << "Estrutura: " << expected << std::endl;
+    std::cout << "Reconstruída igual: " << (describeStructure(restored, boardId) == expected ? "sim" : "nao")
+              << " (esperado sim)" << std::endl;
+    std::string e = restored.addCard(boardId, todo, "E");
+    std::cout << "Novo card após a recuperaçao: " << e << " (esperado card_5)" << std::endl;
+    std::cout << "Busca reconstruída: " << restored.searchCards("contrato", 5).size() << " (esperado 1)" << std::endl;
+    for (const auto& card : restored.listCards(restored.locateCard(b)->columnId)) {
+        if (card->id() == b) {
+            std::cout << "Ediçao reconstruída: " << card->title() << " / " << card->description().value_or("-")
+                      << " (esperado Contrato revisado / Cláusulas novas)" << std::endl;
+        }
+    }
+
+    // Reproduçao parcial a partir dos snapshots
+    auto partial = store->replay(4);   // board + 3 colunas
+    std::cout << "Snapshots: " << store->snapshotCount() << ", após 4 eventos: " << partial.columns().size()
+              << " colunas e " << partial.cards().size() << " cards (esperado 3 e 0)" << std::endl;
+    auto full = store->replay(store->size());
+    const auto* card = full.findCard(store->intern(c));
+    std::cout << "Card C na reproduçao completa: coluna "
+              << (card ? store->resolve(full.columns()[card->column].id) : "?") << " (esperado " << done << ")"
+              << std::endl;
+}
+#endif
+
+#define TEST_UNDO_REDO
+
+#ifdef TEST_UNDO_REDO
+void testUndoRedo() {
+    using kanban::application::KanbanService;
+
+    std::cout << "\n=== TESTE DESFAZER/REFAZER ===" << std::endl;
+
+    KanbanService service;
+    std::string boardId = service.createBoard("Historico");
+    std::string todo = service.addColumn(boardId, "To Do");
+    std::string doing = service.addColumn(boardId, "Doing");
+    std::string done = service.addColumn(boardId, "Done");
+    std::string a = service.addCard(boardId, todo, "A");
+    std::string b = service.addCard(boardId, todo, "B");
+    std::string c = service.addCard(boardId, todo, "C");
+    const std::string initial = describeStructure(service, boardId);   // criações nao entram no histórico
+    service.updateCardTags(boardId, b, {"urgente"});
+
+    service.moveCard(boardId, a, todo, doing);
+    service.moveCardWithinColumn(boardId, todo, c, 0);
+    service.moveColumn(boardId, done, todo);
+    service.updateCardTags(boardId, b, {"backend", "revisao"});
+    const std::string changed = describeStructure(service, boardId);
+    std::cout << "Para desfazer: " << service.undoCount(boardId) << " (esperado 5)" << std::endl;
+
+    while (service.undo(boardId)) {}
+    std::cout << "Estado inicial após desfazer tudo: "
+              << (describeStructure(service, boardId) == initial ? "sim" : "nao") << " (esperado sim)" << std::endl;
+    std::cout << "Card A de volta: " << service.locateCard(a)->columnId << " posiçao "
+              << service.locateCard(a)->position << " (esperado " << todo << " posiçao 0)" << std::endl;
+
+    while (service.redo(boardId)) {}
+    std::cout << "Estado alterado após refazer tudo: "
+              << (describeStructure(service, boardId) == changed ? "sim" : "nao") << " (esperado sim)" << std::endl;
+
+    // Nova mutaçao descarta o que havia para refazer
+    service.undo(boardId);
+    service.moveCard(boardId, c, todo, done);
+    std::cout << "Para refazer após nova mutaçao: " << service.redoCount(boardId) << " (esperado 0)" << std::endl;
+
+    // Delta que nao se aplica mais lança e é descartado
+    KanbanService other;
+    std::string board2 = other.createBoard("Outro");
+    std::string col1 = other.addColumn(board2, "Um");
+    std::string col2 = other.addColumn(board2, "Dois");
+    std::string card = other.addCard(board2, col1, "X");
+    other.moveCard(board2, card, col1, col2);
+    other.applyBatch(board2, {kanban::domain::Command::moveCard(card, col2, col1)});   // lotes nao entram no histórico
+    bool threw = false;
+    try { other.undo(board2); } catch (const std::runtime_error&) { threw = true; }
+    std::cout << "Delta obsoleto lança: " << (threw ? "sim" : "nao") << ", restantes: "
+              << other.undoCount(board2) << " (esperado sim, 0)" << std::endl;
+
+    // Desfazer um movimento entre colunas: um evento e uma atividade, já na posiçao gravada
+    auto store = std::make_shared<kanban::domain::EventStore>(4);
+    KanbanService logged;
+    logged.useEventStore(store);
+    std::string board3 = logged.createBoard("Registrado");
+    std::string from = logged.addColumn(board3, "De");
+    std::string to = logged.addColumn(board3, "Para");
+    logged.addCard(board3, from, "P");
+    std::string middle = logged.addCard(board3, from, "Q");
+    logged.addCard(board3, from, "R");
+    logged.moveCard(board3, middle, from, to);
+    const std::string beforeUndo = describeStructure(logged, board3);
+    auto activityLog = (*logged.findBoard(board3))->activityLog();
+    const auto events = store->size();
+    const auto activities = activityLog->size();
+    logged.undo(board3);
+    std::cout << "Desfazer movimento: " << store->size() - events << " evento, " << activityLog->size() - activities
+              << " atividade, posiçao " << logged.locateCard(middle)->position << " (esperado 1, 1, 1)" << std::endl;
+    KanbanService replayed;
+    replayed.useEventStore(store);
+    std::cout << "Reproduçao igual após desfazer: "
+              << (describeStructure(replayed, board3) == describeStructure(logged, board3) ? "sim" : "nao")
+              << ", diferente de antes: " << (describeStructure(logged, board3) != beforeUndo ? "sim" : "nao")
+              << " (esperado sim, sim)" << std::endl;
+}
+#endif
+
+#define TEST_READ_MODEL
+
+#ifdef TEST_READ_MODEL
+#include "application/ReadModel.h"
+
+void testReadModel() {
+    using kanban::application::KanbanService;
+    using kanban::application::ReadModel;
+    using kanban::domain::Command;
+
+    std::cout << "\n=== TESTE PROJEÇÕES DE LEITURA ===" << std::endl;
+
+    KanbanService service;
+    std::string boardId = service.createBoard("Projetado");
+    std::string todo = service.addColumn(boardId, "To Do");
+    std::string a = service.addCard(boardId, todo, "A");
+
+    // Board existente publicado por inteiro ao ativar
+    auto model = std::make_shared<ReadModel>();
+    std::atomic<int> notices{0};
+    model->setListener([&notices](const std::string&, std::uint64_t) { ++notices; });
+    service.useReadModel(model);
+
+    std::string doing = service.addColumn(boardId, "Doing");
+    std::string b = service.addCard(boardId, todo, "B");
+    std::string c = service.addCard(boardId, todo, "C");
+    service.moveCard(boardId, a, todo, doing);
+    service.updateCardTags(boardId, b, {"urgente", "backend"});
+    service.updateCardTags(boardId, c, {"urgente"});
+    service.applyBatch(boardId, {Command::addCard(doing, "D"), Command::setPriority("$0", 3),
+                                 Command::setPriority(b, 2), Command::retagCard(c, {"frontend"})});
+    service.moveColumn(boardId, doing, todo);
+    service.undo(boardId);   // coluna volta para o fim
+    for (const auto& card : service.listCards(doing)) {
+        if (card->id() == a) card->setPriority(1);   // direto no card: chega pelo observador
+    }
+
+    // Retag substitui o conjunto inteiro com uma única atualizaçao
+    const auto beforeRetag = model->latestVersion(boardId);
+    service.updateCardTags(boardId, b, {"backend", "urgente", "backend"});
+    std::cout << "Atualizações por retag: " << model->latestVersion(boardId) - beforeRetag
+              << " (esperado 1)" << std::endl;
+
+    const auto latest = model->latestVersion(boardId);
+    bool reached = model->waitFor(boardId, latest, std::chrono::seconds(5));
+    auto projection = model->board(boardId);
+    std::cout << "Projeçao alcançou a versao " << latest << ": " << (reached ? "sim" : "nao")
+              << " (esperado sim), avisos: " << (notices > 0 ? "sim" : "nao") << std::endl;
+
+    std::cout << "Colunas: ";
+    for (const auto& column : projection->columns) std::cout << column.name << "=" << column.cards << " ";
+    std::cout << "(esperado To Do=2 Doing=2), total: " << projection->totalCards << " (esperado 4)" << std::endl;
+
+    std::cout << "Tags: ";
+    for (const auto& [tag, cards] : projection->cardsByTag) std::cout << tag << "=" << cards->size() << " ";
+    std::cout << "(esperado backend=1 frontend=1 urgente=1)" << std::endl;
+
+    std::cout << "Prioridades: ";
+    for (const auto& [priority, cards] : projection->cardsByPriority) std::cout << priority << "=" << cards->size() << " ";
+    std::cout << "(esperado 3=1 2=1 1=1 0=1)" << std::endl;
+
+    // Bate com o board percorrido diretamente
+    bool same = true;
+    auto columns = service.listColumns(boardId);
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        same = same && projection->columns[i].id == columns[i]->id() && projection->columns[i].cards == columns[i]->size();
+    }
+    std::cout << "Igual ao board: " << (same ? "sim" : "nao") << " (esperado sim)" << std::endl;
+
+    // Escritas concorrentes em boards distintos: a projeçao converge
+    std::vector<std::string> boards;
+    for (int k = 0; k < 4; ++k) {
+        boards.push_back(service.createBoard("Paralelo " + std::to_string(k)));
+    }
+    std::vector<std::thread> writers;
+    for (const auto& id : boards) {
+        writers.emplace_back([&service, id] {
+            std::string left = service.addColumn(id, "Esquerda");
+            std::string right = service.addColumn(id, "Direita");
+            std::vector<std::string> cards;
+            for (int i = 0; i < 50; ++i) cards.push_back(service.addCard(id, left, "T" + std::to_string(i)));
+            for (int i = 0; i < 50; i += 2) service.moveCard(id, cards[i], left, right);
+        });
+    }
+    for (auto& writer : writers) writer.join();
+    bool converged = true;
+    for (const auto& id : boards) {
+        converged = converged && model->waitFor(id, model->latestVersion(id), std::chrono::seconds(5));
+        auto p = model->board(id);
+        converged = converged && p->columns.size() == 2 && p->columns[0].cards == 25 && p->columns[1].cards == 25;
+    }
+    std::cout << "Boards paralelos convergiram: " << (converged ? "sim" : "nao") << " (esperado sim)" << std::endl;
+}
+#endif
+
 int main() {
 #ifdef TEST_CARD
     testCard();
@@ -286,6 +1649,18 @@ int main() {
     testActivityLog();
 #endif
 
+#ifdef TEST_ACTIVITY_RETENTION
+    testActivityRetention();
+#endif
+
+#ifdef TEST_ACTIVITY_ROLLUP
+    testActivityRollup();
+#endif
+
+#ifdef TEST_ACTIVITY_SINK
+    testActivitySink();
+#endif
+
 #ifdef TEST_BOARD
     testBoard();
 #endif
@@ -298,6 +1673,82 @@ int main() {
     testKanbanService();
 #endif
 
+#ifdef TEST_CONCURRENT_SERVICE
+    testConcurrentService();
+#endif
+
+#ifdef TEST_SHARDED_SERVICE
+    testShardedService();
+#endif
+
+#ifdef TEST_BATCH
+    testBatch();
+#endif
+
+#ifdef TEST_CARD_LOCATION
+    testCardLocation();
+#endif
+
+#ifdef TEST_CARD_FILTER
+    testCardFilter();
+#endif
+
+#ifdef TEST_FILTER_EXPR
+    testFilterExpr();
+#endif
+
+#ifdef TEST_SIMD_KERNELS
+    testSimdKernels();
+#endif
+
+#ifdef TEST_TEXT_INDEX
+    testTextIndex();
+#endif
+
+#ifdef TEST_PREFIX_TRIE
+    testPrefixTrie();
+#endif
+
+#ifdef TEST_FUZZY_SEARCH
+    testFuzzySearch();
+#endif
+
+#ifdef TEST_TOP_CARDS
+    testTopCards();
+#endif
+
+#ifdef TEST_FLOW_METRICS
+    testFlowMetrics();
+#endif
+
+#ifdef TEST_CUMULATIVE_FLOW
+    testCumulativeFlow();
+#endif
+
+#ifdef TEST_DELIVERY_FORECAST
+    testDeliveryForecast();
+#endif
+
+#ifdef TEST_WORK_STEALING
+    testWorkStealing();
+#endif
+
+#ifdef TEST_ASYNC_SERVICE
+    testAsyncService();
+#endif
+
+#ifdef TEST_EVENT_SOURCING
+    testEventSourcing();
+#endif
+
+#ifdef TEST_UNDO_REDO
+    testUndoRedo();
+#endif
+
+#ifdef TEST_READ_MODEL
+    testReadModel();
+#endif
+
     // Nao criamos objetos complexos aqui — apenas garantimos que os headers sao válidos.
     int x;
     std::cout << "Headers included successfully\n";